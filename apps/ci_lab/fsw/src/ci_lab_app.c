@@ -51,6 +51,8 @@ int                CI_SocketID;
 struct sockaddr_in CI_SocketAddress;
 uint8              CI_IngestBuffer[CI_MAX_INGEST];
 CFE_SB_Msg_t       *CI_IngestPointer = (CFE_SB_Msg_t *) &CI_IngestBuffer[0];
+uint8              CI_DatagramBuffer[CI_MAX_DATAGRAM];
+CI_Framer_t        CI_UplinkFramer;
 CFE_SB_MsgId_t     PDUMessageID = 0;
 bool               adjustFileSize = false;
 int		   PDUFileSizeAdjustment;
@@ -186,6 +188,12 @@ void CI_TaskInit(void)
        }
     }
 
+    /*
+    ** Packets are assembled in the ingest buffer so CI_ProcessPDU and
+    ** the SB send always see a complete, contiguous packet
+    */
+    CI_FramerInit(&CI_UplinkFramer, CI_IngestBuffer, sizeof(CI_IngestBuffer));
+
     CI_ResetCounters();
 
     /*
@@ -314,6 +322,13 @@ uint16 CommandCode;
 void CI_ReportHousekeeping(void)
 {
     CI_HkTelemetryPkt.SocketConnected = CI_SocketConnected;
+
+    CI_HkTelemetryPkt.FramerDatagrams      = CI_UplinkFramer.Counters.Datagrams;
+    CI_HkTelemetryPkt.FramerReassembled    = CI_UplinkFramer.Counters.Reassembled;
+    CI_HkTelemetryPkt.FramerHeaderErrors   = CI_UplinkFramer.Counters.HeaderErrors;
+    CI_HkTelemetryPkt.FramerStalePartials  = CI_UplinkFramer.Counters.StalePartials;
+    CI_HkTelemetryPkt.FramerBytesDiscarded = CI_UplinkFramer.Counters.BytesDiscarded;
+
     CFE_SB_TimeStampMsg((CFE_SB_Msg_t *) &CI_HkTelemetryPkt);
     CFE_SB_SendMsg((CFE_SB_Msg_t *) &CI_HkTelemetryPkt);
     return;
@@ -347,6 +362,9 @@ void CI_ResetCounters(void)
     CI_HkTelemetryPkt.NAKPdusDropped = 0;
     CI_HkTelemetryPkt.PDUsCaptured   = 0;
 
+    /* Status of the uplink stream framer */
+    CI_FramerResetCounters(&CI_UplinkFramer);
+
     CFE_EVS_SendEvent(CI_COMMANDRST_INF_EID, CFE_EVS_EventType_INFORMATION,
 		"CI: RESET command");
     return;
@@ -749,16 +767,45 @@ uint32 *fileSizePtr;
 
 } /* End of CI_ProcessPDU() */
 
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*                                                                            */
+/* CI_DispatchIngestPacket() -- Route one complete uplinked packet            */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+void CI_DispatchIngestPacket(void)
+{
+    if (PDUMessageID != 0)
+    {
+        CI_ProcessPDU();
+    }
+    else
+    {
+        CFE_ES_PerfLogEntry(CI_SOCKET_RCV_PERF_ID);
+        CI_HkTelemetryPkt.IngestPackets++;
+        CFE_SB_SendMsg(CI_IngestPointer);
+        CFE_ES_PerfLogExit(CI_SOCKET_RCV_PERF_ID);
+    }
+
+    return;
+
+} /* End of CI_DispatchIngestPacket() */
+
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
 /*                                                                            */
 /* CI_ReadUpLink() --                                                         */
 /*                                                                            */
+/*   Each datagram may carry any number of CCSDS packets, and a packet may    */
+/*   be split across datagrams.  The stream framer assembles every packet     */
+/*   into the ingest buffer before it is dispatched.                          */
+/*                                                                            */
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
 void CI_ReadUpLink(void)
 {
     socklen_t addr_len;
     int i;
     int status;
+    uint32 Offset;
+    bool PacketReady;
 
     addr_len = sizeof(CI_SocketAddress);
 
@@ -766,30 +813,36 @@ void CI_ReadUpLink(void)
 
     for (i = 0; i <= 10; i++)
     {
-        status = recvfrom(CI_SocketID, (char *)&CI_IngestBuffer[0], sizeof(CI_IngestBuffer), MSG_DONTWAIT,
+        status = recvfrom(CI_SocketID, (char *)&CI_DatagramBuffer[0], sizeof(CI_DatagramBuffer), MSG_DONTWAIT,
                          (struct sockaddr *) &CI_SocketAddress, &addr_len);
 
         if ( (status < 0) && (errno == EWOULDBLOCK) )
-            break; /* no (more) messages */
-        else
         {
-            if (status <= CI_MAX_INGEST)
+            if (i == 0)
             {
-		if (PDUMessageID != 0)
-		{
-		  CI_ProcessPDU();
-		}
-                else
-		{
-		  CFE_ES_PerfLogEntry(CI_SOCKET_RCV_PERF_ID);
-                  CI_HkTelemetryPkt.IngestPackets++;
-                  CFE_SB_SendMsg(CI_IngestPointer);
-                  CFE_ES_PerfLogExit(CI_SOCKET_RCV_PERF_ID);
-		}
+                CI_FramerIdle(&CI_UplinkFramer);
             }
-            else
+            break; /* no (more) messages */
+        }
+        else if (status < 0)
+        {
+            CI_HkTelemetryPkt.IngestErrors++;
+            break;
+        }
+        else
+        {
+            CI_FramerStartDatagram(&CI_UplinkFramer);
+
+            Offset = 0;
+            while (Offset < (uint32)status)
             {
-                CI_HkTelemetryPkt.IngestErrors++;
+                Offset += CI_FramerFeed(&CI_UplinkFramer, &CI_DatagramBuffer[Offset],
+                                        (uint32)status - Offset, &PacketReady);
+
+                if (PacketReady)
+                {
+                    CI_DispatchIngestPacket();
+                }
             }
         }
     }
@@ -41,6 +41,8 @@
 #include "osapi.h"
 #include "ccsds.h"
 
+#include "ci_lab_framer.h"
+
 #include <string.h>
 #include <errno.h>
 #include <unistd.h>
@@ -49,6 +51,7 @@
 
 #define cfgCI_PORT                      1234
 #define CI_MAX_INGEST                    768
+#define CI_MAX_DATAGRAM                 8192
 #define CI_PIPE_DEPTH                     32
 
 /************************************************************************
@@ -84,6 +87,7 @@ void CI_DropPDUCmd(CFE_SB_MsgPtr_t msg);
 void CI_CapturePDUsCmd(CFE_SB_MsgPtr_t msg);
 void CI_StopPDUCaptureCmd(CFE_SB_MsgPtr_t msg);
 void CI_ProcessPDU(void);
+void CI_DispatchIngestPacket(void);
 void CI_ReadUpLink(void);
 
 bool CI_VerifyCmdLength(CFE_SB_MsgPtr_t msg, uint16 ExpectedLength);
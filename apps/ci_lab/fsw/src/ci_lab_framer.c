@@ -0,0 +1,217 @@
+/*******************************************************************************
+**
+**      GSC-18128-1, "Core Flight Executive Version 6.7"
+**
+**      Copyright (c) 2006-2019 United States Government as represented by
+**      the Administrator of the National Aeronautics and Space Administration.
+**      All Rights Reserved.
+**
+**      Licensed under the Apache License, Version 2.0 (the "License");
+**      you may not use this file except in compliance with the License.
+**      You may obtain a copy of the License at
+**
+**        http://www.apache.org/licenses/LICENSE-2.0
+**
+**      Unless required by applicable law or agreed to in writing, software
+**      distributed under the License is distributed on an "AS IS" BASIS,
+**      WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**      See the License for the specific language governing permissions and
+**      limitations under the License.
+**
+** File: ci_lab_framer.c
+**
+** Purpose:
+**   Streaming CCSDS framer for the Command Ingest task.
+**
+** Notes:
+**   Framing is recovered from the CCSDS primary header length field.  When
+**   a header is found to be invalid there is no reliable way to locate the
+**   next packet in the byte stream, so the remainder of the datagram is
+**   discarded and framing restarts with the next datagram.
+**
+*******************************************************************************/
+
+/*
+**   Include Files:
+*/
+#include <string.h>
+
+#include "ci_lab_framer.h"
+
+/*
+** Local function prototypes
+*/
+static void CI_FramerDiscard(CI_Framer_t *Framer);
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*                                                                            */
+/* CI_FramerInit() -- Prepare a framer for use                                */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+void CI_FramerInit(CI_Framer_t *Framer, uint8 *Buffer, uint32 BufferSize)
+{
+    memset(Framer, 0, sizeof(*Framer));
+
+    Framer->Buffer     = Buffer;
+    Framer->BufferSize = BufferSize;
+
+    return;
+
+} /* End of CI_FramerInit() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*                                                                            */
+/* CI_FramerResetCounters() -- Clear the stream statistics                    */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+void CI_FramerResetCounters(CI_Framer_t *Framer)
+{
+    memset(&Framer->Counters, 0, sizeof(Framer->Counters));
+
+    return;
+
+} /* End of CI_FramerResetCounters() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*                                                                            */
+/* CI_FramerStartDatagram() -- Note the start of a new datagram               */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+void CI_FramerStartDatagram(CI_Framer_t *Framer)
+{
+    Framer->Counters.Datagrams++;
+    Framer->IdleCycles = 0;
+
+    /*
+    ** A packet still in progress is continued by this datagram
+    */
+    if (Framer->Fill != 0)
+    {
+        Framer->Spanned = true;
+    }
+
+    return;
+
+} /* End of CI_FramerStartDatagram() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*                                                                            */
+/* CI_FramerFeed() -- Consume datagram bytes until a packet is complete       */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+uint32 CI_FramerFeed(CI_Framer_t *Framer, const uint8 *Data, uint32 Length,
+                     bool *PacketReady)
+{
+    CCSDS_PriHdr_t *HdrPtr;
+    uint32          Used = 0;
+    uint32          Chunk;
+
+    *PacketReady = false;
+
+    /*
+    ** Collect the primary header first; it may itself be split
+    */
+    if (Framer->Fill < sizeof(CCSDS_PriHdr_t))
+    {
+        Chunk = sizeof(CCSDS_PriHdr_t) - Framer->Fill;
+        if (Chunk > Length)
+        {
+            Chunk = Length;
+        }
+
+        memcpy(&Framer->Buffer[Framer->Fill], Data, Chunk);
+        Framer->Fill += Chunk;
+        Used         += Chunk;
+
+        if (Framer->Fill < sizeof(CCSDS_PriHdr_t))
+        {
+            return(Used);
+        }
+
+        HdrPtr = (CCSDS_PriHdr_t *) Framer->Buffer;
+        Framer->Expected = CCSDS_RD_LEN(*HdrPtr);
+
+        if ((CCSDS_RD_VERS(*HdrPtr) != 0) ||
+            (Framer->Expected > Framer->BufferSize))
+        {
+            Framer->Counters.HeaderErrors++;
+            Framer->Counters.BytesDiscarded += Framer->Fill + (Length - Used);
+            CI_FramerDiscard(Framer);
+            return(Length);
+        }
+    }
+
+    /*
+    ** Copy as much of the packet body as this datagram holds
+    */
+    Chunk = Framer->Expected - Framer->Fill;
+    if (Chunk > (Length - Used))
+    {
+        Chunk = Length - Used;
+    }
+
+    memcpy(&Framer->Buffer[Framer->Fill], &Data[Used], Chunk);
+    Framer->Fill += Chunk;
+    Used         += Chunk;
+
+    if (Framer->Fill == Framer->Expected)
+    {
+        Framer->Counters.Packets++;
+        if (Framer->Spanned)
+        {
+            Framer->Counters.Reassembled++;
+        }
+
+        /*
+        ** The packet stays in Buffer until the next call overwrites it
+        */
+        CI_FramerDiscard(Framer);
+        *PacketReady = true;
+    }
+
+    return(Used);
+
+} /* End of CI_FramerFeed() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*                                                                            */
+/* CI_FramerIdle() -- Age out an abandoned partial packet                     */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+void CI_FramerIdle(CI_Framer_t *Framer)
+{
+    if (Framer->Fill != 0)
+    {
+        Framer->IdleCycles++;
+
+        if (Framer->IdleCycles >= CI_FRAMER_PARTIAL_TIMEOUT)
+        {
+            Framer->Counters.StalePartials++;
+            Framer->Counters.BytesDiscarded += Framer->Fill;
+            CI_FramerDiscard(Framer);
+        }
+    }
+
+    return;
+
+} /* End of CI_FramerIdle() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*                                                                            */
+/* CI_FramerDiscard() -- Forget the packet in progress                        */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+static void CI_FramerDiscard(CI_Framer_t *Framer)
+{
+    Framer->Fill       = 0;
+    Framer->Expected   = 0;
+    Framer->IdleCycles = 0;
+    Framer->Spanned    = false;
+
+    return;
+
+} /* End of CI_FramerDiscard() */
+
+/************************/
+/*  End of File Comment */
+/************************/
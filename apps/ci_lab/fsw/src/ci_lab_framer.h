@@ -0,0 +1,115 @@
+/*******************************************************************************
+**
+**      GSC-18128-1, "Core Flight Executive Version 6.7"
+**
+**      Copyright (c) 2006-2019 United States Government as represented by
+**      the Administrator of the National Aeronautics and Space Administration.
+**      All Rights Reserved.
+**
+**      Licensed under the Apache License, Version 2.0 (the "License");
+**      you may not use this file except in compliance with the License.
+**      You may obtain a copy of the License at
+**
+**        http://www.apache.org/licenses/LICENSE-2.0
+**
+**      Unless required by applicable law or agreed to in writing, software
+**      distributed under the License is distributed on an "AS IS" BASIS,
+**      WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**      See the License for the specific language governing permissions and
+**      limitations under the License.
+**
+** File: ci_lab_framer.h
+**
+** Purpose:
+**   Streaming CCSDS framer used by the Command Ingest task.  The framer
+**   splits several packets out of a single datagram and reassembles
+**   packets whose bytes span more than one datagram.
+**
+** Notes:
+**   The framer never allocates memory: packets are assembled in a caller
+**   supplied buffer which bounds the largest packet that can be accepted.
+**
+*******************************************************************************/
+#ifndef _ci_lab_framer_h_
+#define _ci_lab_framer_h_
+
+#include "common_types.h"
+#include "ccsds.h"
+
+/*
+** Number of consecutive empty uplink reads after which a partially
+** assembled packet is considered abandoned and discarded.
+*/
+#define CI_FRAMER_PARTIAL_TIMEOUT          4
+
+/************************************************************************
+** Type Definitions
+*************************************************************************/
+
+/*
+** Per-stream framer statistics
+*/
+typedef struct
+{
+    uint32  Datagrams;        /* datagrams fed into the framer              */
+    uint32  Packets;          /* complete packets delivered                 */
+    uint32  Reassembled;      /* delivered packets that spanned datagrams   */
+    uint32  HeaderErrors;     /* primary headers with a bad version/length  */
+    uint32  StalePartials;    /* partial packets dropped after a timeout    */
+    uint32  BytesDiscarded;   /* bytes thrown away while resynchronizing    */
+
+} CI_FramerCounters_t;
+
+/*
+** Framer state for a single uplink stream
+*/
+typedef struct
+{
+    uint8               *Buffer;        /* assembly buffer (caller owned)  */
+    uint32               BufferSize;    /* largest packet that fits        */
+    uint32               Fill;          /* bytes currently in Buffer       */
+    uint32               Expected;      /* total length once header known  */
+    uint32               IdleCycles;    /* empty reads while Fill != 0     */
+    bool                 Spanned;       /* current packet crossed a gram   */
+    CI_FramerCounters_t  Counters;
+
+} CI_Framer_t;
+
+/************************************************************************
+** Function Prototypes
+*************************************************************************/
+
+/*
+** Prepare a framer to assemble packets into the given buffer
+*/
+void   CI_FramerInit(CI_Framer_t *Framer, uint8 *Buffer, uint32 BufferSize);
+
+/*
+** Clear the stream statistics without disturbing a packet in progress
+*/
+void   CI_FramerResetCounters(CI_Framer_t *Framer);
+
+/*
+** Notify the framer that a new datagram is about to be fed
+*/
+void   CI_FramerStartDatagram(CI_Framer_t *Framer);
+
+/*
+** Consume bytes from a datagram.  Returns the number of bytes used; when
+** a complete packet is available in the assembly buffer *PacketReady is
+** set to true and the caller must dispatch it before the next call.
+*/
+uint32 CI_FramerFeed(CI_Framer_t *Framer, const uint8 *Data, uint32 Length,
+                     bool *PacketReady);
+
+/*
+** Notify the framer that an uplink read found no data.  A partial packet
+** that has not progressed for CI_FRAMER_PARTIAL_TIMEOUT calls is dropped.
+*/
+void   CI_FramerIdle(CI_Framer_t *Framer);
+
+#endif /* _ci_lab_framer_h_ */
+
+/************************/
+/*  End of File Comment */
+/************************/
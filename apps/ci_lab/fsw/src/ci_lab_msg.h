@@ -104,6 +104,11 @@ typedef struct {
     uint32             IngestPackets;
     uint32             IngestErrors;
     uint32             PDUsCaptured;
+    uint32             FramerDatagrams;
+    uint32             FramerReassembled;
+    uint32             FramerHeaderErrors;
+    uint32             FramerStalePartials;
+    uint32             FramerBytesDiscarded;
 
 }   OS_PACK ci_hk_tlm_t  ;
 
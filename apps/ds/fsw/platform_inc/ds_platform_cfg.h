@@ -490,6 +490,41 @@
 #define DS_PER_PACKET_PIPE_LIMIT        50
 
 
+/**
+**  \dscfg Compressed Destination Files -- number of compressors
+**
+**  \par Description:
+**       This parameter defines how many destination files with
+**       compression selected in the Destination File Table may be
+**       open at the same time.  Each one uses a streaming compressor
+**       state of about 72K bytes in the DS global data.  A compressed
+**       destination opened while all compressors are in use is written
+**       uncompressed.
+**
+**  \par Limits:
+**       The value must be greater than zero and cannot exceed the
+**       definition of #DS_DEST_FILE_CNT.
+*/
+#define DS_COMPRESSED_FILE_CNT          2
+
+
+/**
+**  \dscfg Compressed Destination Files -- flush interval
+**
+**  \par Description:
+**       A compressed destination file is flushed once this many bytes
+**       of packet data have been stored since the last flush.  Data
+**       that has been flushed can be decompressed even if the file is
+**       never closed, as after a processor reset.  Each flush costs
+**       about five bytes and ends a compressed block early.  A value
+**       of zero flushes after every packet.
+**
+**  \par Limits:
+**       The value cannot be less than zero.
+*/
+#define DS_COMPRESS_FLUSH_BYTES         4096
+
+
 #endif /* _ds_platform_cfg_h_ */
 
 /************************/
@@ -511,6 +511,7 @@ void DS_AppProcessHK(void)
     DS_HkPacket_t HkPacket;
     int32 i = 0;
     int32 Status = 0;
+    uint64 CompressionRatio = 0;
     char FilterTblName[CFE_MISSION_TBL_MAX_NAME_LENGTH] = {0};
     CFE_TBL_Info_t FilterTblInfo;
 
@@ -544,6 +545,18 @@ void DS_AppProcessHK(void)
     HkPacket.FilteredPktCounter = DS_AppData.FilteredPktCounter;
     HkPacket.PassedPktCounter   = DS_AppData.PassedPktCounter;
 
+    /*
+    ** Copy file compression counters and ratio to housekeeping telemetry packet...
+    */
+    HkPacket.CompressInBytes  = DS_AppData.CompressInBytes;
+    HkPacket.CompressOutBytes = DS_AppData.CompressOutBytes;
+
+    if (DS_AppData.CompressOutBytes > 0)
+    {
+        CompressionRatio = ((uint64) DS_AppData.CompressInBytes * 100) / DS_AppData.CompressOutBytes;
+        HkPacket.CompressionRatio = (CompressionRatio > 0xFFFF) ? 0xFFFF : (uint16) CompressionRatio;
+    }
+
     /*
     ** Copy file I/O counters to housekeeping telemetry packet...
     */
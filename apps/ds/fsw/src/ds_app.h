@@ -54,7 +54,8 @@ typedef struct
     uint32  FileRate;                           /**< \brief File growth rate in bytes (at last HK) */
     uint32  FileCount;                          /**< \brief Current file sequence count */
     uint16  FileState;                          /**< \brief Current file enable/disable state */
-    uint16  Unused;                             /**< \brief Unused - structure padding */
+    uint16  Compressor;                         /**< \brief Compressor number (from 1) or DS_NO_COMPRESSOR */
+    uint32  FlushBytes;                         /**< \brief Bytes given to the compressor since it was last flushed */
     char    FileName[DS_TOTAL_FNAME_BUFSIZE];   /**< \brief Current filename (path+base+seq+ext) */
 
 } DS_AppFileStatus_t;
@@ -94,8 +95,14 @@ typedef struct
     uint32  FilteredPktCounter;                 /**< \brief Count of packets discarded (failed filter test) */
     uint32  PassedPktCounter;                   /**< \brief Count of packets that passed filter test */
 
+    uint32  CompressInBytes;                    /**< \brief Count of bytes given to file compressors */
+    uint32  CompressOutBytes;                   /**< \brief Count of compressed bytes written to files */
+
     DS_AppFileStatus_t FileStatus[DS_DEST_FILE_CNT]; /**< \brief Current state of destination files */
 
+    CFE_FS_DeflateState_t Compressor[DS_COMPRESSED_FILE_CNT];   /**< \brief Compressors for compressed destination files */
+    uint8   CompressBuffer[CFE_FS_DEFLATE_OUTPUT_SIZE];         /**< \brief Compressed data on its way to a file */
+
     DS_HashLink_t  HashLinks[DS_PACKETS_IN_FILTER_TABLE];     /**< \brief Hash table linked list elements */
     DS_HashLink_t *HashTable[DS_HASH_TABLE_ENTRIES];          /**< \brief Each hash table entry is a linked list */
 
@@ -46,6 +46,11 @@
 #define DS_BY_COUNT                     1                  /**< \brief Action is based on packet sequence count */
 #define DS_BY_TIME                      2                  /**< \brief Action is based on packet timestamp */
 
+#define DS_COMPRESS_NONE                0                  /**< \brief Destination file data is written as is */
+#define DS_COMPRESS_GZIP                1                  /**< \brief Destination file data is gzip compressed */
+
+#define DS_NO_COMPRESSOR                0                  /**< \brief Destination file is not using a compressor */
+
 #define DS_STRING_REQUIRED              true               /**< \brief String text is required */
 #define DS_STRING_OPTIONAL              false              /**< \brief String text is optional */
 
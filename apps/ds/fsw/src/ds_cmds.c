@@ -119,6 +119,8 @@ void DS_CmdReset(CFE_SB_MsgPtr_t MessagePtr)
         DS_AppData.IgnoredPktCounter  = 0;
         DS_AppData.FilteredPktCounter = 0;
         DS_AppData.PassedPktCounter   = 0;
+        DS_AppData.CompressInBytes    = 0;
+        DS_AppData.CompressOutBytes   = 0;
 
         /*
         ** Reset file I/O counters...
@@ -1213,6 +1213,41 @@
 #define DS_APPHK_FILTER_TBL_PRINT_ERR_EID 69
 
 
+/**
+**  \brief <tt> 'FILE COMPRESS unavailable' </tt>
+**
+**  \event <tt> 'FILE COMPRESS unavailable: dest = \%d, name = '\%s' written uncompressed' </tt>
+**
+**  \par Type: INFORMATION
+**
+**  \par Cause:
+**
+**  This event signals that a new Destination File selected for
+**  compression by the Destination File Table is written uncompressed,
+**  because the compressors set by #DS_COMPRESSED_FILE_CNT are all in
+**  use by other open files.
+*/
+#define DS_COMPRESS_BUSY_EID     70
+
+
+/**
+**  \brief <tt> 'FILE COMPRESS error' </tt>
+**
+**  \event <tt> 'FILE COMPRESS error: result = \%d, dest = \%d, name = '\%s'' </tt>
+**
+**  \par Type: ERROR
+**
+**  \par Cause:
+**
+**  This event signals an error writing the end of the compressed data
+**  to a compressed Destination File as it is closed.  The destination
+**  is disabled, and the file is left without the end of its data.
+**
+**  The event text will indicate the result of the failed seek or write.
+*/
+#define DS_COMPRESS_FILE_ERR_EID 71
+
+
 
 #endif /* _ds_events_h_ */
 
@@ -144,6 +144,7 @@ void DS_FileSetupWrite(int32 FileIndex, CFE_SB_MsgPtr_t MessagePtr)
     DS_AppFileStatus_t *FileStatus = &DS_AppData.FileStatus[FileIndex];
     bool OpenNewFile = false;
     uint16 PacketLength = 0;
+    uint32 WriteLength = 0;
 
     /*
     ** Create local pointers for array indexed data...
@@ -160,9 +161,20 @@ void DS_FileSetupWrite(int32 FileIndex, CFE_SB_MsgPtr_t MessagePtr)
     else
     {
         /*
-        ** Test size of existing destination file...
+        ** Test size of existing destination file (a compressed file
+        **   must also have room for what its compressor still holds)...
         */
-        if ((FileStatus->FileSize + PacketLength) > DestFile->MaxFileSize)
+        if (FileStatus->Compressor != DS_NO_COMPRESSOR)
+        {
+            WriteLength = CFE_FS_DeflateBound(&DS_AppData.Compressor[FileStatus->Compressor - 1],
+                                              PacketLength);
+        }
+        else
+        {
+            WriteLength = PacketLength;
+        }
+
+        if ((FileStatus->FileSize + WriteLength) > DestFile->MaxFileSize)
         {
             /*
             ** This packet would cause file to exceed max size limit...
@@ -219,27 +231,67 @@ void DS_FileWriteData(int32 FileIndex, void *FileData, uint32 DataLength)
     DS_AppFileStatus_t *FileStatus = &DS_AppData.FileStatus[FileIndex];
     int32 Result = CFE_SUCCESS;
 
-    /*
-    ** Let cFE manage the file I/O...
-    */
-    Result = OS_write(FileStatus->FileHandle, FileData, DataLength);
-
-    if (Result == DataLength)
+    if (FileStatus->Compressor != DS_NO_COMPRESSOR)
     {
         /*
-        ** Success - update file size and data rate counters...
+        ** Compressed file - file size grows by the compressed data...
         */
-        DS_AppData.FileWriteCounter++;
+        Result = DS_FileCompressData(FileIndex, FileData, DataLength);
 
-        FileStatus->FileSize   += DataLength;
-        FileStatus->FileGrowth += DataLength;
+        FileStatus->FlushBytes += DataLength;
+
+        if ((Result == CFE_SUCCESS) && (FileStatus->FlushBytes >= DS_COMPRESS_FLUSH_BYTES))
+        {
+            /*
+            ** Write out all that has been stored so far, so that a file
+            **   that is never closed can still be decompressed...
+            */
+            FileStatus->FlushBytes = 0;
+
+            Result = CFE_FS_DeflateFlush(&DS_AppData.Compressor[FileStatus->Compressor - 1]);
+
+            if (Result == CFE_SUCCESS)
+            {
+                Result = DS_FileCompressData(FileIndex, NULL, 0);
+            }
+        }
+
+        if (Result == CFE_SUCCESS)
+        {
+            DS_AppData.FileWriteCounter++;
+        }
+        else
+        {
+            /*
+            ** Error - send event, close file and disable destination...
+            */
+            DS_FileWriteError(FileIndex, DataLength, Result);
+        }
     }
     else
     {
         /*
-        ** Error - send event, close file and disable destination...
+        ** Let cFE manage the file I/O...
         */
-        DS_FileWriteError(FileIndex, DataLength, Result);
+        Result = OS_write(FileStatus->FileHandle, FileData, DataLength);
+
+        if (Result == DataLength)
+        {
+            /*
+            ** Success - update file size and data rate counters...
+            */
+            DS_AppData.FileWriteCounter++;
+
+            FileStatus->FileSize   += DataLength;
+            FileStatus->FileGrowth += DataLength;
+        }
+        else
+        {
+            /*
+            ** Error - send event, close file and disable destination...
+            */
+            DS_FileWriteError(FileIndex, DataLength, Result);
+        }
     }
 
     return;
@@ -247,6 +299,86 @@ void DS_FileWriteData(int32 FileIndex, void *FileData, uint32 DataLength)
 } /* End of DS_FileWriteData() */
 
 
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* DS_FileCompressData() - compress data to destination file       */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+int32 DS_FileCompressData(int32 FileIndex, void *FileData, uint32 DataLength)
+{
+    DS_AppFileStatus_t *FileStatus = &DS_AppData.FileStatus[FileIndex];
+    CFE_FS_DeflateState_t *Compressor = &DS_AppData.Compressor[FileStatus->Compressor - 1];
+    uint8 *Data = (uint8 *) FileData;
+    int32 Length = 0;
+    int32 Result = CFE_SUCCESS;
+    bool Done = false;
+
+    DS_AppData.CompressInBytes += DataLength;
+
+    while (Done == false)
+    {
+        /*
+        ** Write out compressed data before giving the compressor more...
+        */
+        Length = CFE_FS_DeflateDrain(Compressor, DS_AppData.CompressBuffer,
+                                     sizeof(DS_AppData.CompressBuffer));
+
+        if (Length > 0)
+        {
+            Result = OS_write(FileStatus->FileHandle, DS_AppData.CompressBuffer, Length);
+
+            if (Result == Length)
+            {
+                FileStatus->FileSize   += Length;
+                FileStatus->FileGrowth += Length;
+
+                DS_AppData.CompressOutBytes += Length;
+
+                Result = CFE_SUCCESS;
+            }
+            else
+            {
+                if (Result >= 0)
+                {
+                    Result = OS_ERROR;
+                }
+                Done = true;
+            }
+        }
+        else if ((Length == 0) && (DataLength > 0))
+        {
+            /*
+            ** Compressor is empty - it takes as much as its window holds...
+            */
+            Length = CFE_FS_DeflateFeed(Compressor, Data, DataLength);
+
+            if (Length < 0)
+            {
+                Result = Length;
+                Done = true;
+            }
+            else
+            {
+                Data       += Length;
+                DataLength -= Length;
+            }
+        }
+        else
+        {
+            /*
+            ** All data taken and written (or compressor error)...
+            */
+            Result = Length;
+            Done = true;
+        }
+    }
+
+    return(Result);
+
+} /* End of DS_FileCompressData() */
+
+
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
 /* DS_FileWriteHeader() - write header to destination file         */
@@ -291,6 +423,11 @@ void DS_FileWriteHeader(int32 FileIndex)
         DS_FileHeader.FileNameType = DestFile->FileNameType;
         strcpy(DS_FileHeader.FileName, FileStatus->FileName);
 
+        if (FileStatus->Compressor != DS_NO_COMPRESSOR)
+        {
+            DS_FileHeader.Compression = DS_COMPRESS_GZIP;
+        }
+
         /*
         ** Manually write the secondary header...
         */
@@ -305,6 +442,26 @@ void DS_FileWriteHeader(int32 FileIndex)
 
             FileStatus->FileSize   += sizeof(DS_FileHeader_t);
             FileStatus->FileGrowth += sizeof(DS_FileHeader_t);
+
+            if (FileStatus->Compressor != DS_NO_COMPRESSOR)
+            {
+                /*
+                ** Compressed data starts with a copy of both headers...
+                */
+                Result = DS_FileWriteHeaderMember(FileIndex);
+
+                if (Result == CFE_SUCCESS)
+                {
+                    DS_AppData.FileWriteCounter++;
+
+                    FileStatus->FileSize   += DS_FILE_HEADER_MEMBER_SIZE;
+                    FileStatus->FileGrowth += DS_FILE_HEADER_MEMBER_SIZE;
+                }
+                else
+                {
+                    DS_FileWriteError(FileIndex, DS_FILE_HEADER_MEMBER_SIZE, Result);
+                }
+            }
         }
         else
         {
@@ -327,6 +484,61 @@ void DS_FileWriteHeader(int32 FileIndex)
 } /* End of DS_FileWriteHeader() */
 
 
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* DS_FileWriteHeaderMember() - write copy of compressed file hdrs */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+int32 DS_FileWriteHeaderMember(int32 FileIndex)
+{
+    DS_AppFileStatus_t *FileStatus = &DS_AppData.FileStatus[FileIndex];
+    uint8 Headers[sizeof(CFE_FS_Header_t) + sizeof(DS_FileHeader_t)];
+    uint16 Compression = DS_COMPRESS_NONE;
+    int32 Result = CFE_SUCCESS;
+
+    /*
+    ** Read back both headers as written, the cFE header in file byte order...
+    */
+    Result = OS_lseek(FileStatus->FileHandle, 0, OS_SEEK_SET);
+
+    if (Result == 0)
+    {
+        Result = OS_read(FileStatus->FileHandle, Headers, sizeof(Headers));
+    }
+
+    if (Result == sizeof(Headers))
+    {
+        /*
+        ** The restored file is an uncompressed DS file...
+        */
+        CFE_PSP_MemCpy(&Headers[sizeof(CFE_FS_Header_t) + offsetof(DS_FileHeader_t, Compression)],
+                       &Compression, sizeof(uint16));
+
+        CFE_FS_DeflateStored(DS_AppData.CompressBuffer, sizeof(DS_AppData.CompressBuffer),
+                             Headers, sizeof(Headers));
+
+        /*
+        ** The member has a fixed size and place, so it can be rewritten...
+        */
+        Result = OS_write(FileStatus->FileHandle, DS_AppData.CompressBuffer, DS_FILE_HEADER_MEMBER_SIZE);
+
+        if (Result == DS_FILE_HEADER_MEMBER_SIZE)
+        {
+            Result = CFE_SUCCESS;
+        }
+    }
+
+    if ((Result >= 0) && (Result != CFE_SUCCESS))
+    {
+        Result = OS_ERROR;
+    }
+
+    return(Result);
+
+} /* End of DS_FileWriteHeaderMember() */
+
+
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
 /* DS_FileWriteError() - file write error handler                  */
@@ -345,6 +557,11 @@ void DS_FileWriteError(uint32 FileIndex, uint32 DataLength, int32 WriteResult)
                      "FILE WRITE error: result = %d, length = %d, dest = %d, name = '%s'",
                       (int)WriteResult, (int)DataLength, (int)FileIndex, FileStatus->FileName);
 
+    /*
+    ** Release any compressor so nothing more is written to the file...
+    */
+    FileStatus->Compressor = DS_NO_COMPRESSOR;
+
     DS_FileCloseDest(FileIndex);
 
     FileStatus->FileState = DS_DISABLED;
@@ -404,6 +621,14 @@ void DS_FileCreateDest(uint32 FileIndex)
 
             FileStatus->FileHandle = Result;
 
+            /*
+            ** Take a compressor if the table selects compression...
+            */
+            if (DestFile->Compression == DS_COMPRESS_GZIP)
+            {
+                DS_FileStartCompress(FileIndex);
+            }
+
             /*
             ** Initialize and write config specific file header...
             */
@@ -434,6 +659,97 @@ void DS_FileCreateDest(uint32 FileIndex)
 } /* End of DS_FileCreateDest() */
 
 
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* DS_FileStartCompress() - take a compressor for destination file */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void DS_FileStartCompress(uint32 FileIndex)
+{
+    DS_AppFileStatus_t *FileStatus = &DS_AppData.FileStatus[FileIndex];
+    uint16 Compressor = 0;
+    int32 i = 0;
+
+    /*
+    ** Find a compressor that no other open file is using...
+    */
+    for (Compressor = 1; (Compressor <= DS_COMPRESSED_FILE_CNT) &&
+                         (FileStatus->Compressor == DS_NO_COMPRESSOR); Compressor++)
+    {
+        for (i = 0; i < DS_DEST_FILE_CNT; i++)
+        {
+            if (DS_AppData.FileStatus[i].Compressor == Compressor)
+            {
+                break;
+            }
+        }
+
+        if (i == DS_DEST_FILE_CNT)
+        {
+            CFE_FS_DeflateInit(&DS_AppData.Compressor[Compressor - 1]);
+            FileStatus->Compressor = Compressor;
+            FileStatus->FlushBytes = 0;
+        }
+    }
+
+    if (FileStatus->Compressor == DS_NO_COMPRESSOR)
+    {
+        /*
+        ** All in use - write this file uncompressed...
+        */
+        CFE_EVS_SendEvent(DS_COMPRESS_BUSY_EID, CFE_EVS_EventType_INFORMATION,
+                         "FILE COMPRESS unavailable: dest = %d, name = '%s' written uncompressed",
+                          (int)FileIndex, FileStatus->FileName);
+    }
+
+    return;
+
+} /* End of DS_FileStartCompress() */
+
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* DS_FileFinishCompress() - write end of compressed data          */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void DS_FileFinishCompress(int32 FileIndex)
+{
+    DS_AppFileStatus_t *FileStatus = &DS_AppData.FileStatus[FileIndex];
+    int32 Result = CFE_SUCCESS;
+
+    /*
+    ** The header update may have moved the file pointer...
+    */
+    Result = OS_lseek(FileStatus->FileHandle, 0, OS_SEEK_END);
+
+    if (Result >= 0)
+    {
+        CFE_FS_DeflateFinish(&DS_AppData.Compressor[FileStatus->Compressor - 1]);
+
+        Result = DS_FileCompressData(FileIndex, NULL, 0);
+    }
+
+    FileStatus->Compressor = DS_NO_COMPRESSOR;
+
+    if (Result < 0)
+    {
+        /*
+        ** Error - send event and disable destination...
+        */
+        DS_AppData.FileWriteErrCounter++;
+
+        CFE_EVS_SendEvent(DS_COMPRESS_FILE_ERR_EID, CFE_EVS_EventType_ERROR,
+                         "FILE COMPRESS error: result = %d, dest = %d, name = '%s'",
+                          (int)Result, (int)FileIndex, FileStatus->FileName);
+
+        FileStatus->FileState = DS_DISABLED;
+    }
+
+    return;
+
+} /* End of DS_FileFinishCompress() */
+
+
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
 /* Create destination filename                                     */
@@ -720,6 +1036,20 @@ void DS_FileUpdateHeader(int32 FileIndex)
         /* update file close time */
         Result = OS_write(FileStatus->FileHandle, &CurrentTime, sizeof(CFE_TIME_SysTime_t));
 
+        if ((Result == sizeof(CFE_TIME_SysTime_t)) &&
+            (FileStatus->Compressor != DS_NO_COMPRESSOR))
+        {
+            /*
+            ** Compressed file - the restored file gets the close time too...
+            */
+            Result = DS_FileWriteHeaderMember(FileIndex);
+
+            if (Result == CFE_SUCCESS)
+            {
+                Result = sizeof(CFE_TIME_SysTime_t);
+            }
+        }
+
         if (Result == sizeof(CFE_TIME_SysTime_t))
         {
             DS_AppData.FileUpdateCounter++;
@@ -748,6 +1078,14 @@ void DS_FileCloseDest(int32 FileIndex)
 {
     DS_AppFileStatus_t *FileStatus = &DS_AppData.FileStatus[FileIndex];
 
+    /*
+    ** Compressed files end with the rest of the compressed data...
+    */
+    if (FileStatus->Compressor != DS_NO_COMPRESSOR)
+    {
+        DS_FileFinishCompress(FileIndex);
+    }
+
     #if (DS_MOVE_FILES == TRUE)
     /*
     ** Move file from working directory to downlink directory...
@@ -56,8 +56,17 @@ typedef struct
 
     char    FileName[DS_TOTAL_FNAME_BUFSIZE];           /**< \brief On-board filename */
 
+    uint16  Compression;                                /**< \brief File data compression - none vs gzip */
+    uint16  Spare;                                      /**< \brief Structure alignment padding */
+
 } DS_FileHeader_t;
 
+/*
+** \brief Size of the stored gzip member that holds a copy of both file
+**        headers at the start of the data of a compressed file
+*/
+#define DS_FILE_HEADER_MEMBER_SIZE  CFE_FS_DEFLATE_STORED_SIZE(sizeof(CFE_FS_Header_t) + sizeof(DS_FileHeader_t))
+
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
@@ -137,6 +146,35 @@ void DS_FileSetupWrite(int32 FileIndex, CFE_SB_MsgPtr_t MessagePtr);
 void DS_FileWriteData(int32 FileIndex, void *FileData, uint32 DataLength);
 
 
+/*******************************************************************/
+/*  \brief Compress data (packet) to file
+**  
+**  \par Description
+**       This function gives data to the compressor of a compressed
+**       data storage destination file and writes out whatever
+**       compressed data the compressor has ready.  The file size and
+**       data rate counters are updated with the compressed bytes
+**       written.  Called with no data after the compressor has been
+**       told to flush or finish, it writes out the compressed data
+**       the compressor still holds.
+**
+**  \par Assumptions, External Events, and Notes:
+**       The destination file must be using a compressor.
+**       
+**  \param [in]  Destination file index
+**  \param [in]  Pointer to packet data
+**  \param [in]  Length of packet data
+**
+**  \returns
+**  \retcode #CFE_SUCCESS \retdesc All of the data was taken \endcode
+**  \retstmt The failed write result, or #OS_ERROR for a short write \endstmt
+**  \endreturns
+**
+**  \sa #DS_FileWriteData, #DS_FileFinishCompress
+*/
+int32 DS_FileCompressData(int32 FileIndex, void *FileData, uint32 DataLength);
+
+
 /*******************************************************************/
 /*  \brief Write data storage file header
 **  
@@ -158,6 +196,33 @@ void DS_FileWriteData(int32 FileIndex, void *FileData, uint32 DataLength);
 void DS_FileWriteHeader(int32 FileIndex);
 
 
+/*******************************************************************/
+/*  \brief Write copy of compressed file headers
+**  
+**  \par Description
+**       This function reads back the cFE and DS file headers of a
+**       compressed destination file and writes them, with the DS
+**       header set to uncompressed, as a stored gzip member just
+**       after them.  Decompressing the file then gives a complete
+**       uncompressed DS file.  The member has a fixed size, so it is
+**       written once when the file is created and again when the
+**       close time is set.
+**
+**  \par Assumptions, External Events, and Notes:
+**       The destination file must be using a compressor.
+**       
+**  \param [in]  Destination file index
+**
+**  \returns
+**  \retcode #CFE_SUCCESS \retdesc The member was written \endcode
+**  \retstmt The failed seek, read or write result, or #OS_ERROR for a short read or write \endstmt
+**  \endreturns
+**
+**  \sa #DS_FileWriteHeader, #DS_FileUpdateHeader
+*/
+int32 DS_FileWriteHeaderMember(int32 FileIndex);
+
+
 /*******************************************************************/
 /*  \brief File write error handler
 **  
@@ -205,6 +270,45 @@ void DS_FileWriteError(uint32 FileIndex, uint32 DataLength, int32 WriteResult);
 */
 void DS_FileCreateDest(uint32 FileIndex);
 
+
+/*******************************************************************/
+/*  \brief Start compressing destination file
+**  
+**  \par Description
+**       This function is called just after creating a destination
+**       file that the Destination File Table selects for compression.
+**       The function takes a compressor that no other open file is
+**       using.  If all of the compressors are in use the file is
+**       written uncompressed.
+**
+**  \par Assumptions, External Events, and Notes:
+**       (none)
+**       
+**  \param [in]  Destination file index
+**
+**  \sa #DS_FileCreateDest, #DS_FileFinishCompress
+*/
+void DS_FileStartCompress(uint32 FileIndex);
+
+
+/*******************************************************************/
+/*  \brief Finish compressing destination file
+**  
+**  \par Description
+**       This function is called when a compressed destination file is
+**       about to be closed.  The rest of the compressed stream is
+**       written at the end of the file and the compressor is released.
+**       A write error disables the destination.
+**
+**  \par Assumptions, External Events, and Notes:
+**       (none)
+**       
+**  \param [in]  Destination file index
+**
+**  \sa #DS_FileCloseDest, #DS_FileStartCompress
+*/
+void DS_FileFinishCompress(int32 FileIndex);
+
 /*
 ** \brief Construct a filename for a new packet destination file
 */
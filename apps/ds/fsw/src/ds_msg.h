@@ -373,6 +373,13 @@ typedef struct
                                                      \brief Count of packets that passed filter test */
     char    FilterTblFilename[OS_MAX_PATH_LEN]; /**< \dstlmmnemonic \DS_FILTERTBL
                                                      \brief Name of filter table file */
+    uint32  CompressInBytes;                    /**< \dstlmmnemonic \DS_COMPINBYTES
+                                                     \brief Count of bytes given to file compressors */
+    uint32  CompressOutBytes;                   /**< \dstlmmnemonic \DS_COMPOUTBYTES
+                                                     \brief Count of compressed bytes written to files */
+    uint16  CompressionRatio;                   /**< \dstlmmnemonic \DS_COMPRATIO
+                                                     \brief Compressor input over output bytes, in hundredths */
+    uint16  Spare16;                            /**< \brief Structure alignment padding */
 } DS_HkPacket_t;
 
       
@@ -82,6 +82,8 @@
 **       - Filter Table Load Counter (\DS_FILTERLOADCNT)
 **       - Destination Table Ptr Error Counter (\DS_DESTPTRERRCNT)
 **       - Filter Table Ptr Error Counter (\DS_FILTERPTRERRCNT)
+**       - Compressor Input Byte Counter (\DS_COMPINBYTES)
+**       - Compressor Output Byte Counter (\DS_COMPOUTBYTES)
 **
 **  \dscmdmnemonic \DS_RESETCTRS
 **
@@ -501,6 +501,7 @@ bool DS_TableVerifyDestFileEntry(DS_DestFileEntry_t *DestFileEntry,
     **  MaxFileSize   = cannot be less than DS_FILE_MIN_SIZE_LIMIT
     **  MaxFileAge    = cannot be less than DS_FILE_MIN_AGE_LIMIT
     **  SequenceCount = may be zero, cannot exceed DS_MAX_SEQUENCE_COUNT
+    **  Compression   = DS_COMPRESS_NONE or DS_COMPRESS_GZIP
     */
     if (CFS_VerifyString(DestFileEntry->Pathname, DS_PATHNAME_BUFSIZE,
                          DS_STRING_REQUIRED, DS_FILENAME_TEXT) == false)
@@ -585,6 +586,16 @@ bool DS_TableVerifyDestFileEntry(DS_DestFileEntry_t *DestFileEntry,
         }
         Result = false;
     }
+    else if (DS_TableVerifyCompression(DestFileEntry->Compression) == false)
+    {
+        if (ErrorCount == 0)
+        {
+            CFE_EVS_SendEvent(DS_FIL_TBL_ERR_EID, CFE_EVS_EventType_ERROR,
+                             "%s index = %d, compression = %d",
+                              CommonErrorText, (int)TableIndex, (int)DestFileEntry->Compression);
+        }
+        Result = false;
+    }
 
     return(Result);
 
@@ -921,6 +932,26 @@ bool DS_TableVerifyCount(uint32 SequenceCount)
 } /* End of DS_TableVerifyCount() */
 
 
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* DS_TableVerifyCompression() - verify file compression           */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+bool DS_TableVerifyCompression(uint16 Compression)
+{
+    bool Result = true;
+
+    if ((Compression != DS_COMPRESS_NONE) && (Compression != DS_COMPRESS_GZIP))
+    {
+        Result = false;
+    }
+
+    return(Result);
+
+} /* End of DS_TableVerifyCompression() */
+
+
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
 /* DS_TableSubscribe() - process new filter table                  */
@@ -107,6 +107,9 @@ typedef struct
 
     uint32              SequenceCount;                         /**< \brief Sequence count portion of filename */
 
+    uint16              Compression;                           /**< \brief File data compression - none vs gzip */
+    uint16              Spare;                                 /**< \brief Structure alignment padding */
+
 } DS_DestFileEntry_t;
 
 typedef struct
@@ -490,6 +493,27 @@ bool DS_TableVerifyAge(uint32 MaxFileAge);
 bool DS_TableVerifyCount(uint32 SequenceCount);
 
 
+/*******************************************************************/
+/*  \brief Verify destination file compression
+**  
+**  \par Description
+**       This function verifies that the indicated destination file
+**       compression selection is within bounds.
+**       Must be DS_COMPRESS_NONE or DS_COMPRESS_GZIP.
+**
+**  \par Called From:
+**       - Destination File Table entry validation function
+**       
+**  \par Assumptions, External Events, and Notes:
+**       (none)
+**       
+**  \param [in]  Compression value
+**
+**  \sa #DS_TableVerifyCount, #DS_DestFileEntry_t
+*/
+bool DS_TableVerifyCompression(uint16 Compression);
+
+
 /*******************************************************************/
 /*  \brief Subscribe to packet filter table packets
 **  
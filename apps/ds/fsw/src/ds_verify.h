@@ -244,6 +244,21 @@
 #endif
 
 
+#ifndef DS_COMPRESSED_FILE_CNT
+    #error DS_COMPRESSED_FILE_CNT must be defined!
+#elif (DS_COMPRESSED_FILE_CNT  <  1)
+    #error DS_COMPRESSED_FILE_CNT cannot be less than 1!
+#elif (DS_COMPRESSED_FILE_CNT > DS_DEST_FILE_CNT)
+    #error DS_COMPRESSED_FILE_CNT cannot be greater than DS_DEST_FILE_CNT!
+#endif
+
+#ifndef DS_COMPRESS_FLUSH_BYTES
+    #error DS_COMPRESS_FLUSH_BYTES must be defined!
+#elif (DS_COMPRESS_FLUSH_BYTES  <  0)
+    #error DS_COMPRESS_FLUSH_BYTES cannot be less than zero!
+#endif
+
+
 #endif /* _ds_verify_h_ */
 
 /************************/
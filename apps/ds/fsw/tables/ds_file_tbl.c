@@ -95,6 +95,7 @@ DS_DestFileTable_t DS_DestFileTable =
       /* .MaxFileSize   = */ (1024 * 32),               /* 32 K-bytes */
       /* .MaxFileAge    = */ (60 * 45),                 /* 45 minutes */
       /* .SequenceCount = */ 1000,
+      /* .Compression   = */ DS_COMPRESS_NONE,
     },
     /* File Index 01 -- application housekeeping packets */
     {
@@ -110,6 +111,7 @@ DS_DestFileTable_t DS_DestFileTable =
       /* .MaxFileSize   = */ (1024 * 1024 * 2),         /* 2 M-bytes */
       /* .MaxFileAge    = */ (60 * 60 * 2),             /* 2 hours */
       /* .SequenceCount = */ DS_UNUSED,
+      /* .Compression   = */ DS_COMPRESS_NONE,
     },
     /* File Index 02 -- application telemetry packets */
     {
@@ -125,6 +127,7 @@ DS_DestFileTable_t DS_DestFileTable =
       /* .MaxFileSize   = */ (1024 * 1024 * 1024 * 1),  /* 1 G-byte */
       /* .MaxFileAge    = */ (60 * 60 * 2),             /* 2 hours */
       /* .SequenceCount = */ 2000,
+      /* .Compression   = */ DS_COMPRESS_NONE,
     },
     /* File Index 03 -- hardware telemetry packets */
     {
@@ -140,6 +143,7 @@ DS_DestFileTable_t DS_DestFileTable =
       /* .MaxFileSize   = */ (1024 * 1024 * 2),         /* 2 M-bytes */
       /* .MaxFileAge    = */ (60 * 60 * 2),             /* 2 hours */
       /* .SequenceCount = */ 3000,
+      /* .Compression   = */ DS_COMPRESS_NONE,
     },
     /* File Index 04 -- cFE housekeeping packets */
     {
@@ -155,6 +159,7 @@ DS_DestFileTable_t DS_DestFileTable =
       /* .MaxFileSize   = */ (1024 * 1024 * 2),         /* 2 M-bytes */
       /* .MaxFileAge    = */ (60 * 60 * 2),             /* 2 hours */
       /* .SequenceCount = */ 4000,
+      /* .Compression   = */ DS_COMPRESS_NONE,
     },
     /* File Index 05 -- cFE telemetry packets */
     {
@@ -170,6 +175,7 @@ DS_DestFileTable_t DS_DestFileTable =
       /* .MaxFileSize   = */ (1024),         /* 1024 bytes */
       /* .MaxFileAge    = */ (60),             /* 1 minute */
       /* .SequenceCount = */ 5000,
+      /* .Compression   = */ DS_COMPRESS_NONE,
     },
     /* File Index 06 Data Filter*/
     {
@@ -185,6 +191,7 @@ DS_DestFileTable_t DS_DestFileTable =
       /* .MaxFileSize   = */ (1024 * 1024 * 2),         /* 2 Mbytes */
       /* .MaxFileAge    = */ (30 * 60),                /* 30 Minutes */
       /* .SequenceCount = */ 6000,
+      /* .Compression   = */ DS_COMPRESS_GZIP,
     },
     /* File Index 07 */
     {
@@ -200,6 +207,7 @@ DS_DestFileTable_t DS_DestFileTable =
       /* .MaxFileSize   = */ DS_UNUSED,
       /* .MaxFileAge    = */ DS_UNUSED,
       /* .SequenceCount = */ DS_UNUSED,
+      /* .Compression   = */ DS_UNUSED,
     },
     /* File Index 08 */
     {
@@ -215,6 +223,7 @@ DS_DestFileTable_t DS_DestFileTable =
       /* .MaxFileSize   = */ DS_UNUSED,
       /* .MaxFileAge    = */ DS_UNUSED,
       /* .SequenceCount = */ DS_UNUSED,
+      /* .Compression   = */ DS_UNUSED,
     },
     /* File Index 09 */
     {
@@ -230,6 +239,7 @@ DS_DestFileTable_t DS_DestFileTable =
       /* .MaxFileSize   = */ DS_UNUSED,
       /* .MaxFileAge    = */ DS_UNUSED,
       /* .SequenceCount = */ DS_UNUSED,
+      /* .Compression   = */ DS_UNUSED,
     },
     /* File Index 10 */
     {
@@ -245,6 +255,7 @@ DS_DestFileTable_t DS_DestFileTable =
       /* .MaxFileSize   = */ DS_UNUSED,
       /* .MaxFileAge    = */ DS_UNUSED,
       /* .SequenceCount = */ DS_UNUSED,
+      /* .Compression   = */ DS_UNUSED,
     },
     /* File Index 11 */
     {
@@ -260,6 +271,7 @@ DS_DestFileTable_t DS_DestFileTable =
       /* .MaxFileSize   = */ DS_UNUSED,
       /* .MaxFileAge    = */ DS_UNUSED,
       /* .SequenceCount = */ DS_UNUSED,
+      /* .Compression   = */ DS_UNUSED,
     },
     /* File Index 12 */
     {
@@ -275,6 +287,7 @@ DS_DestFileTable_t DS_DestFileTable =
       /* .MaxFileSize   = */ DS_UNUSED,
       /* .MaxFileAge    = */ DS_UNUSED,
       /* .SequenceCount = */ DS_UNUSED,
+      /* .Compression   = */ DS_UNUSED,
     },
     /* File Index 13 */
     {
@@ -290,6 +303,7 @@ DS_DestFileTable_t DS_DestFileTable =
       /* .MaxFileSize   = */ DS_UNUSED,
       /* .MaxFileAge    = */ DS_UNUSED,
       /* .SequenceCount = */ DS_UNUSED,
+      /* .Compression   = */ DS_UNUSED,
     },
     /* File Index 14 */
     {
@@ -305,6 +319,7 @@ DS_DestFileTable_t DS_DestFileTable =
       /* .MaxFileSize   = */ DS_UNUSED,
       /* .MaxFileAge    = */ DS_UNUSED,
       /* .SequenceCount = */ DS_UNUSED,
+      /* .Compression   = */ DS_UNUSED,
     },
     /* File Index 15 */
     {
@@ -320,6 +335,7 @@ DS_DestFileTable_t DS_DestFileTable =
       /* .MaxFileSize   = */ DS_UNUSED,
       /* .MaxFileAge    = */ DS_UNUSED,
       /* .SequenceCount = */ DS_UNUSED,
+      /* .Compression   = */ DS_UNUSED,
     },
   }
 };
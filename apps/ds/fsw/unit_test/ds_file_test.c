@@ -314,6 +314,111 @@ void DS_FileWriteData_Test_Error(void)
 
 } /* end DS_FileWriteData_Test_Error */
 
+void DS_FileWriteData_Test_Compressed(void)
+{
+    DS_NoopCmd_t        CmdPacket;
+    CFE_SB_MsgId_t      FileIndex = 0;
+    uint32              DataLength = 10;
+
+    CFE_SB_InitMsg (&CmdPacket, DS_CMD_MID, sizeof(DS_NoopCmd_t), TRUE);
+    CFE_SB_SetCmdCode((CFE_SB_MsgPtr_t)&CmdPacket, DS_NOOP_CC);
+
+    DS_AppData.FileStatus[FileIndex].Compressor = 1;
+    CFE_FS_DeflateInit(&DS_AppData.Compressor[0]);
+
+    /* Set to return the size of the gzip header, the only compressed data ready after 10 bytes */
+    Ut_OSFILEAPI_SetReturnCode(UT_OSFILEAPI_WRITE_INDEX, 12, 1);
+
+    /* Execute the function being tested */
+    DS_FileWriteData(FileIndex, (CFE_SB_MsgPtr_t)&CmdPacket, DataLength);
+    
+    /* Verify results */
+    UtAssert_True (DS_AppData.FileWriteCounter == 1, "DS_AppData.FileWriteCounter == 1");
+    UtAssert_True (DS_AppData.FileStatus[FileIndex].FileSize == 12, "DS_AppData.FileStatus[FileIndex].FileSize == 12");
+    UtAssert_True (DS_AppData.FileStatus[FileIndex].FileGrowth == 12, "DS_AppData.FileStatus[FileIndex].FileGrowth == 12");
+    UtAssert_True (DS_AppData.CompressInBytes == 10, "DS_AppData.CompressInBytes == 10");
+    UtAssert_True (DS_AppData.CompressOutBytes == 12, "DS_AppData.CompressOutBytes == 12");
+    UtAssert_True (DS_AppData.FileStatus[FileIndex].Compressor == 1, "DS_AppData.FileStatus[FileIndex].Compressor == 1");
+
+    UtAssert_True (Ut_CFE_EVS_GetEventQueueDepth() == 0, "Ut_CFE_EVS_GetEventQueueDepth() == 0");
+
+} /* end DS_FileWriteData_Test_Compressed */
+
+void DS_FileWriteData_Test_CompressedError(void)
+{
+    DS_NoopCmd_t        CmdPacket;
+    CFE_SB_MsgId_t      FileIndex = 0;
+    uint32              DataLength = 10;
+    DS_DestFileTable_t  DestFileTable;
+
+    DS_AppData.DestFileTblPtr = &DestFileTable;
+
+    CFE_SB_InitMsg (&CmdPacket, DS_CMD_MID, sizeof(DS_NoopCmd_t), TRUE);
+    CFE_SB_SetCmdCode((CFE_SB_MsgPtr_t)&CmdPacket, DS_NOOP_CC);
+
+    DS_AppData.FileStatus[FileIndex].Compressor = 1;
+    CFE_FS_DeflateInit(&DS_AppData.Compressor[0]);
+
+    /* Set to reach error case being tested (DS_FileWriteError) */
+    Ut_OSFILEAPI_SetReturnCode(UT_OSFILEAPI_WRITE_INDEX, -1, 1);
+
+    strncpy (DS_AppData.FileStatus[FileIndex].FileName, "directory1/", DS_TOTAL_FNAME_BUFSIZE);
+
+    /* Execute the function being tested */
+    DS_FileWriteData(FileIndex, (CFE_SB_MsgPtr_t)&CmdPacket, DataLength);
+    
+    /* Verify results */
+    UtAssert_True
+        (Ut_CFE_EVS_EventSent(DS_WRITE_FILE_ERR_EID, CFE_EVS_ERROR, "FILE WRITE error: result = -1, length = 10, dest = 0, name = 'directory1/'"),
+        "FILE WRITE error: result = -1, length = 10, dest = 0, name = 'directory1/'");
+
+    UtAssert_True (DS_AppData.FileStatus[FileIndex].Compressor == DS_NO_COMPRESSOR, "DS_AppData.FileStatus[FileIndex].Compressor == DS_NO_COMPRESSOR");
+    UtAssert_True (DS_AppData.FileStatus[FileIndex].FileState == DS_DISABLED, "DS_AppData.FileStatus[FileIndex].FileState == DS_DISABLED");
+
+    UtAssert_True (Ut_CFE_EVS_GetEventQueueDepth() == 1, "Ut_CFE_EVS_GetEventQueueDepth() == 1");
+
+} /* end DS_FileWriteData_Test_CompressedError */
+
+void DS_FileWriteData_Test_CompressedFlushError(void)
+{
+    DS_NoopCmd_t        CmdPacket;
+    CFE_SB_MsgId_t      FileIndex = 0;
+    uint32              DataLength = 10;
+    DS_DestFileTable_t  DestFileTable;
+
+    DS_AppData.DestFileTblPtr = &DestFileTable;
+
+    CFE_SB_InitMsg (&CmdPacket, DS_CMD_MID, sizeof(DS_NoopCmd_t), TRUE);
+    CFE_SB_SetCmdCode((CFE_SB_MsgPtr_t)&CmdPacket, DS_NOOP_CC);
+
+    DS_AppData.FileStatus[FileIndex].Compressor = 1;
+    DS_AppData.FileStatus[FileIndex].FlushBytes = DS_COMPRESS_FLUSH_BYTES;
+    CFE_FS_DeflateInit(&DS_AppData.Compressor[0]);
+
+    /* The gzip header has already been written, so the only write is the flushed data */
+    CFE_FS_DeflateDrain(&DS_AppData.Compressor[0], DS_AppData.CompressBuffer, sizeof(DS_AppData.CompressBuffer));
+
+    /* Set to reach error case being tested (DS_FileWriteError) */
+    Ut_OSFILEAPI_SetReturnCode(UT_OSFILEAPI_WRITE_INDEX, -1, 1);
+
+    strncpy (DS_AppData.FileStatus[FileIndex].FileName, "directory1/", DS_TOTAL_FNAME_BUFSIZE);
+
+    /* Execute the function being tested */
+    DS_FileWriteData(FileIndex, (CFE_SB_MsgPtr_t)&CmdPacket, DataLength);
+    
+    /* Verify results */
+    UtAssert_True
+        (Ut_CFE_EVS_EventSent(DS_WRITE_FILE_ERR_EID, CFE_EVS_ERROR, "FILE WRITE error: result = -1, length = 10, dest = 0, name = 'directory1/'"),
+        "FILE WRITE error: result = -1, length = 10, dest = 0, name = 'directory1/'");
+
+    UtAssert_True (DS_AppData.CompressInBytes == 10, "DS_AppData.CompressInBytes == 10");
+    UtAssert_True (DS_AppData.FileStatus[FileIndex].FlushBytes == 0, "DS_AppData.FileStatus[FileIndex].FlushBytes == 0");
+    UtAssert_True (DS_AppData.FileStatus[FileIndex].Compressor == DS_NO_COMPRESSOR, "DS_AppData.FileStatus[FileIndex].Compressor == DS_NO_COMPRESSOR");
+
+    UtAssert_True (Ut_CFE_EVS_GetEventQueueDepth() == 1, "Ut_CFE_EVS_GetEventQueueDepth() == 1");
+
+} /* end DS_FileWriteData_Test_CompressedFlushError */
+
 #if DS_FILE_HEADER_TYPE == DS_FILE_HEADER_CFE
 void DS_FileWriteHeader_Test_PlatformConfigCFE_Nominal(void)
 {
@@ -391,6 +496,55 @@ void DS_FileWriteHeader_Test_SecondaryHeaderError(void)
 } /* end DS_FileWriteHeader_Test_SecondaryHeaderError */
 #endif
 
+void DS_FileWriteHeaderMember_Test_Nominal(void)
+{
+    CFE_SB_MsgId_t      FileIndex = 0;
+    int32               Result;
+
+    DS_AppData.FileStatus[FileIndex].Compressor = 1;
+
+    /* Set to satisfy condition "if (Result == 0)" */
+    Ut_OSFILEAPI_SetReturnCode(UT_OSFILEAPI_LSEEK_INDEX, 0, 1);
+
+    /* Set to satisfy condition "if (Result == sizeof(Headers))" */
+    Ut_OSFILEAPI_SetReturnCode(UT_OSFILEAPI_READ_INDEX, sizeof(CFE_FS_Header_t) + sizeof(DS_FileHeader_t), 1);
+
+    /* Set to satisfy condition "if (Result == DS_FILE_HEADER_MEMBER_SIZE)" */
+    Ut_OSFILEAPI_SetReturnCode(UT_OSFILEAPI_WRITE_INDEX, DS_FILE_HEADER_MEMBER_SIZE, 1);
+
+    /* Execute the function being tested */
+    Result = DS_FileWriteHeaderMember(FileIndex);
+    
+    /* Verify results */
+    UtAssert_True (Result == CFE_SUCCESS, "Result == CFE_SUCCESS");
+
+    UtAssert_True (Ut_CFE_EVS_GetEventQueueDepth() == 0, "Ut_CFE_EVS_GetEventQueueDepth() == 0");
+
+} /* end DS_FileWriteHeaderMember_Test_Nominal */
+
+void DS_FileWriteHeaderMember_Test_ReadError(void)
+{
+    CFE_SB_MsgId_t      FileIndex = 0;
+    int32               Result;
+
+    DS_AppData.FileStatus[FileIndex].Compressor = 1;
+
+    /* Set to satisfy condition "if (Result == 0)" */
+    Ut_OSFILEAPI_SetReturnCode(UT_OSFILEAPI_LSEEK_INDEX, 0, 1);
+
+    /* Set to fail condition "if (Result == sizeof(Headers))" with a short read */
+    Ut_OSFILEAPI_SetReturnCode(UT_OSFILEAPI_READ_INDEX, 10, 1);
+
+    /* Execute the function being tested */
+    Result = DS_FileWriteHeaderMember(FileIndex);
+    
+    /* Verify results */
+    UtAssert_True (Result == OS_ERROR, "Result == OS_ERROR");
+
+    UtAssert_True (Ut_CFE_EVS_GetEventQueueDepth() == 0, "Ut_CFE_EVS_GetEventQueueDepth() == 0");
+
+} /* end DS_FileWriteHeaderMember_Test_ReadError */
+
 #if DS_FILE_HEADER_TYPE == DS_FILE_HEADER_GPM
 void DS_FileWriteHeader_Test_PlatformConfigGPM_Nominal(void)
 {
@@ -553,6 +707,78 @@ void DS_FileCreateDest_Test_Error(void)
 
 } /* end DS_FileCreateDest_Test_Error */
 
+void DS_FileStartCompress_Test_Nominal(void)
+{
+    CFE_SB_MsgId_t      FileIndex = 0;
+
+    /* Compressor 1 is in use by another file */
+    DS_AppData.FileStatus[1].Compressor = 1;
+
+    /* Execute the function being tested */
+    DS_FileStartCompress(FileIndex);
+    
+    /* Verify results */
+    UtAssert_True (DS_AppData.FileStatus[FileIndex].Compressor == 2, "DS_AppData.FileStatus[FileIndex].Compressor == 2");
+
+    UtAssert_True (Ut_CFE_EVS_GetEventQueueDepth() == 0, "Ut_CFE_EVS_GetEventQueueDepth() == 0");
+
+} /* end DS_FileStartCompress_Test_Nominal */
+
+void DS_FileStartCompress_Test_AllInUse(void)
+{
+    CFE_SB_MsgId_t      FileIndex = 0;
+    uint16              i;
+
+    for (i = 1; i <= DS_COMPRESSED_FILE_CNT; i++)
+    {
+        DS_AppData.FileStatus[i].Compressor = i;
+    }
+
+    strncpy (DS_AppData.FileStatus[FileIndex].FileName, "filename", OS_MAX_PATH_LEN);
+
+    /* Execute the function being tested */
+    DS_FileStartCompress(FileIndex);
+    
+    /* Verify results */
+    UtAssert_True (DS_AppData.FileStatus[FileIndex].Compressor == DS_NO_COMPRESSOR, "DS_AppData.FileStatus[FileIndex].Compressor == DS_NO_COMPRESSOR");
+
+    UtAssert_True
+        (Ut_CFE_EVS_EventSent(DS_COMPRESS_BUSY_EID, CFE_EVS_INFORMATION, "FILE COMPRESS unavailable: dest = 0, name = 'filename' written uncompressed"),
+        "FILE COMPRESS unavailable: dest = 0, name = 'filename' written uncompressed");
+
+    UtAssert_True (Ut_CFE_EVS_GetEventQueueDepth() == 1, "Ut_CFE_EVS_GetEventQueueDepth() == 1");
+
+} /* end DS_FileStartCompress_Test_AllInUse */
+
+void DS_FileFinishCompress_Test_SeekError(void)
+{
+    CFE_SB_MsgId_t      FileIndex = 0;
+
+    DS_AppData.FileStatus[FileIndex].Compressor = 1;
+    DS_AppData.FileStatus[FileIndex].FileState = DS_ENABLED;
+    CFE_FS_DeflateInit(&DS_AppData.Compressor[0]);
+
+    strncpy (DS_AppData.FileStatus[FileIndex].FileName, "filename", OS_MAX_PATH_LEN);
+
+    /* Set to fail the condition "if (Result >= 0)" */
+    Ut_OSFILEAPI_SetReturnCode(UT_OSFILEAPI_LSEEK_INDEX, -1, 1);
+
+    /* Execute the function being tested */
+    DS_FileFinishCompress(FileIndex);
+    
+    /* Verify results */
+    UtAssert_True (DS_AppData.FileWriteErrCounter == 1, "DS_AppData.FileWriteErrCounter == 1");
+    UtAssert_True (DS_AppData.FileStatus[FileIndex].Compressor == DS_NO_COMPRESSOR, "DS_AppData.FileStatus[FileIndex].Compressor == DS_NO_COMPRESSOR");
+    UtAssert_True (DS_AppData.FileStatus[FileIndex].FileState == DS_DISABLED, "DS_AppData.FileStatus[FileIndex].FileState == DS_DISABLED");
+
+    UtAssert_True
+        (Ut_CFE_EVS_EventSent(DS_COMPRESS_FILE_ERR_EID, CFE_EVS_ERROR, "FILE COMPRESS error: result = -1, dest = 0, name = 'filename'"),
+        "FILE COMPRESS error: result = -1, dest = 0, name = 'filename'");
+
+    UtAssert_True (Ut_CFE_EVS_GetEventQueueDepth() == 1, "Ut_CFE_EVS_GetEventQueueDepth() == 1");
+
+} /* end DS_FileFinishCompress_Test_SeekError */
+
 void DS_FileCreateName_Test_Nominal(void)
 {
     CFE_SB_MsgId_t      FileIndex = 0;
@@ -1092,6 +1318,9 @@ void DS_File_Test_AddTestCases(void)
 
     UtTest_Add(DS_FileWriteData_Test_Nominal, DS_Test_Setup, DS_Test_TearDown, "DS_FileWriteData_Test_Nominal");
     UtTest_Add(DS_FileWriteData_Test_Error, DS_Test_Setup, DS_Test_TearDown, "DS_FileWriteData_Test_Error");
+    UtTest_Add(DS_FileWriteData_Test_Compressed, DS_Test_Setup, DS_Test_TearDown, "DS_FileWriteData_Test_Compressed");
+    UtTest_Add(DS_FileWriteData_Test_CompressedError, DS_Test_Setup, DS_Test_TearDown, "DS_FileWriteData_Test_CompressedError");
+    UtTest_Add(DS_FileWriteData_Test_CompressedFlushError, DS_Test_Setup, DS_Test_TearDown, "DS_FileWriteData_Test_CompressedFlushError");
 
 #if DS_FILE_HEADER_TYPE == DS_FILE_HEADER_CFE
     UtTest_Add(DS_FileWriteHeader_Test_PlatformConfigCFE_Nominal, DS_Test_Setup, DS_Test_TearDown, "DS_FileWriteHeader_Test_PlatformConfigCFE_Nominal");
@@ -1102,6 +1331,9 @@ void DS_File_Test_AddTestCases(void)
     UtTest_Add(DS_FileWriteHeader_Test_PlatformConfigGPM_HeaderError, DS_Test_Setup, DS_Test_TearDown, "DS_FileWriteHeader_Test_PlatformConfigGPM_HeaderError");
 #endif
 
+    UtTest_Add(DS_FileWriteHeaderMember_Test_Nominal, DS_Test_Setup, DS_Test_TearDown, "DS_FileWriteHeaderMember_Test_Nominal");
+    UtTest_Add(DS_FileWriteHeaderMember_Test_ReadError, DS_Test_Setup, DS_Test_TearDown, "DS_FileWriteHeaderMember_Test_ReadError");
+
 #if DS_FILE_HEADER_TYPE == DS_FILE_HEADER_CFE
     UtTest_Add(DS_FileWriteError_Test, DS_Test_Setup, DS_Test_TearDown, "DS_FileWriteError_Test");
 #endif
@@ -1109,6 +1341,10 @@ void DS_File_Test_AddTestCases(void)
     UtTest_Add(DS_FileCreateDest_Test_Nominal, DS_Test_Setup, DS_Test_TearDown, "DS_FileCreateDest_Test_Nominal");
     UtTest_Add(DS_FileCreateDest_Test_Error, DS_Test_Setup, DS_Test_TearDown, "DS_FileCreateDest_Test_Error");
 
+    UtTest_Add(DS_FileStartCompress_Test_Nominal, DS_Test_Setup, DS_Test_TearDown, "DS_FileStartCompress_Test_Nominal");
+    UtTest_Add(DS_FileStartCompress_Test_AllInUse, DS_Test_Setup, DS_Test_TearDown, "DS_FileStartCompress_Test_AllInUse");
+    UtTest_Add(DS_FileFinishCompress_Test_SeekError, DS_Test_Setup, DS_Test_TearDown, "DS_FileFinishCompress_Test_SeekError");
+
     UtTest_Add(DS_FileCreateName_Test_Nominal, DS_Test_Setup, DS_Test_TearDown, "DS_FileCreateName_Test_Nominal");
     UtTest_Add(DS_FileCreateName_Test_EmptyPath, DS_Test_Setup,DS_Test_TearDown, "DS_FileCreateName_Test_EmptyPath");
     UtTest_Add(DS_FileCreateName_Test_Error, DS_Test_Setup, DS_Test_TearDown, "DS_FileCreateName_Test_Error");
@@ -450,6 +450,7 @@ void DS_TableVerifyDestFile_Test_Nominal(void)
     DestFileTable.File[FileIndex].MaxFileSize = 2048;
     DestFileTable.File[FileIndex].MaxFileAge = 100;
     DestFileTable.File[FileIndex].SequenceCount = 1;
+    DestFileTable.File[FileIndex].Compression = DS_COMPRESS_NONE;
 
     strncpy (DestFileTable.File[FileIndex].Pathname, "path", DS_PATHNAME_BUFSIZE);
     strncpy (DestFileTable.File[FileIndex].Basename, "basename", DS_BASENAME_BUFSIZE);
@@ -485,6 +486,7 @@ void DS_TableVerifyDestFile_Test_DestFileTableVerificationError(void)
     DestFileTable.File[FileIndex].MaxFileSize = 2048;
     DestFileTable.File[FileIndex].MaxFileAge = 100;
     DestFileTable.File[FileIndex].SequenceCount = 1;
+    DestFileTable.File[FileIndex].Compression = DS_COMPRESS_NONE;
 
     strncpy (DestFileTable.File[FileIndex].Pathname, "path", DS_PATHNAME_BUFSIZE);
     strncpy (DestFileTable.File[FileIndex].Basename, "basename", DS_BASENAME_BUFSIZE);
@@ -531,6 +533,7 @@ void DS_TableVerifyDestFile_Test_CountBad(void)
     DestFileTable.File[FileIndex].MaxFileSize = 2048;
     DestFileTable.File[FileIndex].MaxFileAge = 100;
     DestFileTable.File[FileIndex].SequenceCount = 1;
+    DestFileTable.File[FileIndex].Compression = DS_COMPRESS_NONE;
 
     strncpy (DestFileTable.File[FileIndex].Pathname, "path", DS_PATHNAME_BUFSIZE);
     strncpy (DestFileTable.File[FileIndex].Basename, "basename", DS_BASENAME_BUFSIZE);
@@ -570,6 +573,7 @@ void DS_TableVerifyDestFileEntry_Test_Nominal(void)
     DestFileEntry.MaxFileSize = 2048;
     DestFileEntry.MaxFileAge = 100;
     DestFileEntry.SequenceCount = 1;
+    DestFileEntry.Compression = DS_COMPRESS_NONE;
 
     strncpy (DestFileEntry.Pathname, "path", DS_PATHNAME_BUFSIZE);
     strncpy (DestFileEntry.Basename, "basename", DS_BASENAME_BUFSIZE);
@@ -596,6 +600,7 @@ void DS_TableVerifyDestFileEntry_Test_InvalidPathname(void)
     DestFileEntry.MaxFileSize = 2048;
     DestFileEntry.MaxFileAge = 100;
     DestFileEntry.SequenceCount = 1;
+    DestFileEntry.Compression = DS_COMPRESS_NONE;
 
     strncpy (DestFileEntry.Pathname, "***", DS_PATHNAME_BUFSIZE);
     strncpy (DestFileEntry.Basename, "basename", DS_BASENAME_BUFSIZE);
@@ -626,6 +631,7 @@ void DS_TableVerifyDestFileEntry_Test_InvalidBasename(void)
     DestFileEntry.MaxFileSize = 2048;
     DestFileEntry.MaxFileAge = 100;
     DestFileEntry.SequenceCount = 1;
+    DestFileEntry.Compression = DS_COMPRESS_NONE;
 
     strncpy (DestFileEntry.Pathname, "path", DS_PATHNAME_BUFSIZE);
     strncpy (DestFileEntry.Basename, "***", DS_BASENAME_BUFSIZE);
@@ -656,6 +662,7 @@ void DS_TableVerifyDestFileEntry_Test_InvalidExtension(void)
     DestFileEntry.MaxFileSize = 2048;
     DestFileEntry.MaxFileAge = 100;
     DestFileEntry.SequenceCount = 1;
+    DestFileEntry.Compression = DS_COMPRESS_NONE;
 
     strncpy (DestFileEntry.Pathname, "path", DS_PATHNAME_BUFSIZE);
     strncpy (DestFileEntry.Basename, "pathname", DS_BASENAME_BUFSIZE);
@@ -686,6 +693,7 @@ void DS_TableVerifyDestFileEntry_Test_InvalidFilenameType(void)
     DestFileEntry.MaxFileSize = 2048;
     DestFileEntry.MaxFileAge = 100;
     DestFileEntry.SequenceCount = 1;
+    DestFileEntry.Compression = DS_COMPRESS_NONE;
 
     strncpy (DestFileEntry.Pathname, "path", DS_PATHNAME_BUFSIZE);
     strncpy (DestFileEntry.Basename, "pathname", DS_BASENAME_BUFSIZE);
@@ -716,6 +724,7 @@ void DS_TableVerifyDestFileEntry_Test_InvalidFileEnableState(void)
     DestFileEntry.MaxFileSize = 2048;
     DestFileEntry.MaxFileAge = 100;
     DestFileEntry.SequenceCount = 1;
+    DestFileEntry.Compression = DS_COMPRESS_NONE;
 
     strncpy (DestFileEntry.Pathname, "path", DS_PATHNAME_BUFSIZE);
     strncpy (DestFileEntry.Basename, "pathname", DS_BASENAME_BUFSIZE);
@@ -746,6 +755,7 @@ void DS_TableVerifyDestFileEntry_Test_InvalidSize(void)
     DestFileEntry.MaxFileSize = DS_FILE_MIN_SIZE_LIMIT - 1;
     DestFileEntry.MaxFileAge = 100;
     DestFileEntry.SequenceCount = 1;
+    DestFileEntry.Compression = DS_COMPRESS_NONE;
 
     strncpy (DestFileEntry.Pathname, "path", DS_PATHNAME_BUFSIZE);
     strncpy (DestFileEntry.Basename, "pathname", DS_BASENAME_BUFSIZE);
@@ -776,6 +786,7 @@ void DS_TableVerifyDestFileEntry_Test_InvalidAge(void)
     DestFileEntry.MaxFileSize = 2048;
     DestFileEntry.MaxFileAge = DS_FILE_MIN_AGE_LIMIT - 1;
     DestFileEntry.SequenceCount = 1;
+    DestFileEntry.Compression = DS_COMPRESS_NONE;
 
     strncpy (DestFileEntry.Pathname, "path", DS_PATHNAME_BUFSIZE);
     strncpy (DestFileEntry.Basename, "pathname", DS_BASENAME_BUFSIZE);
@@ -806,6 +817,7 @@ void DS_TableVerifyDestFileEntry_Test_InvalidSequenceCount(void)
     DestFileEntry.MaxFileSize = 2048;
     DestFileEntry.MaxFileAge = 100;
     DestFileEntry.SequenceCount = DS_MAX_SEQUENCE_COUNT + 1;
+    DestFileEntry.Compression = DS_COMPRESS_NONE;
 
     strncpy (DestFileEntry.Pathname, "path", DS_PATHNAME_BUFSIZE);
     strncpy (DestFileEntry.Basename, "pathname", DS_BASENAME_BUFSIZE);
@@ -824,6 +836,37 @@ void DS_TableVerifyDestFileEntry_Test_InvalidSequenceCount(void)
     UtAssert_True (Ut_CFE_EVS_GetEventQueueDepth() == 1, "Ut_CFE_EVS_GetEventQueueDepth() == 1");
 } /* end DS_TableVerifyDestFileEntry_Test_InvalidSequenceCount */
 
+void DS_TableVerifyDestFileEntry_Test_InvalidCompression(void)
+{
+    int32               Result;
+    DS_DestFileEntry_t  DestFileEntry;
+    uint32              TableIndex = 0;
+    uint32              ErrorCount = 0;
+
+    DestFileEntry.FileNameType = DS_BY_TIME;
+    DestFileEntry.EnableState = DS_ENABLED;
+    DestFileEntry.MaxFileSize = 2048;
+    DestFileEntry.MaxFileAge = 100;
+    DestFileEntry.SequenceCount = 1;
+    DestFileEntry.Compression = 99;
+
+    strncpy (DestFileEntry.Pathname, "path", DS_PATHNAME_BUFSIZE);
+    strncpy (DestFileEntry.Basename, "pathname", DS_BASENAME_BUFSIZE);
+    strncpy (DestFileEntry.Extension, "ext", DS_EXTENSION_BUFSIZE);
+
+    /* Execute the function being tested */
+    Result = DS_TableVerifyDestFileEntry(&DestFileEntry, TableIndex, ErrorCount);
+    
+    /* Verify results */
+    UtAssert_True (Result == FALSE, "Result == FALSE");
+
+    UtAssert_True
+        (Ut_CFE_EVS_EventSent(DS_FIL_TBL_ERR_EID, CFE_EVS_ERROR, "Destination file table verify err: index = 0, compression = 99"),
+        "Destination file table verify err: index = 0, compression = 99");
+
+    UtAssert_True (Ut_CFE_EVS_GetEventQueueDepth() == 1, "Ut_CFE_EVS_GetEventQueueDepth() == 1");
+} /* end DS_TableVerifyDestFileEntry_Test_InvalidCompression */
+
 void DS_TableVerifyFilter_Test_Nominal(void)
 {
     int32               Result;
@@ -1332,6 +1375,32 @@ void DS_TableVerifyCount_Test_Fail(void)
     UtAssert_True (Ut_CFE_EVS_GetEventQueueDepth() == 0, "Ut_CFE_EVS_GetEventQueueDepth() == 0");
 } /* end DS_TableVerifyCount_Test_Fail */
 
+void DS_TableVerifyCompression_Test_Nominal(void)
+{
+    int32   Result;
+
+    /* Execute the function being tested */
+    Result = DS_TableVerifyCompression(DS_COMPRESS_GZIP);
+    
+    /* Verify results */
+    UtAssert_True (Result == TRUE, "Result == TRUE");
+
+    UtAssert_True (Ut_CFE_EVS_GetEventQueueDepth() == 0, "Ut_CFE_EVS_GetEventQueueDepth() == 0");
+} /* end DS_TableVerifyCompression_Test_Nominal */
+
+void DS_TableVerifyCompression_Test_Fail(void)
+{
+    int32   Result;
+
+    /* Execute the function being tested */
+    Result = DS_TableVerifyCompression(DS_COMPRESS_GZIP + 1);
+    
+    /* Verify results */
+    UtAssert_True (Result == FALSE, "Result == FALSE");
+
+    UtAssert_True (Ut_CFE_EVS_GetEventQueueDepth() == 0, "Ut_CFE_EVS_GetEventQueueDepth() == 0");
+} /* end DS_TableVerifyCompression_Test_Fail */
+
 void DS_TableSubscribe_Test(void)
 {
     DS_FilterTable_t  FilterTable;
@@ -1575,6 +1644,7 @@ void DS_Table_Test_AddTestCases(void)
     UtTest_Add(DS_TableVerifyDestFileEntry_Test_InvalidSize, DS_Test_Setup, DS_Test_TearDown, "DS_TableVerifyDestFileEntry_Test_InvalidSize");
     UtTest_Add(DS_TableVerifyDestFileEntry_Test_InvalidAge, DS_Test_Setup, DS_Test_TearDown, "DS_TableVerifyDestFileEntry_Test_InvalidAge");
     UtTest_Add(DS_TableVerifyDestFileEntry_Test_InvalidSequenceCount, DS_Test_Setup, DS_Test_TearDown, "DS_TableVerifyDestFileEntry_Test_InvalidSequenceCount");
+    UtTest_Add(DS_TableVerifyDestFileEntry_Test_InvalidCompression, DS_Test_Setup, DS_Test_TearDown, "DS_TableVerifyDestFileEntry_Test_InvalidCompression");
 
     UtTest_Add(DS_TableVerifyFilter_Test_Nominal, DS_Test_Setup, DS_Test_TearDown, "DS_TableVerifyFilter_Test_Nominal");
     UtTest_Add(DS_TableVerifyFilter_Test_FilterTableVerificationError, DS_Test_Setup, DS_Test_TearDown, "DS_TableVerifyFilter_Test_FilterTableVerificationError");
@@ -1610,6 +1680,9 @@ void DS_Table_Test_AddTestCases(void)
     UtTest_Add(DS_TableVerifyCount_Test_Nominal, DS_Test_Setup, DS_Test_TearDown, "DS_TableVerifyCount_Test_Nominal");
     UtTest_Add(DS_TableVerifyCount_Test_Fail, DS_Test_Setup, DS_Test_TearDown, "DS_TableVerifyCount_Test_Fail");
 
+    UtTest_Add(DS_TableVerifyCompression_Test_Nominal, DS_Test_Setup, DS_Test_TearDown, "DS_TableVerifyCompression_Test_Nominal");
+    UtTest_Add(DS_TableVerifyCompression_Test_Fail, DS_Test_Setup, DS_Test_TearDown, "DS_TableVerifyCompression_Test_Fail");
+
     UtTest_Add(DS_TableSubscribe_Test, DS_Test_Setup, DS_Test_TearDown, "DS_TableSubscribe_Test");
 
     UtTest_Add(DS_TableUnsubscribe_Test, DS_Test_Setup, DS_Test_TearDown, "DS_TableUnsubscribe_Test");
@@ -184,6 +184,19 @@
 */
 #define HS_MAX_MONITORED_EVENTS          16
 
+/** \hscfg Event Monitor Table (EMT) Hash Size
+**
+**  \par Description:
+**       Number of hash buckets used to look up the Event Monitor Table
+**       entries that match an incoming event by its Event ID.  Entries
+**       sharing a bucket are searched in table order.
+**
+**  \par Limits:
+**       This parameter must be a power of two, and should be at least
+**       #HS_MAX_MONITORED_EVENTS to keep the buckets short.
+*/
+#define HS_EMT_HASH_SIZE                 64
+
 /** \hscfg Watchdog Timeout Value
 **
 **  \par Description:
@@ -610,6 +623,41 @@
 #define HS_UTIL_TIME_DIAG_ARRAY_LENGTH         (1<<(HS_UTIL_TIME_DIAG_ARRAY_POWER))
 #define HS_UTIL_TIME_DIAG_ARRAY_MASK           (HS_UTIL_TIME_DIAG_ARRAY_LENGTH - 1)
 
+/** \hscfg CPU Utilization from Task Processor Time (custom)
+**
+**  \par Description:
+**       When true, utilization is measured from the processor time each
+**       task has used (see #OS_TaskGetCpuTime), summed per application
+**       through the ES task table, instead of by counting the cycles of
+**       the Idle Child Task.  The Idle Child Task is then not started, and
+**       the utilization of each application is reported in housekeeping
+**       and checked for hogging against #HS_UTIL_PER_INTERVAL_APP_HOGGING.
+**       If the operating system does not keep processor time per task,
+**       the Idle Child Task is used as before.
+**       Utilization is relative to one processor, so the calibration
+**       parameters are not used in this mode.
+**       Note that these values are only necessarily relevant in the
+**       default hs_custom.c.
+**
+**  \par Limits:
+**       Must be true or false
+*/
+#define HS_UTIL_TASK_CPU_TIME                  true
+
+/** \hscfg CPU Utilization Application Hogging Utils Per Interval (custom)
+**
+**  \par Description:
+**       Number of Utils (counts) used by a single application during one
+**       interval which is considered hogging when #HS_UTIL_TASK_CPU_TIME is
+**       true. A greater number of counts is also considered hogging.
+**       Note that these values are only necessarily relevant in the
+**       default hs_custom.c.
+**
+**  \par Limits:
+**       This parameter can't be larger than #HS_UTIL_PER_INTERVAL_TOTAL.
+*/
+#define HS_UTIL_PER_INTERVAL_APP_HOGGING        9500
+
 
 /** \hscfg Mission specific version number for HS application
 **  
@@ -96,10 +96,7 @@ void HS_AppMain(void)
        */
        if (HS_AppData.CurrentEventMonState == HS_STATE_ENABLED)
        {
-          Status = CFE_SB_SubscribeEx(CFE_EVS_LONG_EVENT_MSG_MID,
-                                      HS_AppData.EventPipe,
-                                      CFE_SB_Default_Qos,
-                                      HS_EVENT_PIPE_DEPTH);
+          Status = HS_SubscribeEvents();
           if (Status != CFE_SUCCESS)
           {
              CFE_EVS_SendEvent(HS_SUB_EVS_ERR_EID, CFE_EVS_EventType_ERROR,
@@ -207,6 +204,7 @@ void HS_AppMain(void)
 int32 HS_AppInit(void)
 {
     int32       Status = CFE_SUCCESS;
+    uint32      i = 0;
 
     /* 
     ** Initialize operating data to default states...
@@ -232,6 +230,11 @@ int32 HS_AppInit(void)
     HS_AppData.CDSState = HS_STATE_ENABLED;
 
     HS_AppData.MaxCPUHoggingTime = HS_UTIL_HOGGING_TIMEOUT;
+
+    for (i = 0; i < HS_EMT_HASH_SIZE; i++)
+    {
+        HS_AppData.EMIndexHead[i] = HS_EMT_INDEX_END;
+    }
     
 
     /* 
@@ -57,6 +57,13 @@
 
 #define HS_TBL_VAL_ERR  (-1)
 
+/**
+** \name HS Event Monitor Index */
+/** \{ */
+#define HS_EMT_INDEX_END     0xFFFFFFFF  /**< \brief End of an Event Monitor index chain */
+#define HS_EMT_HASH(EventID) ((((uint32)(EventID) * 0x9E3779B1) >> 16) & (HS_EMT_HASH_SIZE - 1)) /**< \brief Index chain of an Event ID */
+/** \} */
+
 /************************************************************************
 ** Type Definitions
 *************************************************************************/
@@ -114,6 +121,9 @@ typedef struct
 
     uint32   AppMonLastExeCount[HS_MAX_MONITORED_APPS];/**< \brief Last Execution Count for application being checked */
 
+    uint32   AppMonAppId[HS_MAX_MONITORED_APPS];/**< \brief Resolved AppId for application being checked */
+    uint32   AppMonGeneration[HS_MAX_MONITORED_APPS];/**< \brief ES generation of the resolved AppId, 0 if unresolved */
+
     uint32   AlivenessCounter;/**< \brief Current Count towards the CPU Aliveness output period */
 
     uint32   MsgActExec; /**< \brief Number of Software Bus Message Actions Executed */
@@ -141,6 +151,10 @@ typedef struct
     HS_EMTEntry_t   *EMTablePtr;/**< \brief Ptr to Events Monitor table entry */
     HS_MATEntry_t   *MATablePtr;/**< \brief Ptr to Message Actions table entry */
 
+    uint32   EMIndexHead[HS_EMT_HASH_SIZE];/**< \brief First EventMon entry for each Event ID hash */
+    uint32   EMIndexNext[HS_MAX_MONITORED_EVENTS];/**< \brief Next EventMon entry with the same Event ID hash */
+    uint32   EMIndexNameHash[HS_MAX_MONITORED_EVENTS];/**< \brief Hash of the AppName of each EventMon entry */
+
     CFE_ES_CDSHandle_t MyCDSHandle;/* \brief Handle to CDS memory block */
     HS_CDSData_t       CDSData;  /* \brief Copy of Critical Data */
 
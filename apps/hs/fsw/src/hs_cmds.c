@@ -236,6 +236,13 @@ void HS_HousekeepingReq(CFE_SB_MsgPtr_t MessagePtr)
         HS_AppData.HkPacket.UtilCpuAvg = HS_AppData.UtilCpuAvg;
         HS_AppData.HkPacket.UtilCpuPeak = HS_AppData.UtilCpuPeak;
 
+#if HS_UTIL_TASK_CPU_TIME == true
+        for(TableIndex = 0; TableIndex < CFE_PLATFORM_ES_MAX_APPLICATIONS; TableIndex++)
+        {
+            HS_AppData.HkPacket.AppUtil[TableIndex] = HS_CustomData.AppUtil[TableIndex];
+        }
+#endif
+
 #if HS_MAX_EXEC_CNT_SLOTS != 0
         /*
         ** Add the execution counters
@@ -441,10 +448,7 @@ void HS_EnableEventMonCmd(CFE_SB_MsgPtr_t MessagePtr)
        if (HS_AppData.CurrentEventMonState == HS_STATE_DISABLED)
        {
 
-          Status = CFE_SB_SubscribeEx(CFE_EVS_LONG_EVENT_MSG_MID,
-                                      HS_AppData.EventPipe,
-                                      CFE_SB_Default_Qos,
-                                      HS_EVENT_PIPE_DEPTH);
+          Status = HS_SubscribeEvents();
 
           if (Status != CFE_SUCCESS)
           {
@@ -490,8 +494,7 @@ void HS_DisableEventMonCmd(CFE_SB_MsgPtr_t MessagePtr)
        if (HS_AppData.CurrentEventMonState == HS_STATE_ENABLED)
        {
 
-          Status =  CFE_SB_Unsubscribe ( CFE_EVS_LONG_EVENT_MSG_MID,
-                                         HS_AppData.EventPipe );
+          Status = HS_UnsubscribeEvents();
 
           if (Status != CFE_SUCCESS)
           {
@@ -741,6 +744,14 @@ void HS_AcquirePointers(void)
     */
     Status = CFE_TBL_GetAddress((void *)&HS_AppData.EMTablePtr, HS_AppData.EMTableHandle);
 
+    /*
+    ** If there is a new table, rebuild the index (EventMon)
+    */
+    if (Status == CFE_TBL_INFO_UPDATED)
+    {
+        HS_EventMonIndexRefresh();
+    }
+
     /*
     ** If Address acquisition fails and currently enabled, report and disable (EventMon)
     */
@@ -758,8 +769,7 @@ void HS_AcquirePointers(void)
 
             if (HS_AppData.CurrentEventMonState == HS_STATE_ENABLED)
             {
-                Status =  CFE_SB_Unsubscribe ( CFE_EVS_LONG_EVENT_MSG_MID,
-                                               HS_AppData.EventPipe );
+                Status = HS_UnsubscribeEvents();
 
                 if (Status != CFE_SUCCESS)
                 {
@@ -899,6 +909,7 @@ void HS_AppMonStatusRefresh(void)
     for (TableIndex = 0; TableIndex < HS_MAX_MONITORED_APPS; TableIndex++ )
     {
         HS_AppData.AppMonLastExeCount[TableIndex] = 0;
+        HS_AppData.AppMonGeneration[TableIndex] = 0;
 
         if ((HS_AppData.AMTablePtr[TableIndex].CycleCount == 0) ||
             (HS_AppData.AMTablePtr[TableIndex].ActionType == HS_AMT_ACT_NOACT))
@@ -918,6 +929,99 @@ void HS_AppMonStatusRefresh(void)
 
 } /* end HS_AppMonStatusRefresh */
 
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Refresh EventMon Index (on Table Update)                        */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void HS_EventMonIndexRefresh(void)
+{
+    uint32  TableIndex = 0;
+    uint32  HashIndex = 0;
+
+    /*
+    ** Empty all chains
+    */
+    for (HashIndex = 0; HashIndex < HS_EMT_HASH_SIZE; HashIndex++)
+    {
+        HS_AppData.EMIndexHead[HashIndex] = HS_EMT_INDEX_END;
+    }
+
+    /*
+    ** Push entries with an action onto the front of their chain, last
+    ** entry first, so each chain is searched in table order
+    */
+    for (TableIndex = HS_MAX_MONITORED_EVENTS; TableIndex > 0; TableIndex-- )
+    {
+        HS_AppData.EMIndexNext[TableIndex - 1] = HS_EMT_INDEX_END;
+
+        if (HS_AppData.EMTablePtr[TableIndex - 1].ActionType != HS_EMT_ACT_NOACT)
+        {
+            HashIndex = HS_EMT_HASH(HS_AppData.EMTablePtr[TableIndex - 1].EventID);
+
+            HS_AppData.EMIndexNameHash[TableIndex - 1] = HS_AppNameHash(HS_AppData.EMTablePtr[TableIndex - 1].AppName);
+            HS_AppData.EMIndexNext[TableIndex - 1] = HS_AppData.EMIndexHead[HashIndex];
+            HS_AppData.EMIndexHead[HashIndex] = TableIndex - 1;
+        }
+    }
+
+    return;
+
+} /* end HS_EventMonIndexRefresh */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Subscribe to Event Messages (long and short format)             */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+int32 HS_SubscribeEvents(void)
+{
+    int32 Status = CFE_SUCCESS;
+
+    Status = CFE_SB_SubscribeEx(CFE_EVS_LONG_EVENT_MSG_MID,
+                                HS_AppData.EventPipe,
+                                CFE_SB_Default_Qos,
+                                HS_EVENT_PIPE_DEPTH);
+
+    if (Status == CFE_SUCCESS)
+    {
+        Status = CFE_SB_SubscribeEx(CFE_EVS_SHORT_EVENT_MSG_MID,
+                                    HS_AppData.EventPipe,
+                                    CFE_SB_Default_Qos,
+                                    HS_EVENT_PIPE_DEPTH);
+
+        if (Status != CFE_SUCCESS)
+        {
+            CFE_SB_Unsubscribe(CFE_EVS_LONG_EVENT_MSG_MID, HS_AppData.EventPipe);
+        }
+    }
+
+    return Status;
+
+} /* end HS_SubscribeEvents */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Unsubscribe from Event Messages (long and short format)         */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+int32 HS_UnsubscribeEvents(void)
+{
+    int32 Status = CFE_SUCCESS;
+    int32 ShortStatus = CFE_SUCCESS;
+
+    Status = CFE_SB_Unsubscribe(CFE_EVS_LONG_EVENT_MSG_MID, HS_AppData.EventPipe);
+    ShortStatus = CFE_SB_Unsubscribe(CFE_EVS_SHORT_EVENT_MSG_MID, HS_AppData.EventPipe);
+
+    if (Status == CFE_SUCCESS)
+    {
+        Status = ShortStatus;
+    }
+
+    return Status;
+
+} /* end HS_UnsubscribeEvents */
+
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
 /* Refresh MsgActs Status (on Table Update or Enable)              */
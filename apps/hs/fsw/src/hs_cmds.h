@@ -321,6 +321,59 @@ void HS_SetMaxResetsCmd(CFE_SB_MsgPtr_t MessagePtr);
 *************************************************************************/
 void HS_AppMonStatusRefresh(void);
 
+/************************************************************************/
+/** \brief Refresh Event Monitor Index
+**
+**  \par Description
+**       This function gets called when HS detects that a new
+**       events monitor table has been loaded: it rebuilds the
+**       index used to find the entries matching an event by its
+**       Event ID and Application Name.
+**
+**  \par Assumptions, External Events, and Notes:
+**       Entries with no action are left out of the index.  Entries
+**       that share an Event ID hash are chained in table order.
+**
+*************************************************************************/
+void HS_EventMonIndexRefresh(void);
+
+/************************************************************************/
+/** \brief Subscribe to Event Messages
+**
+**  \par Description
+**       Subscribes the event pipe to both the long and short format
+**       event messages, so events are monitored whichever format
+**       EVS is currently sending.
+**
+**  \par Assumptions, External Events, and Notes:
+**       None
+**
+**  \returns
+**  \retcode #CFE_SUCCESS  \retdesc \copydoc CFE_SUCCESS \endcode
+**  \retstmt Return codes from #CFE_SB_SubscribeEx \endcode
+**  \endreturns
+**
+*************************************************************************/
+int32 HS_SubscribeEvents(void);
+
+/************************************************************************/
+/** \brief Unsubscribe from Event Messages
+**
+**  \par Description
+**       Unsubscribes the event pipe from both the long and short
+**       format event messages.
+**
+**  \par Assumptions, External Events, and Notes:
+**       Both unsubscribes are attempted even if the first one fails.
+**
+**  \returns
+**  \retcode #CFE_SUCCESS  \retdesc \copydoc CFE_SUCCESS \endcode
+**  \retstmt Return codes from #CFE_SB_Unsubscribe \endcode
+**  \endreturns
+**
+*************************************************************************/
+int32 HS_UnsubscribeEvents(void);
+
 /************************************************************************/
 /** \brief Refresh Message Actions Status
 **
@@ -99,35 +99,55 @@ void HS_IdleTask(void)
 int32 HS_CustomInit(void)
 {
     int32 Status = CFE_SUCCESS;
+#if HS_UTIL_TASK_CPU_TIME == true
+    OS_time_t CpuTime;
 
     /*
-    ** Spawn the Idle Task
+    ** Use the processor time of each task when the OS keeps it
     */
-    Status = CFE_ES_CreateChildTask(&HS_CustomData.IdleTaskID,      
-                                     HS_IDLE_TASK_NAME,       
-                                     HS_IdleTask,         
-                                     HS_IDLE_TASK_STACK_PTR,  
-                                     HS_IDLE_TASK_STACK_SIZE, 
-                                     HS_IDLE_TASK_PRIORITY,   
-                                     HS_IDLE_TASK_FLAGS);     
-     
-    if(Status != CFE_SUCCESS)
+    HS_CustomData.UtilTaskCpuTime = (OS_TaskGetCpuTime(OS_TaskGetId(), &CpuTime) == OS_SUCCESS);
+    HS_CustomData.TotalUtil = 0;
+    HS_CustomData.LastSampleTime = 0;
+    HS_CustomData.TotalIntervalTime = 0;
+    CFE_PSP_MemSet(HS_CustomData.TaskId, 0, sizeof(HS_CustomData.TaskId));
+    CFE_PSP_MemSet(HS_CustomData.TaskCpuTime, 0, sizeof(HS_CustomData.TaskCpuTime));
+    CFE_PSP_MemSet(HS_CustomData.AppUtil, 0, sizeof(HS_CustomData.AppUtil));
+    CFE_PSP_MemSet(HS_CustomData.AppHoggingTime, 0, sizeof(HS_CustomData.AppHoggingTime));
+#else
+    HS_CustomData.UtilTaskCpuTime = false;
+#endif
+
+    if (HS_CustomData.UtilTaskCpuTime == false)
     {
-        CFE_EVS_SendEvent(HS_CR_CHILD_TASK_ERR_EID, CFE_EVS_EventType_ERROR,
-                          "Error Creating Child Task for CPU Utilization Monitoring,RC=0x%08X",
-                          (unsigned int)Status);
-        return (Status);
-    }
+        /*
+        ** Spawn the Idle Task
+        */
+        Status = CFE_ES_CreateChildTask(&HS_CustomData.IdleTaskID,      
+                                         HS_IDLE_TASK_NAME,       
+                                         HS_IdleTask,         
+                                         HS_IDLE_TASK_STACK_PTR,  
+                                         HS_IDLE_TASK_STACK_SIZE, 
+                                         HS_IDLE_TASK_PRIORITY,   
+                                         HS_IDLE_TASK_FLAGS);     
+         
+        if(Status != CFE_SUCCESS)
+        {
+            CFE_EVS_SendEvent(HS_CR_CHILD_TASK_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "Error Creating Child Task for CPU Utilization Monitoring,RC=0x%08X",
+                              (unsigned int)Status);
+            return (Status);
+        }
 
-    /*
-    ** Connect to CFE TIME's time reference marker (typically 1 Hz) for Idle Task Marking
-    */
-    Status = CFE_TIME_RegisterSynchCallback((CFE_TIME_SynchCallbackPtr_t)&HS_MarkIdleCallback);
-    if (Status != CFE_SUCCESS)
-    {
-        CFE_EVS_SendEvent(HS_CR_SYNC_CALLBACK_ERR_EID, CFE_EVS_EventType_ERROR,
-                          "Error Registering Sync Callback for CPU Utilization Monitoring,RC=0x%08X",
-                          (unsigned int)Status);
+        /*
+        ** Connect to CFE TIME's time reference marker (typically 1 Hz) for Idle Task Marking
+        */
+        Status = CFE_TIME_RegisterSynchCallback((CFE_TIME_SynchCallbackPtr_t)&HS_MarkIdleCallback);
+        if (Status != CFE_SUCCESS)
+        {
+            CFE_EVS_SendEvent(HS_CR_SYNC_CALLBACK_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "Error Registering Sync Callback for CPU Utilization Monitoring,RC=0x%08X",
+                              (unsigned int)Status);
+        }
     }
 
     HS_CustomData.UtilMult1 = HS_UTIL_CONV_MULT1;
@@ -154,6 +174,14 @@ int32 HS_CustomInit(void)
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 void HS_CustomCleanup(void)
 {
+    if (HS_CustomData.UtilTaskCpuTime == true)
+    {
+        /*
+        ** No Idle Task was started
+        */
+        return;
+    }
+
     /*
     ** Unregister the Sync Callback for CPU Monitoring
     */
@@ -234,12 +262,172 @@ void HS_CustomMonitorUtilization(void)
     HS_CustomData.UtilCycleCounter++;
     if (HS_CustomData.UtilCycleCounter >= HS_UTIL_CYCLES_PER_INTERVAL)
     {
+#if HS_UTIL_TASK_CPU_TIME == true
+        if (HS_CustomData.UtilTaskCpuTime == true)
+        {
+            HS_UtilizationSample();
+            HS_UtilizationAppHogging();
+        }
+#endif
         HS_MonitorUtilization();
         HS_CustomData.UtilCycleCounter = 0;
     }
 
 } /* End of HS_CustomMonitorUtilization() */
 
+#if HS_UTIL_TASK_CPU_TIME == true
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Sample the Processor Time of all Tasks                          */
+/*                                                                 */
+/* NOTE: For complete prolog information, see 'hs_custom.h'        */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void HS_UtilizationSample(void)
+{
+    OS_time_t PSPTime = {0,0};
+    uint64    ThisSampleTime = 0;
+    uint64    Elapsed = 0;
+    uint64    Util = 0;
+    uint32    AppId = 0;
+
+    CFE_PSP_GetTime(&PSPTime);
+    ThisSampleTime = ((uint64)PSPTime.seconds * 1000000) + PSPTime.microsecs;
+    Elapsed = ThisSampleTime - HS_CustomData.LastSampleTime;
+
+    /*
+    ** Add up the processor time used by each task since the previous sample
+    */
+    HS_CustomData.TotalIntervalTime = 0;
+    CFE_PSP_MemSet(HS_CustomData.AppIntervalTime, 0, sizeof(HS_CustomData.AppIntervalTime));
+
+    OS_ForEachObject(0, HS_UtilizationSampleTask, NULL);
+
+    if ((HS_CustomData.LastSampleTime != 0) && (Elapsed != 0))
+    {
+        /*
+        ** Convert to Utils of the elapsed interval, relative to one processor
+        */
+        Util = (HS_CustomData.TotalIntervalTime * HS_UTIL_PER_INTERVAL_TOTAL) / Elapsed;
+        HS_CustomData.TotalUtil = (Util > HS_UTIL_PER_INTERVAL_TOTAL) ? HS_UTIL_PER_INTERVAL_TOTAL : (uint32)Util;
+
+        for (AppId = 0; AppId < CFE_PLATFORM_ES_MAX_APPLICATIONS; AppId++)
+        {
+            Util = (HS_CustomData.AppIntervalTime[AppId] * HS_UTIL_PER_INTERVAL_TOTAL) / Elapsed;
+            HS_CustomData.AppUtil[AppId] = (Util > HS_UTIL_PER_INTERVAL_TOTAL) ? HS_UTIL_PER_INTERVAL_TOTAL : (uint32)Util;
+        }
+    }
+
+    HS_CustomData.LastSampleTime = ThisSampleTime;
+
+    return;
+
+} /* end HS_UtilizationSample */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Account the Processor Time of one Task                          */
+/*                                                                 */
+/* NOTE: For complete prolog information, see 'hs_custom.h'        */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void HS_UtilizationSampleTask(uint32 ObjectId, void *CallbackArg)
+{
+    OS_time_t         CpuTime = {0,0};
+    CFE_ES_TaskInfo_t TaskInfo;
+    uint32            TaskIndex = 0;
+    uint64            TaskTime = 0;
+    uint64            Delta = 0;
+
+    if ((OS_IdentifyObject(ObjectId) != OS_OBJECT_TYPE_OS_TASK) ||
+        (OS_ConvertToArrayIndex(ObjectId, &TaskIndex) != OS_SUCCESS) ||
+        (TaskIndex >= OS_MAX_TASKS) ||
+        (OS_TaskGetCpuTime(ObjectId, &CpuTime) != OS_SUCCESS))
+    {
+        return;
+    }
+
+    TaskTime = ((uint64)CpuTime.seconds * 1000000) + CpuTime.microsecs;
+
+    if (HS_CustomData.TaskId[TaskIndex] != ObjectId)
+    {
+        /*
+        ** First time this task is seen: all of its time is new
+        */
+        HS_CustomData.TaskId[TaskIndex] = ObjectId;
+        HS_CustomData.TaskCpuTime[TaskIndex] = 0;
+        HS_CustomData.TaskAppId[TaskIndex] = HS_UTIL_NO_APP;
+    }
+
+    /*
+    ** A task sampled before ES registered it has no application yet, so
+    ** the lookup is repeated until it succeeds; after that it is kept
+    ** for as long as the task slot holds the same task
+    */
+    if ((HS_CustomData.TaskAppId[TaskIndex] == HS_UTIL_NO_APP) &&
+        (CFE_ES_GetTaskInfo(&TaskInfo, ObjectId) == CFE_SUCCESS) &&
+        (TaskInfo.AppId < CFE_PLATFORM_ES_MAX_APPLICATIONS))
+    {
+        HS_CustomData.TaskAppId[TaskIndex] = TaskInfo.AppId;
+    }
+
+    Delta = TaskTime - HS_CustomData.TaskCpuTime[TaskIndex];
+    HS_CustomData.TaskCpuTime[TaskIndex] = TaskTime;
+
+    HS_CustomData.TotalIntervalTime += Delta;
+
+    if (HS_CustomData.TaskAppId[TaskIndex] != HS_UTIL_NO_APP)
+    {
+        HS_CustomData.AppIntervalTime[HS_CustomData.TaskAppId[TaskIndex]] += Delta;
+    }
+
+    return;
+
+} /* end HS_UtilizationSampleTask */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Check each Application for CPU Hogging                          */
+/*                                                                 */
+/* NOTE: For complete prolog information, see 'hs_custom.h'        */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void HS_UtilizationAppHogging(void)
+{
+    char   AppName[OS_MAX_API_NAME];
+    uint32 AppId = 0;
+
+    for (AppId = 0; AppId < CFE_PLATFORM_ES_MAX_APPLICATIONS; AppId++)
+    {
+        if ((HS_CustomData.AppUtil[AppId] >= HS_UTIL_PER_INTERVAL_APP_HOGGING) &&
+            (HS_AppData.CurrentCPUHogState == HS_STATE_ENABLED))
+        {
+            HS_CustomData.AppHoggingTime[AppId]++;
+
+            if (HS_CustomData.AppHoggingTime[AppId] == HS_AppData.MaxCPUHoggingTime)
+            {
+                if (CFE_ES_GetAppName(AppName, AppId, sizeof(AppName)) != CFE_SUCCESS)
+                {
+                    AppName[0] = '\0';
+                }
+
+                CFE_EVS_SendEvent(HS_APP_HOGGING_ERR_EID, CFE_EVS_EventType_ERROR,
+                                  "CPU Hogging Detected: App %s used %d of %d Utils",
+                                  AppName, (int)HS_CustomData.AppUtil[AppId], (int)HS_UTIL_PER_INTERVAL_TOTAL);
+                CFE_ES_WriteToSysLog("HS App: CPU Hogging Detected: App %s\n", AppName);
+            }
+        }
+        else
+        {
+            HS_CustomData.AppHoggingTime[AppId] = 0;
+        }
+    }
+
+    return;
+
+} /* end HS_UtilizationAppHogging */
+#endif
+
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
 /* Processes any additional commands                               */
@@ -408,7 +596,11 @@ int32 HS_CustomGetUtil(void)
 {
    int32 CurrentUtil = 0;
 
-   if (HS_CustomData.UtilDiv != 0)
+   if (HS_CustomData.UtilTaskCpuTime == true)
+   {
+      CurrentUtil = HS_CustomData.TotalUtil;
+   }
+   else if (HS_CustomData.UtilDiv != 0)
    {
       CurrentUtil = HS_UTIL_PER_INTERVAL_TOTAL - (((HS_CustomData.LastIdleTaskInterval * HS_CustomData.UtilMult1) 
                                                   / HS_CustomData.UtilDiv) 
@@ -31,12 +31,15 @@
 ** Includes
 *************************************************************************/
 #include "cfe.h"
+#include "cfe_platform_cfg.h"
 
 /*************************************************************************
 ** Constants
 *************************************************************************/
 #define HS_UTIL_DIAG_REPORTS 4
 
+#define HS_UTIL_NO_APP       0xFFFFFFFF   /**< \brief Task slot not owned by a cFE application */
+
 /*
 ** Command Codes
 ** Custom codes must not conflict with those in hs_msgdefs.h
@@ -217,6 +220,23 @@
 */
 #define HS_SET_UTIL_DIAG_DBG_EID 106
 
+/** \brief <tt> 'CPU Hogging Detected: App \%s used \%d of \%d Utils' </tt>
+**  \event <tt> 'CPU Hogging Detected: App \%s used \%d of \%d Utils' </tt>
+**
+**  \par Type: ERROR
+**
+**  \par Cause:
+**
+**  This event message is issued when CFS Health and Safety measures utilization
+**  from task processor time (#HS_UTIL_TASK_CPU_TIME) and a single application
+**  has used at least #HS_UTIL_PER_INTERVAL_APP_HOGGING Utils for the hogging
+**  timeout number of intervals in a row.
+**
+**  The \c App field contains the name of the application, followed by the
+**  Utils it used in the last interval and the Utils per full interval.
+*/
+#define HS_APP_HOGGING_ERR_EID 107
+
 /*************************************************************************
 ** Command Structure Definitions
 *************************************************************************/
@@ -256,6 +276,19 @@ typedef struct
 
    int32   IdleTaskRunStatus;/**< \brief HS Idle Task Run Status */
   uint32   IdleTaskID;/**< \brief HS Idle Task Task ID */
+
+  bool     UtilTaskCpuTime;/**< \brief Utilization is measured from task processor time */
+  uint32   TotalUtil;/**< \brief Utils used by all tasks during the previous interval */
+  uint64   LastSampleTime;/**< \brief Time of the previous processor time sample, in microseconds */
+  uint64   TotalIntervalTime;/**< \brief Processor time used by all tasks during the interval, in microseconds */
+
+  uint32   TaskId[OS_MAX_TASKS];/**< \brief OSAL task ID last seen in each task slot */
+  uint32   TaskAppId[OS_MAX_TASKS];/**< \brief Application owning each task slot, or #HS_UTIL_NO_APP */
+  uint64   TaskCpuTime[OS_MAX_TASKS];/**< \brief Processor time of each task at the previous sample, in microseconds */
+
+  uint64   AppIntervalTime[CFE_PLATFORM_ES_MAX_APPLICATIONS];/**< \brief Processor time used by each application during the interval */
+  uint32   AppUtil[CFE_PLATFORM_ES_MAX_APPLICATIONS];/**< \brief Utils used by each application during the previous interval */
+  uint32   AppHoggingTime[CFE_PLATFORM_ES_MAX_APPLICATIONS];/**< \brief Consecutive intervals each application has been hogging */
  
 } HS_CustomData_t;
 
@@ -464,6 +497,54 @@ void HS_SetUtilParamsCmd(CFE_SB_MsgPtr_t MessagePtr);
 *************************************************************************/
 void HS_SetUtilDiagCmd(CFE_SB_MsgPtr_t MessagePtr);
 
+/************************************************************************/
+/** \brief Sample the Processor Time of all Tasks
+**
+**  \par Description
+**       Reads the processor time used by every task since the previous
+**       sample, adds it up per application, and converts the totals to
+**       Utils of the elapsed interval. Called once per utilization
+**       interval when #HS_UTIL_TASK_CPU_TIME is true.
+**
+**  \par Assumptions, External Events, and Notes:
+**       The first sample only records the starting point.
+**
+*************************************************************************/
+void HS_UtilizationSample(void);
+
+/************************************************************************/
+/** \brief Account the Processor Time of one Task
+**
+**  \par Description
+**       Callback for #OS_ForEachObject used by #HS_UtilizationSample.
+**       The owning application of a task is looked up in the ES task table
+**       until the lookup succeeds, and then kept until its slot is reused.
+**       A task sampled before ES registered it is therefore picked up later.
+**
+**  \par Assumptions, External Events, and Notes:
+**       Objects other than tasks are ignored.
+**
+**  \param [in]   ObjectId      OSAL ID of the object
+**
+**  \param [in]   CallbackArg   Not used
+**
+*************************************************************************/
+void HS_UtilizationSampleTask(uint32 ObjectId, void *CallbackArg);
+
+/************************************************************************/
+/** \brief Check each Application for CPU Hogging
+**
+**  \par Description
+**       Counts the intervals that each application has used at least
+**       #HS_UTIL_PER_INTERVAL_APP_HOGGING Utils, and reports an application
+**       once the count reaches the hogging timeout.
+**
+**  \par Assumptions, External Events, and Notes:
+**       None
+**
+*************************************************************************/
+void HS_UtilizationAppHogging(void);
+
 
 #endif /* _hs_custom_ */
 
@@ -44,15 +44,14 @@
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 void HS_MonitorApplications(void)
 {
-    CFE_ES_AppInfo_t   AppInfo;
     uint32             AppId = 0;
+    uint32             ExecutionCounter = 0;
+    uint32             Generation = 0;
     int32              Status = CFE_SUCCESS;
     uint32             TableIndex = 0;
     uint16             ActionType = 0;
     uint32             MsgActsIndex = 0;
 
-    CFE_PSP_MemSet(&AppInfo, 0, sizeof(CFE_ES_AppInfo_t));
-
     for(TableIndex = 0; TableIndex < HS_MAX_MONITORED_APPS; TableIndex++)
     {
 
@@ -64,40 +63,73 @@ void HS_MonitorApplications(void)
         if((ActionType != HS_AMT_ACT_NOACT) &&
            (HS_AppData.AppMonCheckInCountdown[TableIndex] != 0))
         {
-            Status = CFE_ES_GetAppIDByName(&AppId, HS_AppData.AMTablePtr[TableIndex].AppName);
+            AppId = HS_AppData.AppMonAppId[TableIndex];
+            Status = CFE_ES_ERR_APPID;
 
-            if (Status == CFE_SUCCESS)
+            /*
+            ** Read the counter through the AppId resolved earlier, as long as
+            ** ES still holds the same instance of the App under it
+            */
+            if (HS_AppData.AppMonGeneration[TableIndex] != 0)
             {
-                Status = CFE_ES_GetAppInfo(&AppInfo, AppId);
+                Status = CFE_ES_GetAppExecCounter(AppId, &ExecutionCounter, &Generation);
+
+                if ((Status == CFE_SUCCESS) &&
+                    (Generation != HS_AppData.AppMonGeneration[TableIndex]))
+                {
+                    Status = CFE_ES_ERR_APPID;
+                }
             }
-            else if(HS_AppData.AppMonCheckInCountdown[TableIndex] == HS_AppData.AMTablePtr[TableIndex].CycleCount)
+
+            /*
+            ** Otherwise (first check after a table load, or the App was
+            ** restarted or deleted) resolve the App by name
+            */
+            if (Status != CFE_SUCCESS)
             {
-                /*
-                ** Only send an error event the first time the App fails to resolve
-                */
-                CFE_EVS_SendEvent(HS_APPMON_APPNAME_ERR_EID, CFE_EVS_EventType_ERROR,
-                                 "App Monitor App Name not found: APP:(%s)",
-                                  HS_AppData.AMTablePtr[TableIndex].AppName);
-            }
-            else {
-                /* For repeated errors, send a debug event */
-                CFE_EVS_SendEvent(HS_APPMON_APPNAME_DBG_EID, CFE_EVS_EventType_DEBUG,
-                                 "App Monitor App Name not found: APP:(%s)",
-                                  HS_AppData.AMTablePtr[TableIndex].AppName);
+                HS_AppData.AppMonGeneration[TableIndex] = 0;
+
+                Status = CFE_ES_GetAppIDByName(&AppId, HS_AppData.AMTablePtr[TableIndex].AppName);
 
+                if (Status == CFE_SUCCESS)
+                {
+                    Status = CFE_ES_GetAppExecCounter(AppId, &ExecutionCounter, &Generation);
+
+                    if (Status == CFE_SUCCESS)
+                    {
+                        HS_AppData.AppMonAppId[TableIndex] = AppId;
+                        HS_AppData.AppMonGeneration[TableIndex] = Generation;
+                    }
+                }
+                else if(HS_AppData.AppMonCheckInCountdown[TableIndex] == HS_AppData.AMTablePtr[TableIndex].CycleCount)
+                {
+                    /*
+                    ** Only send an error event the first time the App fails to resolve
+                    */
+                    CFE_EVS_SendEvent(HS_APPMON_APPNAME_ERR_EID, CFE_EVS_EventType_ERROR,
+                                     "App Monitor App Name not found: APP:(%s)",
+                                      HS_AppData.AMTablePtr[TableIndex].AppName);
+                }
+                else {
+                    /* For repeated errors, send a debug event */
+                    CFE_EVS_SendEvent(HS_APPMON_APPNAME_DBG_EID, CFE_EVS_EventType_DEBUG,
+                                     "App Monitor App Name not found: APP:(%s)",
+                                      HS_AppData.AMTablePtr[TableIndex].AppName);
+
+                }
             }
 
             /*
             ** Failure to get an execution counter is not considered an automatic failure (or eventworthy)
             */
             if((Status == CFE_SUCCESS) &&
-               (HS_AppData.AppMonLastExeCount[TableIndex] != AppInfo.ExecutionCounter))
+               (HS_AppData.AppMonLastExeCount[TableIndex] != ExecutionCounter))
             {
                 /*
                 ** Set the current count, and reset the timeout
                 */
                 HS_AppData.AppMonCheckInCountdown[TableIndex] = HS_AppData.AMTablePtr[TableIndex].CycleCount;
-                HS_AppData.AppMonLastExeCount[TableIndex] = AppInfo.ExecutionCounter;
+                HS_AppData.AppMonLastExeCount[TableIndex] = ExecutionCounter;
             }
             else
             {
@@ -232,26 +264,45 @@ void HS_MonitorApplications(void)
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 void HS_MonitorEvent(CFE_SB_MsgPtr_t MessagePtr)
 {
-    CFE_EVS_LongEventTlm_t  *EventPtr = NULL;
+    CFE_EVS_PacketID_t  *PacketIDPtr = NULL;
     uint32 TableIndex = 0;
     int32  Status = CFE_SUCCESS;
     uint32 AppId = 0;
     uint16 ActionType = 0;
     uint32 MsgActsIndex = 0;
+    uint32 NameHash = 0;
+    bool   NameHashed = false;
+
+    /*
+    ** The packet ID leads the payload of both the long and short event formats
+    */
+    PacketIDPtr = &((CFE_EVS_ShortEventTlm_t *)MessagePtr)->Payload.PacketID;
 
-    EventPtr = ((CFE_EVS_LongEventTlm_t *)MessagePtr);
+    /*
+    ** Only the entries indexed under this event ID's hash can match
+    */
+    TableIndex = HS_AppData.EMIndexHead[HS_EMT_HASH(PacketIDPtr->EventID)];
 
-    for(TableIndex = 0; TableIndex < HS_MAX_MONITORED_EVENTS; TableIndex++)
+    while (TableIndex != HS_EMT_INDEX_END)
     {
         ActionType = HS_AppData.EMTablePtr[TableIndex].ActionType;
 
         /*
-        ** Check this Event Monitor if it has an action, and the event IDs match
+        ** Check this Event Monitor if the event IDs match
         */
-        if ((ActionType != HS_EMT_ACT_NOACT) &&
-            (HS_AppData.EMTablePtr[TableIndex].EventID == EventPtr->Payload.PacketID.EventID))
+        if (HS_AppData.EMTablePtr[TableIndex].EventID == PacketIDPtr->EventID)
         {
-            if ( strncmp(HS_AppData.EMTablePtr[TableIndex].AppName, EventPtr->Payload.PacketID.AppName, OS_MAX_API_NAME) == 0 )
+            /*
+            ** Hash the event's AppName once, and only compare names when the hashes agree
+            */
+            if (NameHashed == false)
+            {
+                NameHash = HS_AppNameHash(PacketIDPtr->AppName);
+                NameHashed = true;
+            }
+
+            if ((HS_AppData.EMIndexNameHash[TableIndex] == NameHash) &&
+                (strncmp(HS_AppData.EMTablePtr[TableIndex].AppName, PacketIDPtr->AppName, OS_MAX_API_NAME) == 0))
             {
 
                 /*
@@ -378,7 +429,9 @@ void HS_MonitorEvent(CFE_SB_MsgPtr_t MessagePtr)
 
         } /* end EventID comparison */
 
-    } /* end for loop */
+        TableIndex = HS_AppData.EMIndexNext[TableIndex];
+
+    } /* end while loop */
 
     return;
 
@@ -45,7 +45,10 @@
 **       action is taken.
 **
 **  \par Assumptions, External Events, and Notes:
-**       None
+**       Each application is looked up by name only on its first check
+**       after the table is loaded or monitoring is enabled, and again
+**       whenever ES reports that the AppId no longer holds the same
+**       instance of the application (e.g. after a restart).
 **
 *************************************************************************/
 void HS_MonitorApplications(void);
@@ -59,7 +62,9 @@ void HS_MonitorApplications(void);
 **       taken.
 **
 **  \par Assumptions, External Events, and Notes:
-**       None
+**       Only the Event Monitor entries indexed under the event's Event ID
+**       by #HS_EventMonIndexRefresh are searched.  The message may be
+**       either a long or a short format event.
 **
 **  \param [in]   MessagePtr   A #CFE_SB_MsgPtr_t pointer that
 **                             references the software bus message
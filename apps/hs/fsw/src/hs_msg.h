@@ -39,6 +39,7 @@
 #include "hs_msgdefs.h"
 #include "hs_platform_cfg.h"
 #include "cfe.h"
+#include "cfe_platform_cfg.h"
 
 /************************************************************************
 ** Macro Definitions
@@ -120,6 +121,10 @@ typedef struct
     uint32    ExeCounts[HS_MAX_EXEC_CNT_SLOTS]; /**< \hstlmmnemonic \HS_EXECUTIONCTR
                                                              \brief Execution Counters              */
 #endif
+#if HS_UTIL_TASK_CPU_TIME == true
+    uint32    AppUtil[CFE_PLATFORM_ES_MAX_APPLICATIONS]; /**< \hstlmmnemonic \HS_APPUTIL
+                                                        \brief CPU Utilization of each Application, by App ID */
+#endif
 
 } HS_HkPacket_t;
 
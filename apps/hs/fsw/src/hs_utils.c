@@ -141,3 +141,23 @@ bool    HS_EMTActionIsValid(uint16 ActionType)
 
     return IsValid;
 }
+
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Hash an Application Name                                        */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+uint32  HS_AppNameHash(const char *AppName)
+{
+    uint32  Hash = 0x811C9DC5;
+    uint32  i = 0;
+
+    for (i = 0; (i < OS_MAX_API_NAME) && (AppName[i] != '\0'); i++)
+    {
+        Hash ^= (uint8)AppName[i];
+        Hash *= 0x01000193;
+    }
+
+    return Hash;
+}
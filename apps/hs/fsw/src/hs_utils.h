@@ -100,4 +100,25 @@ bool    HS_AMTActionIsValid(uint16 ActionType);
 bool    HS_EMTActionIsValid(uint16 ActionType);
 
 
+/************************************************************************/
+/** \brief Hash an Application Name
+**
+**  \par Description
+**       Computes a 32 bit FNV-1a hash of an application name, stopping
+**       at the terminator or after #OS_MAX_API_NAME characters.
+**
+**  \par Assumptions, External Events, and Notes:
+**       Names that compare equal with strncmp over #OS_MAX_API_NAME
+**       characters always hash equal.
+**
+**  \param [in]   AppName          The application name to hash
+**
+**  \returns
+**  \retstmt Returns the hash of the name \endcode
+**  \endreturns
+**
+*************************************************************************/
+uint32  HS_AppNameHash(const char *AppName);
+
+
 #endif /* _hs_utils_h_ */
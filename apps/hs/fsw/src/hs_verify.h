@@ -92,6 +92,15 @@
     #error HS_MAX_MONITORED_EVENTS can not exceed 4294967295
 #endif
 
+/*
+** Event monitor hash size
+*/
+#if HS_EMT_HASH_SIZE < 1
+    #error HS_EMT_HASH_SIZE cannot be less than 1
+#elif (HS_EMT_HASH_SIZE & (HS_EMT_HASH_SIZE - 1)) != 0
+    #error HS_EMT_HASH_SIZE must be a power of two
+#endif
+
 /*
  * JPH 2015-06-29 - Removed check of Watchdog timer values
  *
@@ -291,6 +300,22 @@
     #error HS_UTIL_TIME_DIAG_ARRAY_POWER can not exceed 31
 #endif
 
+/*
+** Utilization from Task Processor Time
+*/
+#if (HS_UTIL_TASK_CPU_TIME != true) && (HS_UTIL_TASK_CPU_TIME != false)
+    #error HS_UTIL_TASK_CPU_TIME must be defined as true or false
+#endif
+
+/*
+** Application Hogging number of Utils per Interval
+*/
+#if HS_UTIL_PER_INTERVAL_APP_HOGGING < 1
+    #error HS_UTIL_PER_INTERVAL_APP_HOGGING cannot be less than 1
+#elif HS_UTIL_PER_INTERVAL_APP_HOGGING > HS_UTIL_PER_INTERVAL_TOTAL
+    #error HS_UTIL_PER_INTERVAL_APP_HOGGING can not exceed HS_UTIL_PER_INTERVAL_TOTAL
+#endif
+
 #ifndef HS_MISSION_REV
     #error HS_MISSION_REV must be defined!
 #elif (HS_MISSION_REV < 0)
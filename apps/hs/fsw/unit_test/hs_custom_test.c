@@ -53,6 +53,7 @@
 #include <sys/fcntl.h>
 #include <unistd.h>
 #include <stdlib.h>
+#include <string.h>
 
 /*
  * Function Definitions
@@ -63,6 +64,41 @@ void HS_CUSTOM_TEST_CFE_ES_IncrementTaskCounterHook(void)
     HS_CustomData.IdleTaskRunStatus = -1;
 }
 
+#if HS_UTIL_TASK_CPU_TIME == true
+#define HS_CUSTOM_TEST_OBJECT_ID(Type, Index)  (((Type) << OS_OBJECT_TYPE_SHIFT) | (Index))
+
+int32 HS_CUSTOM_TEST_OS_TaskGetCpuTimeHook(uint32 task_id, OS_time_t *cpu_time)
+{
+    /* Task 1 has used 0.25 seconds of processor time, task 2 has used 0.5 seconds */
+    cpu_time->seconds   = 0;
+    cpu_time->microsecs = (task_id & OS_OBJECT_INDEX_MASK) * 250000;
+
+    return OS_SUCCESS;
+}
+
+void HS_CUSTOM_TEST_OS_ForEachObjectHook(uint32 creator_id, OS_ArgCallback_t callback_ptr, void *callback_arg)
+{
+    callback_ptr(HS_CUSTOM_TEST_OBJECT_ID(OS_OBJECT_TYPE_OS_TASK, 1), callback_arg);
+    callback_ptr(HS_CUSTOM_TEST_OBJECT_ID(OS_OBJECT_TYPE_OS_TASK, 2), callback_arg);
+    callback_ptr(HS_CUSTOM_TEST_OBJECT_ID(OS_OBJECT_TYPE_OS_QUEUE, 1), callback_arg);
+}
+
+int32 HS_CUSTOM_TEST_CFE_ES_GetTaskInfoHook(CFE_ES_TaskInfo_t *TaskInfo, uint32 TaskId)
+{
+    /* Task 1 belongs to App 1, task 2 belongs to App 3 */
+    TaskInfo->AppId = ((TaskId & OS_OBJECT_INDEX_MASK) == 1) ? 1 : 3;
+
+    return CFE_SUCCESS;
+}
+
+int32 HS_CUSTOM_TEST_CFE_ES_GetAppNameHook(char *AppName, uint32 AppId, uint32 BufferLength)
+{
+    strncpy(AppName, "HOG_APP", BufferLength);
+
+    return CFE_SUCCESS;
+}
+#endif
+
 void HS_IdleTask_Test(void)
 {
     HS_CustomData.UtilMask = 1;
@@ -106,11 +142,43 @@ void HS_CustomInit_Test_Nominal(void)
     UtAssert_True (HS_CustomData.ThisIdleTaskExec == 0, "HS_CustomData.ThisIdleTaskExec == 0");
     UtAssert_True (HS_CustomData.LastIdleTaskExec == 0, "HS_CustomData.LastIdleTaskExec == 0");
     UtAssert_True (HS_CustomData.LastIdleTaskInterval == 0, "HS_CustomData.LastIdleTaskInterval == 0");
+    UtAssert_True (HS_CustomData.UtilTaskCpuTime == false, "HS_CustomData.UtilTaskCpuTime == false");
 
     UtAssert_True (Ut_CFE_EVS_GetEventQueueDepth() == 0, "Ut_CFE_EVS_GetEventQueueDepth() == 0");
 
 } /* end HS_CustomInit_Test_Nominal */
 
+#if HS_UTIL_TASK_CPU_TIME == true
+void HS_CustomInit_Test_TaskCpuTime(void)
+{
+    int32  Result;
+
+    /* The OS keeps processor time per task */
+    Ut_OSAPI_EXT_SetReturnCode(UT_OSAPI_EXT_TASKGETCPUTIME_INDEX, OS_SUCCESS, 1);
+
+    /* Would be returned if the Idle Task were created */
+    Ut_CFE_ES_SetReturnCode(UT_CFE_ES_CREATECHILDTASK_INDEX, -1, 1);
+
+    HS_CustomData.TotalUtil = 99;
+    HS_CustomData.LastSampleTime = 99;
+    HS_CustomData.TaskId[1] = 99;
+
+    /* Execute the function being tested */
+    Result = HS_CustomInit();
+
+    /* Verify results */
+    UtAssert_True (Result == CFE_SUCCESS, "Result == CFE_SUCCESS");
+
+    UtAssert_True (HS_CustomData.UtilTaskCpuTime == true, "HS_CustomData.UtilTaskCpuTime == true");
+    UtAssert_True (HS_CustomData.TotalUtil == 0, "HS_CustomData.TotalUtil == 0");
+    UtAssert_True (HS_CustomData.LastSampleTime == 0, "HS_CustomData.LastSampleTime == 0");
+    UtAssert_True (HS_CustomData.TaskId[1] == 0, "HS_CustomData.TaskId[1] == 0");
+
+    UtAssert_True (Ut_CFE_EVS_GetEventQueueDepth() == 0, "Ut_CFE_EVS_GetEventQueueDepth() == 0");
+
+} /* end HS_CustomInit_Test_TaskCpuTime */
+#endif
+
 void HS_CustomInit_Test_CreateChildTaskError(void)
 {
     int32  Result;
@@ -178,6 +246,23 @@ void HS_CustomCleanup_Test(void)
 
 } /* end HS_CustomCleanup_Test */
 
+#if HS_UTIL_TASK_CPU_TIME == true
+void HS_CustomCleanup_Test_TaskCpuTime(void)
+{
+    HS_CustomData.UtilTaskCpuTime = true;
+    HS_CustomData.IdleTaskRunStatus = CFE_SUCCESS;
+
+    /* Execute the function being tested */
+    HS_CustomCleanup();
+
+    /* Verify results: there is no Idle Task to stop */
+    UtAssert_True (HS_CustomData.IdleTaskRunStatus == CFE_SUCCESS, "HS_CustomData.IdleTaskRunStatus == CFE_SUCCESS");
+
+    UtAssert_True (Ut_CFE_EVS_GetEventQueueDepth() == 0, "Ut_CFE_EVS_GetEventQueueDepth() == 0");
+
+} /* end HS_CustomCleanup_Test_TaskCpuTime */
+#endif
+
 void HS_UtilizationIncrement_Test(void)
 {
     /* No setup required for this test */
@@ -234,6 +319,219 @@ void HS_CustomMonitorUtilization_Test(void)
 
 } /* end HS_CustomMonitorUtilization_Test */
 
+#if HS_UTIL_TASK_CPU_TIME == true
+void HS_CustomMonitorUtilization_Test_TaskCpuTime(void)
+{
+    HS_CustomData.UtilTaskCpuTime = true;
+    HS_CustomData.UtilCycleCounter = 0;
+
+    /* The PSP timer stub reports time 0, so this puts the previous sample 1 second earlier */
+    HS_CustomData.LastSampleTime = (uint64)0 - 1000000;
+
+    Ut_OSAPI_EXT_SetFunctionHook(UT_OSAPI_EXT_FOREACHOBJECT_INDEX, &HS_CUSTOM_TEST_OS_ForEachObjectHook);
+    Ut_OSAPI_EXT_SetFunctionHook(UT_OSAPI_EXT_TASKGETCPUTIME_INDEX, &HS_CUSTOM_TEST_OS_TaskGetCpuTimeHook);
+    Ut_CFE_ES_SetFunctionHook(UT_CFE_ES_GETTASKINFO_INDEX, &HS_CUSTOM_TEST_CFE_ES_GetTaskInfoHook);
+
+    /* Execute the function being tested */
+    HS_CustomMonitorUtilization();
+
+    /* Verify results */
+    UtAssert_True (HS_CustomData.UtilCycleCounter == 0, "HS_CustomData.UtilCycleCounter == 0");
+    UtAssert_True (HS_CustomData.TotalUtil == 7500, "HS_CustomData.TotalUtil == 7500");
+    UtAssert_True (HS_CustomGetUtil() == 7500, "HS_CustomGetUtil() == 7500");
+
+    UtAssert_True (Ut_CFE_EVS_GetEventQueueDepth() == 0, "Ut_CFE_EVS_GetEventQueueDepth() == 0");
+
+} /* end HS_CustomMonitorUtilization_Test_TaskCpuTime */
+
+void HS_UtilizationSample_Test_FirstSample(void)
+{
+    HS_CustomData.LastSampleTime = 0;
+
+    Ut_OSAPI_EXT_SetFunctionHook(UT_OSAPI_EXT_FOREACHOBJECT_INDEX, &HS_CUSTOM_TEST_OS_ForEachObjectHook);
+    Ut_OSAPI_EXT_SetFunctionHook(UT_OSAPI_EXT_TASKGETCPUTIME_INDEX, &HS_CUSTOM_TEST_OS_TaskGetCpuTimeHook);
+    Ut_CFE_ES_SetFunctionHook(UT_CFE_ES_GETTASKINFO_INDEX, &HS_CUSTOM_TEST_CFE_ES_GetTaskInfoHook);
+
+    /* Execute the function being tested */
+    HS_UtilizationSample();
+
+    /* Verify results: the tasks are recorded, but there is no interval to report yet */
+    UtAssert_True (HS_CustomData.TotalIntervalTime == 750000, "HS_CustomData.TotalIntervalTime == 750000");
+    UtAssert_True (HS_CustomData.TaskAppId[1] == 1, "HS_CustomData.TaskAppId[1] == 1");
+    UtAssert_True (HS_CustomData.TaskAppId[2] == 3, "HS_CustomData.TaskAppId[2] == 3");
+    UtAssert_True (HS_CustomData.TaskCpuTime[2] == 500000, "HS_CustomData.TaskCpuTime[2] == 500000");
+
+    UtAssert_True (HS_CustomData.TotalUtil == 0, "HS_CustomData.TotalUtil == 0");
+    UtAssert_True (HS_CustomData.AppUtil[1] == 0, "HS_CustomData.AppUtil[1] == 0");
+    UtAssert_True (HS_CustomData.AppUtil[3] == 0, "HS_CustomData.AppUtil[3] == 0");
+
+    UtAssert_True (Ut_CFE_EVS_GetEventQueueDepth() == 0, "Ut_CFE_EVS_GetEventQueueDepth() == 0");
+
+} /* end HS_UtilizationSample_Test_FirstSample */
+
+void HS_UtilizationSample_Test_Nominal(void)
+{
+    /* The PSP timer stub reports time 0, so this puts the previous sample 1 second earlier */
+    HS_CustomData.LastSampleTime = (uint64)0 - 1000000;
+
+    Ut_OSAPI_EXT_SetFunctionHook(UT_OSAPI_EXT_FOREACHOBJECT_INDEX, &HS_CUSTOM_TEST_OS_ForEachObjectHook);
+    Ut_OSAPI_EXT_SetFunctionHook(UT_OSAPI_EXT_TASKGETCPUTIME_INDEX, &HS_CUSTOM_TEST_OS_TaskGetCpuTimeHook);
+    Ut_CFE_ES_SetFunctionHook(UT_CFE_ES_GETTASKINFO_INDEX, &HS_CUSTOM_TEST_CFE_ES_GetTaskInfoHook);
+
+    /* Execute the function being tested */
+    HS_UtilizationSample();
+
+    /* Verify results */
+    UtAssert_True (HS_CustomData.TotalUtil == 7500, "HS_CustomData.TotalUtil == 7500");
+    UtAssert_True (HS_CustomData.AppUtil[0] == 0, "HS_CustomData.AppUtil[0] == 0");
+    UtAssert_True (HS_CustomData.AppUtil[1] == 2500, "HS_CustomData.AppUtil[1] == 2500");
+    UtAssert_True (HS_CustomData.AppUtil[3] == 5000, "HS_CustomData.AppUtil[3] == 5000");
+    UtAssert_True (HS_CustomData.LastSampleTime == 0, "HS_CustomData.LastSampleTime == 0");
+
+    UtAssert_True (Ut_CFE_EVS_GetEventQueueDepth() == 0, "Ut_CFE_EVS_GetEventQueueDepth() == 0");
+
+} /* end HS_UtilizationSample_Test_Nominal */
+
+void HS_UtilizationSampleTask_Test_KnownTask(void)
+{
+    uint32 TaskId = HS_CUSTOM_TEST_OBJECT_ID(OS_OBJECT_TYPE_OS_TASK, 1);
+
+    /* Seen in the previous sample, after using 0.1 seconds */
+    HS_CustomData.TaskId[1] = TaskId;
+    HS_CustomData.TaskAppId[1] = 2;
+    HS_CustomData.TaskCpuTime[1] = 100000;
+
+    Ut_OSAPI_EXT_SetFunctionHook(UT_OSAPI_EXT_TASKGETCPUTIME_INDEX, &HS_CUSTOM_TEST_OS_TaskGetCpuTimeHook);
+
+    /* Would leave the task without an App if it were looked up again */
+    Ut_CFE_ES_SetReturnCode(UT_CFE_ES_GETTASKINFO_INDEX, -1, 1);
+
+    /* Execute the function being tested */
+    HS_UtilizationSampleTask(TaskId, NULL);
+
+    /* Verify results */
+    UtAssert_True (HS_CustomData.TaskAppId[1] == 2, "HS_CustomData.TaskAppId[1] == 2");
+    UtAssert_True (HS_CustomData.TaskCpuTime[1] == 250000, "HS_CustomData.TaskCpuTime[1] == 250000");
+    UtAssert_True (HS_CustomData.TotalIntervalTime == 150000, "HS_CustomData.TotalIntervalTime == 150000");
+    UtAssert_True (HS_CustomData.AppIntervalTime[2] == 150000, "HS_CustomData.AppIntervalTime[2] == 150000");
+
+    UtAssert_True (Ut_CFE_EVS_GetEventQueueDepth() == 0, "Ut_CFE_EVS_GetEventQueueDepth() == 0");
+
+} /* end HS_UtilizationSampleTask_Test_KnownTask */
+
+void HS_UtilizationSampleTask_Test_NoApp(void)
+{
+    uint32 TaskId = HS_CUSTOM_TEST_OBJECT_ID(OS_OBJECT_TYPE_OS_TASK, 1);
+
+    Ut_OSAPI_EXT_SetFunctionHook(UT_OSAPI_EXT_TASKGETCPUTIME_INDEX, &HS_CUSTOM_TEST_OS_TaskGetCpuTimeHook);
+
+    /* The task was not created through ES */
+    Ut_CFE_ES_SetReturnCode(UT_CFE_ES_GETTASKINFO_INDEX, -1, 1);
+
+    /* Execute the function being tested */
+    HS_UtilizationSampleTask(TaskId, NULL);
+
+    /* Verify results: the time counts toward the total only */
+    UtAssert_True (HS_CustomData.TaskId[1] == TaskId, "HS_CustomData.TaskId[1] == TaskId");
+    UtAssert_True (HS_CustomData.TaskAppId[1] == HS_UTIL_NO_APP, "HS_CustomData.TaskAppId[1] == HS_UTIL_NO_APP");
+    UtAssert_True (HS_CustomData.TotalIntervalTime == 250000, "HS_CustomData.TotalIntervalTime == 250000");
+    UtAssert_True (HS_CustomData.AppIntervalTime[0] == 0, "HS_CustomData.AppIntervalTime[0] == 0");
+
+    UtAssert_True (Ut_CFE_EVS_GetEventQueueDepth() == 0, "Ut_CFE_EVS_GetEventQueueDepth() == 0");
+
+} /* end HS_UtilizationSampleTask_Test_NoApp */
+
+void HS_UtilizationSampleTask_Test_LateRegistration(void)
+{
+    uint32 TaskId = HS_CUSTOM_TEST_OBJECT_ID(OS_OBJECT_TYPE_OS_TASK, 1);
+
+    /* Seen in the previous sample, before ES had registered it */
+    HS_CustomData.TaskId[1] = TaskId;
+    HS_CustomData.TaskAppId[1] = HS_UTIL_NO_APP;
+    HS_CustomData.TaskCpuTime[1] = 100000;
+
+    Ut_OSAPI_EXT_SetFunctionHook(UT_OSAPI_EXT_TASKGETCPUTIME_INDEX, &HS_CUSTOM_TEST_OS_TaskGetCpuTimeHook);
+    Ut_CFE_ES_SetFunctionHook(UT_CFE_ES_GETTASKINFO_INDEX, &HS_CUSTOM_TEST_CFE_ES_GetTaskInfoHook);
+
+    /* Execute the function being tested */
+    HS_UtilizationSampleTask(TaskId, NULL);
+
+    /* Verify results: the task is now accounted to its App */
+    UtAssert_True (HS_CustomData.TaskAppId[1] == 1, "HS_CustomData.TaskAppId[1] == 1");
+    UtAssert_True (HS_CustomData.TotalIntervalTime == 150000, "HS_CustomData.TotalIntervalTime == 150000");
+    UtAssert_True (HS_CustomData.AppIntervalTime[1] == 150000, "HS_CustomData.AppIntervalTime[1] == 150000");
+
+    UtAssert_True (Ut_CFE_EVS_GetEventQueueDepth() == 0, "Ut_CFE_EVS_GetEventQueueDepth() == 0");
+
+} /* end HS_UtilizationSampleTask_Test_LateRegistration */
+
+void HS_UtilizationSampleTask_Test_CpuTimeError(void)
+{
+    uint32 TaskId = HS_CUSTOM_TEST_OBJECT_ID(OS_OBJECT_TYPE_OS_TASK, 1);
+
+    /* The OS_TaskGetCpuTime stub fails by default */
+
+    /* Execute the function being tested */
+    HS_UtilizationSampleTask(TaskId, NULL);
+
+    /* Verify results */
+    UtAssert_True (HS_CustomData.TaskId[1] == 0, "HS_CustomData.TaskId[1] == 0");
+    UtAssert_True (HS_CustomData.TotalIntervalTime == 0, "HS_CustomData.TotalIntervalTime == 0");
+
+    UtAssert_True (Ut_CFE_EVS_GetEventQueueDepth() == 0, "Ut_CFE_EVS_GetEventQueueDepth() == 0");
+
+} /* end HS_UtilizationSampleTask_Test_CpuTimeError */
+
+void HS_UtilizationAppHogging_Test_Hogging(void)
+{
+    HS_AppData.CurrentCPUHogState = HS_STATE_ENABLED;
+    HS_AppData.MaxCPUHoggingTime = 2;
+
+    HS_CustomData.AppUtil[1] = HS_UTIL_PER_INTERVAL_APP_HOGGING;
+    HS_CustomData.AppHoggingTime[1] = 1;
+    HS_CustomData.AppHoggingTime[3] = 1;
+
+    Ut_CFE_ES_SetFunctionHook(UT_CFE_ES_GETAPPNAME_INDEX, &HS_CUSTOM_TEST_CFE_ES_GetAppNameHook);
+
+    /* Execute the function being tested */
+    HS_UtilizationAppHogging();
+
+    /* Verify results */
+    UtAssert_True (HS_CustomData.AppHoggingTime[1] == 2, "HS_CustomData.AppHoggingTime[1] == 2");
+    UtAssert_True (HS_CustomData.AppHoggingTime[3] == 0, "HS_CustomData.AppHoggingTime[3] == 0");
+
+    UtAssert_True
+        (Ut_CFE_EVS_EventSent(HS_APP_HOGGING_ERR_EID, CFE_EVS_ERROR, "CPU Hogging Detected: App HOG_APP used 9500 of 10000 Utils"),
+        "CPU Hogging Detected: App HOG_APP used 9500 of 10000 Utils");
+
+    UtAssert_True
+        (Ut_CFE_ES_SysLogWritten("HS App: CPU Hogging Detected: App HOG_APP\n"),
+        "HS App: CPU Hogging Detected: App HOG_APP\n");
+
+    UtAssert_True (Ut_CFE_EVS_GetEventQueueDepth() == 1, "Ut_CFE_EVS_GetEventQueueDepth() == 1");
+    UtAssert_True (Ut_CFE_ES_GetSysLogQueueDepth() == 1, "Ut_CFE_ES_GetSysLogQueueDepth() == 1");
+
+} /* end HS_UtilizationAppHogging_Test_Hogging */
+
+void HS_UtilizationAppHogging_Test_HogStateDisabled(void)
+{
+    HS_AppData.CurrentCPUHogState = HS_STATE_DISABLED;
+    HS_AppData.MaxCPUHoggingTime = 2;
+
+    HS_CustomData.AppUtil[1] = HS_UTIL_PER_INTERVAL_TOTAL;
+    HS_CustomData.AppHoggingTime[1] = 1;
+
+    /* Execute the function being tested */
+    HS_UtilizationAppHogging();
+
+    /* Verify results */
+    UtAssert_True (HS_CustomData.AppHoggingTime[1] == 0, "HS_CustomData.AppHoggingTime[1] == 0");
+
+    UtAssert_True (Ut_CFE_EVS_GetEventQueueDepth() == 0, "Ut_CFE_EVS_GetEventQueueDepth() == 0");
+
+} /* end HS_UtilizationAppHogging_Test_HogStateDisabled */
+#endif
+
 void HS_CustomCommands_Test_UtilDiagReport(void)
 {
     HS_NoArgsCmd_t    CmdPacket;
@@ -355,6 +653,25 @@ void HS_CustomGetUtil_Test(void)
 
 } /* end HS_CustomGetUtil_Test */
 
+#if HS_UTIL_TASK_CPU_TIME == true
+void HS_CustomGetUtil_Test_TaskCpuTime(void)
+{
+    int32   Result;
+
+    HS_CustomData.UtilTaskCpuTime = true;
+    HS_CustomData.TotalUtil = 1234;
+
+    /* Execute the function being tested */
+    Result = HS_CustomGetUtil();
+
+    /* Verify results */
+    UtAssert_True (Result == 1234, "Result == 1234");
+
+    UtAssert_True (Ut_CFE_EVS_GetEventQueueDepth() == 0, "Ut_CFE_EVS_GetEventQueueDepth() == 0");
+
+} /* end HS_CustomGetUtil_Test_TaskCpuTime */
+#endif
+
 void HS_SetUtilParamsCmd_Test_Nominal(void)
 {
     HS_SetUtilParamsCmd_t    CmdPacket;
@@ -439,8 +756,14 @@ void HS_Custom_Test_AddTestCases(void)
     UtTest_Add(HS_CustomInit_Test_Nominal, HS_Test_Setup, HS_Test_TearDown, "HS_CustomInit_Test_Nominal");
     UtTest_Add(HS_CustomInit_Test_CreateChildTaskError, HS_Test_Setup, HS_Test_TearDown, "HS_CustomInit_Test_CreateChildTaskError");
     UtTest_Add(HS_CustomInit_Test_RegisterSynchCallbackError, HS_Test_Setup, HS_Test_TearDown, "HS_CustomInit_Test_RegisterSynchCallbackError");
+#if HS_UTIL_TASK_CPU_TIME == true
+    UtTest_Add(HS_CustomInit_Test_TaskCpuTime, HS_Test_Setup, HS_Test_TearDown, "HS_CustomInit_Test_TaskCpuTime");
+#endif
 
     UtTest_Add(HS_CustomCleanup_Test, HS_Test_Setup, HS_Test_TearDown, "HS_CustomCleanup_Test");
+#if HS_UTIL_TASK_CPU_TIME == true
+    UtTest_Add(HS_CustomCleanup_Test_TaskCpuTime, HS_Test_Setup, HS_Test_TearDown, "HS_CustomCleanup_Test_TaskCpuTime");
+#endif
 
     UtTest_Add(HS_UtilizationIncrement_Test, HS_Test_Setup, HS_Test_TearDown, "HS_UtilizationIncrement_Test");
 
@@ -449,6 +772,20 @@ void HS_Custom_Test_AddTestCases(void)
     UtTest_Add(HS_MarkIdleCallback_Test, HS_Test_Setup, HS_Test_TearDown, "HS_MarkIdleCallback_Test");
 
     UtTest_Add(HS_CustomMonitorUtilization_Test, HS_Test_Setup, HS_Test_TearDown, "HS_CustomMonitorUtilization_Test");
+#if HS_UTIL_TASK_CPU_TIME == true
+    UtTest_Add(HS_CustomMonitorUtilization_Test_TaskCpuTime, HS_Test_Setup, HS_Test_TearDown, "HS_CustomMonitorUtilization_Test_TaskCpuTime");
+
+    UtTest_Add(HS_UtilizationSample_Test_FirstSample, HS_Test_Setup, HS_Test_TearDown, "HS_UtilizationSample_Test_FirstSample");
+    UtTest_Add(HS_UtilizationSample_Test_Nominal, HS_Test_Setup, HS_Test_TearDown, "HS_UtilizationSample_Test_Nominal");
+
+    UtTest_Add(HS_UtilizationSampleTask_Test_KnownTask, HS_Test_Setup, HS_Test_TearDown, "HS_UtilizationSampleTask_Test_KnownTask");
+    UtTest_Add(HS_UtilizationSampleTask_Test_NoApp, HS_Test_Setup, HS_Test_TearDown, "HS_UtilizationSampleTask_Test_NoApp");
+    UtTest_Add(HS_UtilizationSampleTask_Test_LateRegistration, HS_Test_Setup, HS_Test_TearDown, "HS_UtilizationSampleTask_Test_LateRegistration");
+    UtTest_Add(HS_UtilizationSampleTask_Test_CpuTimeError, HS_Test_Setup, HS_Test_TearDown, "HS_UtilizationSampleTask_Test_CpuTimeError");
+
+    UtTest_Add(HS_UtilizationAppHogging_Test_Hogging, HS_Test_Setup, HS_Test_TearDown, "HS_UtilizationAppHogging_Test_Hogging");
+    UtTest_Add(HS_UtilizationAppHogging_Test_HogStateDisabled, HS_Test_Setup, HS_Test_TearDown, "HS_UtilizationAppHogging_Test_HogStateDisabled");
+#endif
 
     UtTest_Add(HS_CustomCommands_Test_UtilDiagReport, HS_Test_Setup, HS_Test_TearDown, "HS_CustomCommands_Test_UtilDiagReport");
     UtTest_Add(HS_CustomCommands_Test_SetUtilParamsCmd, HS_Test_Setup, HS_Test_TearDown, "HS_CustomCommands_Test_SetUtilParamsCmd");
@@ -458,6 +795,9 @@ void HS_Custom_Test_AddTestCases(void)
     UtTest_Add(HS_UtilDiagReport_Test, HS_Test_Setup, HS_Test_TearDown, "HS_UtilDiagReport_Test");
 
     UtTest_Add(HS_CustomGetUtil_Test, HS_Test_Setup, HS_Test_TearDown, "HS_CustomGetUtil_Test");
+#if HS_UTIL_TASK_CPU_TIME == true
+    UtTest_Add(HS_CustomGetUtil_Test_TaskCpuTime, HS_Test_Setup, HS_Test_TearDown, "HS_CustomGetUtil_Test_TaskCpuTime");
+#endif
 
     UtTest_Add(HS_SetUtilParamsCmd_Test_Nominal, HS_Test_Setup, HS_Test_TearDown, "HS_SetUtilParamsCmd_Test_Nominal");
     UtTest_Add(HS_SetUtilParamsCmd_Test_Error, HS_Test_Setup, HS_Test_TearDown, "HS_SetUtilParamsCmd_Test_Error");
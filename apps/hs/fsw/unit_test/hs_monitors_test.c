@@ -31,6 +31,7 @@
 #include "hs_monitors_test.h"
 #include "hs_app.h"
 #include "hs_monitors.h"
+#include "hs_cmds.h"
 #include "hs_custom.h"
 #include "hs_msg.h"
 #include "hs_msgdefs.h"
@@ -54,14 +55,26 @@
 #include <sys/fcntl.h>
 #include <unistd.h>
 #include <stdlib.h>
+#include <stdio.h>
+#include <time.h>
 
 /*
  * Function Definitions
  */
 
-int32 HS_MONITORS_TEST_CFE_ES_GetAppInfoHook1(CFE_ES_AppInfo_t *AppInfo, uint32 AppId)
+int32 HS_MONITORS_TEST_CFE_ES_GetAppExecCounterHook1(uint32 AppId, uint32 *ExecutionCounter, uint32 *Generation)
 {
-    AppInfo->ExecutionCounter = 3;
+    *ExecutionCounter = 3;
+    *Generation = 1;
+
+    return CFE_SUCCESS;
+}
+
+int32 HS_MONITORS_TEST_CFE_ES_GetAppExecCounterHook2(uint32 AppId, uint32 *ExecutionCounter, uint32 *Generation)
+{
+    /* The App has been restarted since it was resolved with generation 1 */
+    *ExecutionCounter = 3;
+    *Generation = 3;
 
     return CFE_SUCCESS;
 }
@@ -106,7 +119,7 @@ void HS_MonitorApplications_Test_GetExeCountFailure(void)
     strncpy (HS_AppData.AMTablePtr[0].AppName, "AppName", 10);
 
     /* Causes "failure to get an execution counter" */
-    Ut_CFE_ES_SetFunctionHook(UT_CFE_ES_GETAPPINFO_INDEX, &HS_MONITORS_TEST_CFE_ES_GetAppInfoHook1);
+    Ut_CFE_ES_API_SetFunctionHook(UT_CFE_ES_API_GETAPPEXECCOUNTER_INDEX, &HS_MONITORS_TEST_CFE_ES_GetAppExecCounterHook1);
 
     HS_AppData.AppMonLastExeCount[0] = 1;
     HS_AppData.AMTablePtr[0].CycleCount = 2;
@@ -122,6 +135,76 @@ void HS_MonitorApplications_Test_GetExeCountFailure(void)
 
 } /* end HS_MonitorApplications_Test_GetExeCountFailure */
 
+void HS_MonitorApplications_Test_ResolvedOnce(void)
+{
+    HS_AMTEntry_t     AMTable[HS_MAX_MONITORED_APPS];
+
+    HS_AppData.AMTablePtr = AMTable;
+
+    HS_AppData.AMTablePtr[0].ActionType  = HS_AMT_ACT_EVENT;
+    HS_AppData.AppMonCheckInCountdown[0] = 5;
+    HS_AppData.AMTablePtr[0].CycleCount  = 5;
+
+    strncpy (HS_AppData.AMTablePtr[0].AppName, "AppName", 10);
+
+    Ut_CFE_ES_API_SetFunctionHook(UT_CFE_ES_API_GETAPPEXECCOUNTER_INDEX, &HS_MONITORS_TEST_CFE_ES_GetAppExecCounterHook1);
+
+    /* Execute the function being tested: the first check resolves the App by name */
+    HS_MonitorApplications();
+
+    UtAssert_True (HS_AppData.AppMonGeneration[0] == 1, "HS_AppData.AppMonGeneration[0] == 1");
+    UtAssert_True (HS_AppData.AppMonLastExeCount[0] == 3, "HS_AppData.AppMonLastExeCount[0] == 3");
+
+    /* Set CFE_ES_GetAppIDByName to fail, which would generate error HS_APPMON_APPNAME_ERR_EID if it were called again */
+    Ut_CFE_ES_SetReturnCode(UT_CFE_ES_GETAPPIDBYNAME_INDEX, -1, 1);
+
+    /* Execute the function being tested: the second check reads the counter through the resolved AppId */
+    HS_MonitorApplications();
+
+    /* Verify results */
+    UtAssert_True (HS_AppData.AppMonGeneration[0] == 1, "HS_AppData.AppMonGeneration[0] == 1");
+    UtAssert_True (HS_AppData.AppMonCheckInCountdown[0] == 4, "HS_AppData.AppMonCheckInCountdown[0] == 4");
+
+    UtAssert_True (Ut_CFE_EVS_GetEventQueueDepth() == 0, "Ut_CFE_EVS_GetEventQueueDepth() == 0");
+
+} /* end HS_MonitorApplications_Test_ResolvedOnce */
+
+void HS_MonitorApplications_Test_ResolveAfterRestart(void)
+{
+    HS_AMTEntry_t     AMTable[HS_MAX_MONITORED_APPS];
+
+    HS_AppData.AMTablePtr = AMTable;
+
+    HS_AppData.AMTablePtr[0].ActionType  = HS_AMT_ACT_EVENT;
+    HS_AppData.AppMonCheckInCountdown[0] = 5;
+    HS_AppData.AMTablePtr[0].CycleCount  = 5;
+
+    strncpy (HS_AppData.AMTablePtr[0].AppName, "AppName", 10);
+
+    /* Resolved before the App was restarted */
+    HS_AppData.AppMonAppId[0] = 0;
+    HS_AppData.AppMonGeneration[0] = 1;
+
+    Ut_CFE_ES_API_SetFunctionHook(UT_CFE_ES_API_GETAPPEXECCOUNTER_INDEX, &HS_MONITORS_TEST_CFE_ES_GetAppExecCounterHook2);
+
+    /* Set CFE_ES_GetAppIDByName to fail on first call, to generate error HS_APPMON_APPNAME_ERR_EID */
+    Ut_CFE_ES_SetReturnCode(UT_CFE_ES_GETAPPIDBYNAME_INDEX, -1, 1);
+
+    /* Execute the function being tested */
+    HS_MonitorApplications();
+
+    /* Verify results */
+    UtAssert_True (HS_AppData.AppMonGeneration[0] == 0, "HS_AppData.AppMonGeneration[0] == 0");
+    UtAssert_True (HS_AppData.AppMonCheckInCountdown[0] == 4, "HS_AppData.AppMonCheckInCountdown[0] == 4");
+
+    UtAssert_True
+        (Ut_CFE_EVS_EventSent(HS_APPMON_APPNAME_ERR_EID, CFE_EVS_ERROR, "App Monitor App Name not found: APP:(AppName)"),
+        "App Monitor App Name not found: APP:(AppName)");
+
+    UtAssert_True (Ut_CFE_EVS_GetEventQueueDepth() == 1, "Ut_CFE_EVS_GetEventQueueDepth() == 1");
+
+} /* end HS_MonitorApplications_Test_ResolveAfterRestart */
+
 void HS_MonitorApplications_Test_ProcessorResetError(void)
 {
     HS_AMTEntry_t     AMTable[HS_MAX_MONITORED_APPS];
@@ -135,7 +218,7 @@ void HS_MonitorApplications_Test_ProcessorResetError(void)
     strncpy (HS_AppData.AMTablePtr[0].AppName, "AppName", 10);
 
     /* Prevents "failure to get an execution counter" */
-    Ut_CFE_ES_SetFunctionHook(UT_CFE_ES_GETAPPINFO_INDEX, &HS_MONITORS_TEST_CFE_ES_GetAppInfoHook1);
+    Ut_CFE_ES_API_SetFunctionHook(UT_CFE_ES_API_GETAPPEXECCOUNTER_INDEX, &HS_MONITORS_TEST_CFE_ES_GetAppExecCounterHook1);
 
     HS_AppData.AppMonLastExeCount[0] = 3;
 
@@ -178,7 +261,7 @@ void HS_MonitorApplications_Test_ProcessorResetActionLimitError(void)
     strncpy (HS_AppData.AMTablePtr[0].AppName, "AppName", 10);
 
     /* Prevents "failure to get an execution counter" */
-    Ut_CFE_ES_SetFunctionHook(UT_CFE_ES_GETAPPINFO_INDEX, &HS_MONITORS_TEST_CFE_ES_GetAppInfoHook1);
+    Ut_CFE_ES_API_SetFunctionHook(UT_CFE_ES_API_GETAPPEXECCOUNTER_INDEX, &HS_MONITORS_TEST_CFE_ES_GetAppExecCounterHook1);
 
     HS_AppData.AppMonLastExeCount[0] = 3;
 
@@ -222,7 +305,7 @@ void HS_MonitorApplications_Test_RestartAppErrorsGetAppInfoSuccess(void)
 
 
     /* Prevents "failure to get an execution counter" */
-    Ut_CFE_ES_SetFunctionHook(UT_CFE_ES_GETAPPINFO_INDEX, &HS_MONITORS_TEST_CFE_ES_GetAppInfoHook1);
+    Ut_CFE_ES_API_SetFunctionHook(UT_CFE_ES_API_GETAPPEXECCOUNTER_INDEX, &HS_MONITORS_TEST_CFE_ES_GetAppExecCounterHook1);
 
     HS_AppData.AppMonLastExeCount[0] = 3;
 
@@ -259,8 +342,8 @@ void HS_MonitorApplications_Test_RestartAppErrorsGetAppInfoNotSuccess(void)
 
     strncpy (HS_AppData.AMTablePtr[0].AppName, "AppName", 10);
 
-    /* Set CFE_ES_GetAppInfo to fail on first call, to generate error HS_APPMON_NOT_RESTARTED_ERR_EID */
-    Ut_CFE_ES_SetReturnCode(UT_CFE_ES_GETAPPINFO_INDEX, -1, 1);
+    /* Set CFE_ES_GetAppExecCounter to fail on first call, to generate error HS_APPMON_NOT_RESTARTED_ERR_EID */
+    Ut_CFE_ES_API_SetReturnCode(UT_CFE_ES_API_GETAPPEXECCOUNTER_INDEX, -1, 1);
 
     HS_AppData.AppMonLastExeCount[0] = 3;
 
@@ -298,7 +381,7 @@ void HS_MonitorApplications_Test_FailError(void)
     strncpy (HS_AppData.AMTablePtr[0].AppName, "AppName", 10);
 
     /* Prevents "failure to get an execution counter" */
-    Ut_CFE_ES_SetFunctionHook(UT_CFE_ES_GETAPPINFO_INDEX, &HS_MONITORS_TEST_CFE_ES_GetAppInfoHook1);
+    Ut_CFE_ES_API_SetFunctionHook(UT_CFE_ES_API_GETAPPEXECCOUNTER_INDEX, &HS_MONITORS_TEST_CFE_ES_GetAppExecCounterHook1);
 
     HS_AppData.AppMonLastExeCount[0] = 3;
 
@@ -340,7 +423,7 @@ void HS_MonitorApplications_Test_MsgActsNOACT(void)
     strncpy (HS_AppData.AMTablePtr[0].AppName, "AppName", 10);
 
     /* Prevents "failure to get an execution counter" */
-    Ut_CFE_ES_SetFunctionHook(UT_CFE_ES_GETAPPINFO_INDEX, &HS_MONITORS_TEST_CFE_ES_GetAppInfoHook1);
+    Ut_CFE_ES_API_SetFunctionHook(UT_CFE_ES_API_GETAPPEXECCOUNTER_INDEX, &HS_MONITORS_TEST_CFE_ES_GetAppExecCounterHook1);
 
     HS_AppData.AppMonLastExeCount[0] = 3;
 
@@ -378,7 +461,7 @@ void HS_MonitorApplications_Test_MsgActsErrorDefault(void)
     strncpy (HS_AppData.AMTablePtr[0].AppName, "AppName", 10);
 
     /* Prevents "failure to get an execution counter" */
-    Ut_CFE_ES_SetFunctionHook(UT_CFE_ES_GETAPPINFO_INDEX, &HS_MONITORS_TEST_CFE_ES_GetAppInfoHook1);
+    Ut_CFE_ES_API_SetFunctionHook(UT_CFE_ES_API_GETAPPEXECCOUNTER_INDEX, &HS_MONITORS_TEST_CFE_ES_GetAppExecCounterHook1);
 
     HS_AppData.AppMonLastExeCount[0] = 3;
 
@@ -428,6 +511,8 @@ void HS_MonitorEvent_Test_ProcErrorReset(void)
     strncpy (HS_AppData.EMTablePtr[0].AppName, "AppName", 10);
     strncpy (Packet.Payload.PacketID.AppName, "AppName", 10);
 
+    HS_EventMonIndexRefresh();
+
     /* Execute the function being tested */
     HS_MonitorEvent((CFE_SB_MsgPtr_t)&Packet);
     
@@ -471,6 +556,8 @@ void HS_MonitorEvent_Test_ProcErrorNoReset(void)
     strncpy (HS_AppData.EMTablePtr[0].AppName, "AppName", 10);
     strncpy (Packet.Payload.PacketID.AppName, "AppName", 10);
 
+    HS_EventMonIndexRefresh();
+
     /* Execute the function being tested */
     HS_MonitorEvent((CFE_SB_MsgPtr_t)&Packet);
     
@@ -511,6 +598,8 @@ void HS_MonitorEvent_Test_AppRestartErrors(void)
     /* Set CFE_ES_RestartApp to return -1, in order to generate error message HS_EVENTMON_NOT_RESTARTED_ERR_EID */
     Ut_CFE_ES_SetReturnCode(UT_CFE_ES_RESTARTAPP_INDEX, -1, 1);
 
+    HS_EventMonIndexRefresh();
+
     /* Execute the function being tested */
     HS_MonitorEvent((CFE_SB_MsgPtr_t)&Packet);
     
@@ -551,6 +640,8 @@ void HS_MonitorEvent_Test_OnlySecondAppRestartError(void)
     /* Set CFE_ES_GetAppIDByName to return -1, in order to generate error message HS_EVENTMON_NOT_RESTARTED_ERR_EID */
     Ut_CFE_ES_SetReturnCode(UT_CFE_ES_GETAPPIDBYNAME_INDEX, -1, 1);
 
+    HS_EventMonIndexRefresh();
+
     /* Execute the function being tested */
     HS_MonitorEvent((CFE_SB_MsgPtr_t)&Packet);
     
@@ -587,6 +678,8 @@ void HS_MonitorEvent_Test_DeleteErrors(void)
     /* Set CFE_ES_DeleteApp to return -1, in order to generate error message HS_EVENTMON_NOT_DELETED_ERR_EID */
     Ut_CFE_ES_SetReturnCode(UT_CFE_ES_DELETEAPP_INDEX, -1, 1);
 
+    HS_EventMonIndexRefresh();
+
     /* Execute the function being tested */
     HS_MonitorEvent((CFE_SB_MsgPtr_t)&Packet);
     
@@ -627,6 +720,8 @@ void HS_MonitorEvent_Test_OnlySecondDeleteError(void)
     /* Set CFE_ES_GetAppIDByName to fail on first call, to generate error HS_EVENTMON_NOT_DELETED_ERR_EID */
     Ut_CFE_ES_SetReturnCode(UT_CFE_ES_GETAPPIDBYNAME_INDEX, -1, 1);
 
+    HS_EventMonIndexRefresh();
+
     /* Execute the function being tested */
     HS_MonitorEvent((CFE_SB_MsgPtr_t)&Packet);
     
@@ -668,6 +763,8 @@ void HS_MonitorEvent_Test_MsgActsError(void)
     HS_AppData.MATablePtr[0].EnableState = HS_MAT_STATE_ENABLED;
     HS_AppData.MATablePtr[0].Cooldown = 5;
 
+    HS_EventMonIndexRefresh();
+
     /* Execute the function being tested */
     HS_MonitorEvent((CFE_SB_MsgPtr_t)&Packet);
     
@@ -683,6 +780,133 @@ void HS_MonitorEvent_Test_MsgActsError(void)
 
 } /* end HS_MonitorEvent_Test_MsgActsError */
 
+void HS_MonitorEvent_Test_EventStorm(void)
+{
+    HS_EMTEntry_t            EMTable[HS_MAX_MONITORED_EVENTS];
+    HS_MATEntry_t            MATable[HS_MAX_MSG_ACT_TYPES];
+    CFE_EVS_ShortEventTlm_t  Packet;
+    uint32                   i;
+
+    memset(EMTable, 0, sizeof(EMTable));
+    memset(MATable, 0, sizeof(MATable));
+
+    CFE_SB_InitMsg (&Packet, CFE_EVS_SHORT_EVENT_MSG_MID, sizeof(CFE_EVS_ShortEventTlm_t), TRUE);
+
+    HS_AppData.EMTablePtr = EMTable;
+    HS_AppData.MATablePtr = MATable;
+
+    /* Two apps monitored for the same event, and one entry with no action */
+    HS_AppData.EMTablePtr[0].ActionType  = HS_EMT_ACT_LAST_NONMSG + 1;
+    HS_AppData.EMTablePtr[0].EventID = 3;
+    strncpy (HS_AppData.EMTablePtr[0].AppName, "AppName", 10);
+
+    HS_AppData.EMTablePtr[1].ActionType  = HS_EMT_ACT_LAST_NONMSG + 2;
+    HS_AppData.EMTablePtr[1].EventID = 3;
+    strncpy (HS_AppData.EMTablePtr[1].AppName, "OtherApp", 10);
+
+    HS_AppData.EMTablePtr[HS_MAX_MONITORED_EVENTS - 1].ActionType  = HS_EMT_ACT_NOACT;
+    HS_AppData.EMTablePtr[HS_MAX_MONITORED_EVENTS - 1].EventID = 4;
+    strncpy (HS_AppData.EMTablePtr[HS_MAX_MONITORED_EVENTS - 1].AppName, "AppName", 10);
+
+    HS_AppData.MsgActsState = HS_STATE_ENABLED;
+    HS_AppData.MATablePtr[0].EnableState = HS_MAT_STATE_NOEVENT;
+    HS_AppData.MATablePtr[0].Cooldown = 0;
+    HS_AppData.MATablePtr[1].EnableState = HS_MAT_STATE_NOEVENT;
+    HS_AppData.MATablePtr[1].Cooldown = 0;
+
+    HS_EventMonIndexRefresh();
+
+    /* Execute the function being tested: replay a storm of short format events,
+       cycling through 8 event IDs for each of the two apps */
+    for (i = 0; i < 1024; i++)
+    {
+        Packet.Payload.PacketID.EventID = i % 8;
+        strncpy (Packet.Payload.PacketID.AppName, ((i / 8) % 2 == 0) ? "AppName" : "OtherApp", 10);
+
+        HS_MonitorEvent((CFE_SB_MsgPtr_t)&Packet);
+    }
+
+    /* Verify results */
+    UtAssert_True (HS_AppData.MsgActExec == 128, "HS_AppData.MsgActExec == 128");
+
+    UtAssert_True (Ut_CFE_EVS_GetEventQueueDepth() == 0, "Ut_CFE_EVS_GetEventQueueDepth() == 0");
+
+} /* end HS_MonitorEvent_Test_EventStorm */
+
+/*
+** Timed replay of an event storm against a full Event Monitor Table.  Half
+** of the events match a table entry and the other half match no entry.
+** The replay rate is printed so that changes to the event matching can be
+** compared on the same host; only the message action count is asserted.
+*/
+#define HS_UT_EVENT_STORM_REPLAYS   (2 * HS_MAX_MONITORED_EVENTS * 4096)
+
+void HS_MonitorEvent_Test_EventStormTimed(void)
+{
+    HS_EMTEntry_t            EMTable[HS_MAX_MONITORED_EVENTS];
+    HS_MATEntry_t            MATable[HS_MAX_MSG_ACT_TYPES];
+    CFE_EVS_ShortEventTlm_t  Packets[2 * HS_MAX_MONITORED_EVENTS];
+    struct timespec          Start;
+    struct timespec          End;
+    uint32                   ElapsedUsecs;
+    uint32                   i;
+
+    memset(EMTable, 0, sizeof(EMTable));
+    memset(MATable, 0, sizeof(MATable));
+
+    HS_AppData.EMTablePtr = EMTable;
+    HS_AppData.MATablePtr = MATable;
+
+    /* Entry i monitors event ID 100 + i from its own app */
+    for (i = 0; i < HS_MAX_MONITORED_EVENTS; i++)
+    {
+        HS_AppData.EMTablePtr[i].ActionType  = HS_EMT_ACT_LAST_NONMSG + 1;
+        HS_AppData.EMTablePtr[i].EventID = 100 + i;
+        snprintf (HS_AppData.EMTablePtr[i].AppName, OS_MAX_API_NAME, "StormApp%u", (unsigned int)i);
+    }
+
+    /* Packets past the table size carry event IDs that no entry monitors */
+    for (i = 0; i < 2 * HS_MAX_MONITORED_EVENTS; i++)
+    {
+        CFE_SB_InitMsg (&Packets[i], CFE_EVS_SHORT_EVENT_MSG_MID, sizeof(CFE_EVS_ShortEventTlm_t), TRUE);
+        Packets[i].Payload.PacketID.EventID = 100 + i;
+        snprintf (Packets[i].Payload.PacketID.AppName, OS_MAX_API_NAME, "StormApp%u",
+                  (unsigned int)(i % HS_MAX_MONITORED_EVENTS));
+    }
+
+    HS_AppData.MsgActsState = HS_STATE_ENABLED;
+    HS_AppData.MATablePtr[0].EnableState = HS_MAT_STATE_NOEVENT;
+    HS_AppData.MATablePtr[0].Cooldown = 0;
+
+    HS_EventMonIndexRefresh();
+
+    /* Execute the function being tested */
+    clock_gettime(CLOCK_MONOTONIC, &Start);
+
+    for (i = 0; i < HS_UT_EVENT_STORM_REPLAYS; i++)
+    {
+        HS_MonitorEvent((CFE_SB_MsgPtr_t)&Packets[i % (2 * HS_MAX_MONITORED_EVENTS)]);
+    }
+
+    clock_gettime(CLOCK_MONOTONIC, &End);
+
+    ElapsedUsecs = (End.tv_sec - Start.tv_sec) * 1000000 + (End.tv_nsec - Start.tv_nsec) / 1000;
+    if (ElapsedUsecs == 0)
+    {
+        ElapsedUsecs = 1;
+    }
+
+    printf("HS_MonitorEvent_Test_EventStormTimed: %lu events in %lu us, %lu events per ms\n",
+           (unsigned long)HS_UT_EVENT_STORM_REPLAYS, (unsigned long)ElapsedUsecs,
+           (unsigned long)(((uint64)HS_UT_EVENT_STORM_REPLAYS * 1000) / ElapsedUsecs));
+
+    /* Verify results */
+    UtAssert_True (HS_AppData.MsgActExec == HS_UT_EVENT_STORM_REPLAYS / 2, "HS_AppData.MsgActExec == HS_UT_EVENT_STORM_REPLAYS / 2");
+
+    UtAssert_True (Ut_CFE_EVS_GetEventQueueDepth() == 0, "Ut_CFE_EVS_GetEventQueueDepth() == 0");
+
+} /* end HS_MonitorEvent_Test_EventStormTimed */
+
 void HS_MonitorUtilization_Test_HighCurrentUtil(void)
 {
     HS_CustomData.LastIdleTaskInterval = 1;
@@ -1561,6 +1785,8 @@ void HS_Monitors_Test_AddTestCases(void)
 {
     UtTest_Add(HS_MonitorApplications_Test_AppNameNotFound, HS_Test_Setup, HS_Test_TearDown, "HS_MonitorApplications_Test_AppNameNotFound");
     UtTest_Add(HS_MonitorApplications_Test_GetExeCountFailure, HS_Test_Setup, HS_Test_TearDown, "HS_MonitorApplications_Test_GetExeCountFailure");
+    UtTest_Add(HS_MonitorApplications_Test_ResolvedOnce, HS_Test_Setup, HS_Test_TearDown, "HS_MonitorApplications_Test_ResolvedOnce");
+    UtTest_Add(HS_MonitorApplications_Test_ResolveAfterRestart, HS_Test_Setup, HS_Test_TearDown, "HS_MonitorApplications_Test_ResolveAfterRestart");
     UtTest_Add(HS_MonitorApplications_Test_ProcessorResetError, HS_Test_Setup, HS_Test_TearDown, "HS_MonitorApplications_Test_ProcessorResetError");
     UtTest_Add(HS_MonitorApplications_Test_ProcessorResetActionLimitError, HS_Test_Setup, HS_Test_TearDown, "HS_MonitorApplications_Test_ProcessorResetActionLimitError");
     UtTest_Add(HS_MonitorApplications_Test_RestartAppErrorsGetAppInfoSuccess, HS_Test_Setup, HS_Test_TearDown, "HS_MonitorApplications_Test_RestartAppErrorsGetAppInfoSuccess");
@@ -1576,6 +1802,8 @@ void HS_Monitors_Test_AddTestCases(void)
     UtTest_Add(HS_MonitorEvent_Test_DeleteErrors, HS_Test_Setup, HS_Test_TearDown, "HS_MonitorEvent_Test_DeleteErrors");
     UtTest_Add(HS_MonitorEvent_Test_OnlySecondDeleteError, HS_Test_Setup, HS_Test_TearDown, "HS_MonitorEvent_Test_OnlySecondDeleteError");
     UtTest_Add(HS_MonitorEvent_Test_MsgActsError, HS_Test_Setup, HS_Test_TearDown, "HS_MonitorEvent_Test_MsgActsError");
+    UtTest_Add(HS_MonitorEvent_Test_EventStorm, HS_Test_Setup, HS_Test_TearDown, "HS_MonitorEvent_Test_EventStorm");
+    UtTest_Add(HS_MonitorEvent_Test_EventStormTimed, HS_Test_Setup, HS_Test_TearDown, "HS_MonitorEvent_Test_EventStormTimed");
 
     UtTest_Add(HS_MonitorUtilization_Test_HighCurrentUtil, HS_Test_Setup, HS_Test_TearDown, "HS_MonitorUtilization_Test_HighCurrentUtil");
     UtTest_Add(HS_MonitorUtilization_Test_CurrentUtilLessThanZero, HS_Test_Setup, HS_Test_TearDown, "HS_MonitorUtilization_Test_CurrentUtilLessThanZero");
@@ -29,6 +29,9 @@
 
 #include "hs_test_utils.h"
 #include "hs_app.h"
+#include "hs_custom.h"
+#include "utassert.h"
+#include <string.h>
 
 extern HS_AppData_t     HS_AppData;
 
@@ -41,6 +44,7 @@ void HS_Test_Setup(void)
     /* initialize test environment to default state for every test */
 
     CFE_PSP_MemSet(&HS_AppData, 0, sizeof(HS_AppData_t));
+    CFE_PSP_MemSet(&HS_CustomData, 0, sizeof(HS_CustomData_t));
     
     Ut_CFE_EVS_Reset();
     Ut_CFE_FS_Reset();
@@ -50,6 +54,8 @@ void HS_Test_Setup(void)
     Ut_CFE_ES_Reset();
     Ut_OSAPI_Reset();
     Ut_OSFILEAPI_Reset();
+    Ut_CFE_ES_API_Reset();
+    Ut_OSAPI_EXT_Reset();
 } /* end HS_Test_Setup */
 
 void HS_Test_TearDown(void)
@@ -57,6 +63,195 @@ void HS_Test_TearDown(void)
     /* cleanup test environment */
 } /* end HS_Test_TearDown */
 
+/*
+ * Additional UT-Assert Stub Functions and Required Data Structures
+ *
+ * Note: The UT-Assert ES stubs do not include CFE_ES_GetAppExecCounter, so it is stubbed here with its own
+ * hook and return code tables.
+ */
+
+Ut_CFE_ES_API_HookTable_t          Ut_CFE_ES_API_HookTable;
+Ut_CFE_ES_API_ReturnCodeTable_t    Ut_CFE_ES_API_ReturnCodeTable[UT_CFE_ES_API_MAX_INDEX];
+
+void Ut_CFE_ES_API_Reset(void)
+{
+    memset(&Ut_CFE_ES_API_HookTable, 0, sizeof(Ut_CFE_ES_API_HookTable));
+    memset(&Ut_CFE_ES_API_ReturnCodeTable, 0, sizeof(Ut_CFE_ES_API_ReturnCodeTable));
+}
+
+void Ut_CFE_ES_API_SetFunctionHook(uint32 Index, void *FunPtr)
+{
+    if        (Index == UT_CFE_ES_API_GETAPPEXECCOUNTER_INDEX)      { Ut_CFE_ES_API_HookTable.CFE_ES_GetAppExecCounter = FunPtr; }
+    else
+    {
+        printf("Unsupported ES_API Index In SetFunctionHook Call %lu\n", (unsigned long)Index);
+        UtAssert_True(FALSE, "Unsupported ES_API Index In SetFunctionHook Call");
+    }
+}
+
+void Ut_CFE_ES_API_SetReturnCode(uint32 Index, int32 RtnVal, uint32 CallCnt)
+{
+    if (Index < UT_CFE_ES_API_MAX_INDEX)
+    {
+        Ut_CFE_ES_API_ReturnCodeTable[Index].Value = RtnVal;
+        Ut_CFE_ES_API_ReturnCodeTable[Index].Count = CallCnt;
+    }
+    else
+    {
+        printf("Unsupported ES_API Index In SetReturnCode Call %lu\n", (unsigned long)Index);
+        UtAssert_True(FALSE, "Unsupported ES_API Index In SetReturnCode Call");
+    }
+}
+
+boolean Ut_CFE_ES_API_UseReturnCode(uint32 Index)
+{
+    if (Ut_CFE_ES_API_ReturnCodeTable[Index].Count > 0)
+    {
+        Ut_CFE_ES_API_ReturnCodeTable[Index].Count--;
+        if (Ut_CFE_ES_API_ReturnCodeTable[Index].Count == 0)
+            return(TRUE);
+    }
+    else if (Ut_CFE_ES_API_ReturnCodeTable[Index].ContinueReturnCodeAfterCountZero == TRUE)
+    {
+        return(TRUE);
+    }
+    
+    return(FALSE);
+}
+
+void Ut_CFE_ES_API_ContinueReturnCodeAfterCountZero(uint32 Index)
+{
+    Ut_CFE_ES_API_ReturnCodeTable[Index].ContinueReturnCodeAfterCountZero = TRUE;
+}
+
+int32 CFE_ES_GetAppExecCounter(uint32 AppId, uint32 *ExecutionCounter, uint32 *Generation)
+{
+    /* Check for specified return */
+    if (Ut_CFE_ES_API_UseReturnCode(UT_CFE_ES_API_GETAPPEXECCOUNTER_INDEX))
+        return Ut_CFE_ES_API_ReturnCodeTable[UT_CFE_ES_API_GETAPPEXECCOUNTER_INDEX].Value;
+
+    /* Check for Function Hook */
+    if (Ut_CFE_ES_API_HookTable.CFE_ES_GetAppExecCounter)
+        return(Ut_CFE_ES_API_HookTable.CFE_ES_GetAppExecCounter(AppId, ExecutionCounter, Generation));
+
+    /* A running App that has not executed yet */
+    *ExecutionCounter = 0;
+    *Generation = 1;
+
+    return(CFE_SUCCESS);
+}
+
+/*
+ * Note: The UT-Assert OSAPI stubs do not include the task processor time and object iteration functions used
+ * when HS_UTIL_TASK_CPU_TIME is true, so they are stubbed here with their own hook and return code tables.
+ */
+
+Ut_OSAPI_EXT_HookTable_t          Ut_OSAPI_EXT_HookTable;
+Ut_OSAPI_EXT_ReturnCodeTable_t    Ut_OSAPI_EXT_ReturnCodeTable[UT_OSAPI_EXT_MAX_INDEX];
+
+void Ut_OSAPI_EXT_Reset(void)
+{
+    memset(&Ut_OSAPI_EXT_HookTable, 0, sizeof(Ut_OSAPI_EXT_HookTable));
+    memset(&Ut_OSAPI_EXT_ReturnCodeTable, 0, sizeof(Ut_OSAPI_EXT_ReturnCodeTable));
+}
+
+void Ut_OSAPI_EXT_SetFunctionHook(uint32 Index, void *FunPtr)
+{
+    if      (Index == UT_OSAPI_EXT_TASKGETCPUTIME_INDEX)      { Ut_OSAPI_EXT_HookTable.OS_TaskGetCpuTime = FunPtr; }
+    else if (Index == UT_OSAPI_EXT_FOREACHOBJECT_INDEX)       { Ut_OSAPI_EXT_HookTable.OS_ForEachObject = FunPtr; }
+    else if (Index == UT_OSAPI_EXT_IDENTIFYOBJECT_INDEX)      { Ut_OSAPI_EXT_HookTable.OS_IdentifyObject = FunPtr; }
+    else if (Index == UT_OSAPI_EXT_CONVERTTOARRAYINDEX_INDEX) { Ut_OSAPI_EXT_HookTable.OS_ConvertToArrayIndex = FunPtr; }
+    else
+    {
+        printf("Unsupported OSAPI_EXT Index In SetFunctionHook Call %lu\n", (unsigned long)Index);
+        UtAssert_True(FALSE, "Unsupported OSAPI_EXT Index In SetFunctionHook Call");
+    }
+}
+
+void Ut_OSAPI_EXT_SetReturnCode(uint32 Index, int32 RtnVal, uint32 CallCnt)
+{
+    if (Index < UT_OSAPI_EXT_MAX_INDEX)
+    {
+        Ut_OSAPI_EXT_ReturnCodeTable[Index].Value = RtnVal;
+        Ut_OSAPI_EXT_ReturnCodeTable[Index].Count = CallCnt;
+    }
+    else
+    {
+        printf("Unsupported OSAPI_EXT Index In SetReturnCode Call %lu\n", (unsigned long)Index);
+        UtAssert_True(FALSE, "Unsupported OSAPI_EXT Index In SetReturnCode Call");
+    }
+}
+
+boolean Ut_OSAPI_EXT_UseReturnCode(uint32 Index)
+{
+    if (Ut_OSAPI_EXT_ReturnCodeTable[Index].Count > 0)
+    {
+        Ut_OSAPI_EXT_ReturnCodeTable[Index].Count--;
+        if (Ut_OSAPI_EXT_ReturnCodeTable[Index].Count == 0)
+            return(TRUE);
+    }
+    else if (Ut_OSAPI_EXT_ReturnCodeTable[Index].ContinueReturnCodeAfterCountZero == TRUE)
+    {
+        return(TRUE);
+    }
+    
+    return(FALSE);
+}
+
+void Ut_OSAPI_EXT_ContinueReturnCodeAfterCountZero(uint32 Index)
+{
+    Ut_OSAPI_EXT_ReturnCodeTable[Index].ContinueReturnCodeAfterCountZero = TRUE;
+}
+
+int32 OS_TaskGetCpuTime(uint32 task_id, OS_time_t *cpu_time)
+{
+    /* Check for specified return */
+    if (Ut_OSAPI_EXT_UseReturnCode(UT_OSAPI_EXT_TASKGETCPUTIME_INDEX))
+        return Ut_OSAPI_EXT_ReturnCodeTable[UT_OSAPI_EXT_TASKGETCPUTIME_INDEX].Value;
+
+    /* Check for Function Hook */
+    if (Ut_OSAPI_EXT_HookTable.OS_TaskGetCpuTime)
+        return(Ut_OSAPI_EXT_HookTable.OS_TaskGetCpuTime(task_id, cpu_time));
+
+    /* By default, behave like an OS that does not keep processor time per task */
+    return(OS_ERR_NOT_IMPLEMENTED);
+}
+
+void OS_ForEachObject(uint32 creator_id, OS_ArgCallback_t callback_ptr, void *callback_arg)
+{
+    /* Check for Function Hook */
+    if (Ut_OSAPI_EXT_HookTable.OS_ForEachObject)
+        Ut_OSAPI_EXT_HookTable.OS_ForEachObject(creator_id, callback_ptr, callback_arg);
+}
+
+uint32 OS_IdentifyObject(uint32 object_id)
+{
+    /* Check for specified return */
+    if (Ut_OSAPI_EXT_UseReturnCode(UT_OSAPI_EXT_IDENTIFYOBJECT_INDEX))
+        return (uint32)Ut_OSAPI_EXT_ReturnCodeTable[UT_OSAPI_EXT_IDENTIFYOBJECT_INDEX].Value;
+
+    /* Check for Function Hook */
+    if (Ut_OSAPI_EXT_HookTable.OS_IdentifyObject)
+        return(Ut_OSAPI_EXT_HookTable.OS_IdentifyObject(object_id));
+
+    return(object_id >> OS_OBJECT_TYPE_SHIFT);
+}
+
+int32 OS_ConvertToArrayIndex(uint32 object_id, uint32 *ArrayIndex)
+{
+    /* Check for specified return */
+    if (Ut_OSAPI_EXT_UseReturnCode(UT_OSAPI_EXT_CONVERTTOARRAYINDEX_INDEX))
+        return Ut_OSAPI_EXT_ReturnCodeTable[UT_OSAPI_EXT_CONVERTTOARRAYINDEX_INDEX].Value;
+
+    /* Check for Function Hook */
+    if (Ut_OSAPI_EXT_HookTable.OS_ConvertToArrayIndex)
+        return(Ut_OSAPI_EXT_HookTable.OS_ConvertToArrayIndex(object_id, ArrayIndex));
+
+    *ArrayIndex = object_id & OS_OBJECT_INDEX_MASK;
+
+    return(OS_SUCCESS);
+}
+
 
 /************************/
 /*  End of File Comment */
@@ -50,6 +50,70 @@
 void HS_Test_Setup(void);
 void HS_Test_TearDown(void);
 
+/*
+ * Additional UT-Assert Stub Functions and Required Data Structures
+ *
+ * Note: The UT-Assert ES stubs do not include CFE_ES_GetAppExecCounter, so it is stubbed here with its own
+ * hook and return code tables.
+ */
+
+typedef enum 
+{
+    UT_CFE_ES_API_GETAPPEXECCOUNTER_INDEX,
+    UT_CFE_ES_API_MAX_INDEX
+} Ut_CFE_ES_API_INDEX_t;
+
+typedef struct
+{
+    int32 (*CFE_ES_GetAppExecCounter)(uint32 AppId, uint32 *ExecutionCounter, uint32 *Generation);
+} Ut_CFE_ES_API_HookTable_t;
+
+typedef struct
+{
+    int32   Value;
+    uint32  Count;
+    boolean ContinueReturnCodeAfterCountZero;
+} Ut_CFE_ES_API_ReturnCodeTable_t;
+
+void Ut_CFE_ES_API_Reset(void);
+void Ut_CFE_ES_API_SetFunctionHook(uint32 Index, void *FunPtr);
+void Ut_CFE_ES_API_SetReturnCode(uint32 Index, int32 RtnVal, uint32 CallCnt);
+void Ut_CFE_ES_API_ContinueReturnCodeAfterCountZero(uint32 Index);
+
+/*
+ * Note: The UT-Assert OSAPI stubs do not include the task processor time and object iteration functions used
+ * when HS_UTIL_TASK_CPU_TIME is true, so they are stubbed here with their own hook and return code tables.
+ */
+
+typedef enum 
+{
+    UT_OSAPI_EXT_TASKGETCPUTIME_INDEX,
+    UT_OSAPI_EXT_FOREACHOBJECT_INDEX,
+    UT_OSAPI_EXT_IDENTIFYOBJECT_INDEX,
+    UT_OSAPI_EXT_CONVERTTOARRAYINDEX_INDEX,
+    UT_OSAPI_EXT_MAX_INDEX
+} Ut_OSAPI_EXT_INDEX_t;
+
+typedef struct
+{
+    int32  (*OS_TaskGetCpuTime)(uint32 task_id, OS_time_t *cpu_time);
+    void   (*OS_ForEachObject)(uint32 creator_id, OS_ArgCallback_t callback_ptr, void *callback_arg);
+    uint32 (*OS_IdentifyObject)(uint32 object_id);
+    int32  (*OS_ConvertToArrayIndex)(uint32 object_id, uint32 *ArrayIndex);
+} Ut_OSAPI_EXT_HookTable_t;
+
+typedef struct
+{
+    int32   Value;
+    uint32  Count;
+    boolean ContinueReturnCodeAfterCountZero;
+} Ut_OSAPI_EXT_ReturnCodeTable_t;
+
+void Ut_OSAPI_EXT_Reset(void);
+void Ut_OSAPI_EXT_SetFunctionHook(uint32 Index, void *FunPtr);
+void Ut_OSAPI_EXT_SetReturnCode(uint32 Index, int32 RtnVal, uint32 CallCnt);
+void Ut_OSAPI_EXT_ContinueReturnCodeAfterCountZero(uint32 Index);
+
 
 /************************/
 /*  End of File Comment */
@@ -30,6 +30,7 @@
 
 #include "hs_monitors_test.h"
 #include "hs_app.h"
+#include "hs_utils.h"
 #include "hs_msg.h"
 #include "hs_msgdefs.h"
 #include "hs_msgids.h"
@@ -52,6 +53,7 @@
 #include <sys/fcntl.h>
 #include <unistd.h>
 #include <stdlib.h>
+#include <string.h>
 
 /*
  * Function Definitions
@@ -161,6 +163,21 @@ void HS_EMTActionIsValid_Invalid(void)
 
 }
 
+void HS_AppNameHash_Test(void)
+{
+    char   AppName[OS_MAX_API_NAME + 4];
+
+    memset(AppName, 'A', sizeof(AppName));
+    AppName[sizeof(AppName) - 1] = '\0';
+
+    UtAssert_True(HS_AppNameHash("AppName") == HS_AppNameHash("AppName"), "HS_AppNameHash(\"AppName\") is repeatable");
+    UtAssert_True(HS_AppNameHash("AppName") != HS_AppNameHash("AppNamf"), "HS_AppNameHash(\"AppName\") != HS_AppNameHash(\"AppNamf\")");
+
+    /* Only the first OS_MAX_API_NAME characters are hashed, as with the strncmp they stand in for */
+    UtAssert_True(HS_AppNameHash(AppName) == HS_AppNameHash(&AppName[3]), "Characters past OS_MAX_API_NAME are not hashed");
+
+}
+
 void HS_Utils_Test_AddTestCases(void)
 {
     UtTest_Add(HS_VerifyMsgLength_Test_Nominal, HS_Test_Setup, HS_Test_TearDown, "HS_VerifyMsgLength_Test_Nominal");
@@ -175,4 +192,6 @@ void HS_Utils_Test_AddTestCases(void)
 
     UtTest_Add(HS_EMTActionIsValid_Invalid, HS_Test_Setup, HS_Test_TearDown, "HS_EMTActionIsValid_Invalid");
 
+    UtTest_Add(HS_AppNameHash_Test, HS_Test_Setup, HS_Test_TearDown, "HS_AppNameHash_Test");
+
 }
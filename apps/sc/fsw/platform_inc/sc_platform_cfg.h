@@ -55,11 +55,11 @@
  ** Macro Definitions
  *************************************************************************/
  
-/** \sccfg  Max number of commands per second
+/** \sccfg  Max number of commands per rate limit window
 **  
 **  \par Description:
 **       Maximum number of commands that can be sent out by SC 
-*        in any given second.
+*        in any one rate limit window (see #SC_CMD_RATE_WINDOW_MSEC).
 **
 **  \par Limits:
 **       This parameter can't be larger than an unsigned 16 bit
@@ -67,7 +67,33 @@
 **       avoid SC hogging the CPU
 **          
 */
-#define SC_MAX_CMDS_PER_SEC             8   
+#define SC_MAX_CMDS_PER_WINDOW          8   
+
+
+/** \sccfg  Command rate limit window in milliseconds
+**  
+**  \par Description:
+**       Length of the window over which #SC_MAX_CMDS_PER_WINDOW is
+**       enforced.  Commands that become due once the limit has been
+**       reached are released as soon as the window expires.
+**
+**  \par Limits:
+**       This parameter must be between 1 and 60000.
+*/
+#define SC_CMD_RATE_WINDOW_MSEC         1000
+
+
+/** \sccfg  Longest time SC waits for the next command to come due
+**  
+**  \par Description:
+**       SC sleeps on its command pipe until the next ATS or RTS command
+**       is due.  The wait is capped at this many milliseconds so that a
+**       change to the spacecraft time is noticed promptly.
+**
+**  \par Limits:
+**       This parameter must be between 1 and 60000.
+*/
+#define SC_MAX_WAKEUP_WAIT_MSEC         1000
 
 
 /** \sccfg  Number of RTS's
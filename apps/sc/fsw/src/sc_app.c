@@ -74,6 +74,8 @@
 #include "sc_rts.h"
 #include "sc_cmds.h"
 #include "sc_loads.h"
+#include "sc_state.h"
+#include "sc_utils.h"
 #include "sc_events.h"
 #include "sc_msgids.h"
 #include "sc_perfids.h"
@@ -105,6 +107,7 @@ void SC_AppMain(void)
 {   
     uint32 RunStatus = CFE_ES_APP_RUN;
     int32 Result;
+    int32 Timeout;
 
     /* Register application with cFE */
     Result = CFE_ES_RegisterApp();
@@ -131,8 +134,11 @@ void SC_AppMain(void)
         /* Performance Log (stop time counter) */
         CFE_ES_PerfLogExit(SC_APPMAIN_PERF_ID);
 
+        /* Sleep no longer than until the next stored command is due */
+        Timeout = SC_GetWakeupTimeout();
+
         /* Pend on Software Bus for message */
-        Result = CFE_SB_RcvMsg(&SC_OperData.MsgPtr, SC_OperData.CmdPipe, CFE_SB_PEND_FOREVER);
+        Result = CFE_SB_RcvMsg(&SC_OperData.MsgPtr, SC_OperData.CmdPipe, Timeout);
 
         /* Performance Log (start time counter) */
         CFE_ES_PerfLogEntry(SC_APPMAIN_PERF_ID);
@@ -143,6 +149,13 @@ void SC_AppMain(void)
             /* Invoke command handlers */
             SC_ProcessRequest(SC_OperData.MsgPtr);   
         }
+        else if ((Result == CFE_SB_TIME_OUT) || (Result == CFE_SB_NO_MESSAGE))
+        {
+            /* A stored command is due, release it without waiting for 1Hz */
+            SC_GetCurrentTime();
+            SC_ProcessDueCommands();
+            Result = CFE_SUCCESS;
+        }
         else
         {
             /* Exit main process loop */
@@ -322,6 +335,9 @@ int32 SC_InitTables(void)
         SC_OperData.RtsInfoTblAddr[i].DisabledFlag = TRUE;
     }
 
+    /* Nothing is executing yet */
+    SC_InitRtsSchedule();
+
     /* Load default RTS tables */  
     SC_LoadDefaultTables();
 
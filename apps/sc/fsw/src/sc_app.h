@@ -257,6 +257,12 @@ void SC_RegisterManageCmds(void);
 
 #define SC_DUP_TEST_UNUSED  -1
 
+/**
+** \name Saturation value for millisecond time differences */ 
+/** \{ */
+#define SC_MAX_ELAPSED_MSEC     0x7FFFFFFF
+/** \} */
+
 /*********************************************************************************************/
 
 /** 
@@ -331,7 +337,11 @@ typedef struct
     int32                   AtsDupTestArray[SC_MAX_ATS_CMDS];   /**< \brief ATS test for duplicate cmd numbers  */
 
     uint16                  NumCmdsSec;                         /**< \brief the num of cmds that have gone out
-                                                                      in a one second period                    */
+                                                                      in the current rate limit window          */
+    SC_AbsTimeTag_t         RateWindowSecs;                     /**< \brief Start of the rate limit window,
+                                                                      seconds                                   */
+    uint16                  RateWindowMsec;                     /**< \brief Start of the rate limit window,
+                                                                      milliseconds within the second            */
     SC_HkTlm_t              HkPacket;                           /**< \brief SC Housekeeping structure           */
 
     
@@ -353,10 +363,20 @@ typedef struct
          first, the second entry has the number of the 2nd cmd, etc.. */
          
     int32                   AtsCmdIndexBuffer[SC_NUMBER_OF_ATS][SC_MAX_ATS_CMDS]; 
+
+    boolean                 AtsCmdChecksumOk[SC_NUMBER_OF_ATS][SC_MAX_ATS_CMDS];
+    /**< \brief Checksum result for each loaded ATS command, computed once
+         when the command is loaded or appended */
+
+    uint16                  RtsBadChecksumPtr[SC_NUMBER_OF_RTS];
+    /**< \brief Word offset of the first command in each RTS that fails its
+         checksum, #SC_RTS_BUFF_SIZE when every command passes.  Computed
+         once when the RTS is loaded. */
   
     uint8                   NextProcNumber;   /**< \brief the next command processor number */
     SC_AbsTimeTag_t         NextCmdTime[2];   /**< \brief The overall next command time  0 - ATP, 1- RTP*/
     SC_AbsTimeTag_t         CurrentTime;      /**< \brief this is the current time for SC */
+    uint16                  CurrentMsec;      /**< \brief milliseconds within the current second */
     uint16                  CmdErrCtr;        /**< \brief Counts Request Errors  */
     uint16                  CmdCtr;           /**< \brief  Counts Ground Requests */
     uint16                  RtsActiveErrCtr;  /**< \brief Increments when an attempt to start an RTS fails */
@@ -380,6 +400,16 @@ typedef struct
 
     uint16                  Unused;           /**< \brief Unused */
     uint16                  AutoStartRTS;     /**< \brief Start selected auto-exec RTS after init */                              
+
+    uint32                  LastCmdLatency;   /**< \brief Release latency of the last ATS/RTS command (msec) */
+    uint32                  MaxCmdLatency;    /**< \brief Largest release latency since counters reset (msec) */
+
+    uint16                  RtsHeap[SC_NUMBER_OF_RTS];
+    /**< \brief Indexes of the executing RTS's kept as a min heap on next command
+         time, the root is the RTS that runs next */
+    uint16                  RtsHeapPos[SC_NUMBER_OF_RTS];
+    /**< \brief Heap position plus one of each RTS, zero when it is not executing */
+    uint16                  RtsHeapSize;      /**< \brief Number of RTS's in the schedule heap */
     
 } SC_AppData_t;
 
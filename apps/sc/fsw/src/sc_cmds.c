@@ -157,15 +157,16 @@ void SC_ProcessAtpCmd (void)
             if (Entry->CmdNumber == (CmdIndex + 1))
             {
                 /*
-                 ** Check the checksum on the command
-                 **
+                 ** Check the checksum on the command, it was
+                 ** validated once when the command was loaded
                  */
-                if (CFE_SB_ValidateChecksum(CmdPtr) == TRUE)
+                if (SC_AppData.AtsCmdChecksumOk[AtsIndex][CmdIndex] == TRUE)
                 {
                     /*
                      ** Count the command for the rate limiter
                      */
                     SC_OperData.NumCmdsSec++;
+                    SC_RecordCmdLatency(SC_AppData.NextCmdTime[SC_ATP]);
 
                     /*
                      **  First check to see if the command is a switch command,
@@ -384,6 +385,7 @@ void SC_ProcessRtpCommand (void)
          ** even if the command fails
          */
         SC_OperData.NumCmdsSec++;
+        SC_RecordCmdLatency(SC_AppData.NextCmdTime[SC_RTP]);
 
         /* get the RTS number that can be directly indexed into the table*/
         RtsNum = SC_OperData.RtsCtrlBlckAddr -> RtsNumber - 1;
@@ -399,7 +401,11 @@ void SC_ProcessRtpCommand (void)
         RtsEntryPtr = (SC_RtsEntryHeader_t *) &SC_OperData.RtsTblAddr[RtsNum][CmdOffset];
         CmdPtr = (CFE_SB_MsgPtr_t) RtsEntryPtr->CmdHeader;
 
-        if (CFE_SB_ValidateChecksum(CmdPtr) ==  TRUE)
+        /*
+         ** Checksums were validated once when the RTS was loaded,
+         ** every command before the first failure is good
+         */
+        if (CmdOffset < SC_AppData.RtsBadChecksumPtr[RtsNum])
         {
             /*
              ** Try Sending the command on the Software Bus
@@ -517,6 +523,9 @@ void SC_SendHkPacket (void)
     SC_OperData.HkPacket.SwitchPendFlag = SC_OperData.AtsCtrlBlckAddr -> SwitchPendFlag;
     
     SC_OperData.HkPacket.NextAtsTime = SC_AppData.NextCmdTime[SC_ATP];
+
+    SC_OperData.HkPacket.LastCmdLatency = SC_AppData.LastCmdLatency;
+    SC_OperData.HkPacket.MaxCmdLatency  = SC_AppData.MaxCmdLatency;
     
     /*
      ** Fill out the RTP control block information
@@ -581,6 +590,8 @@ void SC_ResetCountersCmd (CFE_SB_MsgPtr_t CmdPacket)
         SC_AppData.RtsCmdErrCtr = 0;
         SC_AppData.RtsActiveCtr = 0;
         SC_AppData.RtsActiveErrCtr = 0;  
+        SC_AppData.LastCmdLatency = 0;
+        SC_AppData.MaxCmdLatency = 0;
     }
 } /* end SC_ResetCountersCmd */
 
@@ -605,6 +616,72 @@ void SC_NoOpCmd(CFE_SB_MsgPtr_t CmdPacket)
 }/* End SC_NoOpCmd */
        
 
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/*  Release every ATS and RTS command that is due                  */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void SC_ProcessDueCommands (void)
+{
+    boolean IsThereAnotherCommandToExecute = FALSE;
+
+    /*
+     ** Open a new rate limit window once the current one has expired
+     ** (or if the clock has been set back past its start)
+     */
+    if ((SC_OperData.RateWindowSecs > SC_AppData.CurrentTime) ||
+        (SC_GetElapsedMsec(SC_OperData.RateWindowSecs, SC_OperData.RateWindowMsec) >= SC_CMD_RATE_WINDOW_MSEC))
+    {
+        SC_OperData.NumCmdsSec     = 0;
+        SC_OperData.RateWindowSecs = SC_AppData.CurrentTime;
+        SC_OperData.RateWindowMsec = SC_AppData.CurrentMsec;
+    }
+
+    /*
+     ** Commands that share a due time are released together, up to
+     ** the number of commands left in this rate limit window
+     */
+    do
+    {
+        /*
+         **  Check to see if there is an ATS switch Pending, if so service it.
+         */
+        if (SC_OperData.AtsCtrlBlckAddr -> SwitchPendFlag == TRUE)
+        {
+            SC_ServiceSwitchPend();
+        }
+        
+        if (SC_OperData.NumCmdsSec < SC_MAX_CMDS_PER_WINDOW)
+        {
+            if (SC_AppData.NextProcNumber == SC_ATP)
+            {
+                SC_ProcessAtpCmd();
+            }
+            else
+            {
+                if (SC_AppData.NextProcNumber == SC_RTP)
+                {
+                    SC_ProcessRtpCommand();
+                }
+            }
+        }
+        
+        SC_UpdateNextTime();
+        
+        if ((SC_AppData.NextProcNumber == SC_NONE) ||
+            (SC_AppData.NextCmdTime[SC_AppData.NextProcNumber] > SC_AppData.CurrentTime) ||
+            (SC_OperData.NumCmdsSec >= SC_MAX_CMDS_PER_WINDOW))
+        {
+            IsThereAnotherCommandToExecute = FALSE;
+        }
+        else /* Command needs to run immediately */
+        {
+            IsThereAnotherCommandToExecute = TRUE;
+        }
+    } while (IsThereAnotherCommandToExecute);
+
+} /* end SC_ProcessDueCommands */
+
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
 /*  Process Requests                                               */
@@ -613,7 +690,6 @@ void SC_NoOpCmd(CFE_SB_MsgPtr_t CmdPacket)
 void SC_ProcessRequest (CFE_SB_MsgPtr_t CmdPacket)
 {      
     CFE_SB_MsgId_t  MessageID;
-    int8            IsThereAnotherCommandToExecute = FALSE;
 
     /* cast the packet header pointer on the packet buffer */
 
@@ -658,54 +734,10 @@ void SC_ProcessRequest (CFE_SB_MsgPtr_t CmdPacket)
             
             case SC_1HZ_WAKEUP_MID:
             /*
-             ** Time to execute a command in the SC memory
+             ** Commands are normally released by the timed pend in the
+             ** main loop, the 1Hz wakeup remains as a backstop
              */
-            
-            do
-            {
-                /*
-                 **  Check to see if there is an ATS switch Pending, if so service it.
-                 */
-                if (SC_OperData.AtsCtrlBlckAddr -> SwitchPendFlag == TRUE)
-                {
-                    SC_ServiceSwitchPend();
-                }
-                
-                if (SC_AppData.NextProcNumber == SC_ATP)
-                {
-                    SC_ProcessAtpCmd();
-                }
-                else
-                {
-                    if (SC_AppData.NextProcNumber == SC_RTP)
-                    {
-                        SC_ProcessRtpCommand();
-                    }
-                }
-                
-                SC_UpdateNextTime();
-                
-                if ((SC_AppData.NextProcNumber == SC_NONE) ||
-                    (SC_AppData.NextCmdTime[SC_AppData.NextProcNumber] > SC_AppData.CurrentTime))
-                {
-                    SC_OperData.NumCmdsSec = 0;
-                    IsThereAnotherCommandToExecute = FALSE;
-                }
-                else /* Command needs to run immediately */
-                {
-                    if (SC_OperData.NumCmdsSec >= SC_MAX_CMDS_PER_SEC)
-                    {
-                        SC_OperData.NumCmdsSec = 0;
-                        IsThereAnotherCommandToExecute = FALSE;
-                    }
-                    else
-                    {
-                        IsThereAnotherCommandToExecute = TRUE;
-                    }
-                    
-                }
-            } while (IsThereAnotherCommandToExecute);
-            
+            SC_ProcessDueCommands();
             break;
             
             default:
@@ -145,6 +145,23 @@ void SC_ManageAppendTable(void);
  *************************************************************************/
 void SC_ProcessRequest (CFE_SB_MsgPtr_t CmdPacket);
 
+/************************************************************************/
+/** \brief Releases all ATS and RTS commands that are due
+ **  
+ **  \par Description
+ **           This routine dispatches every ATS and RTS command whose time
+ **           tag is at or before the current time, subject to the rate
+ **           limit of #SC_MAX_CMDS_PER_WINDOW commands per
+ **           #SC_CMD_RATE_WINDOW_MSEC.  It is called when the main loop
+ **           pend times out at the next command time and on every 1Hz
+ **           wakeup message.
+ **
+ **  \par Assumptions, External Events, and Notes:
+ **        The current time must have been refreshed by the caller
+ **
+ *************************************************************************/
+void SC_ProcessDueCommands (void);
+
 /************************************************************************/
 /** \brief Processes commands
  **  
@@ -82,6 +82,7 @@
 #include "sc_app.h"
 #include "sc_loads.h"
 #include "sc_atsrq.h"
+#include "sc_state.h"
 #include "sc_utils.h"
 #include "sc_events.h"
 
@@ -91,6 +92,45 @@
  **
  **************************************************************************/
 
+/**************************************************************************
+ **
+ ** Local structures
+ **
+ **************************************************************************/
+
+/*
+** Sort key for one ATS command, the execution time is read from the
+** ATS buffer once so sorting does not chase pointers into the table
+*/
+typedef struct
+{
+    SC_AbsTimeTag_t  Time;          /* command execution time */
+    uint16           CmdIndex;      /* ATS command index (cmd num - 1) */
+
+} SC_AtsTimeKey_t;
+
+/**************************************************************************
+ **
+ ** Local data
+ **
+ **************************************************************************/
+
+/* Scratch keys used while building or merging a time index table */
+static SC_AtsTimeKey_t  SC_TimeKeys[SC_MAX_ATS_CMDS];
+
+/**************************************************************************
+ **
+ ** Local function prototypes
+ **
+ **************************************************************************/
+
+static boolean SC_TimeKeyIsLater (const SC_AtsTimeKey_t *Key1, const SC_AtsTimeKey_t *Key2);
+static void    SC_SortTimeKeys (SC_AtsTimeKey_t Keys[], uint32 Count);
+static void    SC_SiftDownTimeKey (SC_AtsTimeKey_t Keys[], uint32 Root, uint32 Count);
+static void    SC_MergeTimeIndexTable (uint16 AtsIndex, uint32 OldListLength,
+                                       int32 AppendStart, uint32 NewKeyCount);
+static uint16  SC_FindRtsBadChecksum (uint16 Buffer[]);
+
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
 /* Load the ATS from its table to memory                           */
@@ -168,6 +208,9 @@ void SC_LoadAts (uint16 AtsIndex)
                             
                             /* set the command status to loaded in the command status table */
                             SC_OperData.AtsCmdStatusTblAddr[AtsIndex][AtsCmdNum - 1] = SC_LOADED;
+
+                            /* checksum is checked here once instead of at every dispatch */
+                            SC_AppData.AtsCmdChecksumOk[AtsIndex][AtsCmdNum - 1] = CFE_SB_ValidateChecksum(AtsCmd);
                             
                             /* increment the number of commands loaded */
                             SC_OperData.AtsInfoTblAddr[AtsIndex].NumberOfCommands++;
@@ -240,99 +283,229 @@ void SC_LoadAts (uint16 AtsIndex)
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 void SC_BuildTimeIndexTable (uint16 AtsIndex)
 {
+    SC_AtsEntryHeader_t *Entry;         /* ATS table entry pointer */
     int32 i;
     int32 ListLength;
 
-    /* initialize sorted list contents */
-    for (i = 0; i < SC_MAX_ATS_CMDS; i++)
-    {
-        SC_AppData.AtsTimeIndexBuffer[AtsIndex][i] = SC_ERROR;
-    }
-    
     /* initialize sorted list length */
     ListLength = 0;
 
-    /* create time sorted list */
+    /*
+    ** Collect the execution time of each in-use command once, in
+    ** command number order, so the sort never touches the ATS buffer
+    */
     for (i = 0; i < SC_MAX_ATS_CMDS; i++)
     {
-        /* add in-use command entries to time sorted list */
         if (SC_AppData.AtsCmdIndexBuffer[AtsIndex][i] != SC_ERROR)
         { 
-            SC_Insert(AtsIndex, i, ListLength);
+            Entry = (SC_AtsEntryHeader_t *)
+                    &SC_OperData.AtsTblAddr[AtsIndex][SC_AppData.AtsCmdIndexBuffer[AtsIndex][i]];
+
+            SC_TimeKeys[ListLength].Time     = SC_GetAtsEntryTime(Entry);
+            SC_TimeKeys[ListLength].CmdIndex = (uint16) i;
             ListLength++;   
         }
     }
 
+    /* create time sorted list */
+    SC_SortTimeKeys(SC_TimeKeys, ListLength);
+
+    for (i = 0; i < ListLength; i++)
+    {
+        SC_AppData.AtsTimeIndexBuffer[AtsIndex][i] = SC_TimeKeys[i].CmdIndex;
+    }
+
+    /* mark the unused remainder of the sorted list */
+    for (i = ListLength; i < SC_MAX_ATS_CMDS; i++)
+    {
+        SC_AppData.AtsTimeIndexBuffer[AtsIndex][i] = SC_ERROR;
+    }
+
 } /* end SC_BuildTimeIndexTable */
 
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
-/*  Inserts and element into a sorted list                         */
+/*  Merges newly appended commands into the time sorted list       */
 /*                                                                 */
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
-void SC_Insert (uint16 AtsIndex, uint32 NewCmdIndex, uint32 ListLength)
+static void SC_MergeTimeIndexTable (uint16 AtsIndex, uint32 OldListLength,
+                             int32 AppendStart, uint32 NewKeyCount)
 {
     SC_AtsEntryHeader_t *Entry;         /* ATS table entry pointer */
-    SC_AbsTimeTag_t      NewCmdTime=0;    /* new command execution time */
-    SC_AbsTimeTag_t      ListCmdTime;   /* list entry execution time */
-    uint32               CmdIndex;      /* ATS command index (cmd num - 1) */
-    uint32               EntryIndex;    /* ATS entry location in table */
-    int32                TimeBufIndex;  /* this must be signed */  
-
-    /* get execution time for new list entry */
-    if (ListLength > 0)
-    { 
-        /* first get the entry index in the selected ATS table for the new command */
-        EntryIndex = SC_AppData.AtsCmdIndexBuffer[AtsIndex][NewCmdIndex];
-        /* then get a pointer to the ATS entry */
-        Entry = (SC_AtsEntryHeader_t *) &SC_OperData.AtsTblAddr[AtsIndex][EntryIndex];
-        /* then get the execution time from the ATS entry for the new command */
-        NewCmdTime = SC_GetAtsEntryTime(Entry);
+    SC_AtsTimeKey_t      ListKey;       /* key for an existing list entry */
+    uint16               CmdIndex;      /* ATS command index (cmd num - 1) */
+    int32                ReadIndex;     /* these must be signed */
+    int32                NewIndex;
+    int32                WriteIndex;
+    uint32               KeptLength;
+    uint32               i;
+
+    /*
+    ** Drop existing entries whose command was replaced by the append,
+    ** their command index now points into the appended area
+    */
+    KeptLength = 0;
+    for (i = 0; i < OldListLength; i++)
+    {
+        CmdIndex = SC_AppData.AtsTimeIndexBuffer[AtsIndex][i];
+
+        if (SC_AppData.AtsCmdIndexBuffer[AtsIndex][CmdIndex] < AppendStart)
+        {
+            SC_AppData.AtsTimeIndexBuffer[AtsIndex][KeptLength] = CmdIndex;
+            KeptLength++;
+        }
     }
 
-    /* start at last element in the sorted by time list */
-    TimeBufIndex = ListLength - 1;
+    /*
+    ** The appended command keys were saved by SC_ProcessAppend,
+    ** they are sorted among themselves first
+    */
+    SC_SortTimeKeys(SC_TimeKeys, NewKeyCount);
+
+    /*
+    ** Merge from the back so the existing list can be shifted in place
+    */
+    ReadIndex  = KeptLength - 1;
+    NewIndex   = NewKeyCount - 1;
+    WriteIndex = KeptLength + NewKeyCount - 1;
 
-    while (TimeBufIndex >= 0)
+    while (NewIndex >= 0)
     {
-        /* first get the cmd index for this list entry */
-        CmdIndex = SC_AppData.AtsTimeIndexBuffer[AtsIndex][TimeBufIndex];
-        /* then get the entry index from the ATS table */
-        EntryIndex = SC_AppData.AtsCmdIndexBuffer[AtsIndex][CmdIndex];
-        /* then get a pointer to the ATS entry data */
-        Entry = (SC_AtsEntryHeader_t *) &SC_OperData.AtsTblAddr[AtsIndex][EntryIndex];
-        /* then get cmd execution time from the ATS entry */
-        ListCmdTime = SC_GetAtsEntryTime(Entry);
+        if (ReadIndex >= 0)
+        {
+            ListKey.CmdIndex = SC_AppData.AtsTimeIndexBuffer[AtsIndex][ReadIndex];
+            Entry = (SC_AtsEntryHeader_t *)
+                    &SC_OperData.AtsTblAddr[AtsIndex][SC_AppData.AtsCmdIndexBuffer[AtsIndex][ListKey.CmdIndex]];
+            ListKey.Time = SC_GetAtsEntryTime(Entry);
+
+            if (SC_TimeKeyIsLater(&ListKey, &SC_TimeKeys[NewIndex]))
+            {
+                SC_AppData.AtsTimeIndexBuffer[AtsIndex][WriteIndex] = ListKey.CmdIndex;
+                ReadIndex--;
+                WriteIndex--;
+                continue;
+            }
+        }
+
+        SC_AppData.AtsTimeIndexBuffer[AtsIndex][WriteIndex] = SC_TimeKeys[NewIndex].CmdIndex;
+        NewIndex--;
+        WriteIndex--;
+    }
+
+    /* mark the unused remainder of the sorted list */
+    for (i = KeptLength + NewKeyCount; i < OldListLength; i++)
+    {
+        SC_AppData.AtsTimeIndexBuffer[AtsIndex][i] = SC_ERROR;
+    }
+
+} /* end SC_MergeTimeIndexTable */
+
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/*  Orders two time keys by execution time then command number    */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+static boolean SC_TimeKeyIsLater (const SC_AtsTimeKey_t *Key1, const SC_AtsTimeKey_t *Key2)
+{
+    int32 Delta;
+
+    /*
+    ** Same whole second ordering as CFE_TIME_Compare, including
+    ** rollover, without the call overhead for every comparison
+    */
+    Delta = (int32) (Key1->Time - Key2->Time);
+
+    if (Delta == 0)
+    {
+        /* same time - keep command number order */
+        return (Key1->CmdIndex > Key2->CmdIndex);
+    }
+
+    return (Delta > 0);
 
-        /* compare time for this list entry to time for new cmd */
-        if (SC_CompareAbsTime(ListCmdTime, NewCmdTime))
+} /* end SC_TimeKeyIsLater */
+
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/*  Sorts an array of time keys                                    */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+static void SC_SortTimeKeys (SC_AtsTimeKey_t Keys[], uint32 Count)
+{
+    SC_AtsTimeKey_t Temp;
+    uint32          i;
+    boolean         Sorted = TRUE;
+
+    /* ATS loads are usually built in time order already */
+    for (i = 1; i < Count; i++)
+    {
+        if (SC_TimeKeyIsLater(&Keys[i - 1], &Keys[i]))
         {
-            /* new cmd will execute before this list entry */
+            Sorted = FALSE;
+            break;
+        }
+    }
+
+    if (Sorted)
+    {
+        return;
+    }
+
+    /*
+    ** Heapsort - in place, no recursion and O(n log n) worst case
+    */
+    for (i = Count / 2; i > 0; i--)
+    {
+        SC_SiftDownTimeKey(Keys, i - 1, Count);
+    }
+
+    for (i = Count - 1; i > 0; i--)
+    {
+        Temp    = Keys[0];
+        Keys[0] = Keys[i];
+        Keys[i] = Temp;
+
+        SC_SiftDownTimeKey(Keys, 0, i);
+    }
 
-            /* move this list entry to make room for new cmd */
-            SC_AppData.AtsTimeIndexBuffer[AtsIndex][TimeBufIndex + 1] =
-               SC_AppData.AtsTimeIndexBuffer[AtsIndex][TimeBufIndex];
+} /* end SC_SortTimeKeys */
 
-            /* back up to previous list entry (ok if -1) */
-            TimeBufIndex--;
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/*  Restores the heap property below one element                   */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+static void SC_SiftDownTimeKey (SC_AtsTimeKey_t Keys[], uint32 Root, uint32 Count)
+{
+    SC_AtsTimeKey_t Key;
+    uint32          Child;
+
+    Key = Keys[Root];
+
+    while ((Child = (2 * Root) + 1) < Count)
+    {
+        /* pick the later of the two children */
+        if (((Child + 1) < Count) && SC_TimeKeyIsLater(&Keys[Child + 1], &Keys[Child]))
+        {
+            Child++;
         }
-        else
+
+        if (!SC_TimeKeyIsLater(&Keys[Child], &Key))
         {
-            /* new cmd will execute at same time or after this list entry */
             break;
         }
+
+        Keys[Root] = Keys[Child];
+        Root = Child;
     }
 
-    /*
-    ** TimeBufIndex is now one slot before the target slot...
-    **   if new cmd time is earlier than all other entries
-    **     then TimeBufIndex is -1 and all others have been moved
-    **   else only entries with later times have been moved
-    ** In either case, there is an empty slot next to TimeBufIndex
-    */    
-    SC_AppData.AtsTimeIndexBuffer[AtsIndex][TimeBufIndex + 1] = NewCmdIndex;
-} /* end SC_Insert */
+    Keys[Root] = Key;
+
+} /* end SC_SiftDownTimeKey */
 
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
@@ -350,6 +523,7 @@ void SC_InitAtsTables (uint16 AtsIndex)
         SC_AppData.AtsCmdIndexBuffer[AtsIndex][i]    = SC_ERROR;
         SC_OperData.AtsCmdStatusTblAddr[AtsIndex][i] = SC_EMPTY;
         SC_AppData.AtsTimeIndexBuffer[AtsIndex][i]   = SC_ERROR;
+        SC_AppData.AtsCmdChecksumOk[AtsIndex][i]     = FALSE;
     }
     
     /* initialize the pointers and counters   */
@@ -376,10 +550,60 @@ void SC_LoadRts (uint16 RtsIndex)
        
     /* Make sure the RTS is disabled */
     SC_OperData.RtsInfoTblAddr[RtsIndex].DisabledFlag = TRUE;
+
+    /* A new load stops an RTS that was executing */
+    SC_UpdateRtsSchedule(RtsIndex);
+
+    /* Validate the command checksums once, not at every dispatch */
+    SC_AppData.RtsBadChecksumPtr[RtsIndex] = SC_FindRtsBadChecksum(SC_OperData.RtsTblAddr[RtsIndex]);
         
 } /* SC_LoadRts */
 
 
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Finds the first RTS command that fails its checksum             */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+static uint16 SC_FindRtsBadChecksum (uint16 Buffer[])
+{
+    uint16                          i = 0;
+    CFE_SB_MsgPtr_t                 RtsCmd;
+    SC_RtsEntryHeader_t            *RtsEntryPtr;
+    uint16                          CmdLength;
+    uint16                          CmdWords;
+
+    /*
+    ** Walk the commands the same way SC_GetNextRtsCommand steps
+    ** through them, the table has already passed SC_ParseRts
+    */
+    while (i < (SC_RTS_BUFF_SIZE - (sizeof(SC_RtsEntryHeader_t) / SC_BYTES_IN_WORD)))
+    {
+        RtsEntryPtr = (SC_RtsEntryHeader_t *) &Buffer[i];
+        RtsCmd = (CFE_SB_MsgPtr_t) RtsEntryPtr->CmdHeader;
+        CmdLength = CFE_SB_GetTotalMsgLength(RtsCmd);
+        CmdWords  = (CmdLength + SC_RTS_HEADER_SIZE + 1) / SC_BYTES_IN_WORD;
+
+        if ((CmdLength < SC_PACKET_MIN_SIZE) || (CmdLength > SC_PACKET_MAX_SIZE) ||
+            ((i + CmdWords) > SC_RTS_BUFF_SIZE))
+        {
+            /* end of the RTS, or a command that will never be sent */
+            break;
+        }
+
+        if (CFE_SB_ValidateChecksum(RtsCmd) != TRUE)
+        {
+            return (i);
+        }
+
+        i += CmdWords;
+    }
+
+    return (SC_RTS_BUFF_SIZE);
+
+} /* end SC_FindRtsBadChecksum */
+
+
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
 /*  Validate ATS table data                                        */
@@ -645,11 +869,17 @@ void SC_ProcessAppend (uint16 AtsIndex)
     int32 CommandBytes;
     int32 CommandWords;
     int32  EntryIndex;
+    int32  AppendStart;
     int32  i;
     uint16 CmdIndex;
+    uint32 OldListLength;
 
     /* save index of free area at end of ATS table data */
     EntryIndex = SC_OperData.AtsInfoTblAddr[AtsIndex].AtsSize;
+    AppendStart = EntryIndex;
+
+    /* save length of the existing time sorted list */
+    OldListLength = SC_OperData.AtsInfoTblAddr[AtsIndex].NumberOfCommands;
 
     /* copy Append table data to end of ATS table data */
     CFE_PSP_MemCpy(&SC_OperData.AtsTblAddr[AtsIndex][EntryIndex],
@@ -677,15 +907,22 @@ void SC_ProcessAppend (uint16 AtsIndex)
         SC_AppData.AtsCmdIndexBuffer[AtsIndex][CmdIndex] = EntryIndex;
         SC_OperData.AtsCmdStatusTblAddr[AtsIndex][CmdIndex] = SC_LOADED;
 
-        /* update entry index to point to the next entry */
+        /* validate the checksum once */
         CmdPacket = (CFE_SB_MsgPtr_t) Entry->CmdHeader;
+        SC_AppData.AtsCmdChecksumOk[AtsIndex][CmdIndex] = CFE_SB_ValidateChecksum(CmdPacket);
+
+        /* save sort key for the appended entry */
+        SC_TimeKeys[i].Time     = SC_GetAtsEntryTime(Entry);
+        SC_TimeKeys[i].CmdIndex = CmdIndex;
+
+        /* update entry index to point to the next entry */
         CommandBytes = CFE_SB_GetTotalMsgLength(CmdPacket);
         CommandWords = (CommandBytes + 1) / 2;
         EntryIndex += (SC_ATS_HDR_NOPKT_WORDS + CommandWords);
     }
 
-    /* rebuild time sorted list of commands */
-    SC_BuildTimeIndexTable(AtsIndex);
+    /* merge appended commands into time sorted list of commands */
+    SC_MergeTimeIndexTable(AtsIndex, OldListLength, AppendStart, SC_AppData.AppendEntryCount);
 
     /* did we just append to an ats that was executing? */
     if ((SC_OperData.AtsCtrlBlckAddr->AtpState == SC_EXECUTING) &&
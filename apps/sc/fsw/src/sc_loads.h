@@ -81,7 +81,10 @@ boolean SC_ParseRts (uint16 Buffer []);
  **            time order.       
  **       
  **  \par Assumptions, External Events, and Notes:
- **        None
+ **        Each command time is read from the ATS buffer once and the
+ **        resulting (time, command) keys are sorted, so the cost is
+ **        O(n log n) in the number of loaded commands.  Commands with
+ **        the same time stay in command number order.
  **
  **  \param [in]    AtsIndex        ATS array index
  **
@@ -90,26 +93,6 @@ boolean SC_ParseRts (uint16 Buffer []);
 
 void SC_BuildTimeIndexTable (uint16 AtsIndex);
 
-/************************************************************************/
-/** \brief Inserts an item in a sorted list
- **  
- **  \par Description
- **            This function will insert a new element into the list of
- **            ATS commands sorted by execution time.       
- **       
- **  \par Assumptions, External Events, and Notes:
- **        None
- **
- **  \param [in]    AtsIndex        ATS array index selection
- **
- **  \param [in]    NewCmdIndex     ATS command index for new list element
- ** 
- **  \param [in]    ListLength      Number of elements currently in list
- **
- **
- *************************************************************************/
-void SC_Insert (uint16 AtsIndex, uint32 NewCmdIndex, uint32 ListLength);
-
 /************************************************************************/
 /** \brief Initializes ATS tables before a load starts
  **  
@@ -142,6 +142,12 @@ typedef struct {
                                                   /**< \brief next RTS cmd Absolute Time */
     uint32      NextAtsTime;                      /**< \sctlmmnemonic \SC_NXTATSTIME */    
                                                   /**< \brief Next ATS Command Time (seconds) */
+    uint32      LastCmdLatency;                   /**< \sctlmmnemonic \SC_LASTCMDLAT */
+                                                  /**< \brief Milliseconds between the time tag and the release
+                                                       of the most recent ATS or RTS command */
+    uint32      MaxCmdLatency;                    /**< \sctlmmnemonic \SC_MAXCMDLAT */
+                                                  /**< \brief Largest release latency (milliseconds) since
+                                                       the counters were last reset */
                                                             
     uint16      RtsExecutingStatus[(SC_NUMBER_OF_RTS + 15) / 16];    /**< \sctlmmnemonic \SC_RTSEXEC */
     /**< \brief RTS executing status bit map where each uint16 represents 16 RTS numbers.  Note: array
@@ -60,6 +60,17 @@
 #include "sc_msgdefs.h"
 #include "sc_tbldefs.h"
 
+/**************************************************************************
+ **
+ ** Local function prototypes
+ **
+ **************************************************************************/
+
+static boolean SC_RtsRunsBefore (uint16 RtsIndex1, uint16 RtsIndex2);
+static void    SC_RtsHeapPlace (uint16 HeapIndex, uint16 RtsIndex);
+static void    SC_RtsHeapSiftUp (uint16 HeapIndex);
+static void    SC_RtsHeapSiftDown (uint16 HeapIndex);
+
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
 /*  Gets the time of the next RTS command                          */
@@ -67,44 +78,181 @@
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 void SC_GetNextRtsTime (void)
 {
-    
-    int16               i;          /* loop counter MUST be SIGNED !*/
     uint16              NextRts;    /* the next rts to schedule */
-    SC_AbsTimeTag_t     NextTime;   /* the next time for the RTS */
 
-    NextRts = 0xFFFF;
-    NextTime = SC_MAX_TIME;
-        
     /*
-     ** Go through the table backwards to account for the RTS priority 
-     ** Lower number RTS's get higher priority
+     ** The executing RTS with the earliest next command time is at
+     ** the root of the schedule heap
      */
-    for (i = SC_NUMBER_OF_RTS - 1; i >= 0; i--)
-    {
-        if (SC_OperData.RtsInfoTblAddr[i].RtsStatus == SC_EXECUTING)
-        {   
-            if (SC_OperData.RtsInfoTblAddr[i].NextCommandTime <= NextTime)
-            {       
-                NextTime = SC_OperData.RtsInfoTblAddr[i].NextCommandTime;
-                NextRts = i;   
-            } /* end if */ 
-        } /* end if */ 
-    } /* end for */
-    
-    if (NextRts == 0xFFFF)
+    if (SC_AppData.RtsHeapSize == 0)
     {
         SC_OperData.RtsCtrlBlckAddr -> RtsNumber = SC_INVALID_RTS_NUMBER;
         SC_AppData.NextCmdTime[SC_RTP] = SC_MAX_TIME;
     }
     else
     {
+        NextRts = SC_AppData.RtsHeap[0];
+
         SC_OperData.RtsCtrlBlckAddr -> RtsNumber = NextRts + 1;
-        SC_AppData.NextCmdTime[SC_RTP] = NextTime;
+        SC_AppData.NextCmdTime[SC_RTP] = SC_OperData.RtsInfoTblAddr[NextRts].NextCommandTime;
     } /* end if */
     
-    
 } /* end SC_GetNextRtsTime */
 
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/*  Rebuilds the RTS schedule from the RTS info table              */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void SC_InitRtsSchedule (void)
+{
+    uint16              i;
+
+    SC_AppData.RtsHeapSize = 0;
+
+    for (i = 0; i < SC_NUMBER_OF_RTS; i++)
+    {
+        SC_AppData.RtsHeapPos[i] = 0;
+    }
+
+    for (i = 0; i < SC_NUMBER_OF_RTS; i++)
+    {
+        SC_UpdateRtsSchedule(i);
+    }
+
+} /* end SC_InitRtsSchedule */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/*  Updates the schedule after an RTS status or time change        */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void SC_UpdateRtsSchedule (uint16 RtsIndex)
+{
+    uint16              HeapIndex;
+    uint16              LastRts;
+
+    if (SC_OperData.RtsInfoTblAddr[RtsIndex].RtsStatus == SC_EXECUTING)
+    {
+        if (SC_AppData.RtsHeapPos[RtsIndex] == 0)
+        {
+            /* newly started, add it at the bottom of the heap */
+            HeapIndex = SC_AppData.RtsHeapSize;
+            SC_AppData.RtsHeapSize++;
+            SC_RtsHeapPlace(HeapIndex, RtsIndex);
+            SC_RtsHeapSiftUp(HeapIndex);
+        }
+        else
+        {
+            /* next command time changed, it may move either way */
+            SC_RtsHeapSiftUp(SC_AppData.RtsHeapPos[RtsIndex] - 1);
+            SC_RtsHeapSiftDown(SC_AppData.RtsHeapPos[RtsIndex] - 1);
+        }
+    }
+    else if (SC_AppData.RtsHeapPos[RtsIndex] != 0)
+    {
+        /* no longer executing, fill its slot with the last heap entry */
+        HeapIndex = SC_AppData.RtsHeapPos[RtsIndex] - 1;
+        SC_AppData.RtsHeapPos[RtsIndex] = 0;
+        SC_AppData.RtsHeapSize--;
+
+        if (HeapIndex != SC_AppData.RtsHeapSize)
+        {
+            LastRts = SC_AppData.RtsHeap[SC_AppData.RtsHeapSize];
+            SC_RtsHeapPlace(HeapIndex, LastRts);
+            SC_RtsHeapSiftUp(HeapIndex);
+            SC_RtsHeapSiftDown(SC_AppData.RtsHeapPos[LastRts] - 1);
+        }
+    } /* end if */
+
+} /* end SC_UpdateRtsSchedule */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/*  Orders two RTS by next command time, then RTS priority         */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+static boolean SC_RtsRunsBefore (uint16 RtsIndex1, uint16 RtsIndex2)
+{
+    SC_AbsTimeTag_t     Time1 = SC_OperData.RtsInfoTblAddr[RtsIndex1].NextCommandTime;
+    SC_AbsTimeTag_t     Time2 = SC_OperData.RtsInfoTblAddr[RtsIndex2].NextCommandTime;
+
+    /* Lower number RTS's get higher priority */
+    return ((Time1 < Time2) || ((Time1 == Time2) && (RtsIndex1 < RtsIndex2)));
+
+} /* end SC_RtsRunsBefore */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/*  Stores an RTS in a heap slot and records its position          */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+static void SC_RtsHeapPlace (uint16 HeapIndex, uint16 RtsIndex)
+{
+    SC_AppData.RtsHeap[HeapIndex] = RtsIndex;
+    SC_AppData.RtsHeapPos[RtsIndex] = HeapIndex + 1;
+
+} /* end SC_RtsHeapPlace */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/*  Moves a heap entry up until its parent runs before it          */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+static void SC_RtsHeapSiftUp (uint16 HeapIndex)
+{
+    uint16              RtsIndex = SC_AppData.RtsHeap[HeapIndex];
+    uint16              Parent;
+
+    while (HeapIndex > 0)
+    {
+        Parent = (HeapIndex - 1) / 2;
+
+        if (!SC_RtsRunsBefore(RtsIndex, SC_AppData.RtsHeap[Parent]))
+        {
+            break;
+        }
+
+        SC_RtsHeapPlace(HeapIndex, SC_AppData.RtsHeap[Parent]);
+        HeapIndex = Parent;
+    }
+
+    SC_RtsHeapPlace(HeapIndex, RtsIndex);
+
+} /* end SC_RtsHeapSiftUp */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/*  Moves a heap entry down until it runs before its children      */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+static void SC_RtsHeapSiftDown (uint16 HeapIndex)
+{
+    uint16              RtsIndex = SC_AppData.RtsHeap[HeapIndex];
+    uint32              Child;
+
+    while ((Child = (2 * (uint32) HeapIndex) + 1) < SC_AppData.RtsHeapSize)
+    {
+        /* pick the child that runs first */
+        if (((Child + 1) < SC_AppData.RtsHeapSize) &&
+            SC_RtsRunsBefore(SC_AppData.RtsHeap[Child + 1], SC_AppData.RtsHeap[Child]))
+        {
+            Child++;
+        }
+
+        if (!SC_RtsRunsBefore(SC_AppData.RtsHeap[Child], RtsIndex))
+        {
+            break;
+        }
+
+        SC_RtsHeapPlace(HeapIndex, SC_AppData.RtsHeap[Child]);
+        HeapIndex = (uint16) Child;
+    }
+
+    SC_RtsHeapPlace(HeapIndex, RtsIndex);
+
+} /* end SC_RtsHeapSiftDown */
+
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
 /* Decides whether an RTS or ATS command gets scheduled next       */
@@ -150,6 +298,63 @@ void SC_UpdateNextTime (void)
     } /* end if */
 } /* end SC_UpdateNextTime */
 
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Computes how long SC may sleep before a command comes due       */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+int32 SC_GetWakeupTimeout (void)
+{
+    uint32      WaitMsec;
+
+    SC_GetCurrentTime();
+    SC_UpdateNextTime();
+
+    /*
+     ** Nothing is scheduled, the next command or wakeup message
+     ** will re-evaluate the schedule
+     */
+    if (SC_AppData.NextProcNumber == SC_NONE)
+    {
+        return(CFE_SB_PEND_FOREVER);
+    }
+
+    if (SC_OperData.NumCmdsSec >= SC_MAX_CMDS_PER_WINDOW)
+    {
+        /*
+         ** The rate limiter is holding commands back, wake up when the
+         ** current window closes
+         */
+        WaitMsec = SC_GetElapsedMsec(SC_OperData.RateWindowSecs, SC_OperData.RateWindowMsec);
+
+        if (WaitMsec >= SC_CMD_RATE_WINDOW_MSEC)
+        {
+            WaitMsec = 0;
+        }
+        else
+        {
+            WaitMsec = SC_CMD_RATE_WINDOW_MSEC - WaitMsec;
+        }
+    }
+    else
+    {
+        WaitMsec = SC_GetMsecUntil(SC_AppData.NextCmdTime[SC_AppData.NextProcNumber]);
+    }
+
+    if (WaitMsec == 0)
+    {
+        return(CFE_SB_POLL);
+    }
+
+    if (WaitMsec > SC_MAX_WAKEUP_WAIT_MSEC)
+    {
+        WaitMsec = SC_MAX_WAKEUP_WAIT_MSEC;
+    }
+
+    return((int32) WaitMsec);
+
+} /* end SC_GetWakeupTimeout */
+
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
 /* Gets the next RTS Command                                       */
@@ -243,6 +448,7 @@ void SC_GetNextRtsCommand(void)
                              */
                             SC_OperData.RtsInfoTblAddr[RtsNum].NextCommandTime = 
                             SC_ComputeAbsTime(RtsEntryPtr->TimeTag);
+                            SC_UpdateRtsSchedule(RtsNum);
                             
                             /*
                              ** Update the appropriate RTS info table current command pointer
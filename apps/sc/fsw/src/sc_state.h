@@ -53,6 +53,37 @@
  *************************************************************************/
 void SC_GetNextRtsTime (void);
 
+/************************************************************************/
+/** \brief Rebuilds the RTS schedule
+ **  
+ **  \par Description
+ **         This function empties the RTS schedule heap and adds every
+ **         RTS that the RTS info table shows as executing.
+ **       
+ **  \par Assumptions, External Events, and Notes:
+ **        Called whenever the RTS info table is initialized.
+ **
+ *************************************************************************/
+void SC_InitRtsSchedule (void);
+
+/************************************************************************/
+/** \brief Updates the RTS schedule for one RTS
+ **  
+ **  \par Description
+ **         The RTS schedule is a min heap of the executing RTS's keyed
+ **         on next command time, so finding the next RTS to run does not
+ **         scan the RTS info table.  This function adds, moves or removes
+ **         an RTS according to its current status and next command time.
+ **       
+ **  \par Assumptions, External Events, and Notes:
+ **        Must be called after any change to the RtsStatus or the
+ **        NextCommandTime of an RTS info table entry.
+ **
+ **  \param [in]    RtsIndex        RTS array index (base zero)
+ **
+ *************************************************************************/
+void SC_UpdateRtsSchedule (uint16 RtsIndex);
+
 /************************************************************************/
 /** \brief Decides whether the ATS or RTS runs next
  **  
@@ -68,6 +99,27 @@ void SC_GetNextRtsTime (void);
  *************************************************************************/
 void SC_UpdateNextTime (void);
 
+/************************************************************************/
+/** \brief Computes the command pipe pend timeout
+ **  
+ **  \par Description
+ **         This function refreshes the current time and the next command
+ **         schedule, then returns how long the SC main loop may pend on
+ **         its command pipe before the next ATS or RTS command is due or
+ **         the rate limit window expires.
+ **       
+ **  \par Assumptions, External Events, and Notes:
+ **        The wait is capped at #SC_MAX_WAKEUP_WAIT_MSEC
+ **
+ **  \returns
+ **  \retcode #CFE_SB_PEND_FOREVER \retdesc No command is scheduled \endcode
+ **  \retcode #CFE_SB_POLL \retdesc A command is due now \endcode
+ **  \retstmt Otherwise the wait time in milliseconds \endcode
+ **  \endreturns
+ **
+ *************************************************************************/
+int32 SC_GetWakeupTimeout (void);
+
 /************************************************************************/
 /** \brief Gets the next RTS command to run
  **  
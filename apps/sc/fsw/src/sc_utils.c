@@ -82,8 +82,9 @@ void SC_GetCurrentTime(void)
         TempTime = CFE_TIME_GetTime();
     #endif
 
-    /* We don't care about subseconds */
+    /* Time tags are whole seconds, milliseconds are kept for wakeup timing */
     SC_AppData.CurrentTime = TempTime.Seconds;
+    SC_AppData.CurrentMsec = (uint16) (CFE_TIME_Sub2MicroSecs(TempTime.Subseconds) / 1000);
     
 } /* end of SC_GetCurrentTime */
 
@@ -175,6 +176,74 @@ boolean SC_CompareAbsTime(SC_AbsTimeTag_t AbsTime1,
     
 }/* end of SC_CompareAbsTime */
 
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Milliseconds elapsed since a point in time                      */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+uint32 SC_GetElapsedMsec(SC_AbsTimeTag_t Seconds, uint16 Msec)
+{
+    uint32 DeltaSecs;
+
+    if ((SC_AppData.CurrentTime < Seconds) ||
+        ((SC_AppData.CurrentTime == Seconds) && (SC_AppData.CurrentMsec < Msec)))
+    {
+        /* The reference point is still in the future */
+        return(0);
+    }
+
+    DeltaSecs = SC_AppData.CurrentTime - Seconds;
+
+    if (DeltaSecs >= (SC_MAX_ELAPSED_MSEC / 1000))
+    {
+        return(SC_MAX_ELAPSED_MSEC);
+    }
+
+    return((DeltaSecs * 1000) + SC_AppData.CurrentMsec - Msec);
+
+} /* end of SC_GetElapsedMsec */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Milliseconds remaining until an absolute time tag comes due     */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+uint32 SC_GetMsecUntil(SC_AbsTimeTag_t AbsTime)
+{
+    uint32 DeltaSecs;
+
+    if (AbsTime <= SC_AppData.CurrentTime)
+    {
+        return(0);
+    }
+
+    DeltaSecs = AbsTime - SC_AppData.CurrentTime;
+
+    if (DeltaSecs >= (SC_MAX_ELAPSED_MSEC / 1000))
+    {
+        return(SC_MAX_ELAPSED_MSEC);
+    }
+
+    return((DeltaSecs * 1000) - SC_AppData.CurrentMsec);
+
+} /* end of SC_GetMsecUntil */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Record how late a command was released relative to its tag      */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void SC_RecordCmdLatency(SC_AbsTimeTag_t TimeTag)
+{
+    SC_AppData.LastCmdLatency = SC_GetElapsedMsec(TimeTag, 0);
+
+    if (SC_AppData.LastCmdLatency > SC_AppData.MaxCmdLatency)
+    {
+        SC_AppData.MaxCmdLatency = SC_AppData.LastCmdLatency;
+    }
+
+} /* end of SC_RecordCmdLatency */
+
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
 /* SC Verify the length of the command                             */
@@ -98,6 +98,63 @@ SC_AbsTimeTag_t SC_ComputeAbsTime (uint16 RelTime);
 
 boolean SC_CompareAbsTime (SC_AbsTimeTag_t AbsTime1, SC_AbsTimeTag_t AbsTime2);
 
+/************************************************************************/
+/** \brief Milliseconds elapsed since a point in time
+ **  
+ **  \par Description
+ **       Returns the number of milliseconds between the given time and
+ **       the current time held in #SC_AppData.
+ **       
+ **  \par Assumptions, External Events, and Notes:
+ **        Times in the future yield zero, very old times saturate at
+ **        #SC_MAX_ELAPSED_MSEC
+ **
+ **  \param [in]    Seconds             Seconds part of the reference time
+ **
+ **  \param [in]    Msec                Milliseconds part of the reference time
+ **
+ **  \returns
+ **  \retstmt Returns the elapsed time in milliseconds \endcode
+ **  \endreturns
+ **
+ *************************************************************************/
+uint32 SC_GetElapsedMsec (SC_AbsTimeTag_t Seconds, uint16 Msec);
+
+/************************************************************************/
+/** \brief Milliseconds until an absolute time tag comes due
+ **  
+ **  \par Description
+ **       Returns the number of milliseconds from the current time held
+ **       in #SC_AppData until the start of the given second.
+ **       
+ **  \par Assumptions, External Events, and Notes:
+ **        Times in the past yield zero, far future times saturate at
+ **        #SC_MAX_ELAPSED_MSEC
+ **
+ **  \param [in]    AbsTime             The absolute time tag
+ **
+ **  \returns
+ **  \retstmt Returns the remaining time in milliseconds \endcode
+ **  \endreturns
+ **
+ *************************************************************************/
+uint32 SC_GetMsecUntil (SC_AbsTimeTag_t AbsTime);
+
+/************************************************************************/
+/** \brief Record command release latency
+ **  
+ **  \par Description
+ **       Updates the last and maximum command latency statistics with
+ **       the time between the given time tag and the current time.
+ **       
+ **  \par Assumptions, External Events, and Notes:
+ **        None
+ **
+ **  \param [in]    TimeTag             Time tag of the released command
+ **
+ *************************************************************************/
+void SC_RecordCmdLatency (SC_AbsTimeTag_t TimeTag);
+
 /************************************************************************/
 /** \brief Verify command message length
  **  
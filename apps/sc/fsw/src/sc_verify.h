@@ -57,12 +57,28 @@
  ** Macro Definitions
  *************************************************************************/
 
-#ifndef SC_MAX_CMDS_PER_SEC
-    #error SC_MAX_CMDS_PER_SEC must be defined!
-#elif (SC_MAX_CMDS_PER_SEC > 65535)
-    #error SC_MAX_CMDS_PER_SEC cannot be greater than 65535!
-#elif (SC_MAX_CMDS_PER_SEC < 1)
-    #error SC_MAX_CMDS_PER_SEC cannot be less than 1!
+#ifndef SC_MAX_CMDS_PER_WINDOW
+    #error SC_MAX_CMDS_PER_WINDOW must be defined!
+#elif (SC_MAX_CMDS_PER_WINDOW > 65535)
+    #error SC_MAX_CMDS_PER_WINDOW cannot be greater than 65535!
+#elif (SC_MAX_CMDS_PER_WINDOW < 1)
+    #error SC_MAX_CMDS_PER_WINDOW cannot be less than 1!
+#endif 
+
+#ifndef SC_CMD_RATE_WINDOW_MSEC
+    #error SC_CMD_RATE_WINDOW_MSEC must be defined!
+#elif (SC_CMD_RATE_WINDOW_MSEC > 60000)
+    #error SC_CMD_RATE_WINDOW_MSEC cannot be greater than 60000!
+#elif (SC_CMD_RATE_WINDOW_MSEC < 1)
+    #error SC_CMD_RATE_WINDOW_MSEC cannot be less than 1!
+#endif 
+
+#ifndef SC_MAX_WAKEUP_WAIT_MSEC
+    #error SC_MAX_WAKEUP_WAIT_MSEC must be defined!
+#elif (SC_MAX_WAKEUP_WAIT_MSEC > 60000)
+    #error SC_MAX_WAKEUP_WAIT_MSEC cannot be greater than 60000!
+#elif (SC_MAX_WAKEUP_WAIT_MSEC < 1)
+    #error SC_MAX_WAKEUP_WAIT_MSEC cannot be less than 1!
 #endif 
  
 #ifndef SC_NUMBER_OF_RTS
@@ -83,8 +83,8 @@ void SC_ProcessAtpCmd_Test_SwitchCmd(void)
      * SC_ProcessAtpCmd, and for all other calls to CFE_TIME_Compare called from subfunctions reached by this test */
     Ut_CFE_TIME_SetFunctionHook(UT_CFE_TIME_COMPARE_INDEX, &Ut_CFE_TIME_CompareHookAlessthanB);
 
-    /* Set to return TRUE in order to satisfy the if-statement from which the function is called */
-    Ut_CFE_SB_SetReturnCode(UT_CFE_SB_VALIDATECHECKSUM_INDEX, TRUE, 1);
+    /* Checksum was validated when the command was loaded */
+    SC_AppData.AtsCmdChecksumOk[0][0] = TRUE;
 
     /* Set these two functions to return these values in order to statisfy the if-statement from which they are both called */
     Ut_CFE_SB_SetReturnCode(UT_CFE_SB_GETMSGID_INDEX, SC_CMD_MID, 1);
@@ -129,8 +129,8 @@ void SC_ProcessAtpCmd_Test_NonSwitchCmd(void)
     SC_OperData.AtsCmdStatusTblAddr[0][0]  = SC_LOADED;
     SC_AppData.AtsCmdIndexBuffer[0][0]     = 0;
 
-    /* Set to return TRUE in order to satisfy the if-statement from which the function is called */
-    Ut_CFE_SB_SetReturnCode(UT_CFE_SB_VALIDATECHECKSUM_INDEX, TRUE, 1);
+    /* Checksum was validated when the command was loaded */
+    SC_AppData.AtsCmdChecksumOk[0][0] = TRUE;
 
     /* Set to return this value in order to statisfy the if-statement from which it is called */
     Ut_CFE_SB_SetReturnCode(UT_CFE_SB_GETMSGID_INDEX, SC_CMD_MID, 1);
@@ -178,8 +178,8 @@ void SC_ProcessAtpCmd_Test_InlineSwitchError(void)
      * SC_ProcessAtpCmd, and for all other calls to CFE_TIME_Compare called from subfunctions reached by this test */
     Ut_CFE_TIME_SetFunctionHook(UT_CFE_TIME_COMPARE_INDEX, &Ut_CFE_TIME_CompareHookAlessthanB);
 
-    /* Set to return TRUE in order to satisfy the if-statement from which the function is called */
-    Ut_CFE_SB_SetReturnCode(UT_CFE_SB_VALIDATECHECKSUM_INDEX, TRUE, 1);
+    /* Checksum was validated when the command was loaded */
+    SC_AppData.AtsCmdChecksumOk[0][0] = TRUE;
 
     /* Set these two functions to return these values in order to statisfy the if-statement from which they are both called */
     Ut_CFE_SB_SetReturnCode(UT_CFE_SB_GETMSGID_INDEX, SC_CMD_MID, 1);
@@ -226,8 +226,8 @@ void SC_ProcessAtpCmd_Test_SBErrorAtsA(void)
     SC_OperData.AtsCmdStatusTblAddr[0][0]  = SC_LOADED;
     SC_AppData.AtsCmdIndexBuffer[0][0]     = 0;
 
-    /* Set to return TRUE in order to satisfy the if-statement from which the function is called */
-    Ut_CFE_SB_SetReturnCode(UT_CFE_SB_VALIDATECHECKSUM_INDEX, TRUE, 1);
+    /* Checksum was validated when the command was loaded */
+    SC_AppData.AtsCmdChecksumOk[0][0] = TRUE;
 
     /* Set to return this value in order to statisfy the if-statement from which it is called */
     Ut_CFE_SB_SetReturnCode(UT_CFE_SB_GETMSGID_INDEX, SC_CMD_MID, 1);
@@ -284,8 +284,8 @@ void SC_ProcessAtpCmd_Test_SBErrorAtsB(void)
     SC_OperData.AtsCmdStatusTblAddr[1][0]  = SC_LOADED;
     SC_AppData.AtsCmdIndexBuffer[1][0]     = 0;
 
-    /* Set to return TRUE in order to satisfy the if-statement from which the function is called */
-    Ut_CFE_SB_SetReturnCode(UT_CFE_SB_VALIDATECHECKSUM_INDEX, TRUE, 1);
+    /* Checksum was validated when the command was loaded */
+    SC_AppData.AtsCmdChecksumOk[1][0] = TRUE;
 
     /* Set to return this value in order to statisfy the if-statement from which it is called */
     Ut_CFE_SB_SetReturnCode(UT_CFE_SB_GETMSGID_INDEX, SC_CMD_MID, 1);
@@ -344,8 +344,8 @@ void SC_ProcessAtpCmd_Test_ChecksumFailedAtsA(void)
     
     SC_AppData.ContinueAtsOnFailureFlag = FALSE;
 
-    /* Set to return FALSE in order to generate error message SC_ATS_CHKSUM_ERR_EID */
-    Ut_CFE_SB_SetReturnCode(UT_CFE_SB_VALIDATECHECKSUM_INDEX, FALSE, 1);
+    /* Checksum failed when the command was loaded, in order to generate error message SC_ATS_CHKSUM_ERR_EID */
+    SC_AppData.AtsCmdChecksumOk[0][0] = FALSE;
 
     /* Execute the function being tested */
     SC_ProcessAtpCmd();
@@ -394,8 +394,8 @@ void SC_ProcessAtpCmd_Test_ChecksumFailedAtsB(void)
     
     SC_AppData.ContinueAtsOnFailureFlag = FALSE;
 
-    /* Set to return FALSE in order to generate error message SC_ATS_CHKSUM_ERR_EID */
-    Ut_CFE_SB_SetReturnCode(UT_CFE_SB_VALIDATECHECKSUM_INDEX, FALSE, 1);
+    /* Checksum failed when the command was loaded, in order to generate error message SC_ATS_CHKSUM_ERR_EID */
+    SC_AppData.AtsCmdChecksumOk[1][0] = FALSE;
 
     /* Execute the function being tested */
     SC_ProcessAtpCmd();
@@ -569,8 +569,8 @@ void SC_ProcessRtpCommand_Test_Nominal(void)
 
     SC_OperData.AtsInfoTblAddr[1].NumberOfCommands = 1;
 
-    /* Set to return TRUE in order to satisfy the if-statement from which the function is called */
-    Ut_CFE_SB_SetReturnCode(UT_CFE_SB_VALIDATECHECKSUM_INDEX, TRUE, 1);
+    /* Every command passed its checksum when the RTS was loaded */
+    SC_AppData.RtsBadChecksumPtr[0] = SC_RTS_BUFF_SIZE;
 
     /* Set returned packet size to prevent error messages */
     Ut_CFE_SB_SetReturnCode(UT_CFE_SB_GETTOTALMSGLENGTH_INDEX, SC_PACKET_MAX_SIZE / 2, 1);
@@ -611,8 +611,8 @@ void SC_ProcessRtpCommand_Test_BadSoftwareBusReturn(void)
     
     SC_OperData.AtsInfoTblAddr[1].NumberOfCommands = 1;
 
-    /* Set to return TRUE in order to satisfy the if-statement from which the function is called */
-    Ut_CFE_SB_SetReturnCode(UT_CFE_SB_VALIDATECHECKSUM_INDEX, TRUE, 1);
+    /* Every command passed its checksum when the RTS was loaded */
+    SC_AppData.RtsBadChecksumPtr[0] = SC_RTS_BUFF_SIZE;
     Ut_CFE_SB_SetReturnCode(UT_CFE_SB_SENDMSG_INDEX, -1, 1);
 
     /* Set returned packet size to prevent error messages */
@@ -660,8 +660,8 @@ void SC_ProcessRtpCommand_Test_BadChecksum(void)
 
     SC_OperData.AtsInfoTblAddr[1].NumberOfCommands = 1;
 
-    /* Set to return FALSE in order to generate error message SC_RTS_CHKSUM_ERR_EID */
-    Ut_CFE_SB_SetReturnCode(UT_CFE_SB_VALIDATECHECKSUM_INDEX, FALSE, 1);
+    /* The first command failed its checksum when the RTS was loaded, in order to generate error message SC_RTS_CHKSUM_ERR_EID */
+    SC_AppData.RtsBadChecksumPtr[0] = 0;
 
     /* Set returned packet size to prevent error messages */
     Ut_CFE_SB_SetReturnCode(UT_CFE_SB_GETTOTALMSGLENGTH_INDEX, SC_PACKET_MAX_SIZE / 2, 1);
@@ -929,8 +929,8 @@ void SC_ProcessRequest_Test_1HzWakeupRtpExecutionTimeTooManyCmds(void)
     /* Execute the function being tested */
     SC_ProcessRequest((CFE_SB_MsgPtr_t)(&CmdPacket));
     
-    /* Verify results */
-    UtAssert_True (SC_OperData.NumCmdsSec == 0, "SC_OperData.NumCmdsSec == 0");
+    /* Verify results: the rate limit window has not expired, so nothing is released */
+    UtAssert_True (SC_OperData.NumCmdsSec == 1000, "SC_OperData.NumCmdsSec == 1000");
     UtAssert_True (Ut_CFE_EVS_GetEventQueueDepth() == 2, "Ut_CFE_EVS_GetEventQueueDepth() == 2");
 
 } /* end SC_ProcessRequest_Test_1HzWakeupRtpExecutionTimeTooManyCmds */
@@ -60,6 +60,7 @@
 #include <sys/fcntl.h>
 #include <unistd.h>
 #include <stdlib.h>
+#include <string.h>
 
 /*
  * Function Definitions
@@ -106,11 +107,6 @@ uint16 SC_LOADS_TEST_CFE_SB_GetTotalMsgLengthHook4(CFE_SB_MsgPtr_t MsgPtr)
         return SC_PACKET_MAX_SIZE;
 } /* end SC_LOADS_TEST_CFE_SB_GetTotalMsgLengthHook4 */
 
-CFE_TIME_Compare_t UT_SC_Insert_CompareHookAgreaterthanB(CFE_TIME_SysTime_t TimeA, CFE_TIME_SysTime_t TimeB)
-{
-    return CFE_TIME_A_GT_B;
-} /* end CFE_TIME_Compare_t UT_SC_StartAtsRq_CompareHookAgreaterthanB */
-
 void SC_LoadAts_Test_Nominal(void)
 {
     SC_NoArgsCmd_t   CmdPacket;
@@ -133,12 +129,16 @@ void SC_LoadAts_Test_Nominal(void)
     Ut_CFE_SB_SetReturnCode(UT_CFE_SB_GETTOTALMSGLENGTH_INDEX, sizeof(SC_NoArgsCmd_t), 1);
     Ut_CFE_SB_ContinueReturnCodeAfterCountZero(UT_CFE_SB_GETTOTALMSGLENGTH_INDEX);
 
+    /* Checksum is validated once while loading */
+    Ut_CFE_SB_SetReturnCode(UT_CFE_SB_VALIDATECHECKSUM_INDEX, TRUE, 1);
+
     /* Execute the function being tested */
     SC_LoadAts(AtsIndex);
     
     /* Verify results */
     UtAssert_True(SC_AppData.AtsCmdIndexBuffer[AtsIndex][0] == 0, "SC_AppData.AtsCmdIndexBuffer[AtsIndex][0] == 0");
     UtAssert_True(SC_OperData.AtsCmdStatusTblAddr[AtsIndex][0] == SC_LOADED, "SC_OperData.AtsCmdStatusTblAddr[AtsIndex][0] == SC_LOADED");
+    UtAssert_True(SC_AppData.AtsCmdChecksumOk[AtsIndex][0] == TRUE, "SC_AppData.AtsCmdChecksumOk[AtsIndex][0] == TRUE");
     UtAssert_True(SC_OperData.AtsInfoTblAddr[AtsIndex].NumberOfCommands == 1, "SC_OperData.AtsInfoTblAddr[AtsIndex].NumberOfCommands == 1");
     UtAssert_True(SC_OperData.AtsInfoTblAddr[AtsIndex].AtsSize == 7, "SC_OperData.AtsInfoTblAddr[AtsIndex].AtsSize == 7");
 
@@ -320,47 +320,81 @@ void SC_LoadAts_Test_LoadExactlyBufferLength(void)
 
 } /* end SC_LoadAts_Test_LoadExactlyBufferLength */
 
-void SC_Insert_Test(void)
+void SC_LOADS_TEST_SetAtsEntry(uint16 AtsIndex, int32 EntryIndex, uint16 CmdNumber, SC_AbsTimeTag_t Time)
+{
+    SC_AtsEntryHeader_t*   Entry;
+
+    Entry = (SC_AtsEntryHeader_t *) &SC_OperData.AtsTblAddr[AtsIndex][EntryIndex];
+    Entry->CmdNumber = CmdNumber;
+    memcpy(&Entry->TimeTag1, &Time, sizeof(SC_AbsTimeTag_t));
+
+    SC_AppData.AtsCmdIndexBuffer[AtsIndex][CmdNumber - 1] = EntryIndex;
+} /* end SC_LOADS_TEST_SetAtsEntry */
+
+void SC_BuildTimeIndexTable_Test_OutOfOrder(void)
 {
-    uint8 AtsIndex    = 0;
-    uint8 ListLength  = 1;
-    uint8 NewCmdIndex = 0;
+    uint8 AtsIndex = 0;
+    uint16 AtsTable[SC_ATS_BUFF_SIZE];
 
     SC_InitTables();
 
+    SC_OperData.AtsTblAddr[AtsIndex] = (uint16*)&AtsTable[0];
+
+    /* Command 4 shares a time with command 2 and must stay behind it */
+    SC_LOADS_TEST_SetAtsEntry(AtsIndex,  0, 1, 30);
+    SC_LOADS_TEST_SetAtsEntry(AtsIndex, 10, 2, 10);
+    SC_LOADS_TEST_SetAtsEntry(AtsIndex, 20, 3, 20);
+    SC_LOADS_TEST_SetAtsEntry(AtsIndex, 30, 4, 10);
+
     /* Execute the function being tested */
-    SC_Insert(AtsIndex, NewCmdIndex, ListLength);
+    SC_BuildTimeIndexTable(AtsIndex);
     
     /* Verify results */
-    UtAssert_True (SC_AppData.AtsTimeIndexBuffer[AtsIndex][1] == SC_AppData.AtsTimeIndexBuffer[AtsIndex][0], "SC_AppData.AtsTimeIndexBuffer[AtsIndex][1] == SC_AppData.AtsTimeIndexBuffer[AtsIndex][0]");
-    UtAssert_True (SC_AppData.AtsTimeIndexBuffer[AtsIndex][1] == NewCmdIndex, "SC_AppData.AtsTimeIndexBuffer[AtsIndex][1] == NewCmdIndex");
-
-    UtAssert_True (Ut_CFE_EVS_GetEventQueueDepth() == 2, "Ut_CFE_EVS_GetEventQueueDepth() == 2");
+    UtAssert_True (SC_AppData.AtsTimeIndexBuffer[AtsIndex][0] == 1, "SC_AppData.AtsTimeIndexBuffer[AtsIndex][0] == 1");
+    UtAssert_True (SC_AppData.AtsTimeIndexBuffer[AtsIndex][1] == 3, "SC_AppData.AtsTimeIndexBuffer[AtsIndex][1] == 3");
+    UtAssert_True (SC_AppData.AtsTimeIndexBuffer[AtsIndex][2] == 2, "SC_AppData.AtsTimeIndexBuffer[AtsIndex][2] == 2");
+    UtAssert_True (SC_AppData.AtsTimeIndexBuffer[AtsIndex][3] == 0, "SC_AppData.AtsTimeIndexBuffer[AtsIndex][3] == 0");
+    UtAssert_True (SC_AppData.AtsTimeIndexBuffer[AtsIndex][4] == (uint16) SC_ERROR, "SC_AppData.AtsTimeIndexBuffer[AtsIndex][4] == SC_ERROR");
 
-} /* end SC_Insert_Test */
+    UtAssert_True (Ut_CFE_EVS_GetEventQueueDepth() == 0, "Ut_CFE_EVS_GetEventQueueDepth() == 0");
 
+} /* end SC_BuildTimeIndexTable_Test_OutOfOrder */
 
-void SC_Insert_Test_MiddleOfList(void)
+void SC_BuildTimeIndexTable_Test_MaxCmds(void)
 {
-    uint8 AtsIndex    = 0;
-    uint8 ListLength  = 1;
-    uint8 NewCmdIndex = 0;
-
-    /* Set to cause SC_BeginAts to return FALSE, in order to reach block starting with "could not start the ats" */
-    Ut_CFE_TIME_SetFunctionHook(UT_CFE_TIME_COMPARE_INDEX, &UT_SC_Insert_CompareHookAgreaterthanB);
+    uint8  AtsIndex = 0;
+    uint16 AtsTable[SC_ATS_BUFF_SIZE];
+    int32  i;
+    boolean Sorted = TRUE;
 
     SC_InitTables();
 
+    SC_OperData.AtsTblAddr[AtsIndex] = (uint16*)&AtsTable[0];
+
+    /* Every command slot in use, all sharing one entry and so one time */
+    SC_LOADS_TEST_SetAtsEntry(AtsIndex, 0, 1, SC_MAX_ATS_CMDS);
+    for (i = 0; i < SC_MAX_ATS_CMDS; i++)
+    {
+        SC_AppData.AtsCmdIndexBuffer[AtsIndex][i] = 0;
+    }
+
     /* Execute the function being tested */
-    SC_Insert(AtsIndex, NewCmdIndex, ListLength);
+    SC_BuildTimeIndexTable(AtsIndex);
     
-    /* Verify results */
-    UtAssert_True (SC_AppData.AtsTimeIndexBuffer[AtsIndex][1] == SC_AppData.AtsTimeIndexBuffer[AtsIndex][0], "SC_AppData.AtsTimeIndexBuffer[AtsIndex][1] == SC_AppData.AtsTimeIndexBuffer[AtsIndex][0]");
-    UtAssert_True (SC_AppData.AtsTimeIndexBuffer[AtsIndex][1] == NewCmdIndex, "SC_AppData.AtsTimeIndexBuffer[AtsIndex][1] == NewCmdIndex");
+    /* Verify results: equal times keep command number order */
+    for (i = 0; i < SC_MAX_ATS_CMDS; i++)
+    {
+        if (SC_AppData.AtsTimeIndexBuffer[AtsIndex][i] != i)
+        {
+            Sorted = FALSE;
+        }
+    }
 
-    UtAssert_True (Ut_CFE_EVS_GetEventQueueDepth() == 2, "Ut_CFE_EVS_GetEventQueueDepth() == 2");
+    UtAssert_True (Sorted == TRUE, "Sorted == TRUE");
 
-} /* end SC_Insert_Test_MiddleOfList */
+    UtAssert_True (Ut_CFE_EVS_GetEventQueueDepth() == 0, "Ut_CFE_EVS_GetEventQueueDepth() == 0");
+
+} /* end SC_BuildTimeIndexTable_Test_MaxCmds */
 
 void SC_ValidateAts_Test(void)
 {
@@ -974,6 +1008,55 @@ void SC_ProcessAppend_Test(void)
 
 } /* end SC_ProcessAppend_Test */
 
+uint16 SC_LOADS_TEST_CFE_SB_GetTotalMsgLengthHookMin(CFE_SB_MsgPtr_t MsgPtr)
+{
+    return SC_PACKET_MIN_SIZE;
+} /* end SC_LOADS_TEST_CFE_SB_GetTotalMsgLengthHookMin */
+
+void SC_ProcessAppend_Test_MergeReplacedCmd(void)
+{
+    uint8  AtsIndex = 0;
+    uint16 AtsTable[SC_ATS_BUFF_SIZE];
+    int32  EntryWords = SC_ATS_HDR_NOPKT_WORDS + ((SC_PACKET_MIN_SIZE + 1) / 2);
+
+    /* Setting memcpy to return success, the appended entries are placed in the ATS directly */
+    Ut_CFE_PSP_MEMUTILS_SetReturnCode(UT_CFE_PSP_MEMUTILS_MEMCPY_INDEX, CFE_PSP_SUCCESS, 1);
+    Ut_CFE_SB_SetFunctionHook(UT_CFE_SB_GETTOTALMSGLENGTH_INDEX, &SC_LOADS_TEST_CFE_SB_GetTotalMsgLengthHookMin);
+
+    SC_InitTables();
+
+    SC_OperData.AtsTblAddr[AtsIndex] = (uint16*)&AtsTable[0];
+
+    /* Existing ATS: command 1 at time 20, command 2 at time 40 */
+    SC_LOADS_TEST_SetAtsEntry(AtsIndex, 0,          1, 20);
+    SC_LOADS_TEST_SetAtsEntry(AtsIndex, EntryWords, 2, 40);
+    SC_OperData.AtsCmdStatusTblAddr[AtsIndex][0] = SC_LOADED;
+    SC_OperData.AtsCmdStatusTblAddr[AtsIndex][1] = SC_LOADED;
+    SC_OperData.AtsInfoTblAddr[AtsIndex].NumberOfCommands = 2;
+    SC_OperData.AtsInfoTblAddr[AtsIndex].AtsSize = 2 * EntryWords;
+    SC_AppData.AtsTimeIndexBuffer[AtsIndex][0] = 0;
+    SC_AppData.AtsTimeIndexBuffer[AtsIndex][1] = 1;
+
+    /* Appended: new command 3 at time 30, command 1 replaced at time 50 */
+    SC_LOADS_TEST_SetAtsEntry(AtsIndex, 2 * EntryWords, 3, 30);
+    SC_LOADS_TEST_SetAtsEntry(AtsIndex, 3 * EntryWords, 1, 50);
+    SC_AppData.AtsCmdIndexBuffer[AtsIndex][0] = 0;
+    SC_AppData.AtsCmdIndexBuffer[AtsIndex][2] = SC_ERROR;
+
+    SC_AppData.AppendWordCount = 2 * EntryWords;
+    SC_AppData.AppendEntryCount = 2;
+
+    /* Execute the function being tested */
+    SC_ProcessAppend(AtsIndex);
+    
+    /* Verify results */
+    UtAssert_True (SC_OperData.AtsInfoTblAddr[AtsIndex].NumberOfCommands == 3, "SC_OperData.AtsInfoTblAddr[AtsIndex].NumberOfCommands == 3");
+    UtAssert_True (SC_AppData.AtsTimeIndexBuffer[AtsIndex][0] == 2, "SC_AppData.AtsTimeIndexBuffer[AtsIndex][0] == 2");
+    UtAssert_True (SC_AppData.AtsTimeIndexBuffer[AtsIndex][1] == 1, "SC_AppData.AtsTimeIndexBuffer[AtsIndex][1] == 1");
+    UtAssert_True (SC_AppData.AtsTimeIndexBuffer[AtsIndex][2] == 0, "SC_AppData.AtsTimeIndexBuffer[AtsIndex][2] == 0");
+
+} /* end SC_ProcessAppend_Test_MergeReplacedCmd */
+
 void SC_VerifyAtsTable_Test_Nominal(void)
 {
     SC_AtsEntryHeader_t*   Entry1;
@@ -1304,7 +1387,7 @@ void SC_VerifyAtsEntry_Test_DuplicateCmdNumber(void)
 } /* end SC_VerifyAtsEntry_Test_DuplicateCmdNumber */
 
 /** 
- **  No tests needed for SC_BuildTimeIndexTable, SC_InitAtsTables, SC_LoadRts, SC_UpdateAppend_Test_EndOfValidCmdNumbers, 
+ **  No tests needed for SC_InitAtsTables, SC_LoadRts, SC_UpdateAppend_Test_EndOfValidCmdNumbers, 
  **  and SC_VerifyAtsEntry_Test_EndOfInUsePartOfBuffer - all lines run and tested in other tests.
 */
 
@@ -1319,8 +1402,8 @@ void SC_Loads_Test_AddTestCases(void)
     UtTest_Add(SC_LoadAts_Test_EndOfLoadReached, SC_Test_Setup, SC_Test_TearDown, "SC_LoadAts_Test_EndOfLoadReached");
     UtTest_Add(SC_LoadAts_Test_AtsBufferTooSmall, SC_Test_Setup, SC_Test_TearDown, "SC_LoadAts_Test_AtsBufferTooSmall");
     UtTest_Add(SC_LoadAts_Test_LoadExactlyBufferLength, SC_Test_Setup, SC_Test_TearDown, "SC_LoadAts_Test_LoadExactlyBufferLength");
-    UtTest_Add(SC_Insert_Test, SC_Test_Setup, SC_Test_TearDown, "SC_Insert_Test");
-    UtTest_Add(SC_Insert_Test_MiddleOfList, SC_Test_Setup, SC_Test_TearDown, "SC_Insert_Test_MiddleOfList");
+    UtTest_Add(SC_BuildTimeIndexTable_Test_OutOfOrder, SC_Test_Setup, SC_Test_TearDown, "SC_BuildTimeIndexTable_Test_OutOfOrder");
+    UtTest_Add(SC_BuildTimeIndexTable_Test_MaxCmds, SC_Test_Setup, SC_Test_TearDown, "SC_BuildTimeIndexTable_Test_MaxCmds");
     UtTest_Add(SC_ValidateAts_Test, SC_Test_Setup, SC_Test_TearDown, "SC_ValidateAts_Test");
     UtTest_Add(SC_ValidateAppend_Test, SC_Test_Setup, SC_Test_TearDown, "SC_ValidateAppend_Test");
     UtTest_Add(SC_ValidateRts_Test, SC_Test_Setup, SC_Test_TearDown, "SC_ValidateRts_Test");
@@ -1340,6 +1423,7 @@ void SC_Loads_Test_AddTestCases(void)
     UtTest_Add(SC_UpdateAppend_Test_InvalidCmdLengthTooLow, SC_Test_Setup, SC_Test_TearDown, "SC_UpdateAppend_Test_InvalidCmdLengthTooLow");
     UtTest_Add(SC_UpdateAppend_Test_InvalidCmdLengthTooHigh, SC_Test_Setup, SC_Test_TearDown, "SC_UpdateAppend_Test_InvalidCmdLengthTooHigh");
     UtTest_Add(SC_ProcessAppend_Test, SC_Test_Setup, SC_Test_TearDown, "SC_ProcessAppend_Test");
+    UtTest_Add(SC_ProcessAppend_Test_MergeReplacedCmd, SC_Test_Setup, SC_Test_TearDown, "SC_ProcessAppend_Test_MergeReplacedCmd");
     UtTest_Add(SC_VerifyAtsTable_Test_Nominal, SC_Test_Setup, SC_Test_TearDown, "SC_VerifyAtsTable_Test_Nominal");
     UtTest_Add(SC_VerifyAtsTable_Test_InvalidEntry, SC_Test_Setup, SC_Test_TearDown, "SC_VerifyAtsTable_Test_InvalidEntry");
     UtTest_Add(SC_VerifyAtsTable_Test_EmptyTable, SC_Test_Setup, SC_Test_TearDown, "SC_VerifyAtsTable_Test_EmptyTable");
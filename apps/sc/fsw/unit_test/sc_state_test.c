@@ -72,6 +72,7 @@ void SC_GetNextRtsTime_Test_Nominal(void)
 
     SC_OperData.RtsInfoTblAddr[0].RtsStatus = SC_EXECUTING;
     SC_OperData.RtsInfoTblAddr[0].NextCommandTime = SC_MAX_TIME;
+    SC_UpdateRtsSchedule(0);
 
     /* Execute the function being tested */
     SC_GetNextRtsTime();
@@ -106,6 +107,48 @@ void SC_GetNextRtsTime_Test_InvalidRtsNumber(void)
 
 } /* end SC_GetNextRtsTime_Test_InvalidRtsNumber */
 
+void SC_UpdateRtsSchedule_Test_Ordering(void)
+{
+    uint16 i;
+
+    SC_InitTables();
+
+    /* Start every RTS, later RTS's get earlier times */
+    for (i = 0; i < SC_NUMBER_OF_RTS; i++)
+    {
+        SC_OperData.RtsInfoTblAddr[i].RtsStatus = SC_EXECUTING;
+        SC_OperData.RtsInfoTblAddr[i].NextCommandTime = 1000 - i;
+        SC_UpdateRtsSchedule(i);
+    }
+
+    SC_GetNextRtsTime();
+    UtAssert_True(SC_OperData.RtsCtrlBlckAddr->RtsNumber == SC_NUMBER_OF_RTS, "SC_OperData.RtsCtrlBlckAddr->RtsNumber == SC_NUMBER_OF_RTS");
+
+    /* Step the earliest RTS past all the others, the next one takes over */
+    SC_OperData.RtsInfoTblAddr[SC_NUMBER_OF_RTS - 1].NextCommandTime = 2000;
+    SC_UpdateRtsSchedule(SC_NUMBER_OF_RTS - 1);
+
+    SC_GetNextRtsTime();
+    UtAssert_True(SC_OperData.RtsCtrlBlckAddr->RtsNumber == SC_NUMBER_OF_RTS - 1, "SC_OperData.RtsCtrlBlckAddr->RtsNumber == SC_NUMBER_OF_RTS - 1");
+
+    /* Equal times go to the lower numbered RTS */
+    SC_OperData.RtsInfoTblAddr[0].NextCommandTime = 1000 - (SC_NUMBER_OF_RTS - 2);
+    SC_UpdateRtsSchedule(0);
+
+    SC_GetNextRtsTime();
+    UtAssert_True(SC_OperData.RtsCtrlBlckAddr->RtsNumber == 1, "SC_OperData.RtsCtrlBlckAddr->RtsNumber == 1");
+
+    /* Stopping an RTS removes it from the schedule */
+    SC_KillRts(0);
+
+    SC_GetNextRtsTime();
+    UtAssert_True(SC_OperData.RtsCtrlBlckAddr->RtsNumber == SC_NUMBER_OF_RTS - 1, "SC_OperData.RtsCtrlBlckAddr->RtsNumber == SC_NUMBER_OF_RTS - 1");
+    UtAssert_True(SC_AppData.RtsHeapSize == SC_NUMBER_OF_RTS - 1, "SC_AppData.RtsHeapSize == SC_NUMBER_OF_RTS - 1");
+
+    UtAssert_True (Ut_CFE_EVS_GetEventQueueDepth() == 2, "Ut_CFE_EVS_GetEventQueueDepth() == 2");
+
+} /* end SC_UpdateRtsSchedule_Test_Ordering */
+
 void SC_UpdateNextTime_TestAtp(void)
 {
     SC_InitTables();
@@ -132,6 +175,7 @@ void SC_UpdateNextTime_TestRtp(void)
 
     SC_OperData.RtsInfoTblAddr[0].RtsStatus = SC_EXECUTING;
     SC_OperData.RtsInfoTblAddr[0].NextCommandTime = 1;
+    SC_UpdateRtsSchedule(0);
 
     /* Execute the function being tested */
     SC_UpdateNextTime();
@@ -163,8 +207,8 @@ void SC_GetNextRtsCommand_Test_GetNextCommand(void)
 
     CFE_SB_InitMsg (&Entry->CmdHeader, SC_CMD_MID, sizeof(SC_NoArgsCmd_t), TRUE);
 
-    /* Set so checksum will pass in SC_ProcessRtpCommand */
-    Ut_CFE_SB_SetReturnCode(UT_CFE_SB_VALIDATECHECKSUM_INDEX, TRUE, 1);
+    /* Set so checksum will pass in SC_ProcessRtpCommand, as if checked when the RTS was loaded */
+    SC_AppData.RtsBadChecksumPtr[0] = SC_RTS_BUFF_SIZE;
 
     /* Give the packet the minimum possible size, to ensure that (CmdOffset <  (SC_RTS_BUFF_SIZE - (sizeof(SC_RtsEntryHeader_t) / SC_BYTES_IN_WORD) is met */
     Ut_CFE_SB_SetReturnCode(UT_CFE_SB_GETTOTALMSGLENGTH_INDEX, SC_PACKET_MIN_SIZE, 1);
@@ -202,8 +246,8 @@ void SC_GetNextRtsCommand_Test_RtsLengthError(void)
 
     CFE_SB_InitMsg (&Entry->CmdHeader, SC_CMD_MID, sizeof(SC_NoArgsCmd_t), TRUE);
 
-    /* Set so checksum will pass in SC_ProcessRtpCommand */
-    Ut_CFE_SB_SetReturnCode(UT_CFE_SB_VALIDATECHECKSUM_INDEX, TRUE, 1);
+    /* Set so checksum will pass in SC_ProcessRtpCommand, as if checked when the RTS was loaded */
+    SC_AppData.RtsBadChecksumPtr[0] = SC_RTS_BUFF_SIZE;
     
     SC_OperData.AtsInfoTblAddr[1].NumberOfCommands = 1;
 
@@ -253,8 +297,8 @@ void SC_GetNextRtsCommand_Test_CommandLengthError(void)
 
     CFE_SB_InitMsg (&Entry->CmdHeader, SC_CMD_MID, sizeof(SC_NoArgsCmd_t), TRUE);
 
-    /* Set to make checksum pass in SC_ProcessRtpCommand, so that SC_GetNextRtsCommand is reached */
-    Ut_CFE_SB_SetReturnCode(UT_CFE_SB_VALIDATECHECKSUM_INDEX, TRUE, 1);
+    /* Set to make checksum pass in SC_ProcessRtpCommand, as if checked when the RTS was loaded, so that SC_GetNextRtsCommand is reached */
+    SC_AppData.RtsBadChecksumPtr[0] = SC_RTS_BUFF_SIZE;
     Ut_CFE_SB_SetReturnCode(UT_CFE_SB_SENDMSG_INDEX, CFE_SUCCESS, 1);
     
     SC_OperData.AtsInfoTblAddr[1].NumberOfCommands = 1;
@@ -306,8 +350,8 @@ void SC_GetNextRtsCommand_Test_ZeroCommandLength(void)
 
     CFE_SB_InitMsg (&Entry->CmdHeader, SC_CMD_MID, sizeof(SC_NoArgsCmd_t), TRUE);
 
-    /* Set to make checksum pass in SC_ProcessRtpCommand, so that SC_GetNextRtsCommand is reached */
-    Ut_CFE_SB_SetReturnCode(UT_CFE_SB_VALIDATECHECKSUM_INDEX, TRUE, 1);
+    /* Set to make checksum pass in SC_ProcessRtpCommand, as if checked when the RTS was loaded, so that SC_GetNextRtsCommand is reached */
+    SC_AppData.RtsBadChecksumPtr[0] = SC_RTS_BUFF_SIZE;
     Ut_CFE_SB_SetReturnCode(UT_CFE_SB_SENDMSG_INDEX, CFE_SUCCESS, 1);
     
     SC_OperData.AtsInfoTblAddr[1].NumberOfCommands = 1;
@@ -350,8 +394,8 @@ void SC_GetNextRtsCommand_Test_EndOfBuffer(void)
 
     CFE_SB_InitMsg (&Entry->CmdHeader, SC_CMD_MID, sizeof(SC_NoArgsCmd_t), TRUE);
 
-    /* Set to make checksum pass in SC_ProcessRtpCommand, so that SC_GetNextRtsCommand is reached */
-    Ut_CFE_SB_SetReturnCode(UT_CFE_SB_VALIDATECHECKSUM_INDEX, TRUE, 1);
+    /* Set to make checksum pass in SC_ProcessRtpCommand, as if checked when the RTS was loaded, so that SC_GetNextRtsCommand is reached */
+    SC_AppData.RtsBadChecksumPtr[0] = SC_RTS_BUFF_SIZE;
     Ut_CFE_SB_SetReturnCode(UT_CFE_SB_SENDMSG_INDEX, CFE_SUCCESS, 1);
     
     SC_OperData.AtsInfoTblAddr[1].NumberOfCommands = 1;
@@ -466,12 +510,55 @@ void SC_GetNextAtsCommand_Test_ExecutionCompleted(void)
 
 } /* end SC_GetNextAtsCommand_Test_ExecutionCompleted */
 
+void SC_GetWakeupTimeout_Test_NothingScheduled(void)
+{
+    int32 Timeout;
+
+    SC_InitTables();
+
+    /* Execute the function being tested */
+    Timeout = SC_GetWakeupTimeout();
+    
+    /* Verify results */
+    UtAssert_True(SC_AppData.NextProcNumber == SC_NONE, "SC_AppData.NextProcNumber == SC_NONE");
+    UtAssert_True(Timeout == CFE_SB_PEND_FOREVER, "Timeout == CFE_SB_PEND_FOREVER");
+
+    UtAssert_True (Ut_CFE_EVS_GetEventQueueDepth() == 0, "Ut_CFE_EVS_GetEventQueueDepth() == 0");
+
+} /* end SC_GetWakeupTimeout_Test_NothingScheduled */
+
+void SC_GetWakeupTimeout_Test_RateLimited(void)
+{
+    int32 Timeout;
+
+    SC_InitTables();
+
+    SC_OperData.AtsCtrlBlckAddr->AtpState = SC_EXECUTING;
+    SC_AppData.NextCmdTime[SC_ATP] = 0;
+
+    SC_OperData.NumCmdsSec     = SC_MAX_CMDS_PER_WINDOW;
+    SC_OperData.RateWindowSecs = 0;
+    SC_OperData.RateWindowMsec = 0;
+
+    /* Execute the function being tested */
+    Timeout = SC_GetWakeupTimeout();
+    
+    /* Verify results: commands are due but must wait for the window to close */
+    UtAssert_True(SC_AppData.NextProcNumber == SC_ATP, "SC_AppData.NextProcNumber == SC_ATP");
+    UtAssert_True(Timeout > 0, "Timeout > 0");
+    UtAssert_True(Timeout <= SC_MAX_WAKEUP_WAIT_MSEC, "Timeout <= SC_MAX_WAKEUP_WAIT_MSEC");
+
+} /* end SC_GetWakeupTimeout_Test_RateLimited */
+
 void SC_State_Test_AddTestCases(void)
 {
     UtTest_Add(SC_GetNextRtsTime_Test_Nominal, SC_Test_Setup, SC_Test_TearDown, "SC_GetNextRtsTime_Test_Nominal");
     UtTest_Add(SC_GetNextRtsTime_Test_InvalidRtsNumber, SC_Test_Setup, SC_Test_TearDown, "SC_GetNextRtsTime_Test_InvalidRtsNumber");
+    UtTest_Add(SC_UpdateRtsSchedule_Test_Ordering, SC_Test_Setup, SC_Test_TearDown, "SC_UpdateRtsSchedule_Test_Ordering");
     UtTest_Add(SC_UpdateNextTime_TestAtp, SC_Test_Setup, SC_Test_TearDown, "SC_UpdateNextTime_TestAtp");
     UtTest_Add(SC_UpdateNextTime_TestRtp, SC_Test_Setup, SC_Test_TearDown, "SC_UpdateNextTime_TestRtp");
+    UtTest_Add(SC_GetWakeupTimeout_Test_NothingScheduled, SC_Test_Setup, SC_Test_TearDown, "SC_GetWakeupTimeout_Test_NothingScheduled");
+    UtTest_Add(SC_GetWakeupTimeout_Test_RateLimited, SC_Test_Setup, SC_Test_TearDown, "SC_GetWakeupTimeout_Test_RateLimited");
 
     UtTest_Add(SC_GetNextRtsCommand_Test_GetNextCommand, SC_Test_Setup, SC_Test_TearDown, "SC_GetNextRtsCommand_Test_GetNextCommand");
     UtTest_Add(SC_GetNextRtsCommand_Test_RtsLengthError, SC_Test_Setup, SC_Test_TearDown, "SC_GetNextRtsCommand_Test_RtsLengthError");
@@ -40,6 +40,7 @@
 #include "cfe_es.h"
 #include "cfe_es_apps.h"
 #include "cfe_es_global.h"
+#include "cfe_es_start.h"
 #include "cfe_es_events.h"
 #include "cfe_es_cds.h"
 #include "cfe_es_cds_mempool.h"
@@ -211,6 +212,92 @@ void CFE_ES_SetAppState(uint32 AppID, uint32 TargetState)
     }
 
     AppState->AppState = TargetState;
+
+    CFE_ES_StartupSyncSignal();
+}
+
+/*
+ * Function: CFE_ES_StartupSyncSignal
+ *
+ * Purpose: Internal ES function to wake every task waiting in CFE_ES_StartupSyncWait()
+ *          after an app or system state change.
+ *
+ * The flush wakes the tasks that are already waiting, and the give leaves the
+ * semaphore full so a task that checked the state just before the change does
+ * not wait for a change that has already happened.
+ */
+void CFE_ES_StartupSyncSignal(void)
+{
+    if (CFE_ES_Global.StartupSyncSem != 0)
+    {
+        OS_BinSemFlush(CFE_ES_Global.StartupSyncSem);
+        OS_BinSemGive(CFE_ES_Global.StartupSyncSem);
+    }
+}
+
+/*
+ * Function: CFE_ES_StartupSyncWait
+ *
+ * Purpose: Internal ES function to wait for the next app or system state change.
+ *
+ * Waits at most CFE_PLATFORM_ES_STARTUP_SYNC_POLL_MSEC, so that a missed wakeup
+ * costs no more than the old polling did, and deducts the time waited from
+ * *WaitRemaining.  Returns false without waiting once no time remains.
+ *
+ * NOTE: This must be called without the ES global state locked.
+ */
+bool CFE_ES_StartupSyncWait(uint32 *WaitRemaining)
+{
+    uint32 WaitTime;
+    uint32 WaitStart;
+    uint32 Elapsed;
+    int32  Status;
+
+    if (*WaitRemaining > CFE_PLATFORM_ES_STARTUP_SYNC_POLL_MSEC)
+    {
+        WaitTime = CFE_PLATFORM_ES_STARTUP_SYNC_POLL_MSEC;
+    }
+    else if (*WaitRemaining > 0)
+    {
+        WaitTime = *WaitRemaining;
+    }
+    else
+    {
+        return false;
+    }
+
+    WaitStart = CFE_ES_GetBootClock();
+    Status = OS_ERROR;
+    if (CFE_ES_Global.StartupSyncSem != 0)
+    {
+        Status = OS_BinSemTimedWait(CFE_ES_Global.StartupSyncSem, WaitTime);
+    }
+
+    if (Status == OS_SUCCESS)
+    {
+        /* woken by a state change, charge the time actually waited (at least 1 msec) */
+        Elapsed = (CFE_ES_GetBootClock() - WaitStart + 999) / 1000;
+        if (Elapsed == 0)
+        {
+            Elapsed = 1;
+        }
+        else if (Elapsed > WaitTime)
+        {
+            Elapsed = WaitTime;
+        }
+    }
+    else
+    {
+        if (Status != OS_SEM_TIMEOUT)
+        {
+            OS_TaskDelay(WaitTime);
+        }
+        Elapsed = WaitTime;
+    }
+
+    *WaitRemaining -= Elapsed;
+
+    return true;
 }
 
 /*
@@ -609,7 +696,6 @@ int32 CFE_ES_WaitForSystemState(uint32 MinSystemState, uint32 TimeOutMillisecond
     int32 Status;
     uint32 AppID;
     uint32 RequiredAppState;
-    uint32 WaitTime;
     uint32 WaitRemaining;
 
     /*
@@ -671,24 +757,11 @@ int32 CFE_ES_WaitForSystemState(uint32 MinSystemState, uint32 TimeOutMillisecond
     WaitRemaining = TimeOutMilliseconds;
     while (CFE_ES_Global.SystemState < MinSystemState)
     {
-        /* TBD: Very Crude timing here, but not sure if it matters,
-         * as this is only done during startup, not real work */
-        if (WaitRemaining > CFE_PLATFORM_ES_STARTUP_SYNC_POLL_MSEC)
-        {
-            WaitTime = CFE_PLATFORM_ES_STARTUP_SYNC_POLL_MSEC;
-        }
-        else if (WaitRemaining > 0)
-        {
-            WaitTime = WaitRemaining;
-        }
-        else
+        if (!CFE_ES_StartupSyncWait(&WaitRemaining))
         {
             Status = CFE_ES_OPERATION_TIMED_OUT;
             break;
         }
-
-        OS_TaskDelay(WaitTime);
-        WaitRemaining -= WaitTime;
     }
 
     return Status;
@@ -800,13 +873,40 @@ int32 CFE_ES_GetAppIDByName(uint32 *AppIdPtr, const char *AppName)
 */
 int32 CFE_ES_GetAppID(uint32 *AppIdPtr)
 {
-   int32  Result;
+   int32  Result = CFE_ES_ERR_APPID;
+#ifdef CFE_ES_LOCKFREE_GETAPPID
+   uint32 OSTaskId;
+   uint32 TaskId;
 
-   CFE_ES_LockSharedData(__func__,__LINE__);
+   /*
+   ** Fast path: a task's own TaskTable entry cannot be released while the
+   ** task is running, and the OSAL task ID is unique to this instance of
+   ** the task (a restarted app gets a new one).  So once the entry carries
+   ** the caller's task ID its AppId can be read without the lock.
+   */
+   OSTaskId = OS_TaskGetId();
+   if (OS_ConvertToArrayIndex(OSTaskId, &TaskId) == OS_SUCCESS &&
+       TaskId < OS_MAX_TASKS &&
+       CFE_ES_Global.TaskTable[TaskId].RecordUsed == true &&
+       CFE_ES_Global.TaskTable[TaskId].TaskId == OSTaskId)
+   {
+      CFE_ES_TASKTABLE_SYNC();
+      *AppIdPtr = CFE_ES_Global.TaskTable[TaskId].AppId;
+      Result = CFE_SUCCESS;
+   }
+#endif
 
-   Result = CFE_ES_GetAppIDInternal(AppIdPtr);
+   /*
+   ** The entry is still being filled in (or this is not a cFE task)
+   */
+   if (Result != CFE_SUCCESS)
+   {
+      CFE_ES_LockSharedData(__func__,__LINE__);
 
-   CFE_ES_UnlockSharedData(__func__,__LINE__);
+      Result = CFE_ES_GetAppIDInternal(AppIdPtr);
+
+      CFE_ES_UnlockSharedData(__func__,__LINE__);
+   }
       
    return(Result);
 
@@ -903,6 +1003,61 @@ int32 CFE_ES_GetAppInfo(CFE_ES_AppInfo_t *AppInfo, uint32 AppId)
 
 } /* End of CFE_ES_GetAppInfo() */
 
+/*
+** Function: CFE_ES_GetAppExecCounter
+**
+** Purpose:  Get the main task execution counter of an App, along with the
+**           generation of the App it was read from.
+**
+*/
+int32 CFE_ES_GetAppExecCounter(uint32 AppId, uint32 *ExecutionCounter, uint32 *Generation)
+{
+   int32  ReturnCode = CFE_ES_ERR_APPID;
+   uint32 AppGeneration;
+   uint32 TaskIndex;
+   uint32 Counter;
+
+   if ( ExecutionCounter == NULL || Generation == NULL )
+   {
+      ReturnCode = CFE_ES_ERR_BUFFER;
+   }
+   else if ( AppId < CFE_PLATFORM_ES_MAX_APPLICATIONS )
+   {
+#ifndef CFE_ES_LOCKFREE_EXECCOUNTER
+      CFE_ES_LockSharedData(__func__,__LINE__);
+#endif
+
+      /*
+      ** An odd generation is a running app; if it is unchanged after the
+      ** counter is read then so is the app the counter was read from
+      */
+      AppGeneration = CFE_ES_Global.AppGeneration[AppId];
+      CFE_ES_TASKTABLE_SYNC();
+
+      if ( (AppGeneration & 1) != 0 &&
+           OS_ConvertToArrayIndex(CFE_ES_Global.AppTable[AppId].TaskInfo.MainTaskId, &TaskIndex) == OS_SUCCESS &&
+           TaskIndex < OS_MAX_TASKS )
+      {
+         Counter = CFE_ES_Global.TaskTable[TaskIndex].ExecutionCounter;
+         CFE_ES_TASKTABLE_SYNC();
+
+         if ( CFE_ES_Global.AppGeneration[AppId] == AppGeneration )
+         {
+            *ExecutionCounter = Counter;
+            *Generation = AppGeneration;
+            ReturnCode = CFE_SUCCESS;
+         }
+      }
+
+#ifndef CFE_ES_LOCKFREE_EXECCOUNTER
+      CFE_ES_UnlockSharedData(__func__,__LINE__);
+#endif
+   }
+
+   return(ReturnCode);
+
+} /* End of CFE_ES_GetAppExecCounter() */
+
 /*
 ** Function: CFE_ES_GetTaskInfo
 **
@@ -1070,9 +1225,11 @@ int32 CFE_ES_CreateChildTask(uint32 *TaskIdPtr,
 
                CFE_ES_Global.TaskTable[TaskId].RecordUsed = true;
                CFE_ES_Global.TaskTable[TaskId].AppId = AppId;
+               CFE_ES_TASKTABLE_SYNC();
                CFE_ES_Global.TaskTable[TaskId].TaskId = *TaskIdPtr;
                strncpy((char *)CFE_ES_Global.TaskTable[TaskId].TaskName,TaskName,OS_MAX_API_NAME);
                CFE_ES_Global.TaskTable[TaskId].TaskName[OS_MAX_API_NAME - 1] = '\0';
+               CFE_ES_SetTaskFullName(TaskId);
                CFE_ES_Global.RegisteredTasks++;
 
                /*
@@ -1763,6 +1920,37 @@ int32 CFE_ES_GetAppIDInternal(uint32 *AppIdPtr)
 } /* End of CFE_ES_GetAppIDInternal() */
 
 
+/*
+** Function: CFE_ES_GetTaskFullName - See API and header file for details
+*/
+int32 CFE_ES_GetTaskFullName(uint32 OSTaskId, char *FullName)
+{
+   int32  ReturnCode = CFE_ES_ERR_TASKID;
+   uint32 TaskId;
+
+   CFE_ES_LockSharedData(__func__,__LINE__);
+
+   /*
+   ** The OSAL ID must still match the record, otherwise the task that
+   ** was asked about has exited and its slot was reused.
+   */
+   if (OS_ConvertToArrayIndex(OSTaskId, &TaskId) == OS_SUCCESS &&
+       TaskId < OS_MAX_TASKS &&
+       CFE_ES_Global.TaskTable[TaskId].RecordUsed == true &&
+       CFE_ES_Global.TaskTable[TaskId].TaskId == OSTaskId)
+   {
+      strncpy(FullName, CFE_ES_Global.TaskTable[TaskId].FullName, OS_MAX_API_NAME);
+      FullName[OS_MAX_API_NAME - 1] = '\0';
+      ReturnCode = CFE_SUCCESS;
+   }
+
+   CFE_ES_UnlockSharedData(__func__,__LINE__);
+
+   return(ReturnCode);
+
+} /* End of CFE_ES_GetTaskFullName() */
+
+
 /******************************************************************************
 **  Function:  CFE_ES_LockSharedData()
 **
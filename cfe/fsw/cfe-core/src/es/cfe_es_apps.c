@@ -41,6 +41,7 @@
 #include "cfe_psp.h"     
 #include "cfe_es_global.h"
 #include "cfe_es_apps.h"
+#include "cfe_es_start.h"
 #include "cfe_es_log.h"
 
 #include <stdio.h>
@@ -51,6 +52,7 @@
 ** Defines
 */
 #define ES_START_BUFF_SIZE 128
+#define ES_START_READ_SIZE 512   /* bytes of the startup script read per OS_read call */
 
 /* For extra debug code */
 #undef ES_APP_DEBUG
@@ -78,6 +80,9 @@
 void CFE_ES_StartApplications(uint32 ResetType, const char *StartFilePath )
 {
    char ES_AppLoadBuffer[ES_START_BUFF_SIZE];  /* A buffer of for a line in a file */   
+   char ES_ReadBuffer[ES_START_READ_SIZE];     /* A block of the file being parsed */
+   int32       ReadLength = 0;                         /* Bytes in the read buffer */
+   int32       ReadIndex = 0;                          /* Next byte to parse in the read buffer */
    const char *TokenList[CFE_ES_STARTSCRIPT_MAX_TOKENS_PER_LINE];
    uint32      NumTokens;
    uint32      BuffLen = 0;                            /* Length of the current buffer */
@@ -153,20 +158,33 @@ void CFE_ES_StartApplications(uint32 ResetType, const char *StartFilePath )
       */
       while(1)
       {
-         ReadStatus = OS_read(AppFile, &c, 1);
-         if ( ReadStatus == OS_FS_ERROR )
-         {
-            CFE_ES_WriteToSysLog ("ES Startup: Error Reading Startup file. EC = 0x%08X\n",(unsigned int)ReadStatus);
-            break;
-         }
-         else if ( ReadStatus == 0 )
+         /*
+         ** Refill the read buffer once every byte in it has been parsed
+         */
+         if ( ReadIndex >= ReadLength )
          {
-            /*
-            ** EOF Reached
-            */
-            break;
+            ReadStatus = OS_read(AppFile, ES_ReadBuffer, sizeof(ES_ReadBuffer));
+            if ( ReadStatus == OS_FS_ERROR )
+            {
+               CFE_ES_WriteToSysLog ("ES Startup: Error Reading Startup file. EC = 0x%08X\n",(unsigned int)ReadStatus);
+               break;
+            }
+            else if ( ReadStatus <= 0 )
+            {
+               /*
+               ** EOF Reached
+               */
+               break;
+            }
+
+            ReadLength = ReadStatus;
+            ReadIndex = 0;
          }
-         else if(c != '!')
+
+         c = ES_ReadBuffer[ReadIndex];
+         ++ReadIndex;
+
+         if(c != '!')
          {
              if ( c <= ' ')
              {
@@ -272,6 +290,7 @@ int32 CFE_ES_ParseFileEntry(const char **TokenList, uint32 NumTokens)
    unsigned int StackSize;
    unsigned int ExceptionAction;
    uint32 ApplicationId;
+   uint32 LoadStart;
    int32  CreateStatus = CFE_ES_ERR_APP_CREATE;
 
    /*
@@ -280,9 +299,12 @@ int32 CFE_ES_ParseFileEntry(const char **TokenList, uint32 NumTokens)
    if ( NumTokens < 8 )
    {
       CFE_ES_WriteToSysLog("ES Startup: Invalid ES Startup file entry: %u\n",(unsigned int)NumTokens);
+      ++CFE_ES_Global.BootProfile.LoadErrors;
       return (CreateStatus);
    }
 
+   LoadStart = CFE_ES_GetBootClock();
+
    EntryType = TokenList[0];
    FileName = TokenList[1];
    EntryPoint = TokenList[2];
@@ -344,6 +366,23 @@ int32 CFE_ES_ParseFileEntry(const char **TokenList, uint32 NumTokens)
       CFE_ES_WriteToSysLog("ES Startup: Unexpected EntryType %s in startup file.\n",EntryType);
    }
 
+   /*
+   ** Account for the entry in the boot profile
+   */
+   CFE_ES_Global.BootProfile.ModuleLoadUsec += CFE_ES_GetBootClock() - LoadStart;
+   if (CreateStatus != CFE_SUCCESS)
+   {
+      ++CFE_ES_Global.BootProfile.LoadErrors;
+   }
+   else if (strcmp(EntryType,"CFE_LIB")==0)
+   {
+      ++CFE_ES_Global.BootProfile.LibsLoaded;
+   }
+   else
+   {
+      ++CFE_ES_Global.BootProfile.AppsCreated;
+   }
+
    return (CreateStatus);
 
 }
@@ -619,13 +658,21 @@ int32 CFE_ES_AppCreate(uint32 *ApplicationIdPtr,
             CFE_ES_Global.TaskTable[TaskId].RecordUsed = true;
          }
          CFE_ES_Global.TaskTable[TaskId].AppId = i;
+         CFE_ES_TASKTABLE_SYNC();
          CFE_ES_Global.TaskTable[TaskId].TaskId = CFE_ES_Global.AppTable[i].TaskInfo.MainTaskId;
          strncpy((char *)CFE_ES_Global.TaskTable[TaskId].TaskName,
              (char *)CFE_ES_Global.AppTable[i].TaskInfo.MainTaskName,OS_MAX_API_NAME );
          CFE_ES_Global.TaskTable[TaskId].TaskName[OS_MAX_API_NAME - 1]='\0';
+         CFE_ES_SetTaskFullName(TaskId);
          CFE_ES_SysLogWrite_Unsync("ES Startup: %s loaded and created\n", AppName);
          *ApplicationIdPtr = i;
 
+         /*
+         ** Publish the app for lock-free execution counter reads
+         */
+         CFE_ES_TASKTABLE_SYNC();
+         CFE_ES_Global.AppGeneration[i]++;
+
          /*
          ** Increment the registered App and Registered External Task variables.
          */
@@ -1232,6 +1279,15 @@ int32 CFE_ES_CleanUpApp(uint32 AppId)
    */
    CFE_ES_LockSharedData(__func__,__LINE__);
         
+   /*
+   ** Retire the app for lock-free execution counter reads before any of it is torn down
+   */
+   if ( (CFE_ES_Global.AppGeneration[AppId] & 1) != 0 )
+   {
+      CFE_ES_Global.AppGeneration[AppId]++;
+      CFE_ES_TASKTABLE_SYNC();
+   }
+
    /*
    ** Get Main Task ID
    */
@@ -1618,3 +1674,38 @@ void CFE_ES_GetAppInfoInternal(uint32 AppId, CFE_ES_AppInfo_t *AppInfoPtr )
 
 } /* end function */
 
+
+/*
+**---------------------------------------------------------------------------------------
+**   Name: CFE_ES_SetTaskFullName
+**
+**   Purpose: Compose the "App.Task" name cached in a task table entry.  When
+**            the task name matches the app name only the app name is used.
+**            The result is truncated to OS_MAX_API_NAME characters, which is
+**            the width of the name in the SB sender ID.
+**
+**            The caller must hold the ES shared data lock and must already
+**            have filled in the AppId and TaskName of the entry.
+**---------------------------------------------------------------------------------------
+*/
+void CFE_ES_SetTaskFullName(uint32 TaskIndex)
+{
+   CFE_ES_TaskRecord_t *TaskRecPtr = &CFE_ES_Global.TaskTable[TaskIndex];
+   const char          *AppName = (const char *)CFE_ES_Global.AppTable[TaskRecPtr->AppId].StartParams.Name;
+   uint32               Len;
+
+   strncpy(TaskRecPtr->FullName, AppName, OS_MAX_API_NAME - 1);
+   TaskRecPtr->FullName[OS_MAX_API_NAME - 1] = '\0';
+
+   if (strncmp(AppName, TaskRecPtr->TaskName, OS_MAX_API_NAME - 1) != 0)
+   {
+      Len = strlen(TaskRecPtr->FullName);
+      if (Len < (OS_MAX_API_NAME - 1))
+      {
+         TaskRecPtr->FullName[Len] = '.';
+         ++Len;
+         strncpy(&TaskRecPtr->FullName[Len], TaskRecPtr->TaskName, OS_MAX_API_NAME - 1 - Len);
+      }
+   }
+
+} /* End of CFE_ES_SetTaskFullName() */
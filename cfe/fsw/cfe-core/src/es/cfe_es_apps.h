@@ -123,7 +123,7 @@ typedef struct
    uint32    TaskId;                          /* Task ID */
    uint32    ExecutionCounter;                /* The execution counter for the Child task */
    char      TaskName[OS_MAX_API_NAME];       /* Task Name */
-   
+   char      FullName[OS_MAX_API_NAME];       /* Cached "App.Task" name, see CFE_ES_SetTaskFullName */
    
 } CFE_ES_TaskRecord_t;
 
@@ -158,6 +158,12 @@ int32 CFE_ES_ParseFileEntry(const char **TokenList, uint32 NumTokens);
  */
 void CFE_ES_SetAppState(uint32 AppID, uint32 TargetState);
 
+/*
+ * Internal functions to wake and wait for tasks synchronizing on app and system state changes
+ */
+void CFE_ES_StartupSyncSignal(void);
+bool CFE_ES_StartupSyncWait(uint32 *WaitRemaining);
+
 
 /*
 ** Internal function to create/start a new cFE app
@@ -221,4 +227,12 @@ int32 CFE_ES_ListResourcesDebug(void);
 */
 void CFE_ES_GetAppInfoInternal(uint32 AppId, CFE_ES_AppInfo_t *AppInfoPtr );
 
+/*
+** Compose the cached "App.Task" name of a task table entry from its
+** parent app and task names.  Called once whenever a task record is
+** filled in so that name lookups do not have to rebuild it.
+** This is an internal function for use in ES.
+*/
+void CFE_ES_SetTaskFullName(uint32 TaskIndex);
+
 #endif  /* _cfe_es_apps_ */
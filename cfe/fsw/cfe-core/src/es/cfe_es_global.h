@@ -89,8 +89,15 @@ typedef struct
    
    /*
    ** Startup Sync
+   ** StartupSyncSem is flushed on every app or system state change
    */
    uint32  SystemState;
+   uint32  StartupSyncSem;
+
+   /*
+   ** Boot timings, sent once by the ES task when startup completes
+   */
+   CFE_ES_BootProfileTlm_Payload_t BootProfile;
 
    /*
    ** ES Task Table
@@ -104,6 +111,12 @@ typedef struct
    uint32             RegisteredCoreApps;
    uint32             RegisteredExternalApps;
    CFE_ES_AppRecord_t AppTable[CFE_PLATFORM_ES_MAX_APPLICATIONS];
+
+   /*
+   ** ES App Generations, bumped when an app is published and again when
+   ** it is cleaned up, so a generation is odd while its app is running
+   */
+   volatile uint32    AppGeneration[CFE_PLATFORM_ES_MAX_APPLICATIONS];
    
    /*
    ** ES Shared Library Table
@@ -134,6 +147,25 @@ extern CFE_ES_Global_t CFE_ES_Global;
 extern CFE_ES_ResetData_t *CFE_ES_ResetDataPtr;
 
 
+/*
+** CFE_ES_GetAppID reads the calling task's own TaskTable entry without
+** taking the shared data lock.  Writers fill in the entry's AppId before
+** publishing its TaskId, with a full memory barrier in between, and the
+** reader uses the same barrier after matching the TaskId.  Compilers that
+** do not provide a barrier always use the locked lookup.
+**
+** CFE_ES_GetAppExecCounter uses the same barrier around the AppGeneration
+** of the app it reads: a generation that is unchanged across the read
+** means the app was neither published nor cleaned up in between.
+*/
+#if defined(__GNUC__)
+#define CFE_ES_LOCKFREE_GETAPPID
+#define CFE_ES_LOCKFREE_EXECCOUNTER
+#define CFE_ES_TASKTABLE_SYNC()    __sync_synchronize()
+#else
+#define CFE_ES_TASKTABLE_SYNC()
+#endif
+
 /*
 ** Functions used to lock/unlock shared data
 */
@@ -41,6 +41,7 @@
 #include "cfe_fs.h"
 #include "cfe_psp.h"
 #include <string.h>
+#include <stdio.h>
 
 
 /*
@@ -48,6 +49,42 @@
 */
 CFE_ES_PerfData_t      *Perf;
 CFE_ES_PerfLogDump_t    CFE_ES_PerfLogDumpStatus;
+CFE_ES_PerfStream_t     CFE_ES_PerfStreamStatus;
+
+/*
+** Number of the entry last stored in each data buffer slot while streaming.
+** A slot being filled holds its entry number minus one.
+*/
+static uint32           CFE_ES_PerfStreamSeq[CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE];
+
+/*
+** Online statistics for each perf id and the id to report next
+*/
+CFE_ES_PerfStatsRecord_t CFE_ES_PerfStats[CFE_MISSION_ES_PERF_MAX_IDS];
+static uint32           CFE_ES_PerfStatsNextId;
+
+/*
+** Markers left out of the statistics because their record was busy
+*/
+uint32                  CFE_ES_PerfStatsDropped;
+
+/*
+** Local function prototypes
+*/
+static uint32 CFE_ES_PerfReserveEntry(void);
+static uint32 CFE_ES_PerfCountTrigger(void);
+static bool   CFE_ES_PerfEntryIsLater(const CFE_ES_PerfDataEntry_t *Entry1,
+                                      const CFE_ES_PerfDataEntry_t *Entry2);
+static void   CFE_ES_PerfStreamAdd(uint32 Data);
+static int32  CFE_ES_PerfStreamOpen(void);
+static int32  CFE_ES_PerfStreamFlush(void);
+static int32  CFE_ES_PerfStreamPutEntry(const CFE_ES_PerfDataEntry_t *Entry);
+static int32  CFE_ES_PerfStreamPutLost(void);
+static uint32 CFE_ES_PerfStreamPutVarint(uint8 *Buffer, uint64 Value);
+static void   CFE_ES_PerfUpdateStats(uint32 Marker, uint32 EntryExit);
+static bool   CFE_ES_PerfStatsLock(CFE_ES_PerfStatsRecord_t *Record);
+static void   CFE_ES_PerfStatsUnlock(CFE_ES_PerfStatsRecord_t *Record);
+static uint32 CFE_ES_PerfStatsBucket(uint32 Usec);
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /* Name: CFE_ES_SetupPerfVariables                                               */
@@ -116,6 +153,16 @@ void CFE_ES_SetupPerfVariables(uint32 ResetType)
     CFE_ES_PerfLogDumpStatus.DataToWrite = 0;
     CFE_ES_PerfLogDumpStatus.ChildID = 0;
     CFE_ES_PerfLogDumpStatus.DataFileName[0] = '\0';
+
+    /* statistics are kept outside the reset area and restart from zero */
+    memset(CFE_ES_PerfStats, 0, sizeof(CFE_ES_PerfStats));
+    CFE_ES_PerfStatsNextId = 0;
+    CFE_ES_PerfStatsDropped = 0;
+
+    /* a streaming child task does not survive a reset */
+    CFE_ES_PerfStreamStatus.Active = false;
+    CFE_ES_PerfStreamStatus.StopRequest = false;
+    CFE_ES_PerfStreamStatus.ChildID = 0;
 }
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
@@ -126,16 +173,23 @@ void CFE_ES_SetupPerfVariables(uint32 ResetType)
 int32 CFE_ES_StartPerfDataCmd(const CFE_ES_StartPerfData_t *data)
 {
     const CFE_ES_StartPerfCmd_Payload_t *CmdPtr = &data->Payload;
+    CFE_ES_PerfMetaData_t PrevMetaData;
+    uint32 i;
+    int32  Stat;
 
     /* Ensure there is no file write in progress before proceeding */
-    if(CFE_ES_PerfLogDumpStatus.DataToWrite == 0)
+    if(CFE_ES_PerfLogDumpStatus.DataToWrite == 0 && !CFE_ES_PerfStreamStatus.Active)
     {
         /* Make sure Trigger Mode is valid */
         /* cppcheck-suppress unsignedPositive */
         if ((CmdPtr->TriggerMode >= CFE_ES_PERF_TRIGGER_START) && (CmdPtr->TriggerMode < CFE_ES_PERF_MAX_MODES))
         {
 
-            CFE_ES_TaskData.CommandCounter++;
+            /*
+            ** The streaming task drains from the reset buffer as soon as it
+            ** runs, so the buffer is reset first and put back if it cannot start
+            */
+            PrevMetaData = Perf->MetaData;
 
             Perf->MetaData.Mode = CmdPtr->TriggerMode;
             Perf->MetaData.TriggerCount = 0;
@@ -143,7 +197,61 @@ int32 CFE_ES_StartPerfDataCmd(const CFE_ES_StartPerfData_t *data)
             Perf->MetaData.DataEnd = 0;
             Perf->MetaData.DataCount = 0;
             Perf->MetaData.InvalidMarkerReported = false;
-            Perf->MetaData.State = CFE_ES_PERF_WAITING_FOR_TRIGGER; /* this must be done last */
+
+            if (CmdPtr->TriggerMode == CFE_ES_PERF_STREAM)
+            {
+                /* no slot holds an entry yet */
+                for (i = 0; i < CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE; i++)
+                {
+                    CFE_ES_PerfStreamSeq[i] = i - 1;
+                }
+
+                memset(&CFE_ES_PerfStreamStatus, 0, sizeof(CFE_ES_PerfStreamStatus));
+                CFE_ES_PerfStreamStatus.FileDescriptor = -1;
+                CFE_ES_PerfStreamStatus.Active = true;
+
+                /* Spawn a task to drain the performance data into the stream files */
+                Stat = CFE_ES_CreateChildTask(&CFE_ES_PerfStreamStatus.ChildID,
+                        CFE_ES_PERF_STREAM_CHILD_NAME,
+                        CFE_ES_PerfStreamTask,
+                        CFE_ES_PERF_CHILD_STACK_PTR,
+                        CFE_PLATFORM_ES_PERF_CHILD_STACK_SIZE,
+                        CFE_PLATFORM_ES_PERF_CHILD_PRIORITY,
+                        CFE_ES_PERF_CHILD_FLAGS);
+
+                if (Stat != CFE_SUCCESS)
+                {
+                    /* leave the capture as it was, not streaming with nobody to drain it */
+                    Perf->MetaData = PrevMetaData;
+                    CFE_ES_PerfStreamStatus.Active = false;
+                    CFE_ES_TaskData.CommandErrorCounter++;
+                    CFE_EVS_SendEvent(CFE_ES_PERF_STREAM_ERR_EID, CFE_EVS_EventType_ERROR,
+                            "Cannot start streaming performance data,Error creating child task RC=0x%08X",
+                            (unsigned int)Stat);
+                    return CFE_SUCCESS;
+                }
+
+                /* every entry is streamed, so there is no trigger to wait for */
+                Perf->MetaData.State = CFE_ES_PERF_TRIGGERED;
+            }
+            else
+            {
+                Perf->MetaData.State = CFE_ES_PERF_WAITING_FOR_TRIGGER; /* this must be done last */
+            }
+
+#if CFE_PLATFORM_ES_PERF_STATS_RATE > 0
+            /* intervals restart with the capture so both describe the same run */
+            for (i = 0; i < CFE_MISSION_ES_PERF_MAX_IDS; i++)
+            {
+                if (CFE_ES_PerfStatsLock(&CFE_ES_PerfStats[i]))
+                {
+                    CFE_ES_PerfStats[i].LastMarker = CFE_ES_PERF_LAST_NONE;
+                    CFE_ES_PerfStatsUnlock(&CFE_ES_PerfStats[i]);
+                }
+            }
+#endif
+
+            CFE_ES_TaskData.CommandCounter++;
 
             CFE_EVS_SendEvent(CFE_ES_PERF_STARTCMD_EID, CFE_EVS_EventType_DEBUG,
                     "Start collecting performance data cmd received, trigger mode = %d",
@@ -154,7 +262,7 @@ int32 CFE_ES_StartPerfDataCmd(const CFE_ES_StartPerfData_t *data)
             CFE_ES_TaskData.CommandErrorCounter++;
             CFE_EVS_SendEvent(CFE_ES_PERF_STARTCMD_TRIG_ERR_EID, CFE_EVS_EventType_ERROR,
                     "Cannot start collecting performance data, trigger mode (%d) out of range (%d to %d)",
-                    (int)CmdPtr->TriggerMode, (int)CFE_ES_PERF_TRIGGER_START, (int)CFE_ES_PERF_TRIGGER_END);
+                    (int)CmdPtr->TriggerMode, (int)CFE_ES_PERF_TRIGGER_START, (int)CFE_ES_PERF_STREAM);
         }/* end if */
     }
     else
@@ -178,8 +286,19 @@ int32 CFE_ES_StopPerfDataCmd(const CFE_ES_StopPerfData_t *data)
     const CFE_ES_StopPerfCmd_Payload_t *CmdPtr = &data->Payload;
     int32 Stat;
 
+    if(CFE_ES_PerfStreamStatus.Active && !CFE_ES_PerfStreamStatus.StopRequest)
+    {
+        /* The streaming task writes what is left and closes its file */
+        Perf->MetaData.State = CFE_ES_PERF_IDLE;
+        CFE_ES_PerfStreamStatus.StopRequest = true;
+
+        CFE_ES_TaskData.CommandCounter++;
+        CFE_EVS_SendEvent(CFE_ES_PERF_STOPCMD_EID,CFE_EVS_EventType_DEBUG,
+                "Perf Stop Cmd Rcvd,%s will finish %s",
+                CFE_ES_PERF_STREAM_CHILD_NAME,CFE_ES_PerfStreamStatus.FileName);
+    }
     /* Ensure there is no file write in progress before proceeding */
-    if(CFE_ES_PerfLogDumpStatus.DataToWrite == 0)
+    else if(CFE_ES_PerfLogDumpStatus.DataToWrite == 0 && !CFE_ES_PerfStreamStatus.Active)
     {
         Perf->MetaData.State = CFE_ES_PERF_IDLE;
 
@@ -280,6 +399,9 @@ void CFE_ES_PerfLogDump(void){
     }/* end if */
     FileSize = WriteStat;
 
+    /* collection has stopped, so the buffer can be put in time order */
+    CFE_ES_PerfSortEntries();
+
     /* write the performance metadata to the file */
     WriteStat = OS_write(CFE_ES_PerfLogDumpStatus.DataFileDescriptor,&Perf->MetaData,sizeof(CFE_ES_PerfMetaData_t));
     if(WriteStat != sizeof(CFE_ES_PerfMetaData_t))
@@ -414,7 +536,15 @@ int32 CFE_ES_SetPerfTriggerMaskCmd(const CFE_ES_SetPerfTriggerMask_t *data)
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 void CFE_ES_PerfLogAdd(uint32 Marker, uint32 EntryExit)
 {
-    int32         IntFlags;
+    uint32        DataEnd;
+    uint32        TriggerCount;
+
+#if CFE_PLATFORM_ES_PERF_STATS_RATE > 0
+    /* statistics are kept whether or not the log is collecting */
+    if (Marker < CFE_MISSION_ES_PERF_MAX_IDS) {
+        CFE_ES_PerfUpdateStats(Marker, EntryExit);
+    }
+#endif
 
     if (Perf->MetaData.State != CFE_ES_PERF_IDLE) {
 
@@ -436,27 +566,16 @@ void CFE_ES_PerfLogAdd(uint32 Marker, uint32 EntryExit)
         /* is this id filtered */
         if (CFE_ES_TEST_LONG_MASK(Perf->MetaData.FilterMask, Marker)) {
 
-           /* disable interrupts to guarentee exclusive access to the data structures */
-            IntFlags = OS_IntLock();
-
-            Perf->DataBuffer[Perf->MetaData.DataEnd].Data = (Marker | (EntryExit << CFE_MISSION_ES_PERF_EXIT_BIT));
-            CFE_PSP_Get_Timebase((uint32*)&Perf->DataBuffer[Perf->MetaData.DataEnd].TimerUpper32,(uint32*)&Perf->DataBuffer[Perf->MetaData.DataEnd].TimerLower32);
-
-            Perf->MetaData.DataEnd++;
-            if (Perf->MetaData.DataEnd >= CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE) {
-                Perf->MetaData.DataEnd = 0;
+            if (Perf->MetaData.Mode == CFE_ES_PERF_STREAM) {
+                CFE_ES_PerfStreamAdd(Marker | (EntryExit << CFE_MISSION_ES_PERF_EXIT_BIT));
+                return;
             }
 
-            /* we have filled up the buffer */
-            Perf->MetaData.DataCount++;
-            if (Perf->MetaData.DataCount > CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE) {
-
-                Perf->MetaData.DataCount = CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE;
+            /* claim a slot of our own, then fill it in */
+            DataEnd = CFE_ES_PerfReserveEntry();
 
-                /* after the buffer fills up start and end point to the same entry since we
-                   are now overwriting old data */
-                Perf->MetaData.DataStart = Perf->MetaData.DataEnd;
-            }
+            Perf->DataBuffer[DataEnd].Data = (Marker | (EntryExit << CFE_MISSION_ES_PERF_EXIT_BIT));
+            CFE_PSP_Get_Timebase((uint32*)&Perf->DataBuffer[DataEnd].TimerUpper32,(uint32*)&Perf->DataBuffer[DataEnd].TimerLower32);
 
             /* waiting for trigger */
             if (Perf->MetaData.State == CFE_ES_PERF_WAITING_FOR_TRIGGER) {
@@ -468,16 +587,16 @@ void CFE_ES_PerfLogAdd(uint32 Marker, uint32 EntryExit)
             /* triggered */
             if (Perf->MetaData.State == CFE_ES_PERF_TRIGGERED) {
 
-                Perf->MetaData.TriggerCount++;
+                TriggerCount = CFE_ES_PerfCountTrigger();
                 if (Perf->MetaData.Mode == CFE_ES_PERF_TRIGGER_START) {
 
-                    if (Perf->MetaData.TriggerCount >= CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE) {
+                    if (TriggerCount >= CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE) {
                         Perf->MetaData.State = CFE_ES_PERF_IDLE;
                     }
                 }
                 else if (Perf->MetaData.Mode == CFE_ES_PERF_TRIGGER_CENTER) {
 
-                    if (Perf->MetaData.TriggerCount >= CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE / 2) {
+                    if (TriggerCount >= CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE / 2) {
                         Perf->MetaData.State = CFE_ES_PERF_IDLE;
                     }
                 }
@@ -486,11 +605,827 @@ void CFE_ES_PerfLogAdd(uint32 Marker, uint32 EntryExit)
                     Perf->MetaData.State = CFE_ES_PERF_IDLE;
                 }
             }
-
-            /* enable interrupts */
-            OS_IntUnlock(IntFlags);
         }
     }
 }/* end CFE_ES_PerfLogAdd */
 
 
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/* Name: CFE_ES_PerfReserveEntry                                                 */
+/*                                                                               */
+/* Purpose: Reserve the next data buffer entry for the calling task and advance  */
+/*          DataEnd/DataCount.  Returns the index of the reserved entry.         */
+/*                                                                               */
+/* Assumptions and Notes:                                                        */
+/*                                                                               */
+/*  On Linux OS_IntLock() is not implemented, so several tasks updating          */
+/*  DataEnd/DataCount at once could lose or corrupt entries.  The lock free      */
+/*  version claims the slot by advancing DataEnd with compare and swap, so each  */
+/*  task writes a different entry.  DataStart is kept equal to DataEnd once the  */
+/*  buffer is full; concurrent loggers may leave it behind by an entry, which    */
+/*  CFE_ES_PerfSortEntries corrects before the data is written out.              */
+/*                                                                               */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+static uint32 CFE_ES_PerfReserveEntry(void)
+{
+    uint32        DataEnd;
+    uint32        NextEnd;
+#ifdef CFE_ES_PERF_LOCKFREE
+    uint32        DataCount;
+
+    do {
+        DataEnd = Perf->MetaData.DataEnd;
+        NextEnd = DataEnd + 1;
+        if (NextEnd >= CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE) {
+            NextEnd = 0;
+        }
+    } while (!__sync_bool_compare_and_swap(&Perf->MetaData.DataEnd, DataEnd, NextEnd));
+
+    do {
+        DataCount = Perf->MetaData.DataCount;
+        if (DataCount >= CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE) {
+
+            /* after the buffer fills up start and end point to the same entry since we
+               are now overwriting old data */
+            Perf->MetaData.DataStart = NextEnd;
+            break;
+        }
+    } while (!__sync_bool_compare_and_swap(&Perf->MetaData.DataCount, DataCount, DataCount + 1));
+#else
+    int32         IntFlags;
+
+    /* disable interrupts to guarentee exclusive access to the data structures */
+    IntFlags = OS_IntLock();
+
+    DataEnd = Perf->MetaData.DataEnd;
+    NextEnd = DataEnd + 1;
+    if (NextEnd >= CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE) {
+        NextEnd = 0;
+    }
+    Perf->MetaData.DataEnd = NextEnd;
+
+    /* we have filled up the buffer */
+    Perf->MetaData.DataCount++;
+    if (Perf->MetaData.DataCount > CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE) {
+
+        Perf->MetaData.DataCount = CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE;
+
+        /* after the buffer fills up start and end point to the same entry since we
+           are now overwriting old data */
+        Perf->MetaData.DataStart = NextEnd;
+    }
+
+    /* enable interrupts */
+    OS_IntUnlock(IntFlags);
+#endif
+
+    return DataEnd;
+
+}/* end CFE_ES_PerfReserveEntry */
+
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/* Name: CFE_ES_PerfCountTrigger                                                 */
+/*                                                                               */
+/* Purpose: Count an entry logged after the trigger and return the new count.    */
+/*                                                                               */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+static uint32 CFE_ES_PerfCountTrigger(void)
+{
+    uint32        TriggerCount;
+#ifdef CFE_ES_PERF_LOCKFREE
+
+    TriggerCount = __sync_add_and_fetch(&Perf->MetaData.TriggerCount, 1);
+#else
+    int32         IntFlags;
+
+    IntFlags = OS_IntLock();
+    TriggerCount = ++Perf->MetaData.TriggerCount;
+    OS_IntUnlock(IntFlags);
+#endif
+
+    return TriggerCount;
+
+}/* end CFE_ES_PerfCountTrigger */
+
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/* Name: CFE_ES_PerfSortEntries                                                  */
+/*                                                                               */
+/* Purpose: Put the logged entries back in time order once collection stopped.   */
+/*                                                                               */
+/* Assumptions and Notes:                                                        */
+/*                                                                               */
+/*  Entries are nearly sorted already: only a task preempted between reserving   */
+/*  a slot and reading the timebase stores an older time than its neighbour.     */
+/*  An insertion sort limited to CFE_ES_PERF_REORDER_WINDOW places fixes that    */
+/*  in a single pass.  The entries keep their place in the circular buffer, so   */
+/*  the file layout and the DataStart/DataEnd/DataCount meaning are unchanged.   */
+/*                                                                               */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void CFE_ES_PerfSortEntries(void)
+{
+    CFE_ES_PerfDataEntry_t  Entry;
+    uint32                  DataStart;
+    uint32                  i;
+    uint32                  Moved;
+    uint32                  Pos;
+    uint32                  Prev;
+
+    if (Perf->MetaData.DataCount >= CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE) {
+        Perf->MetaData.DataStart = Perf->MetaData.DataEnd;
+    }
+
+    DataStart = Perf->MetaData.DataStart;
+
+    for (i = 1; i < Perf->MetaData.DataCount; i++) {
+
+        Pos = (DataStart + i) % CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE;
+        Entry = Perf->DataBuffer[Pos];
+
+        for (Moved = 0; Moved < i && Moved < CFE_ES_PERF_REORDER_WINDOW; Moved++) {
+
+            Prev = (Pos == 0) ? (CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE - 1) : (Pos - 1);
+            if (!CFE_ES_PerfEntryIsLater(&Perf->DataBuffer[Prev], &Entry)) {
+                break;
+            }
+
+            Perf->DataBuffer[Pos] = Perf->DataBuffer[Prev];
+            Pos = Prev;
+        }
+
+        Perf->DataBuffer[Pos] = Entry;
+    }
+
+}/* end CFE_ES_PerfSortEntries */
+
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/* Name: CFE_ES_PerfEntryIsLater                                                 */
+/*                                                                               */
+/* Purpose: Compare the timebase values of two entries.                          */
+/*                                                                               */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+static bool CFE_ES_PerfEntryIsLater(const CFE_ES_PerfDataEntry_t *Entry1,
+                                    const CFE_ES_PerfDataEntry_t *Entry2)
+{
+    if (Entry1->TimerUpper32 != Entry2->TimerUpper32) {
+        return (Entry1->TimerUpper32 > Entry2->TimerUpper32);
+    }
+
+    return (Entry1->TimerLower32 > Entry2->TimerLower32);
+
+}/* end CFE_ES_PerfEntryIsLater */
+
+
+
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/* Name: CFE_ES_PerfStreamAdd                                                    */
+/*                                                                               */
+/* Purpose: Store an entry for the streaming task.                               */
+/*                                                                               */
+/* Assumptions and Notes:                                                        */
+/*                                                                               */
+/*  While streaming, TriggerCount numbers every entry logged and the entry goes  */
+/*  in slot (number % buffer size).  The slot's sequence word is set to the      */
+/*  entry number only after the entry is complete, so the streaming task can     */
+/*  tell a finished entry from one still being written or already overwritten   */
+/*  by a task that has gone a whole buffer ahead of it.                          */
+/*                                                                               */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+static void CFE_ES_PerfStreamAdd(uint32 Data)
+{
+    uint32        Seq;
+    uint32        Index;
+
+    Seq = CFE_ES_PerfCountTrigger() - 1;
+    Index = Seq % CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE;
+
+    CFE_ES_PerfStreamSeq[Index] = Seq - 1;
+    CFE_ES_PERF_SYNC();
+
+    Perf->DataBuffer[Index].Data = Data;
+    CFE_PSP_Get_Timebase((uint32*)&Perf->DataBuffer[Index].TimerUpper32,(uint32*)&Perf->DataBuffer[Index].TimerLower32);
+
+    CFE_ES_PERF_SYNC();
+    CFE_ES_PerfStreamSeq[Index] = Seq;
+
+}/* end CFE_ES_PerfStreamAdd */
+
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*  Function:  CFE_ES_PerfStreamTask()                                           */
+/*                                                                               */
+/*  Purpose:                                                                     */
+/*    Child task that drains the performance data buffer into the stream files   */
+/*    until a stop command is received                                           */
+/*                                                                               */
+/*  Arguments:                                                                   */
+/*    None                                                                       */
+/*                                                                               */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void CFE_ES_PerfStreamTask(void)
+{
+    CFE_ES_PerfStream_t *Stream = &CFE_ES_PerfStreamStatus;
+    bool                 StopRequest;
+    int32                Status;
+
+    CFE_ES_RegisterChildTask();
+
+    Status = CFE_ES_PerfStreamOpen();
+
+    while (Status == CFE_SUCCESS)
+    {
+        /* read the request first so entries logged up to the stop are drained */
+        StopRequest = Stream->StopRequest;
+
+        Status = CFE_ES_PerfStreamDrain();
+        if (Status == CFE_SUCCESS)
+        {
+            Status = CFE_ES_PerfStreamFlush();
+        }
+
+        if (StopRequest)
+        {
+            break;
+        }
+
+        OS_TaskDelay(CFE_PLATFORM_ES_PERF_STREAM_MS_DELAY);
+    }
+
+    /* anything not drained by now was never completely logged */
+    Stream->EntriesLost += Perf->MetaData.TriggerCount - Stream->Consumed;
+    Stream->PendingLost += Perf->MetaData.TriggerCount - Stream->Consumed;
+    Stream->Consumed = Perf->MetaData.TriggerCount;
+
+    if (Status == CFE_SUCCESS && Stream->PendingLost != 0)
+    {
+        Status = CFE_ES_PerfStreamPutLost();
+        if (Status == CFE_SUCCESS)
+        {
+            Status = CFE_ES_PerfStreamFlush();
+        }
+    }
+
+    if (Status != CFE_SUCCESS)
+    {
+        Perf->MetaData.State = CFE_ES_PERF_IDLE;
+    }
+
+    if (Stream->FileDescriptor >= 0)
+    {
+        OS_close(Stream->FileDescriptor);
+        Stream->FileDescriptor = -1;
+    }
+
+    CFE_EVS_SendEvent(CFE_ES_PERF_STREAM_DONE_EID,CFE_EVS_EventType_DEBUG,
+                      "Perf stream ended:Entries=%u,Lost=%u,Files=%u,Last=%s",
+                      (unsigned int)Stream->EntriesWritten,(unsigned int)Stream->EntriesLost,
+                      (unsigned int)Stream->FilesWritten,Stream->FileName);
+
+    Stream->Active = false;
+
+    CFE_ES_ExitChildTask();
+
+}/* end CFE_ES_PerfStreamTask */
+
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/* Name: CFE_ES_PerfStreamDrain                                                  */
+/*                                                                               */
+/* Purpose: Encode the entries logged since the last call into the stream.       */
+/*                                                                               */
+/* Assumptions and Notes:                                                        */
+/*                                                                               */
+/*  Entries are copied in the order they were numbered and the copy is checked   */
+/*  against the slot's sequence word, so an entry overwritten while it was being */
+/*  copied is never written out.  When the logging tasks get a whole buffer      */
+/*  ahead, the oldest entries are dropped to leave half a buffer of slack and a  */
+/*  lost entry record is written in their place.                                */
+/*                                                                               */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+int32 CFE_ES_PerfStreamDrain(void)
+{
+    CFE_ES_PerfStream_t    *Stream = &CFE_ES_PerfStreamStatus;
+    CFE_ES_PerfDataEntry_t  Entry;
+    uint32                  Produced;
+    uint32                  Index;
+    uint32                  Seq;
+    uint32                  Skip;
+    int32                   Status = CFE_SUCCESS;
+
+    Produced = Perf->MetaData.TriggerCount;
+
+    while (Stream->Consumed != Produced && Status == CFE_SUCCESS)
+    {
+        Index = Stream->Consumed % CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE;
+        Seq = CFE_ES_PerfStreamSeq[Index];
+
+        if (Seq == Stream->Consumed)
+        {
+            CFE_ES_PERF_SYNC();
+            Entry = Perf->DataBuffer[Index];
+            CFE_ES_PERF_SYNC();
+
+            Seq = CFE_ES_PerfStreamSeq[Index];
+            if (Seq == Stream->Consumed)
+            {
+                if (Stream->PendingLost != 0)
+                {
+                    Status = CFE_ES_PerfStreamPutLost();
+                }
+                if (Status == CFE_SUCCESS)
+                {
+                    Status = CFE_ES_PerfStreamPutEntry(&Entry);
+                }
+
+                Stream->EntriesWritten++;
+                Stream->Consumed++;
+                continue;
+            }
+        }
+
+        Produced = Perf->MetaData.TriggerCount;
+
+        if ((int32)(Seq - Stream->Consumed) < 0 &&
+            (Produced - Stream->Consumed) < CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE)
+        {
+            /* the task logging this entry has not finished, try again later */
+            break;
+        }
+
+        /* the entry was overwritten before it could be copied */
+        Skip = Produced - Stream->Consumed;
+        if (Skip > CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE / 2)
+        {
+            Skip -= CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE / 2;
+        }
+        else
+        {
+            Skip = 1;
+        }
+
+        Stream->Consumed += Skip;
+        Stream->PendingLost += Skip;
+        Stream->EntriesLost += Skip;
+    }
+
+    /* report the backlog through the housekeeping telemetry */
+    Perf->MetaData.DataStart = Stream->Consumed % CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE;
+    Perf->MetaData.DataEnd = Produced % CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE;
+    Perf->MetaData.DataCount = Produced - Stream->Consumed;
+
+    return Status;
+
+}/* end CFE_ES_PerfStreamDrain */
+
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/* Name: CFE_ES_PerfStreamOpen                                                   */
+/*                                                                               */
+/* Purpose: Create the next stream file and write its headers.                   */
+/*                                                                               */
+/* Assumptions and Notes:                                                        */
+/*                                                                               */
+/*  Each file starts with the standard cFE file header and the performance       */
+/*  metadata, and the first record holds an absolute time, so every file can be  */
+/*  decoded on its own after older files in the rotation are overwritten.        */
+/*                                                                               */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+static int32 CFE_ES_PerfStreamOpen(void)
+{
+    CFE_ES_PerfStream_t *Stream = &CFE_ES_PerfStreamStatus;
+    CFE_FS_Header_t      FileHdr;
+    int32                WriteStat;
+
+    snprintf(Stream->FileName, sizeof(Stream->FileName), "%s_%02u.dat",
+             CFE_PLATFORM_ES_DEFAULT_PERF_STREAM_FILENAME, (unsigned int)Stream->FileNum);
+
+    Stream->FileDescriptor = OS_creat(Stream->FileName, OS_WRITE_ONLY);
+    if (Stream->FileDescriptor < 0)
+    {
+        CFE_EVS_SendEvent(CFE_ES_PERF_STREAM_FILE_ERR_EID,CFE_EVS_EventType_ERROR,
+                          "Error creating perf stream file %s, RC = 0x%08X",
+                          Stream->FileName, (unsigned int)Stream->FileDescriptor);
+        WriteStat = Stream->FileDescriptor;
+        Stream->FileDescriptor = -1;
+        return WriteStat;
+    }
+
+    Stream->FilesWritten++;
+
+    /* Zero cFE header, then fill in fields */
+    CFE_FS_InitHeader(&FileHdr, CFE_ES_PERF_STREAM_DESC, CFE_FS_SubType_ES_PERFSTREAM);
+
+    WriteStat = CFE_FS_WriteHeader(Stream->FileDescriptor, &FileHdr);
+    if (WriteStat != sizeof(CFE_FS_Header_t))
+    {
+        CFE_ES_FileWriteByteCntErr(Stream->FileName, sizeof(CFE_FS_Header_t), WriteStat);
+        return CFE_ES_FILE_IO_ERR;
+    }
+    Stream->FileSize = WriteStat;
+
+    WriteStat = OS_write(Stream->FileDescriptor, &Perf->MetaData, sizeof(CFE_ES_PerfMetaData_t));
+    if (WriteStat != sizeof(CFE_ES_PerfMetaData_t))
+    {
+        CFE_ES_FileWriteByteCntErr(Stream->FileName, sizeof(CFE_ES_PerfMetaData_t), WriteStat);
+        return CFE_ES_FILE_IO_ERR;
+    }
+    Stream->FileSize += WriteStat;
+
+    Stream->PrevUpper32 = 0;
+    Stream->PrevLower32 = 0;
+
+    return CFE_SUCCESS;
+
+}/* end CFE_ES_PerfStreamOpen */
+
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/* Name: CFE_ES_PerfStreamFlush                                                  */
+/*                                                                               */
+/* Purpose: Write the encoded records to the current stream file, moving on to   */
+/*          the next file of the rotation once this one is full.                 */
+/*                                                                               */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+static int32 CFE_ES_PerfStreamFlush(void)
+{
+    CFE_ES_PerfStream_t *Stream = &CFE_ES_PerfStreamStatus;
+    int32                WriteStat;
+
+    if (Stream->BlockFill == 0)
+    {
+        return CFE_SUCCESS;
+    }
+
+    WriteStat = OS_write(Stream->FileDescriptor, Stream->Block, Stream->BlockFill);
+    if (WriteStat != Stream->BlockFill)
+    {
+        CFE_ES_FileWriteByteCntErr(Stream->FileName, Stream->BlockFill, WriteStat);
+        Stream->BlockFill = 0;
+        return CFE_ES_FILE_IO_ERR;
+    }
+
+    Stream->FileSize += WriteStat;
+    Stream->BlockFill = 0;
+
+    if (Stream->FileSize >= CFE_PLATFORM_ES_PERF_STREAM_FILE_SIZE)
+    {
+        OS_close(Stream->FileDescriptor);
+        Stream->FileDescriptor = -1;
+
+        Stream->FileNum = (Stream->FileNum + 1) % CFE_PLATFORM_ES_PERF_STREAM_NUM_FILES;
+        return CFE_ES_PerfStreamOpen();
+    }
+
+    return CFE_SUCCESS;
+
+}/* end CFE_ES_PerfStreamFlush */
+
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/* Name: CFE_ES_PerfStreamPutEntry                                               */
+/*                                                                               */
+/* Purpose: Encode one entry into the block buffer.                              */
+/*                                                                               */
+/* Assumptions and Notes:                                                        */
+/*                                                                               */
+/*  A record is the marker shifted left once with the exit flag in bit 0,        */
+/*  followed by the signed time since the previous record in timer ticks, both   */
+/*  as variable length integers (7 bits a byte, low order first) and the time    */
+/*  zigzag encoded.  A typical record takes 3 to 5 bytes in place of the 12 byte */
+/*  entry.                                                                       */
+/*                                                                               */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+static int32 CFE_ES_PerfStreamPutEntry(const CFE_ES_PerfDataEntry_t *Entry)
+{
+    CFE_ES_PerfStream_t *Stream = &CFE_ES_PerfStreamStatus;
+    int64                Rollover;
+    int64                Delta;
+    int32                Status = CFE_SUCCESS;
+
+    /* flush first: a new file restarts the time deltas */
+    if (Stream->BlockFill > CFE_ES_PERF_STREAM_BLOCK_SIZE - CFE_ES_PERF_STREAM_MAX_RECORD)
+    {
+        Status = CFE_ES_PerfStreamFlush();
+    }
+
+    /* a rollover of zero means the lower word uses the full 32 bits */
+    Rollover = Perf->MetaData.TimerLow32Rollover;
+    if (Rollover == 0)
+    {
+        Rollover = (int64)1 << 32;
+    }
+
+    Delta = ((int64)Entry->TimerUpper32 - (int64)Stream->PrevUpper32) * Rollover +
+            ((int64)Entry->TimerLower32 - (int64)Stream->PrevLower32);
+
+    Stream->PrevUpper32 = Entry->TimerUpper32;
+    Stream->PrevLower32 = Entry->TimerLower32;
+
+    Stream->BlockFill += CFE_ES_PerfStreamPutVarint(&Stream->Block[Stream->BlockFill],
+                                                    (Entry->Data << 1) | (Entry->Data >> CFE_MISSION_ES_PERF_EXIT_BIT));
+    Stream->BlockFill += CFE_ES_PerfStreamPutVarint(&Stream->Block[Stream->BlockFill],
+                                                    ((uint64)Delta << 1) ^ (uint64)(Delta >> 63));
+
+    return Status;
+
+}/* end CFE_ES_PerfStreamPutEntry */
+
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/* Name: CFE_ES_PerfStreamPutLost                                                */
+/*                                                                               */
+/* Purpose: Encode a record of the entries dropped since the last record.        */
+/*                                                                               */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+static int32 CFE_ES_PerfStreamPutLost(void)
+{
+    CFE_ES_PerfStream_t *Stream = &CFE_ES_PerfStreamStatus;
+    int32                Status = CFE_SUCCESS;
+
+    if (Stream->BlockFill > CFE_ES_PERF_STREAM_BLOCK_SIZE - CFE_ES_PERF_STREAM_MAX_RECORD)
+    {
+        Status = CFE_ES_PerfStreamFlush();
+    }
+
+    Stream->BlockFill += CFE_ES_PerfStreamPutVarint(&Stream->Block[Stream->BlockFill], CFE_ES_PERF_STREAM_LOST_CODE);
+    Stream->BlockFill += CFE_ES_PerfStreamPutVarint(&Stream->Block[Stream->BlockFill], Stream->PendingLost);
+    Stream->PendingLost = 0;
+
+    return Status;
+
+}/* end CFE_ES_PerfStreamPutLost */
+
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/* Name: CFE_ES_PerfStreamPutVarint                                              */
+/*                                                                               */
+/* Purpose: Store a variable length integer and return the number of bytes used. */
+/*                                                                               */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+static uint32 CFE_ES_PerfStreamPutVarint(uint8 *Buffer, uint64 Value)
+{
+    uint32        Length = 0;
+
+    while (Value >= 0x80)
+    {
+        Buffer[Length++] = (uint8)(Value | 0x80);
+        Value >>= 7;
+    }
+    Buffer[Length++] = (uint8)Value;
+
+    return Length;
+
+}/* end CFE_ES_PerfStreamPutVarint */
+
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/* Name: CFE_ES_PerfUpdateStats                                                  */
+/*                                                                               */
+/* Purpose: Account the time since the previous marker of the same perf id.      */
+/*                                                                               */
+/* Assumptions and Notes:                                                        */
+/*                                                                               */
+/*  An exit after an entry adds to the busy time and the latency histogram, an   */
+/*  entry after an exit adds to the wait time (apps typically log the exit       */
+/*  before pending on their pipe).  A perf id is expected to be logged by one    */
+/*  task; if several tasks share an id the statistics are only approximate.      */
+/*                                                                               */
+/*  A marker that finds the record locked, because ES is copying it out or       */
+/*  another task shares the id, is not counted.  Its interval then ends up in    */
+/*  neither the busy nor the wait time, which keeps the record consistent, and   */
+/*  the marker is counted in CFE_ES_PerfStatsDropped instead.                    */
+/*                                                                               */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+static void CFE_ES_PerfUpdateStats(uint32 Marker, uint32 EntryExit)
+{
+    CFE_ES_PerfStatsRecord_t *Record = &CFE_ES_PerfStats[Marker];
+    uint32                    Upper32;
+    uint32                    Lower32;
+    uint32                    TicksPerSecond;
+    uint64                    Rollover;
+    uint64                    Ticks;
+    uint32                    Usec = 0;
+#ifndef CFE_ES_PERF_LOCKFREE
+    int32                     IntFlags;
+#endif
+
+    if (!CFE_ES_PerfStatsLock(Record)) {
+#ifdef CFE_ES_PERF_LOCKFREE
+        __sync_add_and_fetch(&CFE_ES_PerfStatsDropped, 1);
+#else
+        IntFlags = OS_IntLock();
+        CFE_ES_PerfStatsDropped++;
+        OS_IntUnlock(IntFlags);
+#endif
+        return;
+    }
+
+    CFE_PSP_Get_Timebase(&Upper32, &Lower32);
+
+    if (Record->LastMarker != CFE_ES_PERF_LAST_NONE) {
+
+        /* a rollover of zero means the lower word uses the full 32 bits */
+        Rollover = Perf->MetaData.TimerLow32Rollover;
+        if (Rollover == 0) {
+            Rollover = (uint64)1 << 32;
+        }
+
+        Ticks = (uint64)(Upper32 - Record->LastUpper32) * Rollover + Lower32 - Record->LastLower32;
+
+        /* whole seconds first so a long interval cannot overflow the multiply */
+        TicksPerSecond = Perf->MetaData.TimerTicksPerSecond;
+        if (TicksPerSecond != 0) {
+            Ticks = (Ticks / TicksPerSecond) * 1000000 +
+                    (Ticks % TicksPerSecond) * 1000000 / TicksPerSecond;
+        }
+        Usec = (Ticks > 0xFFFFFFFF) ? 0xFFFFFFFF : (uint32)Ticks;
+    }
+
+    if (EntryExit == 0) {
+
+        if (Record->LastMarker == CFE_ES_PERF_LAST_EXIT) {
+            Record->Stats.WaitUsec += Usec;
+        }
+        Record->LastMarker = CFE_ES_PERF_LAST_ENTRY;
+    }
+    else {
+
+        if (Record->LastMarker == CFE_ES_PERF_LAST_ENTRY) {
+            if (Record->Stats.Count == 0 || Usec < Record->Stats.MinUsec) {
+                Record->Stats.MinUsec = Usec;
+            }
+            if (Usec > Record->Stats.MaxUsec) {
+                Record->Stats.MaxUsec = Usec;
+            }
+            Record->Stats.TotalUsec += Usec;
+            Record->Stats.Histogram[CFE_ES_PerfStatsBucket(Usec)]++;
+            Record->Stats.Count++;
+        }
+        Record->LastMarker = CFE_ES_PERF_LAST_EXIT;
+    }
+
+    Record->LastUpper32 = Upper32;
+    Record->LastLower32 = Lower32;
+
+    CFE_ES_PerfStatsUnlock(Record);
+
+}/* end CFE_ES_PerfUpdateStats */
+
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/* Name: CFE_ES_PerfStatsLock                                                    */
+/*                                                                               */
+/* Purpose: Take the record of a perf id for updating or copying.  Returns false */
+/*          without waiting if somebody else holds it.                           */
+/*                                                                               */
+/* Assumptions and Notes:                                                        */
+/*                                                                               */
+/*  Loggers run at any priority, so spinning on the record could starve the      */
+/*  lower priority task holding it.  The holder makes Seq odd and the next even  */
+/*  value releases it.                                                           */
+/*                                                                               */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+static bool CFE_ES_PerfStatsLock(CFE_ES_PerfStatsRecord_t *Record)
+{
+    uint32        Seq;
+#ifdef CFE_ES_PERF_LOCKFREE
+
+    Seq = Record->Seq;
+    return ((Seq & 1) == 0 && __sync_bool_compare_and_swap(&Record->Seq, Seq, Seq + 1));
+#else
+    int32         IntFlags;
+    bool          Locked;
+
+    IntFlags = OS_IntLock();
+    Seq = Record->Seq;
+    Locked = ((Seq & 1) == 0);
+    if (Locked) {
+        Record->Seq = Seq + 1;
+    }
+    OS_IntUnlock(IntFlags);
+
+    return Locked;
+#endif
+
+}/* end CFE_ES_PerfStatsLock */
+
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/* Name: CFE_ES_PerfStatsUnlock                                                  */
+/*                                                                               */
+/* Purpose: Release a record taken with CFE_ES_PerfStatsLock.                    */
+/*                                                                               */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+static void CFE_ES_PerfStatsUnlock(CFE_ES_PerfStatsRecord_t *Record)
+{
+    /* the record must be complete before it is seen unlocked */
+    CFE_ES_PERF_SYNC();
+    Record->Seq++;
+
+}/* end CFE_ES_PerfStatsUnlock */
+
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/* Name: CFE_ES_PerfStatsBucket                                                  */
+/*                                                                               */
+/* Purpose: Return the histogram bucket of a duration, see                       */
+/*          CFE_ES_PERF_STATS_BUCKETS.                                           */
+/*                                                                               */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+static uint32 CFE_ES_PerfStatsBucket(uint32 Usec)
+{
+    uint32        Exponent;
+    uint32        Bucket;
+
+    if (Usec < 2) {
+        return Usec;
+    }
+
+    /* position of the highest bit set */
+#if defined(__GNUC__)
+    Exponent = 31 - __builtin_clz(Usec);
+#else
+    Exponent = 0;
+    while ((Usec >> (Exponent + 1)) != 0) {
+        Exponent++;
+    }
+#endif
+
+    Bucket = (2 * Exponent) + ((Usec >> (Exponent - 1)) & 1);
+    if (Bucket >= CFE_ES_PERF_STATS_BUCKETS) {
+        Bucket = CFE_ES_PERF_STATS_BUCKETS - 1;
+    }
+
+    return Bucket;
+
+}/* end CFE_ES_PerfStatsBucket */
+
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/* Name: CFE_ES_PerfSendStats                                                    */
+/*                                                                               */
+/* Purpose: Send the performance statistics telemetry packet.                    */
+/*                                                                               */
+/* Assumptions and Notes:                                                        */
+/*                                                                               */
+/*  The packet holds the next CFE_MISSION_ES_PERF_STATS_PER_PKT perf ids with    */
+/*  activity, continuing where the previous packet stopped.  Statistics are      */
+/*  cleared once reported, so each report covers the time since the id was      */
+/*  last reported.  The entry/exit state is kept so an interval in progress is   */
+/*  counted in the next report.  An id being updated by its task is skipped and  */
+/*  reported in a later packet.                                                  */
+/*                                                                               */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void CFE_ES_PerfSendStats(void)
+{
+    CFE_ES_PerfStatsTlm_Payload_t *Payload = &CFE_ES_TaskData.PerfStatsPacket.Payload;
+    CFE_ES_PerfStatsRecord_t      *Record;
+    uint32                         Checked;
+    uint32                         Id;
+#ifndef CFE_ES_PERF_LOCKFREE
+    int32                          IntFlags;
+#endif
+
+    memset(Payload, 0, sizeof(*Payload));
+
+    /* take the markers dropped since the previous packet */
+#ifdef CFE_ES_PERF_LOCKFREE
+    Payload->DroppedMarkers = __sync_fetch_and_and(&CFE_ES_PerfStatsDropped, 0);
+#else
+    IntFlags = OS_IntLock();
+    Payload->DroppedMarkers = CFE_ES_PerfStatsDropped;
+    CFE_ES_PerfStatsDropped = 0;
+    OS_IntUnlock(IntFlags);
+#endif
+
+    Id = CFE_ES_PerfStatsNextId;
+    for (Checked = 0; Checked < CFE_MISSION_ES_PERF_MAX_IDS &&
+                      Payload->NumIds < CFE_MISSION_ES_PERF_STATS_PER_PKT; Checked++) {
+
+        Record = &CFE_ES_PerfStats[Id];
+        if ((Record->Stats.Count != 0 || Record->Stats.WaitUsec != 0) &&
+            CFE_ES_PerfStatsLock(Record)) {
+
+            Payload->PerfIds[Payload->NumIds] = Record->Stats;
+            Payload->PerfIds[Payload->NumIds].PerfId = Id;
+            Payload->NumIds++;
+
+            memset(&Record->Stats, 0, sizeof(Record->Stats));
+
+            CFE_ES_PerfStatsUnlock(Record);
+        }
+
+        Id++;
+        if (Id >= CFE_MISSION_ES_PERF_MAX_IDS) {
+            Id = 0;
+        }
+    }
+    CFE_ES_PerfStatsNextId = Id;
+
+    CFE_SB_TimeStampMsg((CFE_SB_Msg_t *) &CFE_ES_TaskData.PerfStatsPacket);
+    CFE_SB_SendMsg((CFE_SB_Msg_t *) &CFE_ES_TaskData.PerfStatsPacket);
+
+}/* end CFE_ES_PerfSendStats */
@@ -52,6 +52,41 @@
 #define CFE_ES_PERF_CHILD_NAME           "ES_PerfFileWriter"
 #define CFE_ES_PERF_CHILD_STACK_PTR      0
 #define CFE_ES_PERF_CHILD_FLAGS          0
+#define CFE_ES_PERF_STREAM_CHILD_NAME    "ES_PerfStreamer"
+
+/*
+** Stream files are written in blocks holding whole records, so a file
+** rotation never splits a record.  A record is at most 15 bytes.
+*/
+#define CFE_ES_PERF_STREAM_BLOCK_SIZE    512
+#define CFE_ES_PERF_STREAM_MAX_RECORD    15
+
+/*
+** Record code that marks a count of entries lost to a buffer overrun.  It
+** decodes as the exit of marker 0x7FFFFFFF, which can never be logged.
+** Other codes are the marker shifted left once with the exit flag in bit 0.
+*/
+#define CFE_ES_PERF_STREAM_LOST_CODE     0xFFFFFFFF
+
+/*
+** Entries are stamped after their buffer slot is reserved, so a task that
+** is preempted in between can store a time slightly older than the entry
+** before it.  The dump moves an entry back by at most this many places to
+** restore time order; a timebase that really steps backwards is left alone.
+*/
+#define CFE_ES_PERF_REORDER_WINDOW       32
+
+/*
+** With GCC style atomic builtins, buffer slots are reserved with compare
+** and swap so tasks can log concurrently without a lock.  Otherwise the
+** buffer is protected with OS_IntLock().
+*/
+#if defined(__GNUC__)
+#define CFE_ES_PERF_LOCKFREE
+#define CFE_ES_PERF_SYNC()               __sync_synchronize()
+#else
+#define CFE_ES_PERF_SYNC()
+#endif
 
 
 enum CFE_ES_PerfState_t {
@@ -65,6 +100,7 @@ enum CFE_ES_PerfMode_t {
     CFE_ES_PERF_TRIGGER_START = 0,
     CFE_ES_PERF_TRIGGER_CENTER,
     CFE_ES_PERF_TRIGGER_END,
+    CFE_ES_PERF_STREAM,
     CFE_ES_PERF_MAX_MODES
 };
 
@@ -77,5 +113,75 @@ typedef struct {
 
 extern CFE_ES_PerfLogDump_t    CFE_ES_PerfLogDumpStatus;
 
+/*
+** State of the streaming child task.  Entries are numbered by the free
+** running TriggerCount; Consumed is the number of the next entry to be
+** written to the stream.
+*/
+typedef struct {
+    bool                           Active;
+    bool                           StopRequest;
+    uint32                         ChildID;
+    uint32                         Consumed;
+    uint32                         PendingLost;
+    uint32                         EntriesWritten;
+    uint32                         EntriesLost;
+    uint32                         FileNum;
+    uint32                         FilesWritten;
+    uint32                         FileSize;
+    int32                          FileDescriptor;
+    char                           FileName[OS_MAX_PATH_LEN];
+    uint32                         PrevUpper32;
+    uint32                         PrevLower32;
+    uint32                         BlockFill;
+    uint8                          Block[CFE_ES_PERF_STREAM_BLOCK_SIZE];
+} CFE_ES_PerfStream_t;
+
+extern CFE_ES_PerfStream_t     CFE_ES_PerfStreamStatus;
+
+/*
+** Online statistics of one perf id.  LastMarker tells whether the last
+** marker seen was an entry or an exit and when it was logged.  Seq is odd
+** while a logging task updates the record or ES copies it out; whoever finds
+** it odd leaves the record alone instead of waiting.
+*/
+enum CFE_ES_PerfLastMarker_t {
+    CFE_ES_PERF_LAST_NONE = 0,
+    CFE_ES_PERF_LAST_ENTRY,
+    CFE_ES_PERF_LAST_EXIT
+};
+
+typedef struct {
+    uint32                         Seq;
+    uint32                         LastMarker;
+    uint32                         LastUpper32;
+    uint32                         LastLower32;
+    CFE_ES_PerfIdStats_t           Stats;
+} CFE_ES_PerfStatsRecord_t;
+
+extern CFE_ES_PerfStatsRecord_t CFE_ES_PerfStats[CFE_MISSION_ES_PERF_MAX_IDS];
+extern uint32                   CFE_ES_PerfStatsDropped;
+
+/*
+** Restore time order of the logged entries before they are written out
+*/
+void CFE_ES_PerfSortEntries(void);
+
+/*
+** Entry point of the child task that drains the buffer into stream files
+*/
+void CFE_ES_PerfStreamTask(void);
+
+/*
+** Copy the entries logged so far to the stream.  Returns CFE_SUCCESS or
+** the status of a failed file operation.
+*/
+int32 CFE_ES_PerfStreamDrain(void);
+
+/*
+** Send the statistics of the next perf ids in turn and clear them
+*/
+void CFE_ES_PerfSendStats(void);
+
 #endif /* _cfe_es_perf_ */
 
@@ -87,7 +87,10 @@ void CFE_ES_Main(uint32 StartType, uint32 StartSubtype, uint32 ModeId, const cha
 {
    uint32 i;
    int32 ReturnCode;
+   uint32 BootStart;
+   uint32 PhaseStart;
 
+   BootStart = CFE_ES_GetBootClock();
    /*
    ** Indicate that the CFE is the earliest initialization state
    */
@@ -133,6 +136,18 @@ void CFE_ES_Main(uint32 StartType, uint32 StartSubtype, uint32 ModeId, const cha
       return;
    } /* end if */
 
+   /*
+   ** Create the startup sync semaphore.  Tasks waiting for other apps to
+   ** start are woken through it; without it they fall back to polling.
+   */
+   ReturnCode = OS_BinSemCreate(&(CFE_ES_Global.StartupSyncSem), "ES_STARTUP_SYNC", OS_SEM_EMPTY, 0);
+   if(ReturnCode != OS_SUCCESS)
+   {
+      CFE_ES_WriteToSysLog("ES Startup: Startup sync semaphore could not be created. RC=0x%08X\n",
+              (unsigned int)ReturnCode);
+      CFE_ES_Global.StartupSyncSem = 0;
+   }
+
    /*
    ** Announce the startup
    */
@@ -155,6 +170,7 @@ void CFE_ES_Main(uint32 StartType, uint32 StartSubtype, uint32 ModeId, const cha
    for ( i = 0; i < CFE_PLATFORM_ES_MAX_APPLICATIONS; i++ )
    {
       CFE_ES_Global.AppTable[i].AppState = CFE_ES_AppState_UNDEFINED;
+      CFE_ES_Global.AppGeneration[i] = 0;
    }
    
    /*
@@ -184,20 +200,27 @@ void CFE_ES_Main(uint32 StartType, uint32 StartSubtype, uint32 ModeId, const cha
    /*
    ** Create the tasks, OS objects, and initialize hardware
    */
+   memset(&CFE_ES_Global.BootProfile, 0, sizeof(CFE_ES_Global.BootProfile));
+   CFE_ES_Global.BootProfile.ResetType = StartType;
+   PhaseStart = CFE_ES_GetBootClock();
    CFE_ES_CreateObjects();
+   CFE_ES_Global.BootProfile.CoreStartupUsec = CFE_ES_GetBootClock() - PhaseStart;
 
    /*
    ** Indicate that the CFE core is ready
    */
    CFE_ES_WriteToSysLog("ES Startup: CFE_ES_Main entering CORE_READY state\n");
    CFE_ES_Global.SystemState = CFE_ES_SystemState_CORE_READY;
+   CFE_ES_StartupSyncSignal();
 
    /*
    ** Start the cFE Applications from the disk using the file
    ** specified in the CFE_PLATFORM_ES_NONVOL_STARTUP_FILE or CFE_PLATFORM_ES_VOLATILE_STARTUP_FILE 
    ** ( defined in the cfe_platform_cfg.h file )
    */   
+   PhaseStart = CFE_ES_GetBootClock();
    CFE_ES_StartApplications(StartType, StartFilePath );
+   CFE_ES_Global.BootProfile.ScriptUsec = CFE_ES_GetBootClock() - PhaseStart;
 
    /*
     * Wait for applications to be in at least "LATE_INIT"
@@ -206,14 +229,17 @@ void CFE_ES_Main(uint32 StartType, uint32 StartSubtype, uint32 ModeId, const cha
     * continue anyway since the core apps are OK and control/telemetry should function.
     * The problem app could be deleted/restarted/etc by the ground station.
     */
+   PhaseStart = CFE_ES_GetBootClock();
    if (CFE_ES_MainTaskSyncDelay(CFE_ES_AppState_LATE_INIT,
            CFE_PLATFORM_ES_STARTUP_SCRIPT_TIMEOUT_MSEC) != CFE_SUCCESS)
    {
        CFE_ES_WriteToSysLog("ES Startup: Startup Sync failed - Applications may not have all initialized\n");
    }
+   CFE_ES_Global.BootProfile.AppsInitUsec = CFE_ES_GetBootClock() - PhaseStart;
 
    CFE_ES_WriteToSysLog("ES Startup: CFE_ES_Main entering APPS_INIT state\n");
    CFE_ES_Global.SystemState = CFE_ES_SystemState_APPS_INIT;
+   CFE_ES_StartupSyncSignal();
 
    /*
     * Wait for applications to be "RUNNING" before moving to operational system state.
@@ -222,17 +248,21 @@ void CFE_ES_Main(uint32 StartType, uint32 StartSubtype, uint32 ModeId, const cha
     * continue anyway since the core apps are OK and control/telemetry should function.
     * The problem app could be deleted/restarted/etc by the ground station.
     */
+   PhaseStart = CFE_ES_GetBootClock();
    if (CFE_ES_MainTaskSyncDelay(CFE_ES_AppState_RUNNING,
            CFE_PLATFORM_ES_STARTUP_SCRIPT_TIMEOUT_MSEC) != CFE_SUCCESS)
    {
        CFE_ES_WriteToSysLog("ES Startup: Startup Sync failed - Applications may not have all started\n");
    }
+   CFE_ES_Global.BootProfile.AppsRunUsec = CFE_ES_GetBootClock() - PhaseStart;
 
    /*
    ** Startup is fully complete
    */
    CFE_ES_WriteToSysLog("ES Startup: CFE_ES_Main entering OPERATIONAL state\n");
+   CFE_ES_Global.BootProfile.TotalUsec = CFE_ES_GetBootClock() - BootStart;
    CFE_ES_Global.SystemState = CFE_ES_SystemState_OPERATIONAL;
+   CFE_ES_StartupSyncSignal();
 }
 
 /*
@@ -854,12 +884,20 @@ void  CFE_ES_CreateObjects(void)
                      CFE_ES_Global.TaskTable[TaskIndex].RecordUsed = true;
                   }
                   CFE_ES_Global.TaskTable[TaskIndex].AppId = j;
+                  CFE_ES_TASKTABLE_SYNC();
                   CFE_ES_Global.TaskTable[TaskIndex].TaskId = CFE_ES_Global.AppTable[j].TaskInfo.MainTaskId;
                   strncpy((char *)CFE_ES_Global.TaskTable[TaskIndex].TaskName, (char *)CFE_ES_Global.AppTable[j].TaskInfo.MainTaskName, OS_MAX_API_NAME);
                   CFE_ES_Global.TaskTable[TaskIndex].TaskName[OS_MAX_API_NAME - 1] = '\0';
+                  CFE_ES_SetTaskFullName(TaskIndex);
 
                   CFE_ES_WriteToSysLog("ES Startup: Core App: %s created. App ID: %d\n",
                                        CFE_ES_ObjectTable[i].ObjectName,j);
+
+                  /*
+                  ** Publish the app for lock-free execution counter reads
+                  */
+                  CFE_ES_TASKTABLE_SYNC();
+                  CFE_ES_Global.AppGeneration[j]++;
                                        
                   /*
                   ** Increment the registered App and Registered External Task variables.
@@ -955,14 +993,14 @@ void  CFE_ES_CreateObjects(void)
 ** Function: CFE_ES_MainTaskSyncDelay
 **
 ** Purpose:  Waits for all of the applications that CFE has started thus far to
-**           reach the indicated state, by polling the app counters in a delay loop.
+**           reach the indicated state, checking the app table again each time
+**           an app changes state.
 **
 */
 int32 CFE_ES_MainTaskSyncDelay(uint32 AppStateId, uint32 TimeOutMilliseconds)
 {
     int32 Status;
     uint32 i;
-    uint32 WaitTime;
     uint32 WaitRemaining;
     uint32 AppNotReadyCounter;
 
@@ -994,25 +1032,52 @@ int32 CFE_ES_MainTaskSyncDelay(uint32 AppStateId, uint32 TimeOutMilliseconds)
         }
 
         /*
-         * Must delay and check again
+         * Must wait for a state change and check again
          */
-        if (WaitRemaining > CFE_PLATFORM_ES_STARTUP_SYNC_POLL_MSEC)
-        {
-            WaitTime = CFE_PLATFORM_ES_STARTUP_SYNC_POLL_MSEC;
-        }
-        else if (WaitRemaining > 0)
-        {
-            WaitTime = WaitRemaining;
-        }
-        else
+        if (!CFE_ES_StartupSyncWait(&WaitRemaining))
         {
             break;
         }
-
-        OS_TaskDelay(WaitTime);
-        WaitRemaining -= WaitTime;
     }
 
     return Status;
 }
 
+/*
+** Function: CFE_ES_GetBootClock
+**
+** Purpose:  Returns the PSP time base in microseconds, truncated to 32 bits.
+**           Only the difference between two readings is meaningful; it is
+**           used to time the startup phases and the startup sync waits.
+**
+*/
+uint32 CFE_ES_GetBootClock(void)
+{
+    uint32 Upper32;
+    uint32 Lower32;
+    uint32 Rollover;
+    uint32 TicksPerSecond;
+    uint64 Ticks;
+
+    CFE_PSP_Get_Timebase(&Upper32, &Lower32);
+    Rollover = CFE_PSP_GetTimerLow32Rollover();
+    TicksPerSecond = CFE_PSP_GetTimerTicksPerSecond();
+
+    /* a rollover of zero means the lower word uses the full 32 bits */
+    if (Rollover == 0)
+    {
+        Ticks = ((uint64)Upper32 << 32) | Lower32;
+    }
+    else
+    {
+        Ticks = (uint64)Upper32 * Rollover + Lower32;
+    }
+
+    if (TicksPerSecond == 0)
+    {
+        return 0;
+    }
+
+    return (uint32)((Ticks / TicksPerSecond) * 1000000 +
+                    ((Ticks % TicksPerSecond) * 1000000) / TicksPerSecond);
+}
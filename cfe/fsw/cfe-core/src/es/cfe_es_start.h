@@ -94,6 +94,7 @@ extern void  CFE_ES_CreateObjects(void);
 extern void  CFE_ES_SetupResetVariables(uint32 StartType, uint32 StartSubtype, uint32 BootSource);
 extern void  CFE_ES_InitializeFileSystems(uint32 StartType);
 extern void CFE_ES_SetupPerfVariables(uint32 StartType);
+extern uint32 CFE_ES_GetBootClock(void);
 
 
 #endif  /* _cfe_es_start_ */
@@ -269,6 +269,18 @@ int32 CFE_ES_TaskInit(void)
     CFE_SB_InitMsg(&CFE_ES_TaskData.MemStatsPacket, CFE_ES_MEMSTATS_TLM_MID, 
                    sizeof(CFE_ES_TaskData.MemStatsPacket), true);
 
+    /*
+    ** Initialize performance statistics telemetry packet
+    */
+    CFE_SB_InitMsg(&CFE_ES_TaskData.PerfStatsPacket, CFE_ES_PERFSTATS_TLM_MID,
+                   sizeof(CFE_ES_TaskData.PerfStatsPacket), true);
+
+    /*
+    ** Initialize boot profile telemetry packet
+    */
+    CFE_SB_InitMsg(&CFE_ES_TaskData.BootProfilePacket, CFE_ES_BOOTPROFILE_TLM_MID,
+                   sizeof(CFE_ES_TaskData.BootProfilePacket), true);
+
     /*
     ** Create Software Bus message pipe
     */
@@ -731,6 +743,30 @@ int32 CFE_ES_HousekeepingCmd(const CCSDS_CommandPacket_t *data)
     CFE_SB_TimeStampMsg((CFE_SB_Msg_t *) &CFE_ES_TaskData.HkPacket);
     CFE_SB_SendMsg((CFE_SB_Msg_t *) &CFE_ES_TaskData.HkPacket);
 
+#if CFE_PLATFORM_ES_PERF_STATS_RATE > 0
+    /*
+    ** Send performance statistics every CFE_PLATFORM_ES_PERF_STATS_RATE requests
+    */
+    CFE_ES_TaskData.PerfStatsCounter++;
+    if (CFE_ES_TaskData.PerfStatsCounter >= CFE_PLATFORM_ES_PERF_STATS_RATE)
+    {
+        CFE_ES_TaskData.PerfStatsCounter = 0;
+        CFE_ES_PerfSendStats();
+    }
+#endif
+
+    /*
+    ** Send the boot profile once startup has completed
+    */
+    if (!CFE_ES_TaskData.BootProfileSent &&
+        CFE_ES_Global.SystemState >= CFE_ES_SystemState_OPERATIONAL)
+    {
+        CFE_ES_TaskData.BootProfileSent = true;
+        CFE_ES_TaskData.BootProfilePacket.Payload = CFE_ES_Global.BootProfile;
+        CFE_SB_TimeStampMsg((CFE_SB_Msg_t *) &CFE_ES_TaskData.BootProfilePacket);
+        CFE_SB_SendMsg((CFE_SB_Msg_t *) &CFE_ES_TaskData.BootProfilePacket);
+    }
+
     /*
     ** This command does not affect the command execution counter.
     */
@@ -54,6 +54,7 @@
 #define CFE_ES_APP_LOG_DESC    "ES Application Info file"
 #define CFE_ES_ER_LOG_DESC     "ES ERlog data file"
 #define CFE_ES_PERF_LOG_DESC   "ES Performance data file"
+#define CFE_ES_PERF_STREAM_DESC "ES Performance stream file"
 
 /*************************************************************************/
 /*
@@ -92,6 +93,18 @@ typedef struct
   */
   CFE_ES_MemStatsTlm_t MemStatsPacket;
 
+  /*
+  ** Performance statistics telemetry packet
+  */
+  CFE_ES_PerfStatsTlm_t PerfStatsPacket;
+  uint32                PerfStatsCounter;
+
+  /*
+  ** Boot profile telemetry packet
+  */
+  CFE_ES_BootProfileTlm_t BootProfilePacket;
+  bool                    BootProfileSent;
+
   /*
   ** ES Task operational data (not reported in housekeeping)
   */
@@ -177,6 +177,19 @@
     #error CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE cannot be less than 1025 entries!
 #endif
 
+/*
+** Performance stream file rotation
+*/
+#if CFE_PLATFORM_ES_PERF_STREAM_FILE_SIZE  <  1024
+    #error CFE_PLATFORM_ES_PERF_STREAM_FILE_SIZE cannot be less than 1024 bytes!
+#endif
+
+#if CFE_PLATFORM_ES_PERF_STREAM_NUM_FILES  <  1
+    #error CFE_PLATFORM_ES_PERF_STREAM_NUM_FILES cannot be less than 1!
+#elif CFE_PLATFORM_ES_PERF_STREAM_NUM_FILES  >  100
+    #error CFE_PLATFORM_ES_PERF_STREAM_NUM_FILES cannot be greater than 100!
+#endif
+
 /* 
 ** Maximum number of Registered CDS blocks
 */
@@ -200,6 +213,19 @@
     #error CFE_PLATFORM_ES_MEMPOOL_ALIGN_SIZE_MIN must be a power of 2!
 #endif
 
+/*
+**  ES memory pool task cache
+*/
+#if CFE_PLATFORM_ES_MEMPOOL_CACHE_SLOTS < 0
+    #error CFE_PLATFORM_ES_MEMPOOL_CACHE_SLOTS cannot be less than 0!
+#elif CFE_PLATFORM_ES_MEMPOOL_CACHE_SLOTS > 0
+    #if CFE_PLATFORM_ES_MEMPOOL_CACHE_DEPTH < 2
+        #error CFE_PLATFORM_ES_MEMPOOL_CACHE_DEPTH must be at least 2!
+    #elif CFE_PLATFORM_ES_MEMPOOL_CACHE_DEPTH > 65535
+        #error CFE_PLATFORM_ES_MEMPOOL_CACHE_DEPTH cannot be greater than 65535!
+    #endif
+#endif
+
 /*
 **  Intermediate ES Memory Pool Block Sizes
 */
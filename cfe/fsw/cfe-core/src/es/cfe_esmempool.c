@@ -40,6 +40,7 @@
 #include "cfe_es_task.h"
 #include "cfe_es_log.h"
 #include <stdio.h>
+#include <string.h>
 
 /**
  * Macro that determines the native alignment requirement of a specific type
@@ -74,6 +75,11 @@ typedef union
 #define CFE_ES_CHECK_PATTERN           0x5a5a
 #define CFE_ES_MEMORY_ALLOCATED        0xaaaa
 #define CFE_ES_MEMORY_DEALLOCATED      0xdddd
+
+/*
+** Number of blocks moved between a task cache and the shared free list at once
+*/
+#define CFE_ES_CACHE_BATCH             (CFE_PLATFORM_ES_MEMPOOL_CACHE_DEPTH / 2)
 /*****************************************************************************/
 /*
 ** Type Definitions
@@ -105,7 +111,12 @@ uint32 CFE_ES_MemPoolDefSize[CFE_ES_MAX_MEMPOOL_BLOCK_SIZES] =
 /*
 ** Local Function Prototypes
 */
-uint32 CFE_ES_GetBlockSize(Pool_t  *PoolPtr, uint32 Size);
+uint32 CFE_ES_GetSizeClass(Pool_t  *PoolPtr, uint32 Size);
+#if CFE_ES_MEMPOOL_CACHE_SLOTS > 0
+BD_t  *CFE_ES_CacheGetBlock(Pool_t *PoolPtr, uint32 SizeClass);
+int32  CFE_ES_CachePutBlock(Pool_t *PoolPtr, BD_t *BdPtr);
+BD_t  *CFE_ES_CacheReclaim(Pool_t *PoolPtr, uint32 SizeClass);
+#endif
 
 /*****************************************************************************/
 /*
@@ -237,7 +248,6 @@ int32 CFE_ES_PoolCreateEx(CFE_ES_MemHandle_t  *HandlePtr,
    PoolPtr->Size          = PoolPtr->End - MemAddr;  /* Adjusts for any size lost due to alignment */
    PoolPtr->AlignMask     = MemAlignSize;
    PoolPtr->CurrentAddr   = MemAddr + sizeof(Pool_t);
-   PoolPtr->SizeDescPtr   = NULL;
    PoolPtr->CheckErrCntr  = 0;
    PoolPtr->RequestCntr   = 0;
    
@@ -294,6 +304,25 @@ int32 CFE_ES_PoolCreateEx(CFE_ES_MemHandle_t  *HandlePtr,
         }
    }
 
+   /*
+   ** Record the size class that holds each power of two, so that a lookup
+   ** only has to step over the classes between two powers of two
+   */
+   for (i=0; i<CFE_ES_MEMPOOL_SIZE_INDEX_ENTRIES; i++)
+   {
+       j = 0;
+       while ((j < (CFE_ES_MAX_MEMPOOL_BLOCK_SIZES-1)) &&
+              (((uint64)1 << i) <= PoolPtr->SizeDesc[j+1].MaxSize))
+       {
+           j++;
+       }
+       PoolPtr->SizeIndex[i] = j;
+   }
+
+#if CFE_ES_MEMPOOL_CACHE_SLOTS > 0
+   memset(PoolPtr->Cache, 0, sizeof(PoolPtr->Cache));
+#endif
+
    return(CFE_SUCCESS);
 }
 
@@ -309,6 +338,7 @@ int32 CFE_ES_GetPoolBuf(uint32             **BufPtr,
                         uint32               Size )
 {
    Pool_t  * PoolPtr = (Pool_t *)Handle;
+   uint32   SizeClass;
    uint32   BlockSize;
    MemPoolAddr_t BlockAddr;
    uint32    AppId= 0xFFFFFFFF;
@@ -330,40 +360,53 @@ int32 CFE_ES_GetPoolBuf(uint32             **BufPtr,
    }
 
 
-   if (PoolPtr->UseMutex == CFE_ES_USE_MUTEX)
+   *BufPtr = NULL;
+
+   /*
+   ** The size classes do not change once the pool is created,
+   ** so they can be looked up before taking the lock
+   */
+   SizeClass = CFE_ES_GetSizeClass(PoolPtr, Size);
+   if (SizeClass >= CFE_ES_MAX_MEMPOOL_BLOCK_SIZES)
    {
-      OS_MutSemTake(PoolPtr->MutexId);
+      CFE_ES_WriteToSysLog("CFE_ES:getPoolBuf err:size(%u) > max(%u).\n",
+                  (unsigned int)Size,
+                  (unsigned int)PoolPtr->SizeDesc[0].MaxSize);
+      return(CFE_ES_ERR_MEM_BLOCK_SIZE);
    }
 
-   *BufPtr = NULL;
+   BlockSize = PoolPtr->SizeDesc[SizeClass].MaxSize;
 
-   BlockSize = CFE_ES_GetBlockSize(PoolPtr, Size);
-   if (BlockSize > PoolPtr->SizeDesc[0].MaxSize)
+#if CFE_ES_MEMPOOL_CACHE_SLOTS > 0
+   if (PoolPtr->UseMutex == CFE_ES_USE_MUTEX)
    {
-      /* save off the max size prior to release, for the log message */
-      BlockSize = PoolPtr->SizeDesc[0].MaxSize;
-      if (PoolPtr->UseMutex == CFE_ES_USE_MUTEX)
+      BlockAddr.BdPtr = CFE_ES_CacheGetBlock(PoolPtr, SizeClass);
+      if (BlockAddr.BdPtr != NULL)
       {
-         OS_MutSemGive(PoolPtr->MutexId);
+         ++BlockAddr.BdPtr;
+         *BufPtr = BlockAddr.UserPtr;
+         return (int32)BlockSize;
       }
-      CFE_ES_WriteToSysLog("CFE_ES:getPoolBuf err:size(%u) > max(%u).\n",
-                  (unsigned int)Size,
-                  (unsigned int)BlockSize);
-      return(CFE_ES_ERR_MEM_BLOCK_SIZE);
+   }
+#endif
+
+   if (PoolPtr->UseMutex == CFE_ES_USE_MUTEX)
+   {
+      OS_MutSemTake(PoolPtr->MutexId);
    }
 
    /*
    ** Check if any of the requested size are available
    */
-   if (PoolPtr->SizeDescPtr->Top != NULL) /* Set by GetBlockSize call */
+   if (PoolPtr->SizeDesc[SizeClass].Top != NULL)
    {
          /*
          ** Get it off the top on the list
          */
-         BlockAddr.BdPtr = PoolPtr->SizeDescPtr->Top;
+         BlockAddr.BdPtr = PoolPtr->SizeDesc[SizeClass].Top;
 
-         PoolPtr->SizeDescPtr->Top = BlockAddr.BdPtr->Next;
-         PoolPtr->SizeDescPtr->NumFree--;
+         PoolPtr->SizeDesc[SizeClass].Top = BlockAddr.BdPtr->Next;
+         PoolPtr->SizeDesc[SizeClass].NumFree--;
 
          BlockAddr.BdPtr->CheckBits       = CFE_ES_CHECK_PATTERN;
          BlockAddr.BdPtr->Allocated       = CFE_ES_MEMORY_ALLOCATED; /* Flag memory block as allocated */
@@ -395,6 +438,17 @@ int32 CFE_ES_GetPoolBuf(uint32             **BufPtr,
          if ( (PoolPtr->End - (BlockAddr.Addr + BlockSize)) >= PoolPtr->Size ){ /* can't fit in remaing mem */
             if (PoolPtr->UseMutex == CFE_ES_USE_MUTEX)
             {
+#if CFE_ES_MEMPOOL_CACHE_SLOTS > 0
+               /* Blocks of this size may still be held in the task caches */
+               BlockAddr.BdPtr = CFE_ES_CacheReclaim(PoolPtr, SizeClass);
+               if (BlockAddr.BdPtr != NULL)
+               {
+                  OS_MutSemGive(PoolPtr->MutexId);
+                  ++BlockAddr.BdPtr;
+                  *BufPtr = BlockAddr.UserPtr;
+                  return (int32)BlockSize;
+               }
+#endif
                OS_MutSemGive(PoolPtr->MutexId);
             }
             CFE_ES_WriteToSysLog("CFE_ES:getPoolBuf err:Request won't fit in remaining memory\n");
@@ -408,7 +462,7 @@ int32 CFE_ES_GetPoolBuf(uint32             **BufPtr,
          ** adjust pool current pointer and other recordkeeping in the Pool_t
          */
          PoolPtr->CurrentAddr = BlockAddr.Addr + BlockSize;
-         PoolPtr->SizeDescPtr->NumCreated++;
+         PoolPtr->SizeDesc[SizeClass].NumCreated++;
          PoolPtr->RequestCntr++;
 
          /*
@@ -494,7 +548,10 @@ int32 CFE_ES_PutPoolBuf(CFE_ES_MemHandle_t   Handle,
 {
   Pool_t   *PoolPtr =  (Pool_t *)Handle;
   MemPoolAddr_t BlockAddr;
-  uint32 BlockSize;
+  uint32 SizeClass;
+#if CFE_ES_MEMPOOL_CACHE_SLOTS > 0
+  uint16 Allocated = CFE_ES_MEMORY_ALLOCATED;
+#endif
   int32 Status;
   char LogMessage[CFE_ES_MAX_SYSLOG_MSG_SIZE];
 
@@ -522,37 +579,47 @@ int32 CFE_ES_PutPoolBuf(CFE_ES_MemHandle_t   Handle,
       /*
       ** Move to the descriptor (immediately preceding the user buffer)
       ** and perform simple sanity checks for descriptor.
-      ** This must be done while locked, if the USE_MUTEX flag is set.
+      ** This must be done while locked, if the USE_MUTEX flag is set,
+      ** unless the task cache takes a good block first.
       */
       --BlockAddr.BdPtr;
 
+      Status = 0;
+
+#if CFE_ES_MEMPOOL_CACHE_SLOTS > 0
       if (PoolPtr->UseMutex == CFE_ES_USE_MUTEX)
       {
-         OS_MutSemTake(PoolPtr->MutexId);
+         Status = CFE_ES_CachePutBlock(PoolPtr, BlockAddr.BdPtr);
       }
+#endif
 
-      /* If a block is no longer allocated, report an error */
-      if (BlockAddr.BdPtr->Allocated != CFE_ES_MEMORY_ALLOCATED)
-      {
-          PoolPtr->CheckErrCntr++;
-          CFE_ES_SysLog_snprintf(LogMessage, sizeof(LogMessage),
-                  "CFE_ES:putPoolBuf err:Deallocating unallocated memory block @ 0x%08lX\n",
-                  (unsigned long)BufPtr);
-          Status = CFE_ES_ERR_MEM_HANDLE;
-      }
-      else if (BlockAddr.BdPtr->CheckBits != CFE_ES_CHECK_PATTERN)
+      if (Status == 0)
       {
-          PoolPtr->CheckErrCntr++;
-          CFE_ES_SysLog_snprintf(LogMessage, sizeof(LogMessage),
-                  "CFE_ES:putPoolBuf err:Invalid/Corrupted Memory descriptor @ 0x%08lX\n",
-                  (unsigned long)BufPtr);
-          Status = CFE_ES_ERR_MEM_HANDLE;
-      }
-      else
-      {
-          BlockSize = CFE_ES_GetBlockSize(PoolPtr, BlockAddr.BdPtr->Size);
+          if (PoolPtr->UseMutex == CFE_ES_USE_MUTEX)
+          {
+             OS_MutSemTake(PoolPtr->MutexId);
+          }
+
+          SizeClass = CFE_ES_GetSizeClass(PoolPtr, BlockAddr.BdPtr->Size);
 
-          if (BlockSize > PoolPtr->SizeDesc[0].MaxSize)
+          /* If a block is no longer allocated, report an error */
+          if (BlockAddr.BdPtr->Allocated != CFE_ES_MEMORY_ALLOCATED)
+          {
+              PoolPtr->CheckErrCntr++;
+              CFE_ES_SysLog_snprintf(LogMessage, sizeof(LogMessage),
+                      "CFE_ES:putPoolBuf err:Deallocating unallocated memory block @ 0x%08lX\n",
+                      (unsigned long)BufPtr);
+              Status = CFE_ES_ERR_MEM_HANDLE;
+          }
+          else if (BlockAddr.BdPtr->CheckBits != CFE_ES_CHECK_PATTERN)
+          {
+              PoolPtr->CheckErrCntr++;
+              CFE_ES_SysLog_snprintf(LogMessage, sizeof(LogMessage),
+                      "CFE_ES:putPoolBuf err:Invalid/Corrupted Memory descriptor @ 0x%08lX\n",
+                      (unsigned long)BufPtr);
+              Status = CFE_ES_ERR_MEM_HANDLE;
+          }
+          else if (SizeClass >= CFE_ES_MAX_MEMPOOL_BLOCK_SIZES)
           {
               PoolPtr->CheckErrCntr++;
               CFE_ES_SysLog_snprintf(LogMessage, sizeof(LogMessage),
@@ -560,19 +627,31 @@ int32 CFE_ES_PutPoolBuf(CFE_ES_MemHandle_t   Handle,
                       (unsigned int)BlockAddr.BdPtr->Size,(unsigned int)PoolPtr->SizeDesc[0].MaxSize);
               Status = CFE_ES_ERR_MEM_HANDLE;
           }
+#if CFE_ES_MEMPOOL_CACHE_SLOTS > 0
+          /* Task caches release blocks without the lock, so the flag is swapped atomically */
+          else if (!__atomic_compare_exchange_n(&BlockAddr.BdPtr->Allocated, &Allocated,
+                  CFE_ES_MEMORY_DEALLOCATED, false, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE))
+          {
+              PoolPtr->CheckErrCntr++;
+              CFE_ES_SysLog_snprintf(LogMessage, sizeof(LogMessage),
+                      "CFE_ES:putPoolBuf err:Deallocating unallocated memory block @ 0x%08lX\n",
+                      (unsigned long)BufPtr);
+              Status = CFE_ES_ERR_MEM_HANDLE;
+          }
+#endif
           else
           {
               BlockAddr.BdPtr->Allocated = CFE_ES_MEMORY_DEALLOCATED;
-              BlockAddr.BdPtr->Next = PoolPtr->SizeDescPtr->Top; /* Set by GetBlockSize call */
-              PoolPtr->SizeDescPtr->Top = BlockAddr.BdPtr;
-              PoolPtr->SizeDescPtr->NumFree++;
-              Status = BlockSize;
+              BlockAddr.BdPtr->Next = PoolPtr->SizeDesc[SizeClass].Top;
+              PoolPtr->SizeDesc[SizeClass].Top = BlockAddr.BdPtr;
+              PoolPtr->SizeDesc[SizeClass].NumFree++;
+              Status = PoolPtr->SizeDesc[SizeClass].MaxSize;
           }
-      }
 
-      if (PoolPtr->UseMutex == CFE_ES_USE_MUTEX)
-      {
-         OS_MutSemGive(PoolPtr->MutexId);
+          if (PoolPtr->UseMutex == CFE_ES_USE_MUTEX)
+          {
+             OS_MutSemGive(PoolPtr->MutexId);
+          }
       }
   }
 
@@ -587,35 +666,274 @@ int32 CFE_ES_PutPoolBuf(CFE_ES_MemHandle_t   Handle,
 
 /*
 ** Function:
-**   ES_GetBlockSize
+**   CFE_ES_GetSizeClass
 **
 ** Purpose:
-**
+**   Returns the index of the smallest block size that holds Size, or
+**   CFE_ES_MAX_MEMPOOL_BLOCK_SIZES if Size is larger than the largest block.
+**   The search starts at the class recorded for the next power of two.
 */
-uint32 CFE_ES_GetBlockSize(Pool_t  *PoolPtr, uint32 Size)
+uint32 CFE_ES_GetSizeClass(Pool_t  *PoolPtr, uint32 Size)
 {
-  uint32 i=0;
-
-  PoolPtr->SizeDescPtr = NULL;
+  uint32 i;
+#if !defined(__GNUC__)
+  uint32 Bits;
+#endif
 
   /* If caller is requesting a size larger than the largest allowed */
-  /* then return an error code */  
+  /* then return an error code */
   if (Size > PoolPtr->SizeDesc[0].MaxSize)
   {
-        return(0xFFFFFFFF);
+        return(CFE_ES_MAX_MEMPOOL_BLOCK_SIZES);
   }
-  
+
+  if (Size <= 1)
+  {
+        i = PoolPtr->SizeIndex[0];
+  }
+  else
+  {
+#if defined(__GNUC__)
+        i = PoolPtr->SizeIndex[32 - __builtin_clz(Size - 1)];
+#else
+        for (Bits = 0; ((Size - 1) >> Bits) != 0; ++Bits)
+        {
+        }
+        i = PoolPtr->SizeIndex[Bits];
+#endif
+  }
+
   /* Locate the smallest size that holds the desired size */
   while ((i < (CFE_ES_MAX_MEMPOOL_BLOCK_SIZES-1)) &&
          (Size <= PoolPtr->SizeDesc[i+1].MaxSize))
   {
         i++;
   }
-  
-  PoolPtr->SizeDescPtr = &PoolPtr->SizeDesc[i];
-  return(PoolPtr->SizeDesc[i].MaxSize);
+
+  return(i);
 }
 
+#if CFE_ES_MEMPOOL_CACHE_SLOTS > 0
+/*
+** Function:
+**   CFE_ES_CacheClaim
+**
+** Purpose:
+**   Claims the cache slot of the calling task.  Returns NULL if another
+**   task holds the slot, or the caller is not an OSAL task.
+*/
+static CFE_ES_PoolCache_t *CFE_ES_CacheClaim(Pool_t *PoolPtr)
+{
+    CFE_ES_PoolCache_t *Cache;
+    uint32              TaskIndex;
+
+    if (OS_ConvertToArrayIndex(OS_TaskGetId(), &TaskIndex) != OS_SUCCESS)
+    {
+        return NULL;
+    }
+
+    Cache = &PoolPtr->Cache[TaskIndex % CFE_ES_MEMPOOL_CACHE_SLOTS];
+    if (__atomic_exchange_n(&Cache->Busy, 1, __ATOMIC_ACQUIRE) != 0)
+    {
+        __atomic_fetch_add(&Cache->Misses, 1, __ATOMIC_RELAXED);
+        return NULL;
+    }
+
+    return Cache;
+}
+
+static void CFE_ES_CacheRelease(CFE_ES_PoolCache_t *Cache)
+{
+    __atomic_store_n(&Cache->Busy, 0, __ATOMIC_RELEASE);
+}
+
+/*
+** Function:
+**   CFE_ES_CacheGetBlock
+**
+** Purpose:
+**   Takes a block of the size class from the cache of the calling task,
+**   refilling the cache from the shared free list when it is empty.
+**   Returns NULL if the block must come from the locked pool instead.
+*/
+BD_t *CFE_ES_CacheGetBlock(Pool_t *PoolPtr, uint32 SizeClass)
+{
+    CFE_ES_PoolCache_t *Cache;
+    BlockSizeDesc_t    *SizeDesc = &PoolPtr->SizeDesc[SizeClass];
+    BD_t               *BdPtr;
+    uint32              Count;
+
+    Cache = CFE_ES_CacheClaim(PoolPtr);
+    if (Cache == NULL)
+    {
+        return NULL;
+    }
+
+    if (Cache->Top[SizeClass] != NULL)
+    {
+        ++Cache->Hits;
+    }
+    else
+    {
+        __atomic_fetch_add(&Cache->Misses, 1, __ATOMIC_RELAXED);
+
+        OS_MutSemTake(PoolPtr->MutexId);
+        Count = 0;
+        while (Count < CFE_ES_CACHE_BATCH && SizeDesc->Top != NULL)
+        {
+            BdPtr = SizeDesc->Top;
+            SizeDesc->Top = BdPtr->Next;
+            BdPtr->Next = Cache->Top[SizeClass];
+            Cache->Top[SizeClass] = BdPtr;
+            ++Count;
+        }
+        SizeDesc->NumFree -= Count;
+        OS_MutSemGive(PoolPtr->MutexId);
+
+        Cache->Count[SizeClass] = Count;
+    }
+
+    BdPtr = Cache->Top[SizeClass];
+    if (BdPtr != NULL)
+    {
+        Cache->Top[SizeClass] = BdPtr->Next;
+        --Cache->Count[SizeClass];
+
+        BdPtr->CheckBits = CFE_ES_CHECK_PATTERN;
+        BdPtr->Allocated = CFE_ES_MEMORY_ALLOCATED;
+        BdPtr->Size      = SizeDesc->MaxSize;
+        BdPtr->Next      = NULL;
+    }
+
+    CFE_ES_CacheRelease(Cache);
+
+    return BdPtr;
+}
+
+/*
+** Function:
+**   CFE_ES_CachePutBlock
+**
+** Purpose:
+**   Puts a released block in the cache of the calling task, returning
+**   half of the cache to the shared free list when it is full.  Returns
+**   the block size, or 0 if the block must go through the locked pool
+**   (which also reports any problem with the block).
+*/
+int32 CFE_ES_CachePutBlock(Pool_t *PoolPtr, BD_t *BdPtr)
+{
+    CFE_ES_PoolCache_t *Cache;
+    BlockSizeDesc_t    *SizeDesc;
+    BD_t               *Drain;
+    uint32              SizeClass;
+    uint32              Count;
+    uint16              Allocated = CFE_ES_MEMORY_ALLOCATED;
+
+    SizeClass = CFE_ES_GetSizeClass(PoolPtr, BdPtr->Size);
+    if (BdPtr->CheckBits != CFE_ES_CHECK_PATTERN || SizeClass >= CFE_ES_MAX_MEMPOOL_BLOCK_SIZES)
+    {
+        return 0;
+    }
+
+    Cache = CFE_ES_CacheClaim(PoolPtr);
+    if (Cache == NULL)
+    {
+        return 0;
+    }
+
+    if (!__atomic_compare_exchange_n(&BdPtr->Allocated, &Allocated,
+            CFE_ES_MEMORY_DEALLOCATED, false, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE))
+    {
+        CFE_ES_CacheRelease(Cache);
+        return 0;
+    }
+
+    SizeDesc = &PoolPtr->SizeDesc[SizeClass];
+    BdPtr->Next = Cache->Top[SizeClass];
+    Cache->Top[SizeClass] = BdPtr;
+    ++Cache->Count[SizeClass];
+
+    if (Cache->Count[SizeClass] <= CFE_PLATFORM_ES_MEMPOOL_CACHE_DEPTH)
+    {
+        ++Cache->Hits;
+    }
+    else
+    {
+        __atomic_fetch_add(&Cache->Misses, 1, __ATOMIC_RELAXED);
+
+        OS_MutSemTake(PoolPtr->MutexId);
+        for (Count = 0; Count < CFE_ES_CACHE_BATCH; Count++)
+        {
+            Drain = Cache->Top[SizeClass];
+            Cache->Top[SizeClass] = Drain->Next;
+            Drain->Next = SizeDesc->Top;
+            SizeDesc->Top = Drain;
+        }
+        SizeDesc->NumFree += CFE_ES_CACHE_BATCH;
+        OS_MutSemGive(PoolPtr->MutexId);
+
+        Cache->Count[SizeClass] -= CFE_ES_CACHE_BATCH;
+    }
+
+    CFE_ES_CacheRelease(Cache);
+
+    return (int32)SizeDesc->MaxSize;
+}
+
+/*
+** Function:
+**   CFE_ES_CacheReclaim
+**
+** Purpose:
+**   Moves the blocks of the size class held in the task caches back to the
+**   shared free list, then takes one block from it.  Called with the pool
+**   lock held once the pool is carved out.  A slot claimed by another task
+**   is skipped, as its owner may be waiting for the pool lock.  Returns NULL
+**   if no block of the size class is free.
+*/
+BD_t *CFE_ES_CacheReclaim(Pool_t *PoolPtr, uint32 SizeClass)
+{
+    CFE_ES_PoolCache_t *Cache;
+    BlockSizeDesc_t    *SizeDesc = &PoolPtr->SizeDesc[SizeClass];
+    BD_t               *BdPtr;
+    uint32              i;
+
+    for (i = 0; i < CFE_ES_MEMPOOL_CACHE_SLOTS; i++)
+    {
+        Cache = &PoolPtr->Cache[i];
+        if (__atomic_exchange_n(&Cache->Busy, 1, __ATOMIC_ACQUIRE) != 0)
+        {
+            continue;
+        }
+
+        while (Cache->Top[SizeClass] != NULL)
+        {
+            BdPtr = Cache->Top[SizeClass];
+            Cache->Top[SizeClass] = BdPtr->Next;
+            BdPtr->Next = SizeDesc->Top;
+            SizeDesc->Top = BdPtr;
+        }
+        SizeDesc->NumFree += Cache->Count[SizeClass];
+        Cache->Count[SizeClass] = 0;
+
+        CFE_ES_CacheRelease(Cache);
+    }
+
+    BdPtr = SizeDesc->Top;
+    if (BdPtr != NULL)
+    {
+        SizeDesc->Top = BdPtr->Next;
+        SizeDesc->NumFree--;
+
+        BdPtr->CheckBits = CFE_ES_CHECK_PATTERN;
+        BdPtr->Allocated = CFE_ES_MEMORY_ALLOCATED;
+        BdPtr->Size      = SizeDesc->MaxSize;
+        BdPtr->Next      = NULL;
+    }
+
+    return BdPtr;
+}
+#endif
 
 /*
 ** Function:
@@ -630,6 +948,9 @@ int32 CFE_ES_GetMemPoolStats(CFE_ES_MemPoolStats_t *BufPtr,
     uint32    AppId = 0xFFFFFFFF;
     Pool_t   *PoolPtr;
     uint32    i;
+#if CFE_ES_MEMPOOL_CACHE_SLOTS > 0
+    uint32    j;
+#endif
     
     PoolPtr = (Pool_t *)Handle;
 
@@ -644,6 +965,8 @@ int32 CFE_ES_GetMemPoolStats(CFE_ES_MemPoolStats_t *BufPtr,
     BufPtr->NumBlocksRequested = PoolPtr->RequestCntr;
     BufPtr->CheckErrCtr = PoolPtr->CheckErrCntr;
     BufPtr->NumFreeBytes = PoolPtr->End - PoolPtr->CurrentAddr;
+    BufPtr->CacheHits = 0;
+    BufPtr->CacheMisses = 0;
     
     for (i=0; i<CFE_ES_MAX_MEMPOOL_BLOCK_SIZES; i++)
     {
@@ -651,6 +974,19 @@ int32 CFE_ES_GetMemPoolStats(CFE_ES_MemPoolStats_t *BufPtr,
         BufPtr->BlockStats[i].NumCreated = PoolPtr->SizeDesc[i].NumCreated;
         BufPtr->BlockStats[i].NumFree = PoolPtr->SizeDesc[i].NumFree;
     }
+
+#if CFE_ES_MEMPOOL_CACHE_SLOTS > 0
+    /* Blocks held in the task caches are free as well */
+    for (j=0; j<CFE_ES_MEMPOOL_CACHE_SLOTS; j++)
+    {
+        BufPtr->CacheHits += PoolPtr->Cache[j].Hits;
+        BufPtr->CacheMisses += PoolPtr->Cache[j].Misses;
+        for (i=0; i<CFE_ES_MAX_MEMPOOL_BLOCK_SIZES; i++)
+        {
+            BufPtr->BlockStats[i].NumFree += PoolPtr->Cache[j].Count[i];
+        }
+    }
+#endif
     
     return(CFE_SUCCESS);
 }
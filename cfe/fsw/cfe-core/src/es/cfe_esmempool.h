@@ -55,6 +55,36 @@ typedef struct
   uint32   MaxSize;
 } BlockSizeDesc_t;
 
+/*
+** Number of entries in the size class lookup, one per power of two up to 2^32
+*/
+#define CFE_ES_MEMPOOL_SIZE_INDEX_ENTRIES   33
+
+/*
+** The task caches are claimed with the GCC atomic builtins.  Other
+** compilers build without them and every block goes through the locked pool.
+*/
+#if defined(__GNUC__)
+#define CFE_ES_MEMPOOL_CACHE_SLOTS          CFE_PLATFORM_ES_MEMPOOL_CACHE_SLOTS
+#else
+#define CFE_ES_MEMPOOL_CACHE_SLOTS          0
+#endif
+
+#if CFE_ES_MEMPOOL_CACHE_SLOTS > 0
+/*
+** Cache of free blocks used by the tasks that map to one slot.
+** Busy is claimed atomically; the lists are only touched by the claimant.
+*/
+typedef struct
+{
+  uint32    Busy;
+  uint32    Hits;
+  uint32    Misses;
+  BD_t     *Top[CFE_ES_MAX_MEMPOOL_BLOCK_SIZES];
+  uint16    Count[CFE_ES_MAX_MEMPOOL_BLOCK_SIZES];
+} CFE_ES_PoolCache_t;
+#endif
+
 /*
 ** Memory Pool Type
 */
@@ -65,12 +95,15 @@ typedef struct
    cpuaddr          End;
    cpuaddr          CurrentAddr;
    cpuaddr          AlignMask;
-   BlockSizeDesc_t *SizeDescPtr;
    uint16           CheckErrCntr;
    uint16           RequestCntr;
    uint32           MutexId;
    uint32           UseMutex;
    BlockSizeDesc_t  SizeDesc[CFE_ES_MAX_MEMPOOL_BLOCK_SIZES];
+   uint8            SizeIndex[CFE_ES_MEMPOOL_SIZE_INDEX_ENTRIES];
+#if CFE_ES_MEMPOOL_CACHE_SLOTS > 0
+   CFE_ES_PoolCache_t Cache[CFE_ES_MEMPOOL_CACHE_SLOTS];
+#endif
 } Pool_t;
 
 
@@ -16,7 +16,7 @@ TARGET = fs.o
 #==============================================================================
 # Object files required to build subsystem.
 
-OBJS = cfe_fs_priv.o cfe_fs_api.o cfe_fs_decompress.o
+OBJS = cfe_fs_priv.o cfe_fs_api.o cfe_fs_decompress.o cfe_fs_compress.o
 
 #==============================================================================
 # Source files required to build subsystem; used to generate dependencies.
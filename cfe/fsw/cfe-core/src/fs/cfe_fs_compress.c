@@ -0,0 +1,971 @@
+/*
+**  GSC-18128-1, "Core Flight Executive Version 6.7"
+**
+**  Copyright (c) 2006-2019 United States Government as represented by
+**  the Administrator of the National Aeronautics and Space Administration.
+**  All Rights Reserved.
+**
+**  Licensed under the Apache License, Version 2.0 (the "License");
+**  you may not use this file except in compliance with the License.
+**  You may obtain a copy of the License at
+**
+**    http://www.apache.org/licenses/LICENSE-2.0
+**
+**  Unless required by applicable law or agreed to in writing, software
+**  distributed under the License is distributed on an "AS IS" BASIS,
+**  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**  See the License for the specific language governing permissions and
+**  limitations under the License.
+*/
+
+/*
+**   File: cfe_fs_compress.c
+**
+**   Purpose: Streaming gzip (RFC 1952) compressor behind the CFE_FS_Deflate API.
+**
+**   The compressor favours speed over ratio, much like "gzip -1".  Input is
+**   gathered into blocks.  Each block is parsed greedily against a one entry
+**   hash of 4 byte strings, then written as a stored, fixed Huffman or
+**   dynamic Huffman deflate (RFC 1951) block, whichever is smallest.
+**
+*/
+
+/*
+** Includes
+*/
+#include "cfe_fs_decompress.h"
+
+/*
+** Defines
+*/
+#define PUTBITS(v,n) { b |= (uint64)(v) << k; k += (n); }
+#define FLUSHBITS() {                                            \
+   if ( k >= 32 ) {                                              \
+      Out[o++] = (uint8)b;         Out[o++] = (uint8)(b >> 8);   \
+      Out[o++] = (uint8)(b >> 16); Out[o++] = (uint8)(b >> 24);  \
+      b >>= 32;                                                  \
+      k -= 32;                                                   \
+   }                                                             \
+}
+#define HASH(s) ( ( ( ( (uint32)(s)[0] | ( (uint32)(s)[1] << 8 ) | ( (uint32)(s)[2] << 16 ) |    \
+                      ( (uint32)(s)[3] << 24 ) ) * 0x9E3779B1U ) >> 16 ) & ( CFE_FS_DEFLATE_HASH_SIZE - 1 ) )
+#define DISTCODE(d) ( ( (d) <= 256 ) ? FS_gz_DistCode[(d) - 1] : FS_gz_DistCode[256 + ( ( (d) - 1 ) >> 7 )] )
+
+#define MIN_MATCH       4           /* shortest match looked for, the hashed string length */
+#define LITLEN_CODES    286         /* literal/length symbols that can be sent             */
+#define FIXED_CODES     288         /* literal/length symbols of the fixed code            */
+#define DIST_CODES      30          /* distance symbols                                    */
+#define PRECODE_CODES   19          /* code length symbols                                 */
+#define PRECODE_BITS    7           /* longest code length code                            */
+#define END_OF_BLOCK    256
+
+/*
+** Length code (0..28, for symbols 257..285) of each match length less 3
+*/
+static const uint8 FS_gz_LenCode[256] =
+{
+    0,  1,  2,  3,  4,  5,  6,  7,  8,  8,  9,  9, 10, 10, 11, 11,
+   12, 12, 12, 12, 13, 13, 13, 13, 14, 14, 14, 14, 15, 15, 15, 15,
+   16, 16, 16, 16, 16, 16, 16, 16, 17, 17, 17, 17, 17, 17, 17, 17,
+   18, 18, 18, 18, 18, 18, 18, 18, 19, 19, 19, 19, 19, 19, 19, 19,
+   20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+   21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+   22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+   23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+   24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24,
+   24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24,
+   25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+   25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+   26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+   26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+   27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27,
+   27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 28
+};
+
+/*
+** Distance code of distances 1..256, then of each 128 distances above 256
+*/
+static const uint8 FS_gz_DistCode[512] =
+{
+    0,  1,  2,  3,  4,  4,  5,  5,  6,  6,  6,  6,  7,  7,  7,  7,
+    8,  8,  8,  8,  8,  8,  8,  8,  9,  9,  9,  9,  9,  9,  9,  9,
+   10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+   11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+   12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+   12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+   13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+   13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+   14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+   14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+   14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+   14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+   15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+   15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+   15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+   15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+    0, 14, 16, 17, 18, 18, 19, 19, 20, 20, 20, 20, 21, 21, 21, 21,
+   22, 22, 22, 22, 22, 22, 22, 22, 23, 23, 23, 23, 23, 23, 23, 23,
+   24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24,
+   25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+   26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+   26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+   27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27,
+   27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27,
+   28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+   28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+   28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+   28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+   29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+   29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+   29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+   29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29
+};
+
+
+/*
+** The gzip header that starts every member written here: deflate, no time
+** stamp, fastest compression, unknown OS, and a header CRC so that the
+** stream can be found after the headers of a cFE file.
+*/
+static void FS_gz_deflate_header( uint8 *Out )
+{
+   uint32 HeaderCrc;
+
+   Out[0] = GZIP_MAGIC_0;
+   Out[1] = GZIP_MAGIC_1;
+   Out[2] = DEFLATED;
+   Out[3] = HEADER_CRC;
+   Out[4] = 0;
+   Out[5] = 0;
+   Out[6] = 0;
+   Out[7] = 0;
+   Out[8] = 4;
+   Out[9] = 255;
+
+   HeaderCrc = FS_gz_updcrc( 0, Out, 10 );
+   Out[10] = (uint8)HeaderCrc;
+   Out[11] = (uint8)( HeaderCrc >> 8 );
+}
+
+
+/*
+** Streaming API -- the caller owns the state, so none of these take a lock
+*/
+int32 CFE_FS_DeflateInit( CFE_FS_DeflateState_t *State )
+{
+   if ( State == NULL ) return CFE_FS_BAD_ARGUMENT;
+
+   State->BitBuf   = 0;
+   State->BitCount = 0;
+   State->Mode     = FS_GZ_DEFLATE_DATA;
+   State->WinBase  = 0;
+   State->HistLen  = 0;
+   State->InLen    = 0;
+   State->Crc      = 0;
+   State->TotalIn  = 0;
+
+   memset( State->Head, 0, sizeof(State->Head) );
+
+   /* the gzip header is the first output */
+   FS_gz_deflate_header( State->Out );
+
+   State->OutPos = 0;
+   State->OutEnd = FS_GZ_HEADER_BYTES;
+
+   return CFE_SUCCESS;
+}
+
+
+int32 CFE_FS_DeflateFeed( CFE_FS_DeflateState_t *State, const void *Data, uint32 Size )
+{
+   uint32 Room;
+
+   if ( State == NULL || Data == NULL ) return CFE_FS_BAD_ARGUMENT;
+   if ( State->Mode != FS_GZ_DEFLATE_DATA && State->Mode != FS_GZ_DEFLATE_FLUSH ) return CFE_FS_BAD_ARGUMENT;
+
+   Room = CFE_FS_DEFLATE_BLOCK_SIZE - State->InLen;
+   if ( Size > Room ) Size = Room;
+
+   memcpy( &State->Window[State->HistLen + State->InLen], Data, Size );
+   State->InLen   += Size;
+   State->Crc      = FS_gz_updcrc( State->Crc, Data, Size );
+   State->TotalIn += Size;
+
+   return (int32)Size;
+}
+
+
+int32 CFE_FS_DeflateFlush( CFE_FS_DeflateState_t *State )
+{
+   if ( State == NULL ) return CFE_FS_BAD_ARGUMENT;
+   if ( State->Mode != FS_GZ_DEFLATE_DATA && State->Mode != FS_GZ_DEFLATE_FLUSH ) return CFE_FS_BAD_ARGUMENT;
+
+   State->Mode = FS_GZ_DEFLATE_FLUSH;
+
+   return CFE_SUCCESS;
+}
+
+
+int32 CFE_FS_DeflateFinish( CFE_FS_DeflateState_t *State )
+{
+   if ( State == NULL ) return CFE_FS_BAD_ARGUMENT;
+
+   if ( State->Mode == FS_GZ_DEFLATE_DATA || State->Mode == FS_GZ_DEFLATE_FLUSH )
+   {
+      State->Mode = FS_GZ_DEFLATE_FINISH;
+   }
+
+   return CFE_SUCCESS;
+}
+
+
+int32 CFE_FS_DeflateDrain( CFE_FS_DeflateState_t *State, void *Buffer, uint32 Size )
+{
+   uint8  *Dest = Buffer;
+   uint32  Total = 0;
+   uint32  Count;
+
+   if ( State == NULL || Buffer == NULL ) return CFE_FS_BAD_ARGUMENT;
+
+   while ( Total < Size )
+   {
+      if ( State->OutPos == State->OutEnd )
+      {
+         if ( State->Mode == FS_GZ_DEFLATE_FINISH )
+         {
+            FS_gz_deflate_block( State, true );
+            State->Mode = FS_GZ_DEFLATE_DONE;
+         }
+         else if ( State->Mode != FS_GZ_DEFLATE_DONE && State->InLen == CFE_FS_DEFLATE_BLOCK_SIZE )
+         {
+            FS_gz_deflate_block( State, false );
+         }
+         else if ( State->Mode == FS_GZ_DEFLATE_FLUSH )
+         {
+            if ( State->InLen > 0 )
+            {
+               FS_gz_deflate_block( State, false );
+            }
+            else
+            {
+               State->OutPos = 0;
+               State->OutEnd = 0;
+            }
+            FS_gz_deflate_sync( State );
+            State->Mode = FS_GZ_DEFLATE_DATA;
+         }
+         else
+         {
+            break;
+         }
+      }
+
+      Count = State->OutEnd - State->OutPos;
+      if ( Count > Size - Total ) Count = Size - Total;
+
+      memcpy( &Dest[Total], &State->Out[State->OutPos], Count );
+      State->OutPos += Count;
+      Total         += Count;
+   }
+
+   return (int32)Total;
+}
+
+
+bool CFE_FS_DeflateFinished( const CFE_FS_DeflateState_t *State )
+{
+   return ( State != NULL && State->Mode == FS_GZ_DEFLATE_DONE && State->OutPos == State->OutEnd );
+}
+
+
+int32 CFE_FS_DeflateStored( void *Buffer, uint32 Size, const void *Data, uint32 Length )
+{
+   uint8  *Out = Buffer;
+   uint32  Crc;
+   uint32  o;
+
+   if ( Buffer == NULL || ( Data == NULL && Length > 0 ) ) return CFE_FS_BAD_ARGUMENT;
+   if ( Length > 0xFFFF || Size < CFE_FS_DEFLATE_STORED_SIZE( Length ) ) return CFE_FS_BAD_ARGUMENT;
+
+   /* header, one final stored block, then the CRC-32 and length */
+   FS_gz_deflate_header( Out );
+   o = FS_GZ_HEADER_BYTES;
+
+   Out[o++] = 1;
+   Out[o++] = (uint8)Length;
+   Out[o++] = (uint8)( Length >> 8 );
+   Out[o++] = (uint8)~Length;
+   Out[o++] = (uint8)( ~Length >> 8 );
+
+   memcpy( &Out[o], Data, Length );
+   o += Length;
+
+   Crc = FS_gz_updcrc( 0, Data, Length );
+   Out[o++] = (uint8)Crc;
+   Out[o++] = (uint8)( Crc >> 8 );
+   Out[o++] = (uint8)( Crc >> 16 );
+   Out[o++] = (uint8)( Crc >> 24 );
+   Out[o++] = (uint8)Length;
+   Out[o++] = (uint8)( Length >> 8 );
+   Out[o++] = 0;
+   Out[o++] = 0;
+
+   return (int32)o;
+}
+
+
+uint32 CFE_FS_DeflateBound( const CFE_FS_DeflateState_t *State, uint32 Size )
+{
+   uint32 Bound;
+   uint32 Pending;
+
+   if ( State == NULL ) return 0;
+
+   Bound = State->OutEnd - State->OutPos;
+
+   if ( State->Mode != FS_GZ_DEFLATE_DONE )
+   {
+      /*
+      ** Stored blocks for the rest, a byte of leftover bits and the trailer.
+      ** A flush on the way may split a block and adds an empty stored block.
+      */
+      Pending = State->InLen + Size;
+      Bound  += Pending + ( Pending / CFE_FS_DEFLATE_BLOCK_SIZE + 3 ) * FS_GZ_STORED_BYTES +
+                1 + FS_GZ_TRAILER_BYTES;
+   }
+
+   return Bound;
+}
+
+
+/*
+** Parse the pending input into literals and matches, counting the symbol
+** frequencies and the extra bits the matches will need.  Each symbol is
+** the literal or match length in the upper half word and the distance,
+** zero for a literal, in the lower one.  Returns the number of symbols.
+*/
+uint32 FS_gz_deflate_parse( CFE_FS_DeflateState_t *State, uint32 * LitFreq, uint32 * DistFreq, uint32 * ExtraBits )
+{
+   const uint8 *Win   = State->Window;
+   uint32      *Head  = State->Head;
+   uint32      *Syms  = State->Syms;
+   uint32       Base  = State->WinBase;
+   uint32       p     = State->HistLen;
+   uint32       End   = State->HistLen + State->InLen;
+   uint32       n     = 0;
+   uint32       Extra = 0;
+   uint32       h;
+   uint32       q;
+   uint32       Dist  = 0;
+   uint32       Len;
+   uint32       MaxLen;
+   uint32       c;
+   uint32       d;
+
+   while ( p < End )
+   {
+      Len = 0;
+
+      if ( End - p >= MIN_MATCH )
+      {
+         /*
+         ** The hash holds stream positions, so a candidate is in the window
+         ** when its distance is no more than p.  A stale one only costs the
+         ** compare.
+         */
+         h       = HASH( &Win[p] );
+         Dist    = Base + p - Head[h];
+         Head[h] = Base + p;
+
+         if ( Dist >= 1 && Dist <= p &&
+              Win[p - Dist]     == Win[p]     && Win[p - Dist + 1] == Win[p + 1] &&
+              Win[p - Dist + 2] == Win[p + 2] && Win[p - Dist + 3] == Win[p + 3] )
+         {
+            MaxLen = End - p;
+            if ( MaxLen > MAX_MATCH ) MaxLen = MAX_MATCH;
+
+            Len = MIN_MATCH;
+            while ( Len < MaxLen && Win[p - Dist + Len] == Win[p + Len] ) Len++;
+         }
+      }
+
+      if ( Len >= MIN_MATCH )
+      {
+         c = FS_gz_LenCode[Len - 3];
+         d = DISTCODE( Dist );
+         LitFreq[257 + c]++;
+         DistFreq[d]++;
+         Extra += FS_gz_LenExtra[c] + FS_gz_DistExtra[d];
+         Syms[n++] = ( Len << 16 ) | Dist;
+
+         /* hash the strings inside the match too, later data may refer to them */
+         for ( q = p + 1; q < p + Len && End - q >= MIN_MATCH; q++ )
+         {
+            Head[HASH( &Win[q] )] = Base + q;
+         }
+
+         p += Len;
+      }
+      else
+      {
+         LitFreq[Win[p]]++;
+         Syms[n++] = (uint32)Win[p] << 16;
+         p++;
+      }
+   }
+
+   *ExtraBits = Extra;
+   return n;
+}
+
+
+/*
+** Code lengths, no longer than MaxBits, for the given symbol frequencies.
+** The lengths are those of a minimum redundancy code, found in place with
+** the method of Moffat and Katajainen.  When some are too long, the
+** shortest codes are lengthened until the code fits again.
+*/
+void FS_gz_deflate_lengths( const uint32 * Freq, uint32 NumSyms, uint32 MaxBits, uint8 * Lens )
+{
+   uint16 Sym[LITLEN_CODES];        /* used symbols by increasing frequency        */
+   int32  A[LITLEN_CODES];          /* their frequencies, then tree links, depths */
+   uint32 Count[MAX_CODE_BITS + 1];
+   uint32 Total;
+   uint32 Len;
+   uint32 i;
+   uint32 j;
+   int32  n = 0;
+   int32  root;
+   int32  leaf;
+   int32  next;
+   int32  avbl;
+   int32  used;
+   int32  dpth;
+   bool   Over = false;
+
+   memset( Lens, 0, NumSyms );
+   memset( Count, 0, sizeof(Count) );
+
+   for ( i = 0; i < NumSyms; i++ )
+   {
+      if ( Freq[i] == 0 ) continue;
+
+      for ( j = n; j > 0 && (uint32)A[j - 1] > Freq[i]; j-- )
+      {
+         A[j]   = A[j - 1];
+         Sym[j] = Sym[j - 1];
+      }
+      A[j]   = Freq[i];
+      Sym[j] = i;
+      n++;
+   }
+
+   if ( n == 0 ) return;
+   if ( n == 1 )
+   {
+      Lens[Sym[0]] = 1;
+      return;
+   }
+
+   /* first pass, left to right, setting parent pointers */
+   A[0] += A[1];
+   root  = 0;
+   leaf  = 2;
+   for ( next = 1; next < n - 1; next++ )
+   {
+      if ( leaf >= n || A[root] < A[leaf] )
+      {
+         A[next]   = A[root];
+         A[root++] = next;
+      }
+      else
+      {
+         A[next] = A[leaf++];
+      }
+
+      if ( leaf >= n || ( root < next && A[root] < A[leaf] ) )
+      {
+         A[next]  += A[root];
+         A[root++] = next;
+      }
+      else
+      {
+         A[next] += A[leaf++];
+      }
+   }
+
+   /* second pass, right to left, setting internal depths */
+   A[n - 2] = 0;
+   for ( next = n - 3; next >= 0; next-- )
+   {
+      A[next] = A[A[next]] + 1;
+   }
+
+   /* third pass, right to left, setting leaf depths */
+   avbl = 1;
+   used = 0;
+   dpth = 0;
+   root = n - 2;
+   next = n - 1;
+   while ( avbl > 0 )
+   {
+      while ( root >= 0 && A[root] == dpth )
+      {
+         used++;
+         root--;
+      }
+      while ( avbl > used )
+      {
+         A[next--] = dpth;
+         avbl--;
+      }
+      avbl = 2 * used;
+      dpth++;
+      used = 0;
+   }
+
+   for ( j = 0; j < (uint32)n; j++ )
+   {
+      if ( (uint32)A[j] > MaxBits )
+      {
+         Count[MaxBits]++;
+         Over = true;
+      }
+      else
+      {
+         Count[A[j]]++;
+      }
+   }
+
+   if ( Over )
+   {
+      /*
+      ** Clipping made the code oversubscribed.  Each step turns a leaf at
+      ** the longest length and one at a shorter length into two leaves one
+      ** longer, taking one unit off the Kraft sum.
+      */
+      Total = 0;
+      for ( Len = MaxBits; Len > 0; Len-- )
+      {
+         Total += Count[Len] << ( MaxBits - Len );
+      }
+
+      while ( Total != ( 1U << MaxBits ) )
+      {
+         Count[MaxBits]--;
+         for ( Len = MaxBits - 1; Len > 0; Len-- )
+         {
+            if ( Count[Len] != 0 )
+            {
+               Count[Len]--;
+               Count[Len + 1] += 2;
+               break;
+            }
+         }
+         Total--;
+      }
+   }
+
+   /* the least frequent symbols get the longest codes */
+   j = 0;
+   for ( Len = MaxBits; Len > 0; Len-- )
+   {
+      for ( i = 0; i < Count[Len]; i++ )
+      {
+         Lens[Sym[j++]] = Len;
+      }
+   }
+}
+
+
+/*
+** Canonical codes for the given code lengths, bit reversed because deflate
+** sends codes from their most significant bit and the bit buffer is filled
+** from its least significant one.
+*/
+void FS_gz_deflate_codes( const uint8 * Lens, uint32 NumSyms, uint16 * Codes )
+{
+   uint32 Count[MAX_CODE_BITS + 1];
+   uint32 Next[MAX_CODE_BITS + 1];
+   uint32 Code = 0;
+   uint32 Rev;
+   uint32 Len;
+   uint32 i;
+   uint32 j;
+
+   memset( Count, 0, sizeof(Count) );
+   for ( i = 0; i < NumSyms; i++ )
+   {
+      Count[Lens[i]]++;
+   }
+   Count[0] = 0;
+
+   for ( Len = 1; Len <= MAX_CODE_BITS; Len++ )
+   {
+      Code      = ( Code + Count[Len - 1] ) << 1;
+      Next[Len] = Code;
+   }
+
+   for ( i = 0; i < NumSyms; i++ )
+   {
+      Len = Lens[i];
+      if ( Len == 0 ) continue;
+
+      Code = Next[Len]++;
+      Rev  = 0;
+      for ( j = 0; j < Len; j++ )
+      {
+         Rev    = ( Rev << 1 ) | ( Code & 1 );
+         Code >>= 1;
+      }
+      Codes[i] = (uint16)Rev;
+   }
+}
+
+
+/*
+** Give a code two used symbols at least, as a complete code needs them.
+** The added symbols are never sent.
+*/
+static void FS_gz_deflate_pad_freq( uint32 * Freq, uint32 NumSyms )
+{
+   uint32 Used = 0;
+   uint32 i;
+
+   for ( i = 0; i < NumSyms; i++ )
+   {
+      if ( Freq[i] != 0 ) Used++;
+   }
+
+   for ( i = 0; i < NumSyms && Used < 2; i++ )
+   {
+      if ( Freq[i] == 0 )
+      {
+         Freq[i] = 1;
+         Used++;
+      }
+   }
+}
+
+
+/*
+** Run length code the code lengths of a dynamic block with the code length
+** symbols 16 (repeat the last length), 17 and 18 (repeat zero), counting the
+** symbol frequencies.  Returns the number of code length symbols.
+*/
+static uint32 FS_gz_deflate_rle( const uint8 * Lens, uint32 NumLens, uint8 * Rle, uint8 * RleExtra, uint32 * PreFreq )
+{
+   uint32 n = 0;
+   uint32 i = 0;
+   uint32 Run;
+   uint32 r;
+
+   while ( i < NumLens )
+   {
+      for ( Run = 1; i + Run < NumLens && Lens[i + Run] == Lens[i]; Run++ );
+
+      if ( Lens[i] == 0 && Run >= 3 )
+      {
+         r = ( Run > 138 ) ? 138 : Run;
+         Rle[n]      = ( r >= 11 ) ? 18 : 17;
+         RleExtra[n] = ( r >= 11 ) ? r - 11 : r - 3;
+      }
+      else if ( Lens[i] != 0 && Run >= 4 )
+      {
+         /* the length itself, then up to six repeats of it */
+         Rle[n]      = Lens[i];
+         RleExtra[n] = 0;
+         PreFreq[Lens[i]]++;
+         n++;
+
+         r = ( Run > 7 ) ? 7 : Run;
+         Rle[n]      = 16;
+         RleExtra[n] = r - 4;
+      }
+      else
+      {
+         r = 1;
+         Rle[n]      = Lens[i];
+         RleExtra[n] = 0;
+      }
+
+      PreFreq[Rle[n]]++;
+      n++;
+      i += r;
+   }
+
+   return n;
+}
+
+
+/*
+** Compress the pending input into Out as one deflate block, followed by
+** the gzip trailer when it is the final block, then keep the end of the
+** input as history for the next block.
+*/
+void FS_gz_deflate_block( CFE_FS_DeflateState_t *State, bool Final )
+{
+   uint32  LitFreq[LITLEN_CODES];
+   uint32  DistFreq[DIST_CODES];
+   uint32  PreFreq[PRECODE_CODES];
+   uint8   LitLens[FIXED_CODES];
+   uint8   DistLens[DIST_CODES];
+   uint8   PreLens[PRECODE_CODES];
+   uint16  LitCodes[FIXED_CODES];
+   uint16  DistCodes[DIST_CODES];
+   uint16  PreCodes[PRECODE_CODES];
+   uint8   AllLens[LITLEN_CODES + DIST_CODES];
+   uint8   Rle[LITLEN_CODES + DIST_CODES];
+   uint8   RleExtra[LITLEN_CODES + DIST_CODES];
+   uint8  *Out = State->Out;
+   uint64  b   = State->BitBuf;
+   uint32  k   = State->BitCount;
+   uint32  o   = 0;
+   uint32  NumSyms;
+   uint32  NumLit;
+   uint32  NumDist;
+   uint32  NumPre;
+   uint32  NumRle;
+   uint32  ExtraBits;
+   uint32  DynBits;
+   uint32  FixBits;
+   uint32  StoredBits;
+   uint32  Sym;
+   uint32  Len;
+   uint32  Dist;
+   uint32  Total;
+   uint32  c;
+   uint32  i;
+
+   memset( LitFreq, 0, sizeof(LitFreq) );
+   memset( DistFreq, 0, sizeof(DistFreq) );
+   memset( PreFreq, 0, sizeof(PreFreq) );
+
+   NumSyms = FS_gz_deflate_parse( State, LitFreq, DistFreq, &ExtraBits );
+   LitFreq[END_OF_BLOCK] = 1;
+
+   /*
+   ** Dynamic codes for this block.  The padded frequencies only make the
+   ** size estimate a little high.
+   */
+   FS_gz_deflate_pad_freq( LitFreq, LITLEN_CODES );
+   FS_gz_deflate_pad_freq( DistFreq, DIST_CODES );
+   FS_gz_deflate_lengths( LitFreq, LITLEN_CODES, MAX_CODE_BITS, LitLens );
+   FS_gz_deflate_lengths( DistFreq, DIST_CODES, MAX_CODE_BITS, DistLens );
+
+   for ( NumLit = LITLEN_CODES; NumLit > 257 && LitLens[NumLit - 1] == 0; NumLit-- );
+   for ( NumDist = DIST_CODES; NumDist > 1 && DistLens[NumDist - 1] == 0; NumDist-- );
+
+   memcpy( AllLens, LitLens, NumLit );
+   memcpy( &AllLens[NumLit], DistLens, NumDist );
+   NumRle = FS_gz_deflate_rle( AllLens, NumLit + NumDist, Rle, RleExtra, PreFreq );
+
+   FS_gz_deflate_pad_freq( PreFreq, PRECODE_CODES );
+   FS_gz_deflate_lengths( PreFreq, PRECODE_CODES, PRECODE_BITS, PreLens );
+
+   for ( NumPre = PRECODE_CODES; NumPre > 4 && PreLens[FS_gz_PrecodeOrder[NumPre - 1]] == 0; NumPre-- );
+
+   /*
+   ** Size in bits of the block each way
+   */
+   DynBits = 3 + 5 + 5 + 4 + 3 * NumPre + ExtraBits +
+             2 * PreFreq[16] + 3 * PreFreq[17] + 7 * PreFreq[18];
+   FixBits = 3 + ExtraBits;
+
+   for ( i = 0; i < PRECODE_CODES; i++ )
+   {
+      DynBits += PreFreq[i] * PreLens[i];
+   }
+   for ( i = 0; i < LITLEN_CODES; i++ )
+   {
+      DynBits += LitFreq[i] * LitLens[i];
+      FixBits += LitFreq[i] * ( ( i < 144 ) ? 8 : ( i < 256 ) ? 9 : ( i < 280 ) ? 7 : 8 );
+   }
+   for ( i = 0; i < DIST_CODES; i++ )
+   {
+      DynBits += DistFreq[i] * DistLens[i];
+      FixBits += DistFreq[i] * 5;
+   }
+
+   StoredBits = 3 + ( ( 8 - ( ( k + 3 ) & 7 ) ) & 7 ) + 32 + 8 * State->InLen;
+
+   if ( StoredBits <= DynBits && StoredBits <= FixBits )
+   {
+      /* stored block: header bits, byte boundary, length and its complement */
+      PUTBITS( Final, 1 );
+      PUTBITS( 0, 2 );
+      PUTBITS( 0, ( 8 - ( k & 7 ) ) & 7 );
+      while ( k > 0 )
+      {
+         Out[o++] = (uint8)b;
+         b >>= 8;
+         k  -= 8;
+      }
+
+      Out[o++] = (uint8)State->InLen;
+      Out[o++] = (uint8)( State->InLen >> 8 );
+      Out[o++] = (uint8)~State->InLen;
+      Out[o++] = (uint8)( ~State->InLen >> 8 );
+
+      memcpy( &Out[o], &State->Window[State->HistLen], State->InLen );
+      o += State->InLen;
+   }
+   else
+   {
+      if ( DynBits < FixBits )
+      {
+         FS_gz_deflate_codes( LitLens, LITLEN_CODES, LitCodes );
+         FS_gz_deflate_codes( DistLens, DIST_CODES, DistCodes );
+         FS_gz_deflate_codes( PreLens, PRECODE_CODES, PreCodes );
+
+         PUTBITS( Final, 1 );
+         PUTBITS( 2, 2 );
+         PUTBITS( NumLit - 257, 5 );
+         PUTBITS( NumDist - 1, 5 );
+         PUTBITS( NumPre - 4, 4 );
+         FLUSHBITS();
+
+         for ( i = 0; i < NumPre; i++ )
+         {
+            PUTBITS( PreLens[FS_gz_PrecodeOrder[i]], 3 );
+            FLUSHBITS();
+         }
+
+         for ( i = 0; i < NumRle; i++ )
+         {
+            c = Rle[i];
+            PUTBITS( PreCodes[c], PreLens[c] );
+            if ( c == 16 )      PUTBITS( RleExtra[i], 2 )
+            else if ( c == 17 ) PUTBITS( RleExtra[i], 3 )
+            else if ( c == 18 ) PUTBITS( RleExtra[i], 7 )
+            FLUSHBITS();
+         }
+      }
+      else
+      {
+         /* the fixed code of RFC 1951 section 3.2.6 */
+         for ( i = 0; i < FIXED_CODES; i++ )
+         {
+            LitLens[i] = ( i < 144 ) ? 8 : ( i < 256 ) ? 9 : ( i < 280 ) ? 7 : 8;
+         }
+         memset( DistLens, 5, sizeof(DistLens) );
+
+         FS_gz_deflate_codes( LitLens, FIXED_CODES, LitCodes );
+         FS_gz_deflate_codes( DistLens, DIST_CODES, DistCodes );
+
+         PUTBITS( Final, 1 );
+         PUTBITS( 1, 2 );
+      }
+
+      for ( i = 0; i < NumSyms; i++ )
+      {
+         Sym  = State->Syms[i];
+         Dist = Sym & 0xFFFF;
+
+         if ( Dist == 0 )
+         {
+            c = Sym >> 16;
+            PUTBITS( LitCodes[c], LitLens[c] );
+         }
+         else
+         {
+            Len = Sym >> 16;
+            c   = FS_gz_LenCode[Len - 3];
+            PUTBITS( LitCodes[257 + c], LitLens[257 + c] );
+            PUTBITS( Len - FS_gz_LenBase[c], FS_gz_LenExtra[c] );
+            FLUSHBITS();
+
+            c = DISTCODE( Dist );
+            PUTBITS( DistCodes[c], DistLens[c] );
+            PUTBITS( Dist - FS_gz_DistBase[c], FS_gz_DistExtra[c] );
+         }
+         FLUSHBITS();
+      }
+
+      PUTBITS( LitCodes[END_OF_BLOCK], LitLens[END_OF_BLOCK] );
+   }
+
+   if ( Final )
+   {
+      /* byte boundary, then the CRC-32 and length of the input */
+      PUTBITS( 0, ( 8 - ( k & 7 ) ) & 7 );
+      while ( k > 0 )
+      {
+         Out[o++] = (uint8)b;
+         b >>= 8;
+         k  -= 8;
+      }
+
+      Out[o++] = (uint8)State->Crc;
+      Out[o++] = (uint8)( State->Crc >> 8 );
+      Out[o++] = (uint8)( State->Crc >> 16 );
+      Out[o++] = (uint8)( State->Crc >> 24 );
+      Out[o++] = (uint8)State->TotalIn;
+      Out[o++] = (uint8)( State->TotalIn >> 8 );
+      Out[o++] = (uint8)( State->TotalIn >> 16 );
+      Out[o++] = (uint8)( State->TotalIn >> 24 );
+   }
+   else
+   {
+      /* whole bytes go out now, the odd bits start the next block */
+      while ( k >= 8 )
+      {
+         Out[o++] = (uint8)b;
+         b >>= 8;
+         k  -= 8;
+      }
+   }
+
+   State->BitBuf   = b;
+   State->BitCount = k;
+   State->OutPos   = 0;
+   State->OutEnd   = o;
+
+   /*
+   ** Keep the last WINDOW_SIZE bytes as history for the next block
+   */
+   Total = State->HistLen + State->InLen;
+   if ( Total > CFE_FS_DEFLATE_WINDOW_SIZE )
+   {
+      memmove( State->Window, &State->Window[Total - CFE_FS_DEFLATE_WINDOW_SIZE], CFE_FS_DEFLATE_WINDOW_SIZE );
+      State->WinBase += Total - CFE_FS_DEFLATE_WINDOW_SIZE;
+      State->HistLen  = CFE_FS_DEFLATE_WINDOW_SIZE;
+   }
+   else
+   {
+      State->HistLen = Total;
+   }
+   State->InLen = 0;
+}
+
+
+/*
+** Append an empty stored block after the compressed bytes in Out.  It ends
+** on a byte boundary, so everything fed so far can be decompressed from
+** the output without the rest of the stream.
+*/
+void FS_gz_deflate_sync( CFE_FS_DeflateState_t *State )
+{
+   uint8  *Out = State->Out;
+   uint64  b   = State->BitBuf;
+   uint32  k   = State->BitCount;
+   uint32  o   = State->OutEnd;
+
+   PUTBITS( 0, 3 );
+   PUTBITS( 0, ( 8 - ( k & 7 ) ) & 7 );
+   while ( k > 0 )
+   {
+      Out[o++] = (uint8)b;
+      b >>= 8;
+      k  -= 8;
+   }
+
+   Out[o++] = 0x00;
+   Out[o++] = 0x00;
+   Out[o++] = 0xFF;
+   Out[o++] = 0xFF;
+
+   State->BitBuf   = 0;
+   State->BitCount = 0;
+   State->OutEnd   = o;
+}
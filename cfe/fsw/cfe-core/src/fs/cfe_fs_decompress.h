@@ -34,6 +34,9 @@
 ** that effect with your name and the date.  Thank you. [The history has been
 ** moved to the file ChangeLog.]
 **
+** Modified: the inflater was rewritten as a resumable, table driven decoder
+** with a 64 bit bit buffer behind the streaming CFE_FS_Inflate API.
+**
 */
 
 #ifndef CFE_FS_decompress_H
@@ -42,114 +45,153 @@
 #include "cfe.h"
 #include "cfe_fs_priv.h"
 
-#include <sys/types.h>
-#include <unistd.h>
-#include <stdlib.h>
 #include <string.h>
-#include <stdio.h>
 
 /*
 ** Defines
 */
 #define SH2(p) ((uint16)(uint8)((p)[0]) | ((uint16)(uint8)((p)[1]) << 8))
 #define LG(p) ((uint32)(SH2(p)) | ((uint32)(SH2((p)+2)) << 16))
-#define NEXTBYTE()  (uint8)( State->inptr < State->insize ? State->inbuf[State->inptr++] : FS_gz_fill_inbuf_Reentrant(State) )
-#define DUMPBITS(n) { b>>=(n); k-=(n); }
-#define NEEDBITS(n) {								\
-	while(  k < (n)  )	{								\
-		b |= ( (uint32)NEXTBYTE() ) << k;				\
-		if ( State->Error != CFE_SUCCESS ) return State->Error;	\
-		k += 8;									\
-	}											\
+#define NEEDBITS(n) {                                         \
+   while ( k < (n) ) {                                        \
+      if ( p >= InEnd ) goto NeedInput;                       \
+      b |= (uint64)In[p++] << k;                              \
+      k += 8;                                                 \
+   }                                                          \
 }
-#define BMAX 16
-#define N_MAX 288
-#define WSIZE 0x8000
-#define WSIZE_X2 0x10000L
-#define INBUFSIZ 0x8000
-#define INBUFSIZ_EXTRA 0x8040
-#define OUTBUFSIZ_EXTRA 0x4800
-#define MAX_HUF_TABLES 1000
-#define EXTHDR 16
+#define DUMPBITS(n) { b >>= (n); k -= (n); }
+#define MASKBITS(n) ((uint32)b & ((1U << (n)) - 1))
+#define WSIZE CFE_FS_INFLATE_WINDOW_SIZE
+#define MAX_MATCH 258               /* longest match, the fast path needs this much window */
+#define MAX_CODE_BITS 15            /* longest Huffman code                                 */
+#define LITLEN_ROOT_BITS 11         /* bits decoded by the first literal/length lookup      */
+#define DIST_ROOT_BITS 8            /* bits decoded by the first distance lookup            */
+#define PRECODE_ROOT_BITS 7         /* code length codes are at most 7 bits long            */
+
+/*
+** Decode table entries -- each uint32 holds the code length in bits 0-4,
+** the entry type in bits 5-7, the extra bits (or the subtable index bits)
+** in bits 8-15 and the literal, base value (or subtable offset) in bits 16-31.
+** Subtable entries hold the full code length.  A zero type is an invalid code.
+*/
+#define FS_GZ_ENTRY_LEN(e)    ((e) & 0x1F)
+#define FS_GZ_ENTRY_TYPE(e)   ((e) & 0xE0)
+#define FS_GZ_ENTRY_EXTRA(e)  (((e) >> 8) & 0xFF)
+#define FS_GZ_ENTRY_VALUE(e)  ((e) >> 16)
+
+#define FS_GZ_TYPE_INVALID    0x00
+#define FS_GZ_TYPE_LITERAL    0x20  /* literal byte, or code length symbol */
+#define FS_GZ_TYPE_BASE       0x40  /* length or distance base plus extra bits */
+#define FS_GZ_TYPE_EOB        0x60  /* end of block */
+#define FS_GZ_TYPE_SUB        0x80  /* link to a subtable for codes longer than the root */
+
+/*
+** Kinds of Huffman code, which give the meaning of each symbol
+*/
+#define FS_GZ_CODE_LITLEN     0     /* literals, end of block and length bases */
+#define FS_GZ_CODE_DIST       1     /* distance bases                          */
+#define FS_GZ_CODE_PRECODE    2     /* code length symbols of a dynamic block  */
+
+/*
+** Decoder modes, in stream order
+*/
+#define FS_GZ_MODE_HEADER     0     /* fixed 10 byte gzip header  */
+#define FS_GZ_MODE_EXTRA_LEN  1     /* length of the extra field  */
+#define FS_GZ_MODE_EXTRA      2     /* extra field                */
+#define FS_GZ_MODE_NAME       3     /* original file name         */
+#define FS_GZ_MODE_COMMENT    4     /* file comment               */
+#define FS_GZ_MODE_HCRC       5     /* header CRC-16              */
+#define FS_GZ_MODE_BLOCK      6     /* deflate block header       */
+#define FS_GZ_MODE_STORED     7     /* stored block data          */
+#define FS_GZ_MODE_CODES      8     /* Huffman coded block data   */
+#define FS_GZ_MODE_TRAILER    9     /* CRC-32 and length          */
+#define FS_GZ_MODE_CHECK      10    /* trailer read, check it once all is drained */
+#define FS_GZ_MODE_DONE       11
+
+/*
+** Internal (positive) results of FS_gz_inflate_Reentrant
+*/
+#define FS_GZ_NEED_INPUT      1
+#define FS_GZ_OUTPUT_FULL     2
 
 /*
 ** Gzip header information
 */
-#define GZIP_MAGIC     "\037\213"   /* Magic header for gzip files, 1F 8B              */
-#define OLD_GZIP_MAGIC "\037\236"   /* Magic header for gzip 0.5 = freeze 1.x          */
+#define GZIP_MAGIC_0   0x1F         /* Magic header for gzip files, 1F 8B              */
+#define GZIP_MAGIC_1   0x8B
+#define OLD_GZIP_MAGIC_1 0x9E       /* Magic header for gzip 0.5 = freeze 1.x, 1F 9E   */
+#define DEFLATED       8            /* the only compression method                     */
 
-#define CONTINUATION   0x02         /* bit 1 set: continuation of multi-part gzip file */
+#define HEADER_CRC     0x02         /* bit 1 set: header CRC-16 present                */
 #define EXTRA_FIELD    0x04         /* bit 2 set: extra field present                  */
 #define ORIG_NAME      0x08         /* bit 3 set: original file name present           */
 #define COMMENT        0x10         /* bit 4 set: file comment present                 */
-#define ENCRYPTED      0x20         /* bit 5 set: file is encrypted                    */
-#define RESERVED       0xC0         /* bit 6,7:   reserved                             */
 
 
 /*
-** Typedefs
+** Compressor modes, in stream order
 */
-typedef struct
-{
-   uint16 n;
-   uint16 t;
-   
-} HufTableV;
+#define FS_GZ_DEFLATE_DATA    0     /* taking input                      */
+#define FS_GZ_DEFLATE_FLUSH   1     /* taking input, sync block not made */
+#define FS_GZ_DEFLATE_FINISH  2     /* input ended, last block not made  */
+#define FS_GZ_DEFLATE_DONE    3     /* last block and trailer made       */
 
-typedef struct
-{
-   uint8     e;
-   uint8     b;
-   HufTableV v;
-   
-} HufTable;
+#define FS_GZ_HEADER_BYTES    12    /* compressor gzip header, with its CRC-16 */
+#define FS_GZ_TRAILER_BYTES   8     /* CRC-32 and length                       */
+#define FS_GZ_STORED_BYTES    5     /* worst case stored block header, padding included */
 
+
+/*
+** Typedefs
+*/
 typedef struct
 {
-   int        srcFile_fd;
-   int        dstFile_fd;
+   int32      srcFile_fd;
+   int32      dstFile_fd;
 
-   uint32     bb;
-   uint32     bk;
-   uint32     outcnt;
-   uint32     insize;
-   uint32     inptr;
-   int32      bytes_in;
-   int32      bytes_out;
+   CFE_FS_DecompressSink_t SinkFunc;   /* receives the output instead of dstFile_fd when set */
+   void                   *SinkArg;
 
-   int32      Error;
+   CFE_FS_InflateState_t   Inflate;
 
-   uint8      inbuf[ INBUFSIZ_EXTRA ];
-   uint8      outbuf[ OUTBUFSIZ_EXTRA ];
-   uint8      window[ WSIZE_X2 ];
-   uint32     hufts;
-   uint32     max_hufts;
-
-   HufTable   hufTable[ MAX_HUF_TABLES ];
+   uint8      inbuf[ CFE_FS_INFLATE_INPUT_SIZE ];
 
 } CFE_FS_Decompress_State_t;
 
 
+/*
+** Deflate code tables (RFC 1951)
+*/
+extern const uint16 FS_gz_LenBase[29];
+extern const uint8  FS_gz_LenExtra[29];
+extern const uint16 FS_gz_DistBase[30];
+extern const uint8  FS_gz_DistExtra[30];
+extern const uint8  FS_gz_PrecodeOrder[19];
+
+
 /*
 ** Function Prototypes
 */
-uint32 FS_gz_updcrc( uint8 * s, uint32 n );
+uint32 FS_gz_updcrc( uint32 crc, const uint8 * s, uint32 n );
+int32  FS_gz_find_member( const uint8 * Buf, uint32 Len );
 /*
  * Reentrant versions of all gz functions
  */
 int32 CFE_FS_Decompress_Reentrant(CFE_FS_Decompress_State_t *State, const char * srcFileName, const char * dstFileName );
-void   FS_gz_clear_bufs_Reentrant( CFE_FS_Decompress_State_t *State );
-int32  FS_gz_eat_header_Reentrant( CFE_FS_Decompress_State_t *State );
-int16  FS_gz_fill_inbuf_Reentrant( CFE_FS_Decompress_State_t *State );
-void   FS_gz_flush_window_Reentrant( CFE_FS_Decompress_State_t *State );
-int32  FS_gz_huft_build_Reentrant( CFE_FS_Decompress_State_t *State, uint32 * b, uint32 n, uint32 s, uint16 * d, uint16 * e, int32 * m );
-int32  FS_gz_inflate_Reentrant( CFE_FS_Decompress_State_t *State );
-int32  FS_gz_inflate_block_Reentrant( CFE_FS_Decompress_State_t *State, int32 * e );
-int32  FS_gz_inflate_codes_Reentrant( CFE_FS_Decompress_State_t *State, HufTable * tl, HufTable * td, int32 bl, int32 bd );
-int32  FS_gz_inflate_dynamic_Reentrant( CFE_FS_Decompress_State_t *State );
-int32  FS_gz_inflate_fixed_Reentrant( CFE_FS_Decompress_State_t *State );
-int32  FS_gz_inflate_stored_Reentrant( CFE_FS_Decompress_State_t *State );
+int32 CFE_FS_DecompressToSink_Reentrant(CFE_FS_Decompress_State_t *State, const char * srcFileName, CFE_FS_DecompressSink_t SinkFunc, void *SinkArg );
+int32  FS_gz_build_table( uint32 * Table, uint32 TableSize, uint32 RootBits, const uint8 * Lens, uint32 NumSyms, uint32 Kind );
+int32  FS_gz_inflate_dynamic_Reentrant( CFE_FS_InflateState_t *State );
+int32  FS_gz_inflate_Reentrant( CFE_FS_InflateState_t *State );
+int32  FS_gz_inflate_next( CFE_FS_InflateState_t *State, uint32 MaxSize, const uint8 ** Data );
 int32  FS_gz_unzip_Reentrant( CFE_FS_Decompress_State_t *State );
+/*
+ * Compressor, in cfe_fs_compress.c
+ */
+uint32 FS_gz_deflate_parse( CFE_FS_DeflateState_t *State, uint32 * LitFreq, uint32 * DistFreq, uint32 * ExtraBits );
+void   FS_gz_deflate_lengths( const uint32 * Freq, uint32 NumSyms, uint32 MaxBits, uint8 * Lens );
+void   FS_gz_deflate_codes( const uint8 * Lens, uint32 NumSyms, uint16 * Codes );
+void   FS_gz_deflate_block( CFE_FS_DeflateState_t *State, bool Final );
+void   FS_gz_deflate_sync( CFE_FS_DeflateState_t *State );
 
 
 #endif /* CFE_FS_decompress_H */
@@ -623,6 +623,13 @@
 */
 #define CFE_FS_GZIP_NON_ZIP_FILE        ((int32)0xc600000F)
 
+/*
+** The file to be decompressed ended before its GZIP trailer, as a file
+** that was being written when it was cut off does.  The data restored
+** up to that point is kept.
+*/
+#define CFE_FS_GZIP_TRUNCATED           ((int32)0xc6000010)
+
 /**
 **  Current version of cFE does not have the function or the feature
 **  of the function implemented.  This could be due to either an early
@@ -287,6 +287,10 @@ typedef struct
                                                         \brief Number of bytes never allocated to a block */
     CFE_ES_BlockStats_t   BlockStats[CFE_ES_MAX_MEMPOOL_BLOCK_SIZES]; /**< \cfetlmmnemonic \ES_BLKSTATS
                                                                            \brief Contains stats on each block size */
+    uint32                CacheHits;               /**< \cfetlmmnemonic \ES_CACHEHITS
+                                                        \brief Number of allocations and releases served by a task cache */
+    uint32                CacheMisses;             /**< \cfetlmmnemonic \ES_CACHEMISSES
+                                                        \brief Number of allocations and releases that needed the pool lock */
 } CFE_ES_MemPoolStats_t;
 
 /*
@@ -744,6 +748,44 @@ int32 CFE_ES_GetAppName(char *AppName, uint32 AppId, uint32 BufferLength);
 ******************************************************************************/
 int32 CFE_ES_GetAppInfo(CFE_ES_AppInfo_t *AppInfo, uint32 AppId);
 
+/*****************************************************************************/
+/**
+** \brief Get the Execution Counter of an Application given a specified App ID
+**
+** \par Description
+**        This routine retrieves the execution counter of an App's main task,
+**        the same value reported in the \c ExecutionCounter field of
+**        #CFE_ES_AppInfo_t, without copying the rest of the App information.
+**        It also returns the generation of the App, which changes whenever the
+**        App ID is reused (e.g. when the App is restarted or reloaded).
+**
+** \par Assumptions, External Events, and Notes:
+**        Where the compiler provides a memory barrier the counter is read
+**        without taking the ES shared data lock, so it is cheap enough to poll
+**        every cycle.  Callers that resolved the App ID by name should resolve
+**        it again when the generation changes or this call fails.
+**
+** \param[in]   AppId             Application ID of Application whose counter is being requested.
+**
+** \param[in]   ExecutionCounter  Pointer to a \c uint32 that receives the execution counter.
+**
+** \param[in]   Generation        Pointer to a \c uint32 that receives the App generation.
+**
+** \param[out]  *ExecutionCounter The execution counter of the App's main task.
+**
+** \param[out]  *Generation       The generation of the App the counter was read from.
+**
+** \returns
+** \retcode #CFE_SUCCESS         \retdesc \copydoc CFE_SUCCESS         \endcode
+** \retcode #CFE_ES_ERR_APPID    \retdesc \copydoc CFE_ES_ERR_APPID    \endcode
+** \retcode #CFE_ES_ERR_BUFFER   \retdesc \copydoc CFE_ES_ERR_BUFFER   \endcode
+** \endreturns
+**
+** \sa #CFE_ES_GetAppIDByName, #CFE_ES_GetAppInfo
+**
+******************************************************************************/
+int32 CFE_ES_GetAppExecCounter(uint32 AppId, uint32 *ExecutionCounter, uint32 *Generation);
+
 /*****************************************************************************/
 /**
 ** \brief Get Task Information given a specified Task ID
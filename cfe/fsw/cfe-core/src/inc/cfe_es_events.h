@@ -43,7 +43,7 @@
 ** and when you're done adding, set this to the highest EID you used. It may
 ** be worthwhile to, on occasion, re-number the EID's to put them back in order.
 */
-#define CFE_ES_MAX_EID            92
+#define CFE_ES_MAX_EID            95
 
 /*
 ** ES task event message ID's.
@@ -960,7 +960,8 @@
 **  \link #CFE_ES_START_PERF_DATA_CC Start Performance Analyzer Data Collection Command \endlink
 **
 **  The \c 'd' field identifies the requested trigger mode.  Valid values are #CFE_ES_PerfMode_t CFE_ES_PERF_TRIGGER_START (0),
-**  #CFE_ES_PerfMode_t CFE_ES_PERF_TRIGGER_CENTER (1), and #CFE_ES_PerfMode_t CFE_ES_PERF_TRIGGER_END (2)
+**  #CFE_ES_PerfMode_t CFE_ES_PERF_TRIGGER_CENTER (1), #CFE_ES_PerfMode_t CFE_ES_PERF_TRIGGER_END (2) and
+**  #CFE_ES_PerfMode_t CFE_ES_PERF_STREAM (3)
 **/
 #define CFE_ES_PERF_STARTCMD_EID      57
 
@@ -990,8 +991,8 @@
 **
 **  The first \c 'd' field identifies the received trigger mode value.
 **  The second and third \c 'd' fields specify the valid range of values for the trigger mode.  Valid values 
-**  are #CFE_ES_PerfMode_t CFE_ES_PERF_TRIGGER_START (0), #CFE_ES_PerfMode_t CFE_ES_PERF_TRIGGER_CENTER (1), and 
-**  #CFE_ES_PerfMode_t CFE_ES_PERF_TRIGGER_END (2).
+**  are #CFE_ES_PerfMode_t CFE_ES_PERF_TRIGGER_START (0), #CFE_ES_PerfMode_t CFE_ES_PERF_TRIGGER_CENTER (1),
+**  #CFE_ES_PerfMode_t CFE_ES_PERF_TRIGGER_END (2) and #CFE_ES_PerfMode_t CFE_ES_PERF_STREAM (3).
 **/
 #define CFE_ES_PERF_STARTCMD_TRIG_ERR_EID      59
 
@@ -1537,6 +1538,54 @@
 **/
 #define CFE_ES_BUILD_INF_EID    92
 
+/** \brief <tt> 'Cannot start streaming performance data,Error creating child task RC=0x\%08X' </tt>
+**  \event <tt> 'Cannot start streaming performance data,Error creating child task RC=0x\%08X' </tt>
+**
+**  \par Type: ERROR
+**
+**  \par Cause:
+**
+**  This event message is generated when an Executive Services \link #CFE_ES_START_PERF_DATA_CC
+**  Start Performance Analyzer Data Collection Command \endlink requesting the stream mode
+**  fails to create the child task that writes the stream files.
+**
+**  The \c 'RC' field specifies, in hex, the error code returned by the #CFE_ES_CreateChildTask API
+**/
+#define CFE_ES_PERF_STREAM_ERR_EID    93
+
+/** \brief <tt> 'Error creating perf stream file \%s, RC = 0x\%08X' </tt>
+**  \event <tt> 'Error creating perf stream file \%s, RC = 0x\%08X' </tt>
+**
+**  \par Type: ERROR
+**
+**  \par Cause:
+**
+**  This event message is generated when the performance data streaming task fails
+**  to create the next file of the rotation.  Streaming stops and the Performance
+**  Analyzer returns to the IDLE state.
+**
+**  The \c 's' field identifies the name of the file and the \c 'RC' field specifies,
+**  in hex, the error code returned by the #OS_creat API.
+**/
+#define CFE_ES_PERF_STREAM_FILE_ERR_EID    94
+
+/** \brief <tt> 'Perf stream ended:Entries=\%u,Lost=\%u,Files=\%u,Last=\%s' </tt>
+**  \event <tt> 'Perf stream ended:Entries=\%u,Lost=\%u,Files=\%u,Last=\%s' </tt>
+**
+**  \par Type: DEBUG
+**
+**  \par Cause:
+**
+**  This event message is generated when the performance data streaming task finishes,
+**  either after a \link #CFE_ES_STOP_PERF_DATA_CC Stop Performance Analyzer Data Collection
+**  Command \endlink or because a stream file could not be written.
+**
+**  The \c 'Entries' field is the number of entries written to the stream, \c 'Lost' the
+**  number of entries overwritten before they could be written, \c 'Files' the number of
+**  stream files created and \c 'Last' the name of the last file written.
+**/
+#define CFE_ES_PERF_STREAM_DONE_EID    95
+
 
 
 #endif /* _cfe_es_events_ */
@@ -662,7 +662,10 @@
 **         either WAITING FOR TRIGGER or, if conditions are appropriate fast enough,
 **         TRIGGERED.
 **       - \b \c \ES_PERFMODE - Performance Analyzer Mode will change to the commanded trigger mode (TRIGGER START, 
-**         TRIGGER CENTER, or TRIGGER END).
+**         TRIGGER CENTER, TRIGGER END or STREAM).  In STREAM mode every entry is written to a rotating set of
+**         files (see #CFE_PLATFORM_ES_DEFAULT_PERF_STREAM_FILENAME) by a low priority child task until the
+**         #CFE_ES_STOP_PERF_DATA_CC command is received.  The stream files are varint and time delta
+**         encoded, not compressed.
 **       - \b \c \ES_PERFTRIGCNT - Performance Trigger Count will go to zero
 **       - \b \c \ES_PERFDATASTART - Data Start Index will go to zero
 **       - \b \c \ES_PERFDATAEND - Data End Index will go to zero
@@ -675,6 +678,8 @@
 **       - The command packet length is incorrect
 **       - A previous #CFE_ES_STOP_PERF_DATA_CC command has not completely finished.
 **       - An invalid trigger mode is requested.
+**       - The child task that writes the stream files could not be created.  The previous trigger
+**         mode and performance data are left as they were.
 **
 **       Evidence of failure may be found in the following telemetry:
 **       - \b \c \ES_CMDEC - command error counter will increment
@@ -710,7 +715,9 @@
 **         generated.
 **       - The file specified in the command (or the default specified
 **         by the #CFE_PLATFORM_ES_DEFAULT_PERF_DUMP_FILENAME configuration parameter) will be 
-**         updated with the lastest information.
+**         updated with the lastest information.  In STREAM mode the streaming task writes
+**         the remaining entries, closes its file and generates the
+**         #CFE_ES_PERF_STREAM_DONE_EID event message instead.
 **
 **  \par Error Conditions
 **       This command may fail for the following reason(s):
@@ -1338,7 +1345,7 @@ typedef struct
 **/
 typedef struct
 {
-  uint32                TriggerMode;                    /**< \brief Desired trigger position (Start, Center, End) */
+  uint32                TriggerMode;                    /**< \brief Desired trigger position (Start, Center, End) or Stream */
 } CFE_ES_StartPerfCmd_Payload_t;
 
 typedef struct
@@ -1477,6 +1484,91 @@ typedef struct
     CFE_ES_PoolStatsTlm_Payload_t   Payload;
 } CFE_ES_MemStatsTlm_t;
 
+/*
+** Number of buckets in a perf id latency histogram.  Bucket 0 and 1 count
+** durations of 0 and 1 microseconds; above that each power of two range is
+** split into two buckets, so bucket 2n counts 2^n to 1.5*2^n - 1 usec and
+** bucket 2n+1 counts 1.5*2^n to 2^(n+1) - 1 usec.  The last bucket also
+** counts every longer duration.
+*/
+#define CFE_ES_PERF_STATS_BUCKETS       32
+
+/**
+**  \brief Statistics of one perf id since it was last reported
+*/
+typedef struct
+{
+  uint32                PerfId;          /**< \cfetlmmnemonic \ES_PSID
+                                              \brief Perf id the statistics belong to */
+  uint32                Count;           /**< \cfetlmmnemonic \ES_PSCOUNT
+                                              \brief Number of entry to exit intervals */
+  uint32                TotalUsec;       /**< \cfetlmmnemonic \ES_PSTOTAL
+                                              \brief Total time between entry and exit markers */
+  uint32                WaitUsec;        /**< \cfetlmmnemonic \ES_PSWAIT
+                                              \brief Total time between exit and the next entry marker */
+  uint32                MinUsec;         /**< \cfetlmmnemonic \ES_PSMIN
+                                              \brief Shortest entry to exit interval */
+  uint32                MaxUsec;         /**< \cfetlmmnemonic \ES_PSMAX
+                                              \brief Longest entry to exit interval */
+  uint32                Histogram[CFE_ES_PERF_STATS_BUCKETS]; /**< \cfetlmmnemonic \ES_PSHIST
+                                              \brief Entry to exit intervals by duration, see #CFE_ES_PERF_STATS_BUCKETS */
+} CFE_ES_PerfIdStats_t;
+
+/** 
+**  \cfeestlm Performance Statistics Packet
+**/
+typedef struct
+{
+  uint32                NumIds;          /**< \cfetlmmnemonic \ES_PSNUMIDS
+                                              \brief Number of valid entries in PerfIds */
+  uint32                DroppedMarkers;  /**< \cfetlmmnemonic \ES_PSDROPPED
+                                              \brief Markers left out of the statistics since the previous packet
+                                                      because their perf id was being updated or reported */
+  CFE_ES_PerfIdStats_t  PerfIds[CFE_MISSION_ES_PERF_STATS_PER_PKT]; /**< \brief Statistics of the perf ids reported */
+} CFE_ES_PerfStatsTlm_Payload_t;
+
+typedef struct
+{
+    uint8                           TlmHeader[CFE_SB_TLM_HDR_SIZE]; /**< \brief cFE Software Bus Telemetry Message Header */
+    CFE_ES_PerfStatsTlm_Payload_t   Payload;
+} CFE_ES_PerfStatsTlm_t;
+
+/** 
+**  \cfeestlm Boot Profile Packet
+**
+**  Sent once after the system reaches the operational state.  All times are
+**  in microseconds.
+**/
+typedef struct
+{
+  uint32                ResetType;       /**< \cfetlmmnemonic \ES_BPRESETTYPE
+                                              \brief Reset type of this boot, see #CFE_PSP_RST_TYPE_POWERON */
+  uint32                CoreStartupUsec; /**< \cfetlmmnemonic \ES_BPCORE
+                                              \brief Time to create the cFE core tasks and objects */
+  uint32                ScriptUsec;      /**< \cfetlmmnemonic \ES_BPSCRIPT
+                                              \brief Time to read the startup script and load its entries */
+  uint32                ModuleLoadUsec;  /**< \cfetlmmnemonic \ES_BPLOAD
+                                              \brief Part of ScriptUsec spent loading libraries and creating apps */
+  uint32                AppsInitUsec;    /**< \cfetlmmnemonic \ES_BPAPPSINIT
+                                              \brief Time waiting for the apps to reach LATE_INIT */
+  uint32                AppsRunUsec;     /**< \cfetlmmnemonic \ES_BPAPPSRUN
+                                              \brief Time waiting for the apps to reach RUNNING */
+  uint32                TotalUsec;       /**< \cfetlmmnemonic \ES_BPTOTAL
+                                              \brief Time from the start of ES to the operational state */
+  uint32                LibsLoaded;      /**< \cfetlmmnemonic \ES_BPLIBS
+                                              \brief Libraries loaded from the startup script */
+  uint32                AppsCreated;     /**< \cfetlmmnemonic \ES_BPAPPS
+                                              \brief Applications created from the startup script */
+  uint32                LoadErrors;      /**< \cfetlmmnemonic \ES_BPERRS
+                                              \brief Startup script entries that failed to load */
+} CFE_ES_BootProfileTlm_Payload_t;
+
+typedef struct
+{
+    uint8                             TlmHeader[CFE_SB_TLM_HDR_SIZE]; /**< \brief cFE Software Bus Telemetry Message Header */
+    CFE_ES_BootProfileTlm_Payload_t   Payload;
+} CFE_ES_BootProfileTlm_t;
+
 /*************************************************************************/
 
 /** 
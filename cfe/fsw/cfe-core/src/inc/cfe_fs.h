@@ -48,6 +48,18 @@
 
 #define CFE_FS_FILE_CONTENT_ID  0x63464531  /**< \brief Magic Number for cFE compliant files (= 'cFE1') */
 
+#define CFE_FS_INFLATE_WINDOW_SIZE  32768  /**< \brief Size of the deflate history window, which also holds undrained output */
+#define CFE_FS_INFLATE_INPUT_SIZE   4096   /**< \brief Compressed bytes #CFE_FS_InflateFeed can hold between calls */
+#define CFE_FS_INFLATE_LITLEN_SIZE  2342   /**< \brief Entries in the literal/length decode table (11 bit root) */
+#define CFE_FS_INFLATE_DIST_SIZE    402    /**< \brief Entries in the distance decode table (8 bit root) */
+#define CFE_FS_INFLATE_PRECODE_SIZE 128    /**< \brief Entries in the code length decode table (7 bit root) */
+
+#define CFE_FS_DEFLATE_WINDOW_SIZE  8192   /**< \brief History searched for matches by the streaming gzip compressor */
+#define CFE_FS_DEFLATE_BLOCK_SIZE   8192   /**< \brief Input bytes compressed as one deflate block, at most 65535 */
+#define CFE_FS_DEFLATE_HASH_SIZE    4096   /**< \brief Entries in the match finder hash table, a power of two */
+#define CFE_FS_DEFLATE_OUTPUT_SIZE  (CFE_FS_DEFLATE_BLOCK_SIZE + 64) /**< \brief Compressed bytes held between drains */
+#define CFE_FS_DEFLATE_STORED_SIZE(Length) ((Length) + 25) /**< \brief Size of a gzip member written by #CFE_FS_DeflateStored */
+
 
 /*
  * To preserve source-code compatibility with existing code,
@@ -99,6 +111,85 @@ typedef struct
 
 } CFE_FS_Header_t;
 
+/**
+** \brief Receiver for the data produced by #CFE_FS_DecompressToSink
+**
+** Called with each run of decompressed data, in order.  Any return value
+** other than #CFE_SUCCESS stops the decompression and is passed back to
+** the caller of #CFE_FS_DecompressToSink.
+*/
+typedef int32 (*CFE_FS_DecompressSink_t)(void *SinkArg, const uint8 *Data, uint32 Size);
+
+/**
+** \brief State of a streaming gzip decompression
+**
+** Allocated by the caller, for example as a static or in a memory pool,
+** and set up with #CFE_FS_InflateInit.  The contents are private to FS
+** and must not be used directly.
+*/
+typedef struct
+{
+    uint64  BitBuf;                /**< \brief Input bits not yet decoded, first bit in bit 0 */
+    uint32  BitCount;              /**< \brief Number of valid bits in \c BitBuf */
+    uint32  InPos;                 /**< \brief Next unused byte in \c In */
+    uint32  InEnd;                 /**< \brief End of the fed bytes in \c In */
+    uint32  WinPos;                /**< \brief Next byte of \c Window to be written */
+    uint32  DrainPos;              /**< \brief Next byte of \c Window to be drained */
+
+    uint32  Mode;                  /**< \brief Which part of the stream is being decoded */
+    int32   Error;                 /**< \brief Sticky error status */
+    uint32  Flags;                 /**< \brief gzip header flags */
+    uint32  Skip;                  /**< \brief Bytes left in the gzip header extra field */
+    uint32  StoredLeft;            /**< \brief Bytes left in the current stored block */
+    uint32  MatchLeft;             /**< \brief Bytes left in a match that did not fit the window */
+    uint32  MatchDist;             /**< \brief Distance of that match */
+    bool    Final;                 /**< \brief The current block is the last one */
+    bool    Wrapped;               /**< \brief The window holds 32 KB of history */
+    bool    FixedTables;           /**< \brief The decode tables hold the fixed Huffman codes */
+
+    uint32  Crc;                   /**< \brief CRC-32 of the data drained so far */
+    uint32  TotalOut;              /**< \brief Number of bytes drained so far */
+    uint32  TrailerCrc;            /**< \brief CRC-32 from the gzip trailer */
+    uint32  TrailerLen;            /**< \brief Length from the gzip trailer */
+
+    uint32  LitLenTable[CFE_FS_INFLATE_LITLEN_SIZE];
+    uint32  DistTable[CFE_FS_INFLATE_DIST_SIZE];
+    uint32  PrecodeTable[CFE_FS_INFLATE_PRECODE_SIZE];
+
+    uint8   In[CFE_FS_INFLATE_INPUT_SIZE];
+    uint8   Window[CFE_FS_INFLATE_WINDOW_SIZE];
+
+} CFE_FS_InflateState_t;
+
+/**
+** \brief State of a streaming gzip compression
+**
+** Allocated by the caller and set up with #CFE_FS_DeflateInit.  The
+** contents are private to FS and must not be used directly.
+*/
+typedef struct
+{
+    uint64  BitBuf;                /**< \brief Output bits not yet stored, first bit in bit 0 */
+    uint32  BitCount;              /**< \brief Number of valid bits in \c BitBuf */
+    uint32  Mode;                  /**< \brief Which part of the stream comes next */
+
+    uint32  WinBase;               /**< \brief Stream position of the first byte of \c Window */
+    uint32  HistLen;               /**< \brief Bytes of history in \c Window before the pending input */
+    uint32  InLen;                 /**< \brief Bytes of pending input, not compressed yet */
+    uint32  OutPos;                /**< \brief Next byte of \c Out to be drained */
+    uint32  OutEnd;                /**< \brief End of the compressed bytes in \c Out */
+
+    uint32  Crc;                   /**< \brief CRC-32 of the data fed so far */
+    uint32  TotalIn;               /**< \brief Number of bytes fed so far */
+
+    uint32  Head[CFE_FS_DEFLATE_HASH_SIZE];   /**< \brief Last stream position of each hashed 4 byte string */
+    uint32  Syms[CFE_FS_DEFLATE_BLOCK_SIZE];  /**< \brief Literals and matches of the pending block */
+
+    uint8   Window[CFE_FS_DEFLATE_WINDOW_SIZE + CFE_FS_DEFLATE_BLOCK_SIZE];
+    uint8   Out[CFE_FS_DEFLATE_OUTPUT_SIZE];
+
+} CFE_FS_DeflateState_t;
+
 
 /*
 ** File header access functions...
@@ -285,6 +376,17 @@ int32 CFE_FS_ExtractFilenameFromPath(const char *OriginalPath, char *FileNameOnl
 ** \par Assumptions, External Events, and Notes:
 **        -# The paths and filenames used here are cfe compliant file names.
 **        -# The source file is compressed with the "gzip" utility.
+**        -# A source file that starts with a cFE file header, such as one
+**           written with #CFE_FS_DeflateInit after its headers, is restored
+**           from the gzip stream that follows the headers.  The stream is
+**           found by its header CRC within the first 4 KB of the file.
+**        -# gzip members that follow each other are restored one after
+**           the other, as the "gzip" utility does.
+**        -# A source file that ends before its gzip trailer, such as one
+**           that was cut off while being written, leaves the data restored
+**           so far in the destination file and returns
+**           #CFE_FS_GZIP_TRUNCATED.  After other errors the destination
+**           file is removed.
 **        -# The destination file does not exist, or can be overwritten. 
 **
 ** \param[in] SourceFile The "gzipped" file to decompress.
@@ -293,6 +395,7 @@ int32 CFE_FS_ExtractFilenameFromPath(const char *OriginalPath, char *FileNameOnl
 **
 ** \returns
 ** \retstmt CFE_SUCCESS if the file was decompressed sucessfully.  \endstmt
+** \retstmt CFE_FS_GZIP_TRUNCATED if the file was cut off before its end.  \endstmt
 ** \endreturns
 **
 ** \sa
@@ -300,6 +403,332 @@ int32 CFE_FS_ExtractFilenameFromPath(const char *OriginalPath, char *FileNameOnl
 ******************************************************************************/
 int32 CFE_FS_Decompress( const char * SourceFile, const char * DestinationFile );
 
+/*****************************************************************************/
+/**
+** \brief Decompresses the source file into a caller supplied sink.
+**
+** \par Description
+**        This API decompresses a "gzip" file in the same way as
+**        #CFE_FS_Decompress, but instead of writing a destination file it
+**        passes the decompressed data to \c SinkFunc as it is produced.
+**        This lets the caller decompress straight into memory without a
+**        temporary file.
+**
+** \par Assumptions, External Events, and Notes:
+**        -# The source file is compressed with the "gzip" utility.
+**        -# The data is passed in runs of at most 32 KB.  Each run is only
+**           valid for the duration of the call.
+**        -# The sink is called with the FS shared data lock held, so it must
+**           not call back into the FS decompression API.
+**
+** \param[in] SourceFile The "gzipped" file to decompress.
+** \param[in] SinkFunc   The function to receive the decompressed data.
+** \param[in] SinkArg    Passed unchanged to \c SinkFunc.
+**
+** \returns
+** \retstmt CFE_SUCCESS if the file was decompressed sucessfully.  \endstmt
+** \retstmt Any error returned by \c SinkFunc.  \endstmt
+** \endreturns
+**
+** \sa #CFE_FS_Decompress
+**
+******************************************************************************/
+int32 CFE_FS_DecompressToSink( const char * SourceFile, CFE_FS_DecompressSink_t SinkFunc, void *SinkArg );
+
+/*****************************************************************************/
+/**
+** \brief Prepares a streaming gzip decompression
+**
+** \par Description
+**        Sets up a caller supplied state for decompressing one "gzip" stream
+**        from memory with #CFE_FS_InflateFeed and #CFE_FS_InflateDrain.  The
+**        compressed data can come from anywhere: a file read in pieces, a
+**        pipe, a table buffer or a message.
+**
+** \par Assumptions, External Events, and Notes:
+**        -# The state is about 48 KB, so it should not be put on a task stack.
+**        -# Each state is used by one task at a time.  No locks are taken, so
+**           any number of decompressions can run at once.
+**
+** \param[out] State  The decompression state to set up.
+**
+** \returns
+** \retstmt CFE_SUCCESS if the state is ready.  \endstmt
+** \retstmt CFE_FS_BAD_ARGUMENT if \c State is NULL.  \endstmt
+** \endreturns
+**
+** \sa #CFE_FS_InflateFeed, #CFE_FS_InflateDrain, #CFE_FS_InflateFinished
+**
+******************************************************************************/
+int32 CFE_FS_InflateInit( CFE_FS_InflateState_t *State );
+
+/*****************************************************************************/
+/**
+** \brief Passes compressed data to a streaming gzip decompression
+**
+** \par Description
+**        Copies as much of \c Data as fits into the state's input buffer.
+**        The caller passes any bytes that were not accepted again after
+**        the next #CFE_FS_InflateDrain.
+**
+** \par Assumptions, External Events, and Notes:
+**        -# The input buffer holds #CFE_FS_INFLATE_INPUT_SIZE bytes, so no
+**           more than that is ever accepted at once.
+**
+** \param[in] State  A state set up by #CFE_FS_InflateInit.
+** \param[in] Data   The compressed data.
+** \param[in] Size   The number of bytes in \c Data.
+**
+** \returns
+** \retstmt The number of bytes accepted, which may be zero.  \endstmt
+** \retstmt CFE_FS_BAD_ARGUMENT if a pointer is NULL.  \endstmt
+** \retstmt The error that stopped the decompression, if any.  \endstmt
+** \endreturns
+**
+** \sa #CFE_FS_InflateInit, #CFE_FS_InflateDrain
+**
+******************************************************************************/
+int32 CFE_FS_InflateFeed( CFE_FS_InflateState_t *State, const void *Data, uint32 Size );
+
+/*****************************************************************************/
+/**
+** \brief Takes decompressed data from a streaming gzip decompression
+**
+** \par Description
+**        Decompresses the data fed so far into \c Buffer.  A return of zero
+**        means that more input is needed or, when #CFE_FS_InflateFinished
+**        is true, that the stream is complete and its CRC and length have
+**        been checked.
+**
+** \par Assumptions, External Events, and Notes:
+**        -# An error found after some data was copied is returned by the
+**           next call, and by every call after that.
+**
+** \param[in]  State   A state set up by #CFE_FS_InflateInit.
+** \param[out] Buffer  Where to copy the decompressed data.
+** \param[in]  Size    The size of \c Buffer in bytes.
+**
+** \returns
+** \retstmt The number of bytes copied into \c Buffer.  \endstmt
+** \retstmt CFE_FS_BAD_ARGUMENT if a pointer is NULL.  \endstmt
+** \retstmt CFE_FS_GZIP_NON_ZIP_FILE if the data is not in gzip format.  \endstmt
+** \retstmt CFE_FS_GZIP_BAD_DATA, CFE_FS_GZIP_BAD_CODE_BLOCK or CFE_FS_GZIP_INDEX_ERROR if the data is corrupt.  \endstmt
+** \retstmt CFE_FS_GZIP_CRC_ERROR or CFE_FS_GZIP_LENGTH_ERROR if the trailer check fails.  \endstmt
+** \endreturns
+**
+** \sa #CFE_FS_InflateInit, #CFE_FS_InflateFeed, #CFE_FS_InflateFinished
+**
+******************************************************************************/
+int32 CFE_FS_InflateDrain( CFE_FS_InflateState_t *State, void *Buffer, uint32 Size );
+
+/*****************************************************************************/
+/**
+** \brief Tells whether a streaming gzip decompression is complete
+**
+** \par Description
+**        Returns true once all of the data has been drained and the gzip
+**        trailer has been checked.  Any input after the end of the stream
+**        is ignored.
+**
+** \param[in] State  A state set up by #CFE_FS_InflateInit.
+**
+** \returns
+** \retstmt true if the stream is complete, false otherwise.  \endstmt
+** \endreturns
+**
+** \sa #CFE_FS_InflateDrain
+**
+******************************************************************************/
+bool CFE_FS_InflateFinished( const CFE_FS_InflateState_t *State );
+
+/*****************************************************************************/
+/**
+** \brief Prepares a streaming gzip compression
+**
+** \par Description
+**        Sets up a caller supplied state for compressing data into one
+**        "gzip" stream with #CFE_FS_DeflateFeed and #CFE_FS_DeflateDrain.
+**        The compressor is built for speed, in the manner of "gzip -1":
+**        greedy matching over an 8 KB history, with each block written as
+**        stored, fixed or dynamic Huffman data, whichever is smallest.
+**
+** \par Assumptions, External Events, and Notes:
+**        -# The state is about 72 KB, so it should not be put on a task stack.
+**        -# Each state is used by one task at a time.  No locks are taken.
+**        -# The gzip header carries a header CRC, which is how
+**           #CFE_FS_Decompress finds the stream when it follows the
+**           headers of a cFE file.
+**
+** \param[out] State  The compression state to set up.
+**
+** \returns
+** \retstmt CFE_SUCCESS if the state is ready.  \endstmt
+** \retstmt CFE_FS_BAD_ARGUMENT if \c State is NULL.  \endstmt
+** \endreturns
+**
+** \sa #CFE_FS_DeflateFeed, #CFE_FS_DeflateFinish, #CFE_FS_DeflateDrain
+**
+******************************************************************************/
+int32 CFE_FS_DeflateInit( CFE_FS_DeflateState_t *State );
+
+/*****************************************************************************/
+/**
+** \brief Passes data to a streaming gzip compression
+**
+** \par Description
+**        Copies as much of \c Data as fits into the pending block.  Once
+**        a full block is pending nothing more is accepted until it has
+**        been compressed by #CFE_FS_DeflateDrain.
+**
+** \param[in] State  A state set up by #CFE_FS_DeflateInit.
+** \param[in] Data   The data to compress.
+** \param[in] Size   The number of bytes in \c Data.
+**
+** \returns
+** \retstmt The number of bytes accepted, which may be zero.  \endstmt
+** \retstmt CFE_FS_BAD_ARGUMENT if a pointer is NULL or the stream has been finished.  \endstmt
+** \endreturns
+**
+** \sa #CFE_FS_DeflateInit, #CFE_FS_DeflateDrain
+**
+******************************************************************************/
+int32 CFE_FS_DeflateFeed( CFE_FS_DeflateState_t *State, const void *Data, uint32 Size );
+
+/*****************************************************************************/
+/**
+** \brief Makes the data fed so far recoverable from a streaming gzip compression
+**
+** \par Description
+**        The following calls to #CFE_FS_DeflateDrain return the pending
+**        block followed by an empty stored block, which ends on a byte
+**        boundary.  Once that has been drained, everything fed so far can
+**        be decompressed from the output even if the stream is never
+**        finished.  More data may be fed afterwards as usual.
+**
+** \par Assumptions, External Events, and Notes:
+**        -# Each flush ends a block early and costs about five bytes, so
+**           flushing very often hurts the compression.
+**
+** \param[in] State  A state set up by #CFE_FS_DeflateInit.
+**
+** \returns
+** \retstmt CFE_SUCCESS if the stream will be flushed.  \endstmt
+** \retstmt CFE_FS_BAD_ARGUMENT if \c State is NULL or the stream has been finished.  \endstmt
+** \endreturns
+**
+** \sa #CFE_FS_DeflateDrain, #CFE_FS_DeflateFinish
+**
+******************************************************************************/
+int32 CFE_FS_DeflateFlush( CFE_FS_DeflateState_t *State );
+
+/*****************************************************************************/
+/**
+** \brief Ends the input of a streaming gzip compression
+**
+** \par Description
+**        Marks the data fed so far as all of the data.  The following
+**        calls to #CFE_FS_DeflateDrain return the last block and the gzip
+**        trailer.
+**
+** \param[in] State  A state set up by #CFE_FS_DeflateInit.
+**
+** \returns
+** \retstmt CFE_SUCCESS if the stream will be finished.  \endstmt
+** \retstmt CFE_FS_BAD_ARGUMENT if \c State is NULL.  \endstmt
+** \endreturns
+**
+** \sa #CFE_FS_DeflateDrain, #CFE_FS_DeflateFinished
+**
+******************************************************************************/
+int32 CFE_FS_DeflateFinish( CFE_FS_DeflateState_t *State );
+
+/*****************************************************************************/
+/**
+** \brief Takes compressed data from a streaming gzip compression
+**
+** \par Description
+**        Copies compressed data into \c Buffer, compressing the pending
+**        block first when it is full or the stream has been finished.  A
+**        return of zero means that more input is needed or, when
+**        #CFE_FS_DeflateFinished is true, that the stream is complete.
+**
+** \param[in]  State   A state set up by #CFE_FS_DeflateInit.
+** \param[out] Buffer  Where to copy the compressed data.
+** \param[in]  Size    The size of \c Buffer in bytes.
+**
+** \returns
+** \retstmt The number of bytes copied into \c Buffer.  \endstmt
+** \retstmt CFE_FS_BAD_ARGUMENT if a pointer is NULL.  \endstmt
+** \endreturns
+**
+** \sa #CFE_FS_DeflateFeed, #CFE_FS_DeflateFinish, #CFE_FS_DeflateFinished
+**
+******************************************************************************/
+int32 CFE_FS_DeflateDrain( CFE_FS_DeflateState_t *State, void *Buffer, uint32 Size );
+
+/*****************************************************************************/
+/**
+** \brief Tells whether a streaming gzip compression is complete
+**
+** \param[in] State  A state set up by #CFE_FS_DeflateInit.
+**
+** \returns
+** \retstmt true once the stream has been finished and all of it drained.  \endstmt
+** \endreturns
+**
+** \sa #CFE_FS_DeflateFinish, #CFE_FS_DeflateDrain
+**
+******************************************************************************/
+bool CFE_FS_DeflateFinished( const CFE_FS_DeflateState_t *State );
+
+/*****************************************************************************/
+/**
+** \brief Bounds the compressed size still to come from a gzip compression
+**
+** \par Description
+**        Returns the most bytes that #CFE_FS_DeflateDrain can still produce
+**        if \c Size more bytes are fed and the stream is then finished.
+**        Data that does not compress is stored, so the bound is only a
+**        few bytes per block more than the uncompressed size.
+**
+** \param[in] State  A state set up by #CFE_FS_DeflateInit.
+** \param[in] Size   The number of bytes that may still be fed.
+**
+** \returns
+** \retstmt The upper bound in bytes, or zero if \c State is NULL.  \endstmt
+** \endreturns
+**
+** \sa #CFE_FS_DeflateFeed
+**
+******************************************************************************/
+uint32 CFE_FS_DeflateBound( const CFE_FS_DeflateState_t *State, uint32 Size );
+
+/*****************************************************************************/
+/**
+** \brief Writes data as a complete gzip member without compressing it
+**
+** \par Description
+**        Fills \c Buffer with a gzip member holding \c Data in one stored
+**        block, with the same header as #CFE_FS_DeflateInit writes.  The
+**        size of the member only depends on \c Length, so a member written
+**        into a file can later be rewritten in place with new contents.
+**        #CFE_FS_Decompress restores members that follow each other.
+**
+** \param[out] Buffer  Where to write the member.
+** \param[in]  Size    The size of \c Buffer in bytes.
+** \param[in]  Data    The data to store.
+** \param[in]  Length  The number of bytes in \c Data, at most 65535.
+**
+** \returns
+** \retstmt The member size, #CFE_FS_DEFLATE_STORED_SIZE of \c Length.  \endstmt
+** \retstmt CFE_FS_BAD_ARGUMENT if a pointer is NULL, \c Length is too big or \c Buffer too small.  \endstmt
+** \endreturns
+**
+** \sa #CFE_FS_DeflateInit
+**
+******************************************************************************/
+int32 CFE_FS_DeflateStored( void *Buffer, uint32 Size, const void *Data, uint32 Length );
+
 
 /*****************************************************************************/
 /**
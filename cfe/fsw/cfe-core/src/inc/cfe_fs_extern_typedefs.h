@@ -190,7 +190,19 @@ enum CFE_FS_SubType
     * command.
     *
     */
-   CFE_FS_SubType_ES_QUERYALLTASKS                    = 23
+   CFE_FS_SubType_ES_QUERYALLTASKS                    = 23,
+
+   /**
+    * @brief Executive Services Performance Stream File
+    *
+    *
+    * Executive Services Performance Analyzer Stream File which is written continuously
+    * while the Performance Analyzer is started in stream mode by a
+    * \link #CFE_ES_START_PERF_DATA_CC \ES_STARTLADATA \endlink
+    * command.
+    *
+    */
+   CFE_FS_SubType_ES_PERFSTREAM                       = 24
 };
 
 /**
@@ -570,6 +570,11 @@ int32  CFE_SB_RcvMsg(CFE_SB_MsgPtr_t  *BufPtr,
 **          random. Therefore, it is recommended that the return code be tested 
 **          for CFE_SUCCESS before reading the sender information.
 **
+**          Note - The sender's name is looked up when this routine is called.
+**          If the sending task has exited since the message was sent the
+**          name reads "Unknown", and if sender reporting was disabled when
+**          the message was sent the name is empty.
+**
 ** \param[in]  Ptr       A pointer to a local variable of type #CFE_SB_SenderId_t.  
 **                       Typically a caller declares a ptr of type CFE_SB_SenderId_t 
 **                       (i.e. CFE_SB_SenderId_t *Ptr) then gives the address of that 
@@ -1020,10 +1025,32 @@ int32 CFE_SB_SetMsgTime(CFE_SB_MsgPtr_t MsgPtr,
 **                         This must point to the first byte of the message header. 
 **
 ** \sa #CFE_SB_SetMsgId, #CFE_SB_SetUserDataLength, #CFE_SB_SetTotalMsgLength,
-**     #CFE_SB_SetMsgTime, #CFE_SB_SetCmdCode, #CFE_SB_InitMsg 
+**     #CFE_SB_SetMsgTime, #CFE_SB_SetCmdCode, #CFE_SB_InitMsg, #CFE_SB_TimeStampMsgs 
 **/
 void CFE_SB_TimeStampMsg(CFE_SB_MsgPtr_t MsgPtr);
 
+/*****************************************************************************/
+/** 
+** \brief Sets the time field in several software bus messages with one time read.
+**
+** \par Description
+**          This routine reads the current spacecraft time once, as returned by
+**          #CFE_TIME_GetTime, and sets it as the time of every message in the
+**          list.  Applications that build several packets for the same cycle
+**          should use this rather than calling #CFE_SB_TimeStampMsg for each.
+**
+** \par Assumptions, External Events, and Notes:
+**          - NULL entries in the list are skipped.
+**          - Messages without a time field are left unchanged.
+**
+** \param[in]  MsgPtrs     An array of pointers to the messages to stamp.
+**
+** \param[in]  MsgCount    The number of entries in \c MsgPtrs.
+**
+** \sa #CFE_SB_TimeStampMsg, #CFE_SB_SetMsgTime
+**/
+void CFE_SB_TimeStampMsgs(CFE_SB_MsgPtr_t *MsgPtrs, uint32 MsgCount);
+
 /*****************************************************************************/
 /** 
 ** \brief Gets the command code field from a software bus message.
@@ -372,7 +372,8 @@ int32 CFE_TBL_Unregister ( CFE_TBL_Handle_t TblHandle );
 ** \param[in] SrcDataPtr Pointer to either a character string specifying a filename or
 **                       a memory address of a block of binary data to be loaded into a table or,
 **                       if the table was registered with the #CFE_TBL_OPT_USR_DEF_ADDR option,
-**                       the address of the active table buffer.
+**                       the address of the active table buffer.  A filename with the ".gz"
+**                       extension is decompressed straight into the table's working buffer.
 **
 ** \returns
 ** \retcode #CFE_SUCCESS                   \retdesc \copydoc CFE_SUCCESS                   \endcode
@@ -610,6 +611,81 @@ int32 CFE_TBL_GetAddresses( void **TblPtrs[],
 int32 CFE_TBL_ReleaseAddresses( uint16 NumTables,
                                 const CFE_TBL_Handle_t TblHandles[] );
 
+/*****************************************************************************/
+/**
+** \brief Obtain the address of a table for reading without locking it
+**
+** \par Description
+**        Returns the address of the active buffer of the specified table, like
+**        #CFE_TBL_GetAddress, but without locking the table or checking the
+**        identity of the caller.  The caller is instead recorded as a reader in
+**        the current table epoch.  When Table Services activates a new buffer of
+**        a double buffered table, the old buffer is only reused for a later load
+**        once every reader has reported a quiescent point.
+**
+** \par Assumptions, External Events, and Notes:
+**        -# The returned address remains valid until the application calls
+**           #CFE_TBL_ReleaseReadAddress or #CFE_TBL_Manage with the same handle.
+**           Either call is a quiescent point, typically made once per pass of
+**           the application's main loop.
+**        -# A table update never waits for readers, but a new load into the
+**           inactive buffer of a double buffered table fails with
+**           #CFE_TBL_ERR_NO_BUFFER_AVAIL until all readers of the previous epoch
+**           have reported a quiescent point.  Single buffered tables are updated
+**           in place, so their updates are held off like #CFE_TBL_GetAddress locks.
+**        -# The handle must have been obtained by the calling application.
+**
+** \param[in]  TblPtr     The address of a pointer that will be loaded with the address of
+**                        the first byte of the table.
+**
+** \param[in]  TblHandle  Handle, previously obtained from #CFE_TBL_Register or #CFE_TBL_Share, that
+**                        identifies the Table whose address is to be returned.
+**
+** \param[out] *TblPtr    Address of the first byte of data associated with the specified table.
+**
+** \returns
+** \retcode #CFE_SUCCESS                \retdesc \copydoc CFE_SUCCESS                 \endcode
+** \retcode #CFE_TBL_INFO_UPDATED       \retdesc \copydoc CFE_TBL_INFO_UPDATED        \endcode
+** \retcode                             \retdesc <BR><BR>                             \endcode
+** \retcode #CFE_TBL_ERR_INVALID_HANDLE \retdesc \copydoc CFE_TBL_ERR_INVALID_HANDLE  \endcode
+** \retcode #CFE_TBL_ERR_UNREGISTERED   \retdesc \copydoc CFE_TBL_ERR_UNREGISTERED    \endcode
+** \retcode #CFE_TBL_ERR_NEVER_LOADED   \retdesc \copydoc CFE_TBL_ERR_NEVER_LOADED    \endcode
+** \endreturns
+**
+** \sa #CFE_TBL_ReleaseReadAddress, #CFE_TBL_GetAddress, #CFE_TBL_Manage
+**
+******************************************************************************/
+int32 CFE_TBL_GetReadAddress( void **TblPtr,
+                              CFE_TBL_Handle_t TblHandle );
+
+/*****************************************************************************/
+/**
+** \brief Report a quiescent point for a table read with #CFE_TBL_GetReadAddress
+**
+** \par Description
+**        Tells Table Services that the calling application no longer uses the
+**        address obtained with #CFE_TBL_GetReadAddress, so that a buffer retired
+**        by a table update can be reused.
+**
+** \par Assumptions, External Events, and Notes:
+**        Calling #CFE_TBL_Manage with the same handle has the same effect.
+**
+** \param[in] TblHandle  Handle, previously obtained from #CFE_TBL_Register or #CFE_TBL_Share, that
+**                       identifies the Table whose address is to be released.
+**
+** \returns
+** \retcode #CFE_SUCCESS                \retdesc \copydoc CFE_SUCCESS                 \endcode
+** \retcode #CFE_TBL_INFO_UPDATED       \retdesc \copydoc CFE_TBL_INFO_UPDATED        \endcode
+** \retcode                             \retdesc <BR><BR>                             \endcode
+** \retcode #CFE_TBL_ERR_INVALID_HANDLE \retdesc \copydoc CFE_TBL_ERR_INVALID_HANDLE  \endcode
+** \retcode #CFE_TBL_ERR_NEVER_LOADED   \retdesc \copydoc CFE_TBL_ERR_NEVER_LOADED    \endcode
+** \endreturns
+**
+** \sa #CFE_TBL_GetReadAddress, #CFE_TBL_Manage
+**
+******************************************************************************/
+int32 CFE_TBL_ReleaseReadAddress( CFE_TBL_Handle_t TblHandle );
+
 /*****************************************************************************/
 /**
 ** \brief Perform steps to validate the contents of a table image.
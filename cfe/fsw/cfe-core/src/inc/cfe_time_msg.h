@@ -1133,6 +1133,18 @@ typedef struct
      */
     uint32                DataStoreStatus;  /**< \cfetlmmnemonic \TIME_ATASTSTAT
 	                                               \brief Data Store status (preserved across processor reset) */
+
+    /*
+     ** Clock discipline loop (rates in 2^-32 seconds per second)...
+     */
+    int32                 RateError;        /**< \cfetlmmnemonic \TIME_RATEERR
+	                                               \brief Estimated local clock rate error, positive when the local clock runs slow */
+    int32                 PhaseError;       /**< \cfetlmmnemonic \TIME_PHASEERR
+	                                               \brief Tone MET less disciplined MET at the most recent tone (Sub-seconds) */
+    int32                 SlewRate;         /**< \cfetlmmnemonic \TIME_SLEWRATE
+	                                               \brief Rate correction applied since the tone, phase slew included */
+    uint32                StepCounter;      /**< \cfetlmmnemonic \TIME_STEPCNT
+	                                               \brief Tones that stepped the MET instead of slewing it */
 } CFE_TIME_DiagnosticTlm_Payload_t;
 
 typedef struct
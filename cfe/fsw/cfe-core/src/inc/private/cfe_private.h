@@ -306,6 +306,32 @@ extern int32 CFE_TIME_CleanUpApp(uint32 AppId);
 ******************************************************************************/
 int32 CFE_ES_RegisterCDSEx(CFE_ES_CDSHandle_t *HandlePtr, int32 BlockSize, const char *Name, bool CriticalTbl);
 
+/*****************************************************************************/
+/**
+** \brief Get the cached "App.Task" name of a task
+**
+** \par Description
+**        Copies the name ES composed for the task when it was registered.
+**        The name is the application name alone for an application's main
+**        task and "AppName.TaskName" for a child task, truncated to fit.
+**        This avoids rebuilding the name from #CFE_ES_GetTaskInfo on every
+**        call and is used by Software Bus sender reporting.
+**
+** \par Assumptions, External Events, and Notes:
+**        -# A task ID that no longer refers to the task it was taken from
+**           (the task exited) is reported as invalid.
+**
+** \param[in]   OSTaskId    The OSAL task ID of the task.
+**
+** \param[out]  *FullName   Buffer of at least #OS_MAX_API_NAME characters that
+**                          receives the null terminated name.
+**
+** \return #CFE_SUCCESS                     \copydoc CFE_SUCCESS
+** \return #CFE_ES_ERR_TASKID               \copydoc CFE_ES_ERR_TASKID
+**
+******************************************************************************/
+int32 CFE_ES_GetTaskFullName(uint32 OSTaskId, char *FullName);
+
 /*****************************************************************************/
 /**
 ** \brief Deletes the specified CDS from the CDS Registry and frees CDS Memory
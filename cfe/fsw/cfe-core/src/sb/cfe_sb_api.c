@@ -1227,6 +1227,8 @@ int32  CFE_SB_SendMsgFull(CFE_SB_Msg_t    *MsgPtr,
     uint16                  TotalMsgSize;
     CFE_SB_MsgRouteIdx_t    RtgTblIdx;
     uint32                  TskId = 0;
+    uint32                  AppId = 0xFFFFFFFF;
+    bool                    AppIdKnown = false;
     uint16                  i;
     char                    FullName[(OS_MAX_API_NAME * 2)];
     CFE_SB_EventBuf_t       SBSndErr;
@@ -1360,11 +1362,14 @@ int32  CFE_SB_SendMsgFull(CFE_SB_Msg_t    *MsgPtr,
                 RtgTblPtr->SeqCnt);
     }/* end if */
 
-    /* store the sender information */
+    /* store the sender; the name is only looked up by CFE_SB_GetLastSenderId */
     if(CFE_SB.SenderReporting != 0)
     {
-       BufDscPtr->Sender.ProcessorId = CFE_PSP_GetProcessorId();
-       strncpy(&BufDscPtr->Sender.AppName[0],CFE_SB_GetAppTskName(TskId,FullName),OS_MAX_API_NAME);
+       BufDscPtr->SenderTaskId = TskId;
+    }
+    else
+    {
+       BufDscPtr->SenderTaskId = 0;
     }
 
     /* At this point there must be at least one destination for pkt */
@@ -1389,9 +1394,12 @@ int32  CFE_SB_SendMsgFull(CFE_SB_Msg_t    *MsgPtr,
 
         if(PipeDscPtr->Opts & CFE_SB_PIPEOPTS_IGNOREMINE)
         {
-            uint32 AppId = 0xFFFFFFFF;
-
-            CFE_ES_GetAppID(&AppId);
+            /* look up the sending app once, on the first pipe that needs it */
+            if(AppIdKnown == false)
+            {
+                CFE_ES_GetAppID(&AppId);
+                AppIdKnown = true;
+            }
 
             if(PipeDscPtr->AppId == AppId)
             {
@@ -1704,7 +1712,8 @@ int32  CFE_SB_RcvMsg(CFE_SB_MsgPtr_t    *BufPtr,
 uint32  CFE_SB_GetLastSenderId(CFE_SB_SenderId_t **Ptr,CFE_SB_PipeId_t  PipeId)
 {
 
-    CFE_SB_BufferD_t *Ptr2BufDescriptor;
+    CFE_SB_BufferD_t  *Ptr2BufDescriptor;
+    CFE_SB_SenderId_t *SenderPtr;
     uint32            TskId = 0;
     uint32            AppId = 0xFFFFFFFF;
     char              FullName[(OS_MAX_API_NAME * 2)];
@@ -1746,8 +1755,21 @@ uint32  CFE_SB_GetLastSenderId(CFE_SB_SenderId_t **Ptr,CFE_SB_PipeId_t  PipeId)
     /* Get ptr to buffer descriptor for the last msg received on the given pipe */
     Ptr2BufDescriptor = CFE_SB.PipeTbl[PipeId].CurrentBuff;
 
-    /* Set the receivers pointer to the adr of 'Sender' struct in buf descriptor */
-    *Ptr = (CFE_SB_SenderId_t *) &Ptr2BufDescriptor -> Sender;
+    /* Resolve the sender recorded at send time into the pipe's sender info */
+    SenderPtr = &CFE_SB.LastSenderId[PipeId];
+    SenderPtr->ProcessorId = CFE_PSP_GetProcessorId();
+
+    if(Ptr2BufDescriptor != NULL && Ptr2BufDescriptor->SenderTaskId != 0)
+    {
+        CFE_SB_GetAppTskName(Ptr2BufDescriptor->SenderTaskId, SenderPtr->AppName);
+    }
+    else
+    {
+        SenderPtr->AppName[0] = '\0';
+    }
+
+    /* Set the receivers pointer to the pipe's 'Sender' struct */
+    *Ptr = SenderPtr;
 
     CFE_SB_UnlockSharedData(__func__,__LINE__);
 
@@ -652,38 +652,19 @@ int32 CFE_SB_ValidatePipeId(CFE_SB_PipeId_t PipeId){
 **  Return:
 **    Pointer to App.Tsk Name
 **
-**  Note: With taskId, Parent App name and Child Task name can be queried from ES
+**  Note: ES composes the app.tsk name once when the task is registered, so
+**        this is a single copy rather than a task info query and sprintf.
+**        FullName must hold at least OS_MAX_API_NAME characters.
 **
 */
 char *CFE_SB_GetAppTskName(uint32 TaskId,char *FullName){
 
-    CFE_ES_TaskInfo_t  TaskInfo;
-    CFE_ES_TaskInfo_t  *ptr = &TaskInfo;
-    char               AppName[OS_MAX_API_NAME];
-    char               TskName[OS_MAX_API_NAME];
-
-    if(CFE_ES_GetTaskInfo(ptr, TaskId) != CFE_SUCCESS){
+    if(CFE_ES_GetTaskFullName(TaskId, FullName) != CFE_SUCCESS){
 
       /* unlikely, but possible if TaskId is bogus */
       strncpy(FullName,"Unknown",OS_MAX_API_NAME-1);
       FullName[OS_MAX_API_NAME-1] = '\0';
 
-    }else if(strncmp((char *)ptr->AppName,(char *)ptr->TaskName,OS_MAX_API_NAME-1) == 0){
-
-      /* if app name and task name are the same */
-      strncpy(FullName,(char *)ptr->AppName,OS_MAX_API_NAME-1);
-      FullName[OS_MAX_API_NAME-1] = '\0';
-
-    }else{
-
-      /* AppName and TskName buffers and strncpy are needed to limit string sizes */
-      strncpy(AppName,(char *)ptr->AppName,OS_MAX_API_NAME-1);
-      AppName[OS_MAX_API_NAME-1] = '\0';
-      strncpy(TskName,(char *)ptr->TaskName,OS_MAX_API_NAME-1);
-      TskName[OS_MAX_API_NAME-1] = '\0';
-
-      sprintf(FullName,"%s.%s",AppName,TskName);
-
     }/* end if */
 
     return FullName;
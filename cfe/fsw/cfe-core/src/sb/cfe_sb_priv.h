@@ -175,7 +175,7 @@ typedef struct {
      uint16            UseCount;
      uint32            Size;
      void              *Buffer;
-     CFE_SB_SenderId_t Sender;
+     uint32            SenderTaskId; /* OSAL task ID of the sender, 0 if not reported */
 } CFE_SB_BufferD_t;
 
 
@@ -292,6 +292,7 @@ typedef struct {
     uint32              StopRecurseFlags[CFE_PLATFORM_ES_MAX_APPLICATIONS];
     void               *ZeroCopyTail;
     CFE_SB_PipeD_t      PipeTbl[CFE_PLATFORM_SB_MAX_PIPES];
+    CFE_SB_SenderId_t   LastSenderId[CFE_PLATFORM_SB_MAX_PIPES];
     CFE_SB_HousekeepingTlm_t        HKTlmMsg;
     CFE_SB_StatsTlm_t               StatTlmMsg;
     CFE_SB_PipeId_t     CmdPipe;
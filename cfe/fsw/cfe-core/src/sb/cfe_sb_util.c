@@ -428,6 +428,40 @@ void CFE_SB_TimeStampMsg(CFE_SB_MsgPtr_t MsgPtr)
 }/* end CFE_SB_TimeStampMsg */
 
 
+/******************************************************************************
+**  Function:  CFE_SB_TimeStampMsgs()
+**
+**  Purpose:
+**    Set the time field of each message in a list to the same current time.
+**
+**  Arguments:
+**    MsgPtrs  - Array of pointers to CFE_SB_Msg_t, NULL entries are skipped
+**    MsgCount - Number of entries in MsgPtrs
+**
+**  Return:
+**    (none)
+*/
+void CFE_SB_TimeStampMsgs(CFE_SB_MsgPtr_t *MsgPtrs, uint32 MsgCount)
+{
+    CFE_TIME_SysTime_t Time;
+    uint32             i;
+
+    if (MsgPtrs != NULL && MsgCount > 0)
+    {
+        Time = CFE_TIME_GetTime();
+
+        for (i = 0; i < MsgCount; i++)
+        {
+            if (MsgPtrs[i] != NULL)
+            {
+                CFE_SB_SetMsgTime(MsgPtrs[i], Time);
+            }
+        }
+    }
+
+}/* end CFE_SB_TimeStampMsgs */
+
+
 /******************************************************************************
 **  Function:  CFE_SB_GetCmdCode()
 **
@@ -334,6 +334,7 @@ int32 CFE_TBL_Register( CFE_TBL_Handle_t *TblHandlePtr,
                     AccessDescPtr->AppId = ThisAppId;
                     AccessDescPtr->LockFlag = false;
                     AccessDescPtr->Updated = false;
+                    AccessDescPtr->ReadEpoch = 0;
 
                     if ((RegRecPtr->DumpOnly) && (!RegRecPtr->UserDefAddr))
                     {
@@ -557,6 +558,7 @@ int32 CFE_TBL_Share( CFE_TBL_Handle_t *TblHandlePtr,
                 AccessDescPtr->AppId = ThisAppId;
                 AccessDescPtr->LockFlag = false;
                 AccessDescPtr->Updated = false;
+                AccessDescPtr->ReadEpoch = 0;
 
                 /* Check current state of table in order to set Notification flags properly */
                 if (RegRecPtr->TableLoadedOnce)
@@ -1194,6 +1196,105 @@ int32 CFE_TBL_ReleaseAddresses( uint16 NumTables,
 }   /* End of CFE_TBL_ReleaseAddresses() */
 
 
+/*******************************************************************
+**
+** CFE_TBL_GetReadAddress() -- Enter the read side of a table and
+**             obtain the address of its active buffer
+**
+** NOTE: For complete prolog information, see 'cfe_tbl.h'
+********************************************************************/
+
+int32 CFE_TBL_GetReadAddress( void **TblPtr,
+                              CFE_TBL_Handle_t TblHandle )
+{
+    int32   Status;
+    uint8   BufferIndex;
+    CFE_TBL_AccessDescriptor_t *AccessDescPtr;
+    CFE_TBL_RegistryRec_t *RegRecPtr;
+
+    /* Assume failure at returning the table address */
+    *TblPtr = NULL;
+
+    /* The handle was obtained by the caller, so only the handle itself is checked */
+    Status = CFE_TBL_ValidateHandle(TblHandle);
+
+    if (Status == CFE_SUCCESS)
+    {
+        AccessDescPtr = &CFE_TBL_TaskData.Handles[TblHandle];
+        RegRecPtr = &CFE_TBL_TaskData.Registry[AccessDescPtr->RegIndex];
+
+        if (RegRecPtr->OwnerAppId == CFE_TBL_NOT_OWNED)
+        {
+            Status = CFE_TBL_ERR_UNREGISTERED;
+
+            CFE_ES_WriteToSysLog("CFE_TBL:GetReadAddress-Attempt to access unowned Tbl Handle=%d\n",
+                                 (int)TblHandle);
+        }
+        else
+        {
+#ifdef CFE_TBL_LOCKFREE_READ
+            /* Enter the current epoch before looking at the active buffer, so that */
+            /* a buffer published after this point is never reclaimed from under us */
+            __atomic_store_n(&AccessDescPtr->ReadEpoch,
+                             __atomic_load_n(&RegRecPtr->Epoch, __ATOMIC_SEQ_CST), __ATOMIC_SEQ_CST);
+            BufferIndex = __atomic_load_n(&RegRecPtr->ActiveBufferIndex, __ATOMIC_SEQ_CST);
+#else
+            /* Lock the buffer as CFE_TBL_GetAddress does, and note that it was */
+            /* locked for a read address so that a quiescent point releases it  */
+            AccessDescPtr->ReadEpoch = 1;
+            AccessDescPtr->LockFlag = true;
+            BufferIndex = RegRecPtr->ActiveBufferIndex;
+            AccessDescPtr->BufferIndex = BufferIndex;
+#endif
+
+            *TblPtr = RegRecPtr->Buffers[BufferIndex].BufferPtr;
+
+            /* Return any pending warning or info status indicators */
+            Status = CFE_TBL_GetNextNotification(TblHandle);
+
+            /* Clear Table Updated Notify Bit so that caller only gets it once */
+            AccessDescPtr->Updated = false;
+        }
+    }
+    else
+    {
+        CFE_ES_WriteToSysLog("CFE_TBL:GetReadAddress-Invalid Tbl Handle=%d\n", (int)TblHandle);
+    }
+
+    return Status;
+}   /* End of CFE_TBL_GetReadAddress() */
+
+
+/*******************************************************************
+**
+** CFE_TBL_ReleaseReadAddress() -- Report a quiescent point for a
+**             table read with CFE_TBL_GetReadAddress
+**
+** NOTE: For complete prolog information, see 'cfe_tbl.h'
+********************************************************************/
+
+int32 CFE_TBL_ReleaseReadAddress( CFE_TBL_Handle_t TblHandle )
+{
+    int32   Status;
+
+    Status = CFE_TBL_ValidateHandle(TblHandle);
+
+    if (Status == CFE_SUCCESS)
+    {
+        CFE_TBL_QuiescentPoint(TblHandle);
+
+        /* Return any pending warning or info status indicators */
+        Status = CFE_TBL_GetNextNotification(TblHandle);
+    }
+    else
+    {
+        CFE_ES_WriteToSysLog("CFE_TBL:ReleaseReadAddress-Invalid Tbl Handle=%d\n", (int)TblHandle);
+    }
+
+    return Status;
+}   /* End of CFE_TBL_ReleaseReadAddress() */
+
+
 /*******************************************************************
 **
 ** CFE_TBL_Validate() -- Validate a table image for the specified table
@@ -1359,6 +1460,14 @@ int32 CFE_TBL_Manage( CFE_TBL_Handle_t TblHandle )
     int32   Status = CFE_SUCCESS;
     bool    FinishedManaging = false;
 
+    /* Managing a table is a quiescent point for any read address the caller holds. */
+    /* Bad handles are reported by CFE_TBL_GetStatus below.                         */
+    if ((TblHandle >= 0) && (TblHandle < CFE_PLATFORM_TBL_MAX_NUM_HANDLES) &&
+        (CFE_TBL_TaskData.Handles[TblHandle].UsedFlag))
+    {
+        CFE_TBL_QuiescentPoint(TblHandle);
+    }
+
     while (!FinishedManaging)
     {
         /* Determine if the table has a validation or update that needs to be performed */
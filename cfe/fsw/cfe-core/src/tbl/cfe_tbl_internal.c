@@ -44,6 +44,12 @@
 #include <stdio.h>
 #include <string.h>
 
+/*
+** Table file data is read in blocks of this size, so that the CRC of
+** each block is computed while the block is still in the data cache
+*/
+#define CFE_TBL_LOAD_BLOCK_SIZE     4096
+
 /*******************************************************************
 **
 ** CFE_TBL_EarlyInit
@@ -88,6 +94,7 @@ int32 CFE_TBL_EarlyInit (void)
         CFE_TBL_TaskData.Handles[i].LockFlag = false;
         CFE_TBL_TaskData.Handles[i].Updated = false;
         CFE_TBL_TaskData.Handles[i].BufferIndex = 0;
+        CFE_TBL_TaskData.Handles[i].ReadEpoch = 0;
     }
 
     /* Initialize the Table Validation Results Records */
@@ -302,6 +309,7 @@ void CFE_TBL_InitRegistryRecord (CFE_TBL_RegistryRec_t *RegRecPtr)
     RegRecPtr->DoubleBuffered = false;
     RegRecPtr->NotifyByMsg = false;
     RegRecPtr->ActiveBufferIndex = 0;
+    RegRecPtr->Epoch = 1;
     RegRecPtr->Name[0] = '\0';
     RegRecPtr->LastFileLoaded[0] = '\0';
 }
@@ -791,6 +799,29 @@ int32 CFE_TBL_UnlockRegistry(void)
 }   /* End of CFE_TBL_UnlockRegistry() */
 
 
+/*******************************************************************
+**
+** CFE_TBL_QuiescentPoint
+**
+** NOTE: For complete prolog information, see 'cfe_tbl_internal.h'
+********************************************************************/
+
+void CFE_TBL_QuiescentPoint(CFE_TBL_Handle_t TblHandle)
+{
+#ifdef CFE_TBL_LOCKFREE_READ
+    __atomic_store_n(&CFE_TBL_TaskData.Handles[TblHandle].ReadEpoch, 0, __ATOMIC_SEQ_CST);
+#else
+    /* Only release the lock flag if it was set by CFE_TBL_GetReadAddress */
+    if (CFE_TBL_TaskData.Handles[TblHandle].ReadEpoch != 0)
+    {
+        CFE_TBL_TaskData.Handles[TblHandle].ReadEpoch = 0;
+        CFE_TBL_TaskData.Handles[TblHandle].LockFlag = false;
+    }
+#endif
+
+}   /* End of CFE_TBL_QuiescentPoint() */
+
+
 /*******************************************************************
 **
 ** CFE_TBL_GetWorkingBuffer
@@ -805,6 +836,7 @@ int32 CFE_TBL_GetWorkingBuffer(CFE_TBL_LoadBuff_t **WorkingBufferPtr,
     int32   Status = CFE_SUCCESS;
     int32   i;
     int32   InactiveBufferIndex;
+    uint32  ReadEpoch;
     CFE_TBL_Handle_t AccessIterator;
 
     /* Initialize return pointer to NULL */
@@ -848,12 +880,16 @@ int32 CFE_TBL_GetWorkingBuffer(CFE_TBL_LoadBuff_t **WorkingBufferPtr,
                 /* Determine the index of the Inactive Buffer Pointer */
                 InactiveBufferIndex = 1 - RegRecPtr->ActiveBufferIndex;
 
-                /* Scan the access descriptor table to determine if anyone is still using the inactive buffer */
+                /* Scan the access descriptor table to determine if anyone is still using the inactive buffer. */
+                /* A reader that entered before the active buffer was last published may still hold the   */
+                /* inactive buffer until it releases the read address or reports a quiescent point.       */
                 AccessIterator = RegRecPtr->HeadOfAccessList;
                 while ((AccessIterator != CFE_TBL_END_OF_LIST) && (Status == CFE_SUCCESS))
                 {
-                    if ((CFE_TBL_TaskData.Handles[AccessIterator].BufferIndex == InactiveBufferIndex) &&
-		                (CFE_TBL_TaskData.Handles[AccessIterator].LockFlag))
+                    ReadEpoch = CFE_TBL_READ_EPOCH(AccessIterator);
+                    if (((CFE_TBL_TaskData.Handles[AccessIterator].BufferIndex == InactiveBufferIndex) &&
+		                 (CFE_TBL_TaskData.Handles[AccessIterator].LockFlag)) ||
+                        ((ReadEpoch != 0) && (ReadEpoch != RegRecPtr->Epoch)))
                     {
                         Status = CFE_TBL_ERR_NO_BUFFER_AVAIL;
 
@@ -947,12 +983,20 @@ int32 CFE_TBL_LoadFromFile(CFE_TBL_LoadBuff_t *WorkingBufferPtr,
     int32                FileDescriptor;
     size_t               FilenameLen = strlen(Filename);
     uint32               NumBytes;
+    uint32               BlockSize;
+    uint32               Remaining;
+    uint32               Crc;
+    uint8               *DataPtr;
     uint8                ExtraByte;
 
     if (FilenameLen > (OS_MAX_PATH_LEN-1))
     {
         Status = CFE_TBL_ERR_FILENAME_TOO_LONG;
     }
+    else if (CFE_FS_IsGzFile(Filename))
+    {
+        Status = CFE_TBL_LoadFromGzFile(WorkingBufferPtr, RegRecPtr, Filename);
+    }
     else
     {
         /* Try to open the specified table file */
@@ -985,13 +1029,34 @@ int32 CFE_TBL_LoadFromFile(CFE_TBL_LoadBuff_t *WorkingBufferPtr,
                             Status = CFE_TBL_WARN_SHORT_FILE;
                         }
 
-                        NumBytes = OS_read(FileDescriptor,
-                                           &WorkingBufferPtr->BufferPtr[TblFileHeader.Offset],
-                                           TblFileHeader.NumBytes);
-
-                        if (NumBytes != TblFileHeader.NumBytes)
+                        /* The CRC covers the whole table, including any bytes the file does not load */
+                        Crc = CFE_ES_CalculateCRC(WorkingBufferPtr->BufferPtr,
+                                                  TblFileHeader.Offset,
+                                                  0,
+                                                  CFE_MISSION_ES_DEFAULT_CRC);
+
+                        /* Read the data straight into the working buffer, adding each */
+                        /* block to the CRC as soon as it has been read                */
+                        DataPtr = &WorkingBufferPtr->BufferPtr[TblFileHeader.Offset];
+                        Remaining = TblFileHeader.NumBytes;
+                        while (Remaining > 0)
                         {
-                            Status = CFE_TBL_ERR_LOAD_INCOMPLETE;
+                            BlockSize = Remaining;
+                            if (BlockSize > CFE_TBL_LOAD_BLOCK_SIZE)
+                            {
+                                BlockSize = CFE_TBL_LOAD_BLOCK_SIZE;
+                            }
+
+                            NumBytes = OS_read(FileDescriptor, DataPtr, BlockSize);
+                            if (NumBytes != BlockSize)
+                            {
+                                Status = CFE_TBL_ERR_LOAD_INCOMPLETE;
+                                break;
+                            }
+
+                            Crc = CFE_ES_CalculateCRC(DataPtr, BlockSize, Crc, CFE_MISSION_ES_DEFAULT_CRC);
+                            DataPtr += BlockSize;
+                            Remaining -= BlockSize;
                         }
                         
                         /* Check to see if the file is too large (ie - more data than header claims) */
@@ -1010,10 +1075,10 @@ int32 CFE_TBL_LoadFromFile(CFE_TBL_LoadBuff_t *WorkingBufferPtr,
                         WorkingBufferPtr->FileCreateTimeSecs = StdFileHeader.TimeSeconds;
                         WorkingBufferPtr->FileCreateTimeSubSecs = StdFileHeader.TimeSubSeconds;
                         
-                        /* Compute the CRC on the specified table buffer */
-                        WorkingBufferPtr->Crc = CFE_ES_CalculateCRC(WorkingBufferPtr->BufferPtr,
-                                                                    RegRecPtr->Size,
-                                                                    0,
+                        /* Finish the CRC with the rest of the table buffer */
+                        WorkingBufferPtr->Crc = CFE_ES_CalculateCRC(DataPtr,
+                                                                    RegRecPtr->Size - (DataPtr - WorkingBufferPtr->BufferPtr),
+                                                                    Crc,
                                                                     CFE_MISSION_ES_DEFAULT_CRC);
                     }
                 }
@@ -1036,6 +1101,219 @@ int32 CFE_TBL_LoadFromFile(CFE_TBL_LoadBuff_t *WorkingBufferPtr,
 }
 
 
+/*******************************************************************
+**
+** CFE_TBL_LoadFromGzFile
+**
+** NOTE: For complete prolog information, see 'cfe_tbl_internal.h'
+********************************************************************/
+
+int32 CFE_TBL_LoadFromGzFile(CFE_TBL_LoadBuff_t *WorkingBufferPtr,
+                             CFE_TBL_RegistryRec_t *RegRecPtr,
+                             const char *Filename)
+{
+    int32              Status;
+    CFE_TBL_GzLoad_t   GzLoad;
+    uint32             DataBytes;
+    uint8             *DataPtr;
+
+    memset(&GzLoad, 0, sizeof(GzLoad));
+    GzLoad.WorkingBufferPtr = WorkingBufferPtr;
+    GzLoad.RegRecPtr = RegRecPtr;
+    GzLoad.Filename = Filename;
+
+    /* Decompress straight into the working buffer, without a temporary file */
+    Status = CFE_FS_DecompressToSink(Filename, CFE_TBL_GzLoadSink, &GzLoad);
+
+    if (Status == CFE_SUCCESS)
+    {
+        if (GzLoad.BytesReceived < sizeof(CFE_FS_Header_t))
+        {
+            CFE_EVS_SendEventWithAppID(CFE_TBL_FILE_STD_HDR_ERR_EID,
+                                       CFE_EVS_EventType_ERROR,
+                                       CFE_TBL_TaskData.TableTaskAppId,
+                                       "Unable to read std header for '%s', Status = 0x%08X",
+                                       Filename, (unsigned int)GzLoad.BytesReceived);
+
+            Status = CFE_TBL_ERR_NO_STD_HEADER;
+        }
+        else if (GzLoad.BytesReceived < (sizeof(CFE_FS_Header_t) + sizeof(CFE_TBL_File_Hdr_t)))
+        {
+            CFE_EVS_SendEventWithAppID(CFE_TBL_FILE_TBL_HDR_ERR_EID,
+                                       CFE_EVS_EventType_ERROR,
+                                       CFE_TBL_TaskData.TableTaskAppId,
+                                       "Unable to read tbl header for '%s', Status = 0x%08X",
+                                       Filename, (unsigned int)(GzLoad.BytesReceived - sizeof(CFE_FS_Header_t)));
+
+            Status = CFE_TBL_ERR_NO_TBL_HEADER;
+        }
+        else
+        {
+            DataBytes = GzLoad.BytesReceived - (sizeof(CFE_FS_Header_t) + sizeof(CFE_TBL_File_Hdr_t));
+            if (DataBytes < GzLoad.TblFileHeader.NumBytes)
+            {
+                Status = CFE_TBL_ERR_LOAD_INCOMPLETE;
+            }
+            else
+            {
+                Status = GzLoad.Status;
+            }
+
+            memset(WorkingBufferPtr->DataSource, 0, OS_MAX_PATH_LEN);
+            strncpy(WorkingBufferPtr->DataSource, Filename, OS_MAX_PATH_LEN);
+
+            /* Save file creation time for later storage into Registry */
+            WorkingBufferPtr->FileCreateTimeSecs = GzLoad.StdFileHeader.TimeSeconds;
+            WorkingBufferPtr->FileCreateTimeSubSecs = GzLoad.StdFileHeader.TimeSubSeconds;
+
+            /* Finish the CRC with the rest of the table buffer */
+            DataPtr = &WorkingBufferPtr->BufferPtr[GzLoad.TblFileHeader.Offset + DataBytes];
+            WorkingBufferPtr->Crc = CFE_ES_CalculateCRC(DataPtr,
+                                                        RegRecPtr->Size - (DataPtr - WorkingBufferPtr->BufferPtr),
+                                                        GzLoad.Crc,
+                                                        CFE_MISSION_ES_DEFAULT_CRC);
+        }
+    }
+
+    return Status;
+}
+
+
+/*******************************************************************
+**
+** CFE_TBL_GzLoadSink
+**
+** NOTE: For complete prolog information, see 'cfe_tbl_internal.h'
+********************************************************************/
+
+int32 CFE_TBL_GzLoadSink(void *SinkArg, const uint8 *Data, uint32 Size)
+{
+    CFE_TBL_GzLoad_t  *GzLoad = SinkArg;
+    int32              Status = CFE_SUCCESS;
+    int32              EndianCheck = 0x01020304;
+    uint32             HeaderSize = sizeof(CFE_FS_Header_t) + sizeof(CFE_TBL_File_Hdr_t);
+    uint32             Position;
+    uint32             Count;
+    uint8             *DataPtr;
+
+    while (Size > 0 && Status == CFE_SUCCESS)
+    {
+        if (GzLoad->BytesReceived < sizeof(CFE_FS_Header_t))
+        {
+            /* Gather the standard cFE header */
+            Position = GzLoad->BytesReceived;
+            Count = sizeof(CFE_FS_Header_t) - Position;
+            if (Count > Size)
+            {
+                Count = Size;
+            }
+
+            memcpy((uint8 *)&GzLoad->StdFileHeader + Position, Data, Count);
+
+            if ((Position + Count) == sizeof(CFE_FS_Header_t))
+            {
+                if ((*(char *)&EndianCheck) == 0x04)
+                {
+                    CFE_TBL_ByteSwapStdHeader(&GzLoad->StdFileHeader);
+                }
+
+                Status = CFE_TBL_CheckStdHeader(&GzLoad->StdFileHeader, GzLoad->Filename);
+            }
+        }
+        else if (GzLoad->BytesReceived < HeaderSize)
+        {
+            /* Gather the table header */
+            Position = GzLoad->BytesReceived - sizeof(CFE_FS_Header_t);
+            Count = sizeof(CFE_TBL_File_Hdr_t) - Position;
+            if (Count > Size)
+            {
+                Count = Size;
+            }
+
+            memcpy((uint8 *)&GzLoad->TblFileHeader + Position, Data, Count);
+
+            if ((Position + Count) == sizeof(CFE_TBL_File_Hdr_t))
+            {
+                if ((*(char *)&EndianCheck) == 0x04)
+                {
+                    CFE_TBL_ByteSwapTblHeader(&GzLoad->TblFileHeader);
+                }
+
+                Status = CFE_TBL_CheckTblHeader(&GzLoad->StdFileHeader, &GzLoad->TblFileHeader, GzLoad->Filename);
+                if (Status == CFE_SUCCESS)
+                {
+                    Status = CFE_TBL_CheckGzLoadFits(GzLoad);
+                }
+            }
+        }
+        else
+        {
+            /* Table data goes straight into the working buffer */
+            Position = GzLoad->BytesReceived - HeaderSize;
+            Count = Size;
+            if (Count > (GzLoad->TblFileHeader.NumBytes - Position))
+            {
+                Status = CFE_TBL_ERR_FILE_TOO_LARGE;
+                break;
+            }
+
+            DataPtr = &GzLoad->WorkingBufferPtr->BufferPtr[GzLoad->TblFileHeader.Offset + Position];
+            memcpy(DataPtr, Data, Count);
+            GzLoad->Crc = CFE_ES_CalculateCRC(DataPtr, Count, GzLoad->Crc, CFE_MISSION_ES_DEFAULT_CRC);
+        }
+
+        GzLoad->BytesReceived += Count;
+        Data += Count;
+        Size -= Count;
+    }
+
+    return Status;
+}
+
+
+/*******************************************************************
+**
+** CFE_TBL_CheckGzLoadFits
+**
+** NOTE: For complete prolog information, see 'cfe_tbl_internal.h'
+********************************************************************/
+
+int32 CFE_TBL_CheckGzLoadFits(CFE_TBL_GzLoad_t *GzLoad)
+{
+    int32 Status = CFE_SUCCESS;
+
+    /* Verify that the specified file has compatible data for specified table */
+    if (strcmp(GzLoad->RegRecPtr->Name, GzLoad->TblFileHeader.TableName) != 0)
+    {
+        Status = CFE_TBL_ERR_FILE_FOR_WRONG_TABLE;
+    }
+    else if ((GzLoad->TblFileHeader.Offset + GzLoad->TblFileHeader.NumBytes) > GzLoad->RegRecPtr->Size)
+    {
+        Status = CFE_TBL_ERR_FILE_TOO_LARGE;
+    }
+    else
+    {
+        /* Partial and short loads are only warnings, reported once the data is in */
+        if (GzLoad->TblFileHeader.Offset > 0)
+        {
+            GzLoad->Status = CFE_TBL_WARN_PARTIAL_LOAD;
+        }
+        else if (GzLoad->TblFileHeader.NumBytes < GzLoad->RegRecPtr->Size)
+        {
+            GzLoad->Status = CFE_TBL_WARN_SHORT_FILE;
+        }
+
+        /* The CRC covers the whole table, including any bytes the file does not load */
+        GzLoad->Crc = CFE_ES_CalculateCRC(GzLoad->WorkingBufferPtr->BufferPtr,
+                                          GzLoad->TblFileHeader.Offset,
+                                          0,
+                                          CFE_MISSION_ES_DEFAULT_CRC);
+    }
+
+    return Status;
+}
+
+
 /*******************************************************************
 **
 ** CFE_TBL_UpdateInternal
@@ -1061,8 +1339,16 @@ int32 CFE_TBL_UpdateInternal( CFE_TBL_Handle_t TblHandle,
     {
         if (RegRecPtr->DoubleBuffered)
         {
-            /* To update a double buffered table only requires a pointer swap */
+            /* To update a double buffered table only requires a pointer swap.  The new */
+            /* buffer is published before the epoch advances, so that readers entering  */
+            /* in the new epoch can only see the new buffer.                            */
+#ifdef CFE_TBL_LOCKFREE_READ
+            __atomic_store_n(&RegRecPtr->ActiveBufferIndex, (uint8)RegRecPtr->LoadInProgress, __ATOMIC_SEQ_CST);
+            __atomic_add_fetch(&RegRecPtr->Epoch, 1, __ATOMIC_SEQ_CST);
+#else
             RegRecPtr->ActiveBufferIndex = (uint8)RegRecPtr->LoadInProgress;
+            RegRecPtr->Epoch++;
+#endif
 
             /* Source description in buffer should already have been updated by either */
             /* the LoadFromFile function or the Load function (when a memory load).    */
@@ -1081,11 +1367,13 @@ int32 CFE_TBL_UpdateInternal( CFE_TBL_Handle_t TblHandle,
         }
         else
         {
-            /* Check to see if the Table is locked by anyone */
+            /* Check to see if the Table is locked by anyone, including readers that have */
+            /* not yet passed a quiescent point, since the update is copied in place       */
             AccessIterator = RegRecPtr->HeadOfAccessList;
             while (AccessIterator != CFE_TBL_END_OF_LIST)
             {
-                LockStatus = (LockStatus || CFE_TBL_TaskData.Handles[AccessIterator].LockFlag);
+                LockStatus = (LockStatus || CFE_TBL_TaskData.Handles[AccessIterator].LockFlag ||
+                              (CFE_TBL_READ_EPOCH(AccessIterator) != 0));
 
                 AccessIterator = CFE_TBL_TaskData.Handles[AccessIterator].NextLink;
             }
@@ -1184,17 +1472,6 @@ int32 CFE_TBL_ReadHeaders( int32 FileDescriptor,
     int32 Status;
     int32 EndianCheck = 0x01020304;
 
-    #if (CFE_PLATFORM_TBL_VALID_SCID_COUNT > 0)
-    static uint32 ListSC[2] = { CFE_PLATFORM_TBL_VALID_SCID_1, CFE_PLATFORM_TBL_VALID_SCID_2};
-    uint32 IndexSC;
-    #endif
-    
-    #if (CFE_PLATFORM_TBL_VALID_PRID_COUNT > 0)
-    static uint32 ListPR[4] = { CFE_PLATFORM_TBL_VALID_PRID_1, CFE_PLATFORM_TBL_VALID_PRID_2,
-                                CFE_PLATFORM_TBL_VALID_PRID_3, CFE_PLATFORM_TBL_VALID_PRID_4};
-    uint32 IndexPR;
-    #endif
-    
     /* Once the file is open, read the headers to determine the target Table */
     Status = CFE_FS_ReadHeader(StdFileHeaderPtr, FileDescriptor);
 
@@ -1211,120 +1488,167 @@ int32 CFE_TBL_ReadHeaders( int32 FileDescriptor,
     }
     else
     {
-        /* Verify the file type is a cFE compatible file */
-        if (StdFileHeaderPtr->ContentType != CFE_FS_FILE_CONTENT_ID)
-        {
-            CFE_EVS_SendEventWithAppID(CFE_TBL_FILE_TYPE_ERR_EID,
-                                       CFE_EVS_EventType_ERROR,
-                                       CFE_TBL_TaskData.TableTaskAppId,
-                                       "File '%s' is not a cFE file type, ContentType = 0x%08X",
-                                       LoadFilename, (unsigned int)StdFileHeaderPtr->ContentType);
+        Status = CFE_TBL_CheckStdHeader(StdFileHeaderPtr, LoadFilename);
 
-            Status = CFE_TBL_ERR_BAD_CONTENT_ID;
-        }
-        else
+        if (Status == CFE_SUCCESS)
         {
-            /* Verify the SubType to ensure that it is a Table Image File */
-            if (StdFileHeaderPtr->SubType != CFE_FS_SubType_TBL_IMG)
+            Status = OS_read(FileDescriptor, TblFileHeaderPtr, sizeof(CFE_TBL_File_Hdr_t));
+
+            /* Verify successful read of cFE Table File Header */
+            if (Status != sizeof(CFE_TBL_File_Hdr_t))
             {
-                CFE_EVS_SendEventWithAppID(CFE_TBL_FILE_SUBTYPE_ERR_EID,
+                CFE_EVS_SendEventWithAppID(CFE_TBL_FILE_TBL_HDR_ERR_EID,
                                            CFE_EVS_EventType_ERROR,
                                            CFE_TBL_TaskData.TableTaskAppId,
-                                           "File subtype for '%s' is wrong. Subtype = 0x%08X",
-                                           LoadFilename, (unsigned int)StdFileHeaderPtr->SubType);
+                                           "Unable to read tbl header for '%s', Status = 0x%08X",
+                                           LoadFilename, (unsigned int)Status);
 
-                Status = CFE_TBL_ERR_BAD_SUBTYPE_ID;
+                Status = CFE_TBL_ERR_NO_TBL_HEADER;
             }
             else
             {
-                Status = OS_read(FileDescriptor, TblFileHeaderPtr, sizeof(CFE_TBL_File_Hdr_t));
-
-                /* Verify successful read of cFE Table File Header */
-                if (Status != sizeof(CFE_TBL_File_Hdr_t))
+                if ((*(char *)&EndianCheck) == 0x04)
                 {
-                    CFE_EVS_SendEventWithAppID(CFE_TBL_FILE_TBL_HDR_ERR_EID,
-                                               CFE_EVS_EventType_ERROR,
-                                               CFE_TBL_TaskData.TableTaskAppId,
-                                               "Unable to read tbl header for '%s', Status = 0x%08X",
-                                               LoadFilename, (unsigned int)Status);
-
-                    Status = CFE_TBL_ERR_NO_TBL_HEADER;
+                    /* If this is a little endian processor, then the standard cFE Table Header,   */
+                    /* which is in big endian format, must be swapped so that the data is readable */
+                    CFE_TBL_ByteSwapTblHeader(TblFileHeaderPtr);
                 }
-                else
-                {
-                    /* All "required" checks have passed and we are pointing at the data */
-                    Status = CFE_SUCCESS;
 
-                    if ((*(char *)&EndianCheck) == 0x04)
-                    {
-                        /* If this is a little endian processor, then the standard cFE Table Header,   */
-                        /* which is in big endian format, must be swapped so that the data is readable */
-                        CFE_TBL_ByteSwapTblHeader(TblFileHeaderPtr);
-                    }
+                Status = CFE_TBL_CheckTblHeader(StdFileHeaderPtr, TblFileHeaderPtr, LoadFilename);
+            }
+        }
+    }
 
-                    /*
-                     * Ensure termination of all local strings. These were read from a file, so they
-                     * must be treated with appropriate care.  This could happen in case the file got
-                     * damaged in transit or simply was not written properly to begin with.
-                     *
-                     * Since the "TblFileHeaderPtr" is a local buffer, this can be done directly.
-                     */
-                    TblFileHeaderPtr->TableName[sizeof(TblFileHeaderPtr->TableName) - 1] = '\0';
-
-                    /* Verify Spacecraft ID contained in table file header [optional] */
-                    #if (CFE_PLATFORM_TBL_VALID_SCID_COUNT > 0)
-                    if (Status == CFE_SUCCESS)
-                    {
-                        Status = CFE_TBL_ERR_BAD_SPACECRAFT_ID;
-                        for (IndexSC = 0; IndexSC < CFE_PLATFORM_TBL_VALID_SCID_COUNT; IndexSC++)
-                        {
-                            if (StdFileHeaderPtr->SpacecraftID == ListSC[IndexSC])
-                            {
-                                Status = CFE_SUCCESS;
-                            }
-                        }
+    return Status;
+}   /* End of CFE_TBL_ReadHeaders() */
 
-                        if (Status == CFE_TBL_ERR_BAD_SPACECRAFT_ID)
-                        {
-                            CFE_EVS_SendEventWithAppID(CFE_TBL_SPACECRAFT_ID_ERR_EID,
-                                                       CFE_EVS_EventType_ERROR,
-                                                       CFE_TBL_TaskData.TableTaskAppId,
-                                                       "Unable to verify Spacecraft ID for '%s', ID = 0x%08X",
-                                                       LoadFilename, (unsigned int)StdFileHeaderPtr->SpacecraftID);
-                        }
-                    }
-                    #endif
 
-                    /* Verify Processor ID contained in table file header [optional] */
-                    #if (CFE_PLATFORM_TBL_VALID_PRID_COUNT > 0)
-                    if (Status == CFE_SUCCESS)
-                    {
-                        Status = CFE_TBL_ERR_BAD_PROCESSOR_ID;
-                        for (IndexPR = 0; IndexPR < CFE_PLATFORM_TBL_VALID_PRID_COUNT; IndexPR++)
-                        {
-                            if (StdFileHeaderPtr->ProcessorID == ListPR[IndexPR])
-                            {
-                                Status = CFE_SUCCESS;
-                            }
-                        }
+/*******************************************************************
+**
+** CFE_TBL_CheckStdHeader
+**
+** NOTE: For complete prolog information, see 'cfe_tbl_internal.h'
+********************************************************************/
 
-                        if (Status == CFE_TBL_ERR_BAD_PROCESSOR_ID)
-                        {
-                            CFE_EVS_SendEventWithAppID(CFE_TBL_PROCESSOR_ID_ERR_EID,
-                                                       CFE_EVS_EventType_ERROR,
-                                                       CFE_TBL_TaskData.TableTaskAppId,
-                                                       "Unable to verify Processor ID for '%s', ID = 0x%08X",
-                                                       LoadFilename, (unsigned int)StdFileHeaderPtr->ProcessorID);
-                        }
-                    }
-                    #endif
-                }
+int32 CFE_TBL_CheckStdHeader( const CFE_FS_Header_t *StdFileHeaderPtr,
+                              const char *LoadFilename )
+{
+    int32 Status = CFE_SUCCESS;
+
+    /* Verify the file type is a cFE compatible file */
+    if (StdFileHeaderPtr->ContentType != CFE_FS_FILE_CONTENT_ID)
+    {
+        CFE_EVS_SendEventWithAppID(CFE_TBL_FILE_TYPE_ERR_EID,
+                                   CFE_EVS_EventType_ERROR,
+                                   CFE_TBL_TaskData.TableTaskAppId,
+                                   "File '%s' is not a cFE file type, ContentType = 0x%08X",
+                                   LoadFilename, (unsigned int)StdFileHeaderPtr->ContentType);
+
+        Status = CFE_TBL_ERR_BAD_CONTENT_ID;
+    }
+    else
+    {
+        /* Verify the SubType to ensure that it is a Table Image File */
+        if (StdFileHeaderPtr->SubType != CFE_FS_SubType_TBL_IMG)
+        {
+            CFE_EVS_SendEventWithAppID(CFE_TBL_FILE_SUBTYPE_ERR_EID,
+                                       CFE_EVS_EventType_ERROR,
+                                       CFE_TBL_TaskData.TableTaskAppId,
+                                       "File subtype for '%s' is wrong. Subtype = 0x%08X",
+                                       LoadFilename, (unsigned int)StdFileHeaderPtr->SubType);
+
+            Status = CFE_TBL_ERR_BAD_SUBTYPE_ID;
+        }
+    }
+
+    return Status;
+}   /* End of CFE_TBL_CheckStdHeader() */
+
+
+/*******************************************************************
+**
+** CFE_TBL_CheckTblHeader
+**
+** NOTE: For complete prolog information, see 'cfe_tbl_internal.h'
+********************************************************************/
+
+int32 CFE_TBL_CheckTblHeader( const CFE_FS_Header_t *StdFileHeaderPtr,
+                              CFE_TBL_File_Hdr_t *TblFileHeaderPtr,
+                              const char *LoadFilename )
+{
+    /* All "required" checks have passed and we are pointing at the data */
+    int32 Status = CFE_SUCCESS;
+
+    #if (CFE_PLATFORM_TBL_VALID_SCID_COUNT > 0)
+    static uint32 ListSC[2] = { CFE_PLATFORM_TBL_VALID_SCID_1, CFE_PLATFORM_TBL_VALID_SCID_2};
+    uint32 IndexSC;
+    #endif
+    
+    #if (CFE_PLATFORM_TBL_VALID_PRID_COUNT > 0)
+    static uint32 ListPR[4] = { CFE_PLATFORM_TBL_VALID_PRID_1, CFE_PLATFORM_TBL_VALID_PRID_2,
+                                CFE_PLATFORM_TBL_VALID_PRID_3, CFE_PLATFORM_TBL_VALID_PRID_4};
+    uint32 IndexPR;
+    #endif
+
+    /*
+     * Ensure termination of all local strings. These were read from a file, so they
+     * must be treated with appropriate care.  This could happen in case the file got
+     * damaged in transit or simply was not written properly to begin with.
+     *
+     * Since the "TblFileHeaderPtr" is a local buffer, this can be done directly.
+     */
+    TblFileHeaderPtr->TableName[sizeof(TblFileHeaderPtr->TableName) - 1] = '\0';
+
+    /* Verify Spacecraft ID contained in table file header [optional] */
+    #if (CFE_PLATFORM_TBL_VALID_SCID_COUNT > 0)
+    if (Status == CFE_SUCCESS)
+    {
+        Status = CFE_TBL_ERR_BAD_SPACECRAFT_ID;
+        for (IndexSC = 0; IndexSC < CFE_PLATFORM_TBL_VALID_SCID_COUNT; IndexSC++)
+        {
+            if (StdFileHeaderPtr->SpacecraftID == ListSC[IndexSC])
+            {
+                Status = CFE_SUCCESS;
             }
         }
+
+        if (Status == CFE_TBL_ERR_BAD_SPACECRAFT_ID)
+        {
+            CFE_EVS_SendEventWithAppID(CFE_TBL_SPACECRAFT_ID_ERR_EID,
+                                       CFE_EVS_EventType_ERROR,
+                                       CFE_TBL_TaskData.TableTaskAppId,
+                                       "Unable to verify Spacecraft ID for '%s', ID = 0x%08X",
+                                       LoadFilename, (unsigned int)StdFileHeaderPtr->SpacecraftID);
+        }
     }
+    #endif
+
+    /* Verify Processor ID contained in table file header [optional] */
+    #if (CFE_PLATFORM_TBL_VALID_PRID_COUNT > 0)
+    if (Status == CFE_SUCCESS)
+    {
+        Status = CFE_TBL_ERR_BAD_PROCESSOR_ID;
+        for (IndexPR = 0; IndexPR < CFE_PLATFORM_TBL_VALID_PRID_COUNT; IndexPR++)
+        {
+            if (StdFileHeaderPtr->ProcessorID == ListPR[IndexPR])
+            {
+                Status = CFE_SUCCESS;
+            }
+        }
+
+        if (Status == CFE_TBL_ERR_BAD_PROCESSOR_ID)
+        {
+            CFE_EVS_SendEventWithAppID(CFE_TBL_PROCESSOR_ID_ERR_EID,
+                                       CFE_EVS_EventType_ERROR,
+                                       CFE_TBL_TaskData.TableTaskAppId,
+                                       "Unable to verify Processor ID for '%s', ID = 0x%08X",
+                                       LoadFilename, (unsigned int)StdFileHeaderPtr->ProcessorID);
+        }
+    }
+    #endif
 
     return Status;
-}   /* End of CFE_TBL_ReadHeaders() */
+}   /* End of CFE_TBL_CheckTblHeader() */
 
 
 /*******************************************************************
@@ -1342,6 +1666,26 @@ void CFE_TBL_ByteSwapTblHeader(CFE_TBL_File_Hdr_t *HdrPtr)
 } /* End of CFE_TBL_ByteSwapTblHeader() */
 
 
+/*******************************************************************
+**
+** CFE_TBL_ByteSwapStdHeader
+**
+** NOTE: For complete prolog information, see above
+********************************************************************/
+
+void CFE_TBL_ByteSwapStdHeader(CFE_FS_Header_t *HdrPtr)
+{
+    CFE_TBL_ByteSwapUint32(&HdrPtr->ContentType);
+    CFE_TBL_ByteSwapUint32(&HdrPtr->SubType);
+    CFE_TBL_ByteSwapUint32(&HdrPtr->Length);
+    CFE_TBL_ByteSwapUint32(&HdrPtr->SpacecraftID);
+    CFE_TBL_ByteSwapUint32(&HdrPtr->ProcessorID);
+    CFE_TBL_ByteSwapUint32(&HdrPtr->ApplicationID);
+    CFE_TBL_ByteSwapUint32(&HdrPtr->TimeSeconds);
+    CFE_TBL_ByteSwapUint32(&HdrPtr->TimeSubSeconds);
+} /* End of CFE_TBL_ByteSwapStdHeader() */
+
+
 /*******************************************************************
 **
 ** CFE_TBL_ByteSwapUint32
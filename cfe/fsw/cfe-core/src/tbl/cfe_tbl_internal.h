@@ -45,6 +45,27 @@
 #define CFE_TBL_NOT_FOUND               (-1)
 #define CFE_TBL_END_OF_LIST             (CFE_TBL_Handle_t)0xFFFF
 
+/*********************************  Type Definitions   **********************************/
+
+/*******************************************************************************/
+/**   \brief Compressed Table Load State
+**
+**     State of a load from a gzip compressed table file, which is decompressed
+**     straight into the working buffer.  The decompressed stream holds the
+**     standard cFE header, the table header and then the table data.
+*/
+typedef struct
+{
+    CFE_TBL_LoadBuff_t    *WorkingBufferPtr;    /**< \brief Working buffer receiving the table data */
+    CFE_TBL_RegistryRec_t *RegRecPtr;           /**< \brief Registry record of the table being loaded */
+    const char            *Filename;            /**< \brief Name of the file being loaded */
+    CFE_FS_Header_t        StdFileHeader;       /**< \brief Standard cFE header from the file */
+    CFE_TBL_File_Hdr_t     TblFileHeader;       /**< \brief Table header from the file */
+    uint32                 BytesReceived;       /**< \brief Decompressed bytes received so far, headers included */
+    uint32                 Crc;                 /**< \brief CRC of the table buffer up to the last byte received */
+    int32                  Status;              /**< \brief Result of the header checks */
+} CFE_TBL_GzLoad_t;
+
 /*****************************  Function Prototypes   **********************************/
 
 /*****************************************************************************/
@@ -321,6 +342,22 @@ int32   CFE_TBL_LockRegistry(void);
 ******************************************************************************/
 int32   CFE_TBL_UnlockRegistry(void);
 
+/*****************************************************************************/
+/**
+** \brief Reports a quiescent point for a table read address
+**
+** \par Description
+**        Releases any address the handle obtained with #CFE_TBL_GetReadAddress,
+**        so that an update no longer waits for it.
+**
+** \par Assumptions, External Events, and Notes:
+**          The handle must be valid.
+**
+** \param[in]  TblHandle   Handle of the table access descriptor
+**
+******************************************************************************/
+void    CFE_TBL_QuiescentPoint(CFE_TBL_Handle_t TblHandle);
+
 
 /*****************************************************************************/
 /**
@@ -401,6 +438,95 @@ int32   CFE_TBL_LoadFromFile(CFE_TBL_LoadBuff_t *WorkingBufferPtr,
                              CFE_TBL_RegistryRec_t *RegRecPtr, const char *Filename);
 
 
+/*****************************************************************************/
+/**
+** \brief Loads a Table Buffer with data from a gzip compressed file
+**
+** \par Description
+**        Decompresses the specified file straight into the working buffer,
+**        without a temporary file, performing the same checks as
+**        #CFE_TBL_LoadFromFile does on an uncompressed file.
+**
+** \par Assumptions, External Events, and Notes:
+**        -# This function assumes parameters have been verified.
+**
+** \param[in]  WorkingBufferPtr Pointer to a working buffer that is to be loaded
+**                              with the contents of the specified file
+**
+** \param[in]  RegRecPtr        Pointer to Table Registry record for table whose
+**                              buffer is to filled with data from the specified file
+** 
+** \param[in]  Filename         Pointer to ASCII string containing full path and filename
+**                              of the compressed table image file to be loaded
+**
+** \retval #CFE_SUCCESS                      \copydoc CFE_SUCCESS
+** \retval #CFE_TBL_ERR_FILE_TOO_LARGE       \copydoc CFE_TBL_ERR_FILE_TOO_LARGE      
+** \retval #CFE_TBL_WARN_SHORT_FILE          \copydoc CFE_TBL_WARN_SHORT_FILE         
+** \retval #CFE_TBL_WARN_PARTIAL_LOAD        \copydoc CFE_TBL_WARN_PARTIAL_LOAD       
+** \retval #CFE_TBL_ERR_LOAD_INCOMPLETE      \copydoc CFE_TBL_ERR_LOAD_INCOMPLETE
+** \retval #CFE_TBL_ERR_FILE_FOR_WRONG_TABLE \copydoc CFE_TBL_ERR_FILE_FOR_WRONG_TABLE
+** \retval #CFE_TBL_ERR_NO_STD_HEADER        \copydoc CFE_TBL_ERR_NO_STD_HEADER       
+** \retval #CFE_TBL_ERR_NO_TBL_HEADER        \copydoc CFE_TBL_ERR_NO_TBL_HEADER       
+** \retval #CFE_TBL_ERR_BAD_CONTENT_ID       \copydoc CFE_TBL_ERR_BAD_CONTENT_ID      
+** \retval #CFE_TBL_ERR_BAD_SUBTYPE_ID       \copydoc CFE_TBL_ERR_BAD_SUBTYPE_ID      
+** \retval #CFE_FS_GZIP_OPEN_INPUT           \copydoc CFE_FS_GZIP_OPEN_INPUT
+**                     
+******************************************************************************/
+int32   CFE_TBL_LoadFromGzFile(CFE_TBL_LoadBuff_t *WorkingBufferPtr, 
+                               CFE_TBL_RegistryRec_t *RegRecPtr, const char *Filename);
+
+
+/*****************************************************************************/
+/**
+** \brief Receives decompressed data for a compressed table load
+**
+** \par Description
+**        Called by #CFE_FS_DecompressToSink with each run of decompressed
+**        data.  The headers are gathered and checked as soon as they are
+**        complete, and the table data is then copied straight into the
+**        working buffer and added to the running CRC.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \param[in]  SinkArg  Pointer to the #CFE_TBL_GzLoad_t state of the load
+**
+** \param[in]  Data     Pointer to the decompressed data
+**
+** \param[in]  Size     Number of bytes at \c Data
+**
+** \retval #CFE_SUCCESS                      \copydoc CFE_SUCCESS
+** \retval #CFE_TBL_ERR_FILE_TOO_LARGE       \copydoc CFE_TBL_ERR_FILE_TOO_LARGE      
+** \retval #CFE_TBL_ERR_FILE_FOR_WRONG_TABLE \copydoc CFE_TBL_ERR_FILE_FOR_WRONG_TABLE
+** \retval #CFE_TBL_ERR_BAD_CONTENT_ID       \copydoc CFE_TBL_ERR_BAD_CONTENT_ID      
+** \retval #CFE_TBL_ERR_BAD_SUBTYPE_ID       \copydoc CFE_TBL_ERR_BAD_SUBTYPE_ID      
+**                     
+******************************************************************************/
+int32   CFE_TBL_GzLoadSink(void *SinkArg, const uint8 *Data, uint32 Size);
+
+
+/*****************************************************************************/
+/**
+** \brief Checks that a compressed table file fits the table being loaded
+**
+** \par Description
+**        Verifies the table name and the size of the data described by the
+**        table header, records any partial or short load warning, and starts
+**        the CRC with the part of the buffer in front of the loaded data.
+**
+** \par Assumptions, External Events, and Notes:
+**        -# Both headers of \c GzLoad are complete and in processor byte order.
+**
+** \param[in]  GzLoad   Pointer to the state of the compressed table load
+**
+** \retval #CFE_SUCCESS                      \copydoc CFE_SUCCESS
+** \retval #CFE_TBL_ERR_FILE_TOO_LARGE       \copydoc CFE_TBL_ERR_FILE_TOO_LARGE      
+** \retval #CFE_TBL_ERR_FILE_FOR_WRONG_TABLE \copydoc CFE_TBL_ERR_FILE_FOR_WRONG_TABLE
+**                     
+******************************************************************************/
+int32   CFE_TBL_CheckGzLoadFits(CFE_TBL_GzLoad_t *GzLoad);
+
+
 /*****************************************************************************/
 /**
 ** \brief Updates the active table buffer with contents of inactive buffer
@@ -487,6 +613,58 @@ int32 CFE_TBL_ReadHeaders( int32 FileDescriptor,
                            const char *LoadFilename );
 
 
+/*****************************************************************************/
+/**
+** \brief Checks a Table File's standard cFE Header
+**
+** \par Description
+**        Verifies that the standard cFE header describes a table image file.
+**
+** \par Assumptions, External Events, and Notes:
+**        -# The header is in processor byte order.
+**
+** \param[in]  StdFileHeaderPtr  Pointer to the file's standard cFE Header
+**
+** \param[in]  LoadFilename      Pointer to character string containing full path
+**                               and filename of table image to be loaded
+**
+** \retval #CFE_SUCCESS                     \copydoc CFE_SUCCESS
+** \retval #CFE_TBL_ERR_BAD_CONTENT_ID      \copydoc CFE_TBL_ERR_BAD_CONTENT_ID
+** \retval #CFE_TBL_ERR_BAD_SUBTYPE_ID      \copydoc CFE_TBL_ERR_BAD_SUBTYPE_ID
+**                     
+******************************************************************************/
+int32 CFE_TBL_CheckStdHeader( const CFE_FS_Header_t *StdFileHeaderPtr,
+                              const char *LoadFilename );
+
+
+/*****************************************************************************/
+/**
+** \brief Checks a Table File's cFE Table Header
+**
+** \par Description
+**        Terminates the table name and verifies the optional spacecraft and
+**        processor IDs.
+**
+** \par Assumptions, External Events, and Notes:
+**        -# Both headers are in processor byte order.
+**
+** \param[in]  StdFileHeaderPtr  Pointer to the file's standard cFE Header
+**
+** \param[in]  TblFileHeaderPtr  Pointer to the file's cFE Table Header
+**
+** \param[in]  LoadFilename      Pointer to character string containing full path
+**                               and filename of table image to be loaded
+**
+** \retval #CFE_SUCCESS                     \copydoc CFE_SUCCESS
+** \retval #CFE_TBL_ERR_BAD_SPACECRAFT_ID   \copydoc CFE_TBL_ERR_BAD_SPACECRAFT_ID
+** \retval #CFE_TBL_ERR_BAD_PROCESSOR_ID    \copydoc CFE_TBL_ERR_BAD_PROCESSOR_ID
+**                     
+******************************************************************************/
+int32 CFE_TBL_CheckTblHeader( const CFE_FS_Header_t *StdFileHeaderPtr,
+                              CFE_TBL_File_Hdr_t *TblFileHeaderPtr,
+                              const char *LoadFilename );
+
+
 
 /*****************************************************************************/
 /**
@@ -522,6 +700,26 @@ void CFE_TBL_InitRegistryRecord (CFE_TBL_RegistryRec_t *RegRecPtr);
 void CFE_TBL_ByteSwapTblHeader(CFE_TBL_File_Hdr_t *HdrPtr);
 
 
+/*****************************************************************************/
+/**
+** \brief Byte swaps a CFE_FS_Header_t structure
+**
+** \par Description
+**        Converts a big-endian version of a CFE_FS_Header_t structure to
+**        a little-endian version and vice-versa.
+**
+** \par Assumptions, External Events, and Notes:
+**          None
+**
+** \param[in]  HdrPtr   Pointer to standard header that needs to be swapped.
+** 
+** \param[out] *HdrPtr  The swapped header
+**
+**                     
+******************************************************************************/
+void CFE_TBL_ByteSwapStdHeader(CFE_FS_Header_t *HdrPtr);
+
+
 /*****************************************************************************/
 /**
 ** \brief Searches the Critical Table Registry for the given handle
@@ -84,6 +84,22 @@
 */ 
 #define CFE_TBL_NO_DUMP_PENDING (-1) 
 
+/*
+** A reader that obtained its address with CFE_TBL_GetReadAddress publishes
+** the table epoch it entered, rather than setting its lock flag, so that
+** updates only wait for readers that may still hold the retired buffer.
+** The epoch and the active buffer index are then shared without a lock and
+** need the atomic builtins.  Compilers that do not provide them fall back
+** to the lock flag used by CFE_TBL_GetAddress, and CFE_TBL_READ_EPOCH is
+** always 0 so that only the lock flag holds off an update.
+*/
+#if defined(__GNUC__)
+#define CFE_TBL_LOCKFREE_READ
+#define CFE_TBL_READ_EPOCH(Handle)  __atomic_load_n(&CFE_TBL_TaskData.Handles[Handle].ReadEpoch, __ATOMIC_SEQ_CST)
+#else
+#define CFE_TBL_READ_EPOCH(Handle)  0
+#endif
+
 /************************  Internal Structure Definitions  *****************************/
 
 /*******************************************************************************/
@@ -173,6 +189,7 @@ typedef struct
     bool                  LockFlag;         /**< \brief Indicates whether thread is currently accessing table data */
     bool                  Updated;          /**< \brief Indicates table has been updated since last GetAddress call */
     uint8                 BufferIndex;      /**< \brief Index of buffer currently being used */
+    uint32                ReadEpoch;        /**< \brief Table epoch seen by #CFE_TBL_GetReadAddress, 0 when quiescent */
 } CFE_TBL_AccessDescriptor_t;
 
 
@@ -196,6 +213,7 @@ typedef struct
     int32                       ValidateActiveIndex;    /**< \brief Index to Validation Request on Active Table Result data */
     int32                       ValidateInactiveIndex;  /**< \brief Index to Validation Request on Inactive Table Result data */
     int32                       DumpControlIndex;       /**< \brief Index to Dump Control Block */
+    uint32                      Epoch;              /**< \brief Incremented each time a new active buffer is published */
     CFE_ES_CDSHandle_t          CDSHandle;          /**< \brief Handle to Critical Data Store for Critical Tables */
     uint16                      NotificationCC;     /**< \brief Command Code of an associated management notification message */
     bool                        CriticalTable;      /**< \brief Flag indicating whether table is a Critical Table */
@@ -632,8 +632,16 @@ uint32  CFE_TIME_Micro2SubSecs(uint32 MicroSeconds)
     **
     **  Conversion factor was reduced and factored accordingly
     **  to minimize precision loss and register overflow.
+    **
+    **  Both divisions are done as a multiply by a fixed-point
+    **  reciprocal and a shift, which gives the same quotient for
+    **  every input below one second (checked over 0 - 999999) and
+    **  avoids a divide call on targets without hardware divide:
+    **    n / 5     = ( n * 0xCCCCCCCD ) >> 34
+    **    ( n << 3 ) / 3125 = ( n * 0x14F8B588F ) >> 41
     */
-        SubSeconds = ( ( ( ( MicroSeconds << 11 ) / 5 ) << 3 ) / 3125 ) << 12;
+        SubSeconds = (uint32)(((uint64)(MicroSeconds << 11) * CFE_TIME_DIV5_MULT) >> CFE_TIME_DIV5_SHIFT);
+        SubSeconds = (uint32)(((uint64)SubSeconds * CFE_TIME_DIV3125_MULT) >> CFE_TIME_DIV3125_SHIFT) << 12;
 
         /* To get the SubSeconds to "bump up" against 0xFFFFF000 when 
          * MicroSeconds = 9999999, we add in another anomaly to the 
@@ -856,6 +856,8 @@ int32 CFE_TIME_ResetCountersCmd(const CFE_TIME_ResetCounters_t *data)
     CFE_TIME_TaskData.InternalCount   = 0;
     CFE_TIME_TaskData.ExternalCount   = 0;
 
+    CFE_TIME_TaskData.DisciplineStepCounter = 0;
+
     CFE_EVS_SendEvent(CFE_TIME_RESET_EID, CFE_EVS_EventType_DEBUG,
                      "Reset Counters command");
 
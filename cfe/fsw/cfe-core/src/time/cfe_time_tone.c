@@ -1040,6 +1040,11 @@ void CFE_TIME_ToneUpdate(void)
     }
     #endif /* CFE_PLATFORM_TIME_CFG_CLIENT */
 
+    /*
+    ** Slew toward the new time at the tone rather than step to it...
+    */
+    CFE_TIME_DisciplineClock(&Reference, NextState);
+
     /*
     ** Complete the time update.
     */
@@ -1059,6 +1064,158 @@ void CFE_TIME_ToneUpdate(void)
 } /* End of CFE_TIME_ToneUpdate() */
 
 
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* CFE_TIME_DisciplineClock() -- discipline MET to the tone        */
+/*                                                                 */
+/* Called with the reference state that was in use before the      */
+/* tone and the pending state, which holds the MET and local clock */
+/* latched at the tone.                                            */
+/*                                                                 */
+/* The frequency error of the local clock is measured from the     */
+/* MET and latch of successive tones and low pass filtered.  The   */
+/* phase error is the tone MET less the MET that the disciplined   */
+/* clock reached at the same latch.  Small phase errors are not    */
+/* stepped out: the pending state keeps the disciplined MET at the */
+/* tone and runs at the filtered frequency plus a fraction of the  */
+/* phase error per second, so time stays continuous and monotonic. */
+/* The first tone, a large phase error, or a step limit of zero    */
+/* step the MET to the tone value as before.                       */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void CFE_TIME_DisciplineClock(const CFE_TIME_Reference_t *Reference,
+                              volatile CFE_TIME_ReferenceState_t *NextState)
+{
+    CFE_TIME_SysTime_t ToneMET;
+    CFE_TIME_SysTime_t ToneLatch;
+    CFE_TIME_SysTime_t ExpectedMET;
+    CFE_TIME_SysTime_t Elapsed;
+    uint64 LocalDelta;
+    int64  Phase;
+    int64  Offset;
+    int64  Limit;
+    int64  Rate;
+    uint32 Shift;
+
+    ToneMET   = NextState->AtToneMET;
+    ToneLatch = NextState->AtToneLatch;
+
+    /*
+    ** MET the disciplined clock reached at the new tone...
+    */
+    Elapsed = CFE_TIME_LatchDelta(Reference->AtToneLatch, ToneLatch);
+    ExpectedMET = CFE_TIME_Add(CFE_TIME_RateAdjust(Elapsed, Reference->AtToneRate),
+                               Reference->AtToneMET);
+
+    Phase = (int64)((((uint64)ToneMET.Seconds << 32) | ToneMET.Subseconds) -
+                    (((uint64)ExpectedMET.Seconds << 32) | ExpectedMET.Subseconds));
+
+    Limit = CFE_TIME_TaskData.DisciplineStepLimit;
+
+    if ((!CFE_TIME_TaskData.DisciplineValid) || (Phase > Limit) || (Phase < -Limit))
+    {
+        /*
+        ** Step -- keep the tone MET, run at the frequency estimate...
+        */
+        NextState->AtToneRate = CFE_TIME_TaskData.DisciplineFreq;
+        CFE_TIME_TaskData.DisciplineStepCounter++;
+        CFE_TIME_TaskData.DisciplineValid = (Limit != 0);
+    }
+    else
+    {
+        /*
+        ** Frequency error measured since the previous tone...
+        **
+        ** The offset is clamped to a fraction of the interval so that
+        **    the shifted value below stays well inside 64 bits.
+        */
+        Elapsed = CFE_TIME_LatchDelta(CFE_TIME_TaskData.DisciplineToneLatch, ToneLatch);
+        LocalDelta = ((uint64)Elapsed.Seconds << 32) | Elapsed.Subseconds;
+
+        if ((Elapsed.Seconds < CFE_TIME_DISCIPLINE_MAX_SECS) && (LocalDelta >= 0x80000000))
+        {
+            Offset = (int64)(((((uint64)ToneMET.Seconds << 32) | ToneMET.Subseconds) -
+                              (((uint64)CFE_TIME_TaskData.DisciplineToneMET.Seconds << 32) |
+                               CFE_TIME_TaskData.DisciplineToneMET.Subseconds)) - LocalDelta);
+            Limit = (int64)(LocalDelta >> 8);
+
+            if (Offset > Limit)
+            {
+                Offset = Limit;
+            }
+            else if (Offset < -Limit)
+            {
+                Offset = -Limit;
+            }
+
+            Rate = (Offset * (1 << 24)) / (int64)(LocalDelta >> 8);
+
+            if (Rate > CFE_TIME_DISCIPLINE_MAX_RATE)
+            {
+                Rate = CFE_TIME_DISCIPLINE_MAX_RATE;
+            }
+            else if (Rate < -CFE_TIME_DISCIPLINE_MAX_RATE)
+            {
+                Rate = -CFE_TIME_DISCIPLINE_MAX_RATE;
+            }
+
+            /*
+            ** The first measurements are weighted 1, 1/2, 1/4 ... so the
+            **    estimate locks quickly before the filter settles to its
+            **    configured gain...
+            */
+            if (CFE_TIME_TaskData.DisciplineSamples < CFE_PLATFORM_TIME_CFG_FREQ_SHIFT)
+            {
+                Shift = CFE_TIME_TaskData.DisciplineSamples;
+                CFE_TIME_TaskData.DisciplineSamples++;
+            }
+            else
+            {
+                Shift = CFE_PLATFORM_TIME_CFG_FREQ_SHIFT;
+            }
+
+            CFE_TIME_TaskData.DisciplineFreq +=
+                    (int32)((Rate - CFE_TIME_TaskData.DisciplineFreq) >> Shift);
+        }
+
+        /*
+        ** Slew -- keep the disciplined MET, remove part of the phase error
+        **    each second...
+        */
+        Rate = CFE_TIME_TaskData.DisciplineFreq + (Phase >> CFE_PLATFORM_TIME_CFG_SLEW_SHIFT);
+
+        if (Rate > 2 * (int64)CFE_TIME_DISCIPLINE_MAX_RATE)
+        {
+            Rate = 2 * (int64)CFE_TIME_DISCIPLINE_MAX_RATE;
+        }
+        else if (Rate < -2 * (int64)CFE_TIME_DISCIPLINE_MAX_RATE)
+        {
+            Rate = -2 * (int64)CFE_TIME_DISCIPLINE_MAX_RATE;
+        }
+
+        NextState->AtToneMET  = ExpectedMET;
+        NextState->AtToneRate = (int32)Rate;
+    }
+
+    if (Phase > 0x7FFFFFFF)
+    {
+        Phase = 0x7FFFFFFF;
+    }
+    else if (Phase < -0x7FFFFFFF)
+    {
+        Phase = -0x7FFFFFFF;
+    }
+
+    CFE_TIME_TaskData.DisciplinePhase = (int32)Phase;
+    CFE_TIME_TaskData.DisciplineToneMET   = ToneMET;
+    CFE_TIME_TaskData.DisciplineToneLatch = ToneLatch;
+
+    return;
+
+} /* End of CFE_TIME_DisciplineClock() */
+
+
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
 /* CFE_TIME_Local1HzTimerCallback() -- 1Hz callback routine        */
@@ -1318,6 +1475,17 @@ void CFE_TIME_Local1HzStateMachine(void)
             ** Change current state to "fly-wheel"...
             */
             NextState->ClockFlyState = CFE_TIME_FlywheelState_IS_FLY;
+
+            /*
+            ** Hold the estimated frequency but stop slewing out the phase
+            **    error of the last tone, starting from the current time
+            **    so that the rate change does not move it...
+            */
+            NextState->AtToneMET   = CFE_TIME_Add(CFE_TIME_RateAdjust(Reference.TimeSinceTone,
+                                                                  Reference.AtToneRate),
+                                                Reference.AtToneMET);
+            NextState->AtToneLatch = Reference.CurrentLatch;
+            NextState->AtToneRate  = CFE_TIME_TaskData.DisciplineFreq;
             #if (CFE_PLATFORM_TIME_CFG_SERVER == true)
             CFE_TIME_TaskData.ServerFlyState = CFE_TIME_FlywheelState_IS_FLY;
             #endif
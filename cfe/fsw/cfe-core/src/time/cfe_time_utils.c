@@ -58,6 +58,12 @@ volatile CFE_TIME_ReferenceState_t *CFE_TIME_StartReferenceUpdate(void)
 
     NextState->StateVersion = Version;
 
+    /*
+     * A reader still on this slot from a lapped version must see the
+     * new StateVersion before any of the fields below change.
+     */
+    CFE_TIME_REFERENCE_SYNC();
+
     /* initially propagate all previous values to next values */
     NextState->AtToneLeapSeconds = CurrState->AtToneLeapSeconds;
     NextState->ClockSetState = CurrState->ClockSetState;
@@ -67,6 +73,7 @@ volatile CFE_TIME_ReferenceState_t *CFE_TIME_StartReferenceUpdate(void)
     NextState->AtToneSTCF = CurrState->AtToneSTCF;
     NextState->AtToneDelay = CurrState->AtToneDelay;
     NextState->AtToneLatch = CurrState->AtToneLatch;
+    NextState->AtToneRate = CurrState->AtToneRate;
 
     return NextState;
 }
@@ -359,6 +366,20 @@ void CFE_TIME_InitData(void)
     CFE_TIME_TaskData.MaxLocalClock.Seconds    = CFE_PLATFORM_TIME_MAX_LOCAL_SECS;
     CFE_TIME_TaskData.MaxLocalClock.Subseconds = CFE_PLATFORM_TIME_MAX_LOCAL_SUBS;
 
+    /*
+    ** Clock discipline loop starts by stepping to the first tone...
+    */
+    CFE_TIME_TaskData.DisciplineToneMET.Seconds      = 0;
+    CFE_TIME_TaskData.DisciplineToneMET.Subseconds   = 0;
+    CFE_TIME_TaskData.DisciplineToneLatch.Seconds    = 0;
+    CFE_TIME_TaskData.DisciplineToneLatch.Subseconds = 0;
+    CFE_TIME_TaskData.DisciplineStepLimit   = CFE_TIME_Micro2SubSecs(CFE_PLATFORM_TIME_CFG_STEP_LIMIT);
+    CFE_TIME_TaskData.DisciplineFreq        = 0;
+    CFE_TIME_TaskData.DisciplinePhase       = 0;
+    CFE_TIME_TaskData.DisciplineStepCounter = 0;
+    CFE_TIME_TaskData.DisciplineSamples     = 0;
+    CFE_TIME_TaskData.DisciplineValid       = false;
+
     /*
     ** Range limits for time between tone signal interrupts...
     */
@@ -604,6 +625,14 @@ void CFE_TIME_GetDiagData(void)
     */
     CFE_TIME_Copy(&CFE_TIME_TaskData.DiagPacket.Payload.MaxLocalClock, &CFE_TIME_TaskData.MaxLocalClock);
 
+    /*
+    ** Clock discipline loop state...
+    */
+    CFE_TIME_TaskData.DiagPacket.Payload.RateError   = CFE_TIME_TaskData.DisciplineFreq;
+    CFE_TIME_TaskData.DiagPacket.Payload.PhaseError  = CFE_TIME_TaskData.DisciplinePhase;
+    CFE_TIME_TaskData.DiagPacket.Payload.SlewRate    = Reference.AtToneRate;
+    CFE_TIME_TaskData.DiagPacket.Payload.StepCounter = CFE_TIME_TaskData.DisciplineStepCounter;
+
     /*
     ** Tone signal tolerance limits...
     */
@@ -635,25 +664,30 @@ void CFE_TIME_GetReference(CFE_TIME_Reference_t *Reference)
     volatile CFE_TIME_ReferenceState_t *RefState;
 
     /*
-    ** VersionCounter is incremented when reference data is modified...
+    ** VersionCounter is incremented when reference data is modified.
+    ** The reads are a seqlock: the barrier after the counter is read
+    ** pairs with the one in CFE_TIME_FinishReferenceUpdate(), and the
+    ** barrier after the copy keeps it ahead of the StateVersion check.
     */
     while (true)
     {
         VersionCounter = CFE_TIME_TaskData.LastVersionCounter;
+        CFE_TIME_REFERENCE_SYNC();
         RefState = &CFE_TIME_TaskData.ReferenceState[VersionCounter & CFE_TIME_REFERENCE_BUF_MASK];
 
-        Reference->CurrentLatch = CFE_TIME_LatchClock();
-
         Reference->AtToneMET    = RefState->AtToneMET;
         Reference->AtToneSTCF   = RefState->AtToneSTCF;
         Reference->AtToneLeapSeconds  = RefState->AtToneLeapSeconds;
         Reference->AtToneDelay  = RefState->AtToneDelay;
         Reference->AtToneLatch  = RefState->AtToneLatch;
+        Reference->AtToneRate   = RefState->AtToneRate;
 
         Reference->ClockSetState  = RefState->ClockSetState;
         Reference->ClockFlyState  = RefState->ClockFlyState;
         Reference->DelayDirection = RefState->DelayDirection;
 
+        CFE_TIME_REFERENCE_SYNC();
+
         /*
          * If the version counter inside the state record
          * is the same value as the global _after_ copying the
@@ -682,31 +716,25 @@ void CFE_TIME_GetReference(CFE_TIME_Reference_t *Reference)
         --RetryCount;
     }
 
+    /*
+    ** Latch once, after the copy, so the local clock can never read
+    ** earlier than the latch at tone of the state that was copied...
+    */
+    Reference->CurrentLatch = CFE_TIME_LatchClock();
+
     /*
     ** Compute the amount of time "since" the tone...
     */
-    if (CFE_TIME_Compare(Reference->CurrentLatch, Reference->AtToneLatch) == CFE_TIME_A_LT_B)
-    {
-        /*
-        ** Local clock has rolled over since last tone...
-        */
-        TimeSinceTone = CFE_TIME_Subtract(CFE_TIME_TaskData.MaxLocalClock, Reference->AtToneLatch);
-        TimeSinceTone = CFE_TIME_Add(TimeSinceTone, Reference->CurrentLatch);
-    }
-    else
-    {
-        /*
-        ** Normal case -- local clock is greater than latch at tone...
-        */
-        TimeSinceTone = CFE_TIME_Subtract(Reference->CurrentLatch, Reference->AtToneLatch);
-    }
+    TimeSinceTone = CFE_TIME_LatchDelta(Reference->AtToneLatch, Reference->CurrentLatch);
 
     Reference->TimeSinceTone = TimeSinceTone;
 
     /*
-    ** Add in the MET at the tone...
+    ** Add in the MET at the tone, running the local clock at the
+    ** disciplined rate...
     */
-    CurrentMET = CFE_TIME_Add(TimeSinceTone, Reference->AtToneMET);
+    CurrentMET = CFE_TIME_Add(CFE_TIME_RateAdjust(TimeSinceTone, Reference->AtToneRate),
+                              Reference->AtToneMET);
 
 
     /*
@@ -730,6 +758,68 @@ void CFE_TIME_GetReference(CFE_TIME_Reference_t *Reference)
 } /* End of CFE_TIME_GetReference() */
 
 
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* CFE_TIME_LatchDelta() -- local clock elapsed between latches    */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+CFE_TIME_SysTime_t CFE_TIME_LatchDelta(CFE_TIME_SysTime_t Start, CFE_TIME_SysTime_t End)
+{
+    CFE_TIME_SysTime_t Elapsed;
+
+    if (CFE_TIME_Compare(End, Start) == CFE_TIME_A_LT_B)
+    {
+        /*
+        ** Local clock has rolled over between the latches...
+        */
+        Elapsed = CFE_TIME_Subtract(CFE_TIME_TaskData.MaxLocalClock, Start);
+        Elapsed = CFE_TIME_Add(Elapsed, End);
+    }
+    else
+    {
+        /*
+        ** Normal case -- later latch is greater than earlier latch...
+        */
+        Elapsed = CFE_TIME_Subtract(End, Start);
+    }
+
+    return(Elapsed);
+
+} /* End of CFE_TIME_LatchDelta() */
+
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* CFE_TIME_RateAdjust() -- scale local clock elapsed time to MET  */
+/*                                                                 */
+/* Rate is the disciplined rate correction, in 2^-32 seconds per   */
+/* second.  It is limited to a few parts per thousand, so the      */
+/* products below cannot overflow 64 bits.                         */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+CFE_TIME_SysTime_t CFE_TIME_RateAdjust(CFE_TIME_SysTime_t Elapsed, int32 Rate)
+{
+    uint64 Scaled;
+    int64  Correction;
+
+    if (Rate != 0)
+    {
+        Correction = ((int64)Elapsed.Seconds * Rate) +
+                     (((int64)Elapsed.Subseconds * Rate) >> 32);
+
+        Scaled = (((uint64)Elapsed.Seconds << 32) | Elapsed.Subseconds) + (uint64)Correction;
+
+        Elapsed.Seconds    = (uint32)(Scaled >> 32);
+        Elapsed.Subseconds = (uint32)Scaled;
+    }
+
+    return(Elapsed);
+
+} /* End of CFE_TIME_RateAdjust() */
+
+
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
 /* CFE_TIME_CalculateTAI() -- calculate TAI from reference data    */
@@ -1002,6 +1092,11 @@ void CFE_TIME_SetMET(CFE_TIME_SysTime_t NewMET)
     CFE_TIME_TaskData.VirtualMET   = NewMET.Seconds;
     RefState->AtToneLatch  = CFE_TIME_LatchClock();
 
+    /*
+    ** The next tone cannot be compared against the old MET...
+    */
+    CFE_TIME_TaskData.DisciplineValid = false;
+
     /*
     ** Update h/w MET register...
     */
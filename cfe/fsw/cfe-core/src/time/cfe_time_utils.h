@@ -49,6 +49,24 @@
 
 #define CFE_TIME_NEGATIVE        0x80000000  /* ~ 68 * 31,536,000 seconds */
 
+/*
+** Fixed-point reciprocals used by CFE_TIME_Micro2SubSecs()...
+*/
+#define CFE_TIME_DIV5_MULT       0xCCCCCCCDULL   /* ceil(2^34 / 5)     */
+#define CFE_TIME_DIV5_SHIFT      34
+#define CFE_TIME_DIV3125_MULT    0x14F8B588FULL  /* ceil(2^44 / 3125), applied before the << 3 */
+#define CFE_TIME_DIV3125_SHIFT   41
+
+/*
+** Clock discipline loop limits...
+**
+** Rates are fractions of a second per second in units of 2^-32
+** (about 0.23 parts per billion).  Frequency is only measured over
+** tone intervals shorter than CFE_TIME_DISCIPLINE_MAX_SECS.
+*/
+#define CFE_TIME_DISCIPLINE_MAX_RATE  ((int32)(((uint64)CFE_PLATFORM_TIME_CFG_MAX_RATE << 32) / 1000000))
+#define CFE_TIME_DISCIPLINE_MAX_SECS  64
+
 /*************************************************************************/
 
 /*
@@ -124,6 +142,7 @@ typedef struct
   int16                 DelayDirection; /* Wheter "AtToneDelay" is add or subtract */
   CFE_TIME_SysTime_t    AtToneDelay;    /* Adjustment for slow tone detection */
   CFE_TIME_SysTime_t    AtToneLatch;    /* Local clock latched at time of tone */
+  int32                 AtToneRate;     /* MET rate correction since tone (2^-32 s/s) */
   CFE_TIME_SysTime_t    CurrentLatch;   /* Local clock latched just "now" */
   CFE_TIME_SysTime_t    TimeSinceTone;  /* Time elapsed since the tone */
   CFE_TIME_SysTime_t    CurrentMET;     /* MET at this instant */
@@ -159,6 +178,8 @@ typedef struct
     CFE_TIME_SysTime_t    AtToneDelay;
     CFE_TIME_SysTime_t    AtToneLatch;
 
+    int32                 AtToneRate;
+
 } CFE_TIME_ReferenceState_t;
 
 /*************************************************************************/
@@ -256,6 +277,18 @@ typedef struct
   */
   CFE_TIME_SysTime_t    MaxLocalClock;
 
+  /*
+  ** Clock discipline loop state (see CFE_TIME_DisciplineClock)...
+  */
+  CFE_TIME_SysTime_t    DisciplineToneMET;    /* MET received at the previous tone */
+  CFE_TIME_SysTime_t    DisciplineToneLatch;  /* Local clock latched at the previous tone */
+  uint32                DisciplineStepLimit;  /* Largest phase error slewed (sub-seconds) */
+  int32                 DisciplineFreq;       /* Filtered frequency correction (2^-32 s/s) */
+  int32                 DisciplinePhase;      /* Phase error at the most recent tone (sub-seconds) */
+  uint32                DisciplineStepCounter;    /* Tones that stepped the MET */
+  uint32                DisciplineSamples;    /* Frequency measurements taken, up to the filter shift */
+  bool                  DisciplineValid;      /* Previous tone values can be used */
+
   /*
   ** Clock state has been commanded into (CFE_TIME_ClockState_FLYWHEEL)...
   */
@@ -360,6 +393,8 @@ void CFE_TIME_GetHkData(const CFE_TIME_Reference_t *Reference);
 ** Function prototypes (reference)...
 */
 void CFE_TIME_GetReference(CFE_TIME_Reference_t *Reference);
+CFE_TIME_SysTime_t CFE_TIME_LatchDelta(CFE_TIME_SysTime_t Start, CFE_TIME_SysTime_t End);
+CFE_TIME_SysTime_t CFE_TIME_RateAdjust(CFE_TIME_SysTime_t Elapsed, int32 Rate);
 
 /*
 ** Function prototypes (calculate TAI/UTC)...
@@ -416,6 +451,19 @@ int32 CFE_TIME_ToneSendTime(CFE_TIME_SysTime_t NewTime);
 #endif
 
 
+/*
+** The reference state is read as a seqlock: LastVersionCounter selects the
+** slot to read, and the StateVersion inside the slot is checked again after
+** the copy.  A full memory barrier orders the counter and StateVersion with
+** the slot contents on both sides.  Compilers that do not provide a barrier
+** rely on the volatile accesses alone, as the reference state did before.
+*/
+#if defined(__GNUC__)
+#define CFE_TIME_REFERENCE_SYNC()   __sync_synchronize()
+#else
+#define CFE_TIME_REFERENCE_SYNC()
+#endif
+
 /*
  * Helper function for updating the "Reference" value
  * This is the local replacement for "OS_IntLock()"
@@ -428,6 +476,8 @@ volatile CFE_TIME_ReferenceState_t *CFE_TIME_StartReferenceUpdate(void);
  */
 static inline void CFE_TIME_FinishReferenceUpdate(volatile CFE_TIME_ReferenceState_t *NextState)
 {
+    /* the new state must be visible before the counter that selects it */
+    CFE_TIME_REFERENCE_SYNC();
     CFE_TIME_TaskData.LastVersionCounter = NextState->StateVersion;
 }
 
@@ -438,8 +488,13 @@ static inline void CFE_TIME_FinishReferenceUpdate(volatile CFE_TIME_ReferenceSta
  */
 static inline volatile CFE_TIME_ReferenceState_t *CFE_TIME_GetReferenceState(void)
 {
-    return &CFE_TIME_TaskData.ReferenceState
+    volatile CFE_TIME_ReferenceState_t *RefState;
+
+    RefState = &CFE_TIME_TaskData.ReferenceState
             [CFE_TIME_TaskData.LastVersionCounter & CFE_TIME_REFERENCE_BUF_MASK];
+    CFE_TIME_REFERENCE_SYNC();
+
+    return RefState;
 }
 
 /*
@@ -449,6 +504,8 @@ void CFE_TIME_ToneSignal(void);
 void CFE_TIME_ToneData(const CFE_TIME_ToneDataCmd_Payload_t *Packet);
 void CFE_TIME_ToneVerify(CFE_TIME_SysTime_t Time1, CFE_TIME_SysTime_t Time2);
 void CFE_TIME_ToneUpdate(void);
+void CFE_TIME_DisciplineClock(const CFE_TIME_Reference_t *Reference,
+                              volatile CFE_TIME_ReferenceState_t *NextState);
 
 /*
 ** Function prototypes (tone 1Hz interrupt)...
@@ -119,6 +119,20 @@
 #endif
 
 
+/*
+** Validate clock discipline loop settings...
+*/
+#if CFE_PLATFORM_TIME_CFG_STEP_LIMIT > 999999
+    #error CFE_PLATFORM_TIME_CFG_STEP_LIMIT must be less than one second!
+#endif
+#if CFE_PLATFORM_TIME_CFG_FREQ_SHIFT >= 16 || CFE_PLATFORM_TIME_CFG_SLEW_SHIFT >= 16
+    #error CFE_PLATFORM_TIME_CFG_FREQ_SHIFT and CFE_PLATFORM_TIME_CFG_SLEW_SHIFT must be less than 16!
+#endif
+#if CFE_PLATFORM_TIME_CFG_MAX_RATE < 1 || CFE_PLATFORM_TIME_CFG_MAX_RATE > 100000
+    #error CFE_PLATFORM_TIME_CFG_MAX_RATE must be between 1 and 100000 parts per million!
+#endif
+
+
 /*
 ** Validate tone signal and data packet arrival selection...
 */
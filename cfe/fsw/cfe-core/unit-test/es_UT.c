@@ -311,6 +311,7 @@ void ES_ResetUnitTest(void)
     for (j = 0; j < CFE_PLATFORM_ES_MAX_APPLICATIONS; j++)
     {
         CFE_ES_Global.AppTable[j].AppState = CFE_ES_AppState_UNDEFINED;
+        CFE_ES_Global.AppGeneration[j] = 0;
     }
 
     for (j = 0; j < OS_MAX_TASKS; j++)
@@ -366,6 +367,7 @@ void TestStartupErrorPaths(void)
     uint32 ResetType;
     uint32 Id;
     uint32 TestObjId;
+    uint32 WaitRemaining;
 
 #ifdef UT_VERBOSE
     UT_Text("Begin Test Startup Error Paths\n");
@@ -811,6 +813,41 @@ void TestStartupErrorPaths(void)
                                         CFE_ES_AppState_LATE_INIT,
               "CFE_ES_WaitForSystemState",
               "Min System State is CFE_ES_SystemState_APPS_INIT");
+
+    /* Test the startup sync wait being woken by a state change */
+    ES_ResetUnitTest();
+    CFE_ES_Global.StartupSyncSem = 1;
+    WaitRemaining = CFE_PLATFORM_ES_STARTUP_SYNC_POLL_MSEC + 10;
+    UT_Report(__FILE__, __LINE__,
+              CFE_ES_StartupSyncWait(&WaitRemaining) &&
+              WaitRemaining == CFE_PLATFORM_ES_STARTUP_SYNC_POLL_MSEC + 9 &&
+              UT_GetStubCount(UT_KEY(OS_TaskDelay)) == 0,
+              "CFE_ES_StartupSyncWait",
+              "Woken by state change");
+
+    /* Test the startup sync wait timing out */
+    ES_ResetUnitTest();
+    UT_SetForceFail(UT_KEY(OS_BinSemTimedWait), OS_SEM_TIMEOUT);
+    UT_Report(__FILE__, __LINE__,
+              CFE_ES_StartupSyncWait(&WaitRemaining) &&
+              WaitRemaining == 9 &&
+              CFE_ES_StartupSyncWait(&WaitRemaining) &&
+              WaitRemaining == 0 &&
+              !CFE_ES_StartupSyncWait(&WaitRemaining),
+              "CFE_ES_StartupSyncWait",
+              "Timed out");
+
+    /* Test the startup sync wait falling back to a delay without the semaphore */
+    ES_ResetUnitTest();
+    CFE_ES_Global.StartupSyncSem = 0;
+    WaitRemaining = 5;
+    UT_Report(__FILE__, __LINE__,
+              CFE_ES_StartupSyncWait(&WaitRemaining) &&
+              WaitRemaining == 0 &&
+              UT_GetStubCount(UT_KEY(OS_BinSemTimedWait)) == 0 &&
+              UT_GetStubCount(UT_KEY(OS_TaskDelay)) == 1,
+              "CFE_ES_StartupSyncWait",
+              "No semaphore - delay");
 }
 
 void TestApps(void)
@@ -819,6 +856,8 @@ void TestApps(void)
     int Return;
     int j;
     CFE_ES_AppInfo_t AppInfo;
+    uint32 ExecCounter;
+    uint32 Generation;
     char LongFileName[OS_MAX_PATH_LEN + 9];
     char LongLibraryName[sizeof(CFE_ES_Global.LibTable[0].LibName)+1];
     uint32 Id, Id2, Id3, Id4;
@@ -899,6 +938,7 @@ void TestApps(void)
 
     /* Test successfully starting an application */
     ES_ResetUnitTest();
+    memset(&CFE_ES_Global.BootProfile, 0, sizeof(CFE_ES_Global.BootProfile));
     UT_SetReadBuffer(StartupScript, NumBytes);
     CFE_ES_StartApplications(CFE_PSP_RST_TYPE_PROCESSOR,
                              CFE_PLATFORM_ES_NONVOL_STARTUP_FILE);
@@ -907,6 +947,13 @@ void TestApps(void)
                  UT_GetStubCount(UT_KEY(OS_printf)) == 8,
               "CFE_ES_StartApplications",
               "Start application; successful");
+    UT_Report(__FILE__, __LINE__,
+              UT_GetStubCount(UT_KEY(OS_read)) == 1 &&
+              CFE_ES_Global.BootProfile.LibsLoaded == 1 &&
+              CFE_ES_Global.BootProfile.AppsCreated == 3 &&
+              CFE_ES_Global.BootProfile.LoadErrors == 0,
+              "CFE_ES_StartApplications",
+              "Script read in blocks and entries counted in boot profile");
 
     /* Test parsing the startup script with an invalid CFE driver type */
     ES_ResetUnitTest();
@@ -1785,6 +1832,46 @@ void TestApps(void)
               "CFE_ES_GetAppInfo",
               "Module not found");
 
+    /* Test reading the execution counter of a running application */
+    ES_ResetUnitTest();
+    OS_TaskCreate(&TestObjId, "UT", NULL, NULL, 0, 0, 0);
+    Id = ES_UT_OSALID_TO_ARRAYIDX(TestObjId);
+    CFE_ES_Global.AppTable[Id].AppState = CFE_ES_AppState_RUNNING;
+    CFE_ES_Global.AppTable[Id].TaskInfo.MainTaskId = TestObjId;
+    CFE_ES_Global.TaskTable[Id].ExecutionCounter = 42;
+    CFE_ES_Global.AppGeneration[Id] = 3;
+    UT_Report(__FILE__, __LINE__,
+              CFE_ES_GetAppExecCounter(Id, &ExecCounter, &Generation) == CFE_SUCCESS &&
+              ExecCounter == 42 && Generation == 3,
+              "CFE_ES_GetAppExecCounter",
+              "Get execution counter; successful");
+
+    /* Test reading the execution counter of an application that has been
+     * cleaned up (even generation)
+     */
+    CFE_ES_Global.AppGeneration[Id] = 4;
+    UT_Report(__FILE__, __LINE__,
+              CFE_ES_GetAppExecCounter(Id, &ExecCounter, &Generation) == CFE_ES_ERR_APPID,
+              "CFE_ES_GetAppExecCounter",
+              "Application not running");
+
+    /* Test reading the execution counter with a null output pointer */
+    CFE_ES_Global.AppGeneration[Id] = 5;
+    UT_Report(__FILE__, __LINE__,
+              CFE_ES_GetAppExecCounter(Id, NULL, &Generation) == CFE_ES_ERR_BUFFER &&
+              CFE_ES_GetAppExecCounter(Id, &ExecCounter, NULL) == CFE_ES_ERR_BUFFER,
+              "CFE_ES_GetAppExecCounter",
+              "Null output pointer");
+
+    /* Test reading the execution counter using an application ID value
+     * greater than the maximum allowed
+     */
+    UT_Report(__FILE__, __LINE__,
+              CFE_ES_GetAppExecCounter(CFE_PLATFORM_ES_MAX_APPLICATIONS,
+                                       &ExecCounter, &Generation) == CFE_ES_ERR_APPID,
+              "CFE_ES_GetAppExecCounter",
+              "Application ID exceeds maximum");
+
     /* Test deleting an application and cleaning up its resources with OS
      * delete and close failures
      */
@@ -2028,9 +2115,11 @@ void TestApps(void)
     CFE_ES_Global.TaskTable[Id2].AppId = Id;
     OS_ModuleLoad(&CFE_ES_Global.AppTable[Id].StartParams.ModuleId, NULL, NULL);
     CFE_ES_Global.AppTable[Id].TaskInfo.MainTaskId = TestObjId3;
+    CFE_ES_Global.AppGeneration[Id] = 1;
     UT_Report(__FILE__, __LINE__,
               CFE_ES_CleanUpApp(Id) == CFE_SUCCESS &&
-              CFE_ES_Global.TaskTable[Id2].RecordUsed == true,
+              CFE_ES_Global.TaskTable[Id2].RecordUsed == true &&
+              CFE_ES_Global.AppGeneration[Id] == 2,
               "CFE_ES_CleanUpApp",
               "Main task ID matches task ID");
     CFE_ES_Global.TaskTable[Id].RecordUsed = false;
@@ -2477,6 +2566,7 @@ void TestTask(void)
     uint32                      Id;
     uint32                      TestObjId;
     uint32                      ResetType;
+    uint32                      SendCount[3];
     union
     {
         CFE_SB_Msg_t             Msg;
@@ -2630,6 +2720,33 @@ void TestTask(void)
               "CFE_ES_HousekeepingCmd",
               "HK packet - get heap fail");
 
+    /* Test that the boot profile is sent once startup has completed */
+    ES_ResetUnitTest();
+    CFE_ES_TaskData.BootProfileSent = false;
+    CFE_ES_Global.SystemState = CFE_ES_SystemState_APPS_INIT;
+    CFE_ES_Global.BootProfile.TotalUsec = 1234;
+    UT_CallTaskPipe(CFE_ES_TaskPipe, &CmdBuf.Msg, sizeof(CmdBuf.NoArgsCmd),
+            UT_TPID_CFE_ES_SEND_HK);
+    UT_Report(__FILE__, __LINE__,
+              !CFE_ES_TaskData.BootProfileSent,
+              "CFE_ES_HousekeepingCmd",
+              "Boot profile - not sent during startup");
+
+    CFE_ES_Global.SystemState = CFE_ES_SystemState_OPERATIONAL;
+    SendCount[0] = UT_GetStubCount(UT_KEY(CFE_SB_SendMsg));
+    UT_CallTaskPipe(CFE_ES_TaskPipe, &CmdBuf.Msg, sizeof(CmdBuf.NoArgsCmd),
+            UT_TPID_CFE_ES_SEND_HK);
+    SendCount[1] = UT_GetStubCount(UT_KEY(CFE_SB_SendMsg));
+    UT_CallTaskPipe(CFE_ES_TaskPipe, &CmdBuf.Msg, sizeof(CmdBuf.NoArgsCmd),
+            UT_TPID_CFE_ES_SEND_HK);
+    SendCount[2] = UT_GetStubCount(UT_KEY(CFE_SB_SendMsg));
+    UT_Report(__FILE__, __LINE__,
+              CFE_ES_TaskData.BootProfileSent &&
+              CFE_ES_TaskData.BootProfilePacket.Payload.TotalUsec == 1234 &&
+              SendCount[1] - SendCount[0] == SendCount[2] - SendCount[1] + 1,
+              "CFE_ES_HousekeepingCmd",
+              "Boot profile - sent once when operational");
+
     /* Test successful no-op command */
     ES_ResetUnitTest();
     UT_CallTaskPipe(CFE_ES_TaskPipe, &CmdBuf.Msg, sizeof(CmdBuf.NoArgsCmd),
@@ -3831,6 +3948,8 @@ void TestPerf(void)
     } CmdBuf;
 
     extern CFE_ES_PerfLogDump_t CFE_ES_PerfLogDumpStatus;
+    uint8  StreamBuf[256];
+    uint32 StreamLen;
 
 #ifdef UT_VERBOSE
     UT_Text("Begin Test Performance Log\n");
@@ -3854,11 +3973,13 @@ void TestPerf(void)
      */
     ES_ResetUnitTest();
     memset(&CmdBuf, 0, sizeof(CmdBuf));
+    CFE_ES_PerfStats[3].LastMarker = CFE_ES_PERF_LAST_EXIT;
     CmdBuf.PerfStartCmd.Payload.TriggerMode = CFE_ES_PERF_TRIGGER_START;
     UT_CallTaskPipe(CFE_ES_TaskPipe, &CmdBuf.Msg, sizeof(CmdBuf.PerfStartCmd),
             UT_TPID_CFE_ES_CMD_START_PERF_DATA_CC);
     UT_Report(__FILE__, __LINE__,
-              UT_EventIsInHistory(CFE_ES_PERF_STARTCMD_EID),
+              UT_EventIsInHistory(CFE_ES_PERF_STARTCMD_EID) &&
+              CFE_ES_PerfStats[3].LastMarker == CFE_ES_PERF_LAST_NONE,
               "CFE_ES_StartPerfDataCmd",
               "Collect performance data; mode START");
 
@@ -3893,7 +4014,7 @@ void TestPerf(void)
      */
     ES_ResetUnitTest();
     memset(&CmdBuf, 0, sizeof(CmdBuf));
-    CmdBuf.PerfStartCmd.Payload.TriggerMode = (CFE_ES_PERF_TRIGGER_END + 1);
+    CmdBuf.PerfStartCmd.Payload.TriggerMode = CFE_ES_PERF_MAX_MODES;
     UT_CallTaskPipe(CFE_ES_TaskPipe, &CmdBuf.Msg, sizeof(CmdBuf.PerfStartCmd),
             UT_TPID_CFE_ES_CMD_START_PERF_DATA_CC);
     UT_Report(__FILE__, __LINE__,
@@ -4115,6 +4236,32 @@ void TestPerf(void)
               "CFE_ES_PerfLogDump",
               "Performance log dump; data write failed");
 
+    /* Test that entries stamped out of order are put back in time order,
+     * starting from the oldest entry of a wrapped buffer
+     */
+    ES_ResetUnitTest();
+    memset(Perf->DataBuffer, 0, sizeof(Perf->DataBuffer));
+    Perf->MetaData.DataCount = CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE;
+    Perf->MetaData.DataEnd = 1;
+    Perf->MetaData.DataStart = 0;
+    for (Id = 0; Id < CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE; Id++)
+    {
+        Perf->DataBuffer[(Id + 1) % CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE].TimerLower32 = Id;
+    }
+    Perf->DataBuffer[1].TimerLower32 = 2;
+    Perf->DataBuffer[2].TimerLower32 = 0;
+    Perf->DataBuffer[3].TimerLower32 = 1;
+    CFE_ES_PerfSortEntries();
+    UT_Report(__FILE__, __LINE__,
+              Perf->MetaData.DataStart == 1 &&
+              Perf->DataBuffer[1].TimerLower32 == 0 &&
+              Perf->DataBuffer[2].TimerLower32 == 1 &&
+              Perf->DataBuffer[3].TimerLower32 == 2 &&
+              Perf->DataBuffer[0].TimerLower32 ==
+                  CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE - 1,
+              "CFE_ES_PerfSortEntries",
+              "Entries restored to time order");
+
     /* Test successful addition of a new entry to the performance log */
     ES_ResetUnitTest();
     Perf->MetaData.State = CFE_ES_PERF_WAITING_FOR_TRIGGER;
@@ -4207,6 +4354,22 @@ void TestPerf(void)
               "CFE_ES_PerfLogAdd",
               "Data count below maximum");
 
+    /* Test addition of a new entry to a full performance log */
+    ES_ResetUnitTest();
+    Perf->MetaData.State = CFE_ES_PERF_WAITING_FOR_TRIGGER;
+    Perf->MetaData.DataCount = CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE;
+    Perf->MetaData.DataStart = 5;
+    Perf->MetaData.DataEnd = 5;
+    Perf->MetaData.FilterMask[0] = 0xffff;
+    CFE_ES_PerfLogAdd(0x1, 0);
+    UT_Report(__FILE__, __LINE__,
+              Perf->MetaData.DataCount == CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE &&
+              Perf->MetaData.DataEnd == 6 &&
+              Perf->MetaData.DataStart == 6 &&
+              Perf->DataBuffer[5].Data == 0x1,
+              "CFE_ES_PerfLogAdd",
+              "Data count at maximum; oldest entry overwritten");
+
     /* Test addition of a new entry to the performance log with a marker that
      * is not in the trigger mask
      */
@@ -4260,6 +4423,139 @@ void TestPerf(void)
               "CFE_ES_PerfLogAdd",
               "Invalid trigger mode");
 
+    /* Test successful performance data collection start in STREAM mode */
+    ES_ResetUnitTest();
+    memset(&CmdBuf, 0, sizeof(CmdBuf));
+    OS_TaskCreate(&TestObjId, "UT", NULL, NULL, 0, 0, 0);
+    Id = ES_UT_OSALID_TO_ARRAYIDX(TestObjId);
+    CFE_ES_Global.TaskTable[Id].RecordUsed = true;
+    CFE_ES_PerfLogDumpStatus.DataToWrite = 0;
+    CFE_ES_PerfStreamStatus.Active = false;
+    CmdBuf.PerfStartCmd.Payload.TriggerMode = CFE_ES_PERF_STREAM;
+    UT_CallTaskPipe(CFE_ES_TaskPipe, &CmdBuf.Msg, sizeof(CmdBuf.PerfStartCmd),
+            UT_TPID_CFE_ES_CMD_START_PERF_DATA_CC);
+    UT_Report(__FILE__, __LINE__,
+              UT_EventIsInHistory(CFE_ES_PERF_STARTCMD_EID) &&
+              Perf->MetaData.State == CFE_ES_PERF_TRIGGERED &&
+              CFE_ES_PerfStreamStatus.Active == true,
+              "CFE_ES_StartPerfDataCmd",
+              "Stream performance data");
+
+    /* Test performance data collection start while streaming */
+    ES_ResetUnitTest();
+    UT_CallTaskPipe(CFE_ES_TaskPipe, &CmdBuf.Msg, sizeof(CmdBuf.PerfStartCmd),
+            UT_TPID_CFE_ES_CMD_START_PERF_DATA_CC);
+    UT_Report(__FILE__, __LINE__,
+              UT_EventIsInHistory(CFE_ES_PERF_STARTCMD_ERR_EID),
+              "CFE_ES_StartPerfDataCmd",
+              "Cannot collect performance data; stream in progress");
+
+    /* Test performance data collection stop while streaming; a second stop
+     * is ignored until the streaming task has finished
+     */
+    ES_ResetUnitTest();
+    UT_CallTaskPipe(CFE_ES_TaskPipe, &CmdBuf.Msg, sizeof(CmdBuf.PerfStopCmd),
+            UT_TPID_CFE_ES_CMD_STOP_PERF_DATA_CC);
+    UT_CallTaskPipe(CFE_ES_TaskPipe, &CmdBuf.Msg, sizeof(CmdBuf.PerfStopCmd),
+            UT_TPID_CFE_ES_CMD_STOP_PERF_DATA_CC);
+    UT_Report(__FILE__, __LINE__,
+              UT_EventIsInHistory(CFE_ES_PERF_STOPCMD_EID) &&
+              UT_EventIsInHistory(CFE_ES_PERF_STOPCMD_ERR2_EID) &&
+              UT_GetStubCount(UT_KEY(OS_creat)) == 0 &&
+              Perf->MetaData.State == CFE_ES_PERF_IDLE &&
+              CFE_ES_PerfStreamStatus.StopRequest == true,
+              "CFE_ES_StopPerfDataCmd",
+              "Stop streaming performance data");
+
+    /* Test that the streaming task writes the entries as delta encoded
+     * records after the headers, then finishes on the stop request
+     */
+    ES_ResetUnitTest();
+    CFE_ES_PerfStreamStatus.StopRequest = false;
+    Perf->MetaData.State = CFE_ES_PERF_TRIGGERED;
+    Perf->MetaData.FilterMask[0] = 0xffff;
+    CFE_ES_PerfLogAdd(1, 0);
+    CFE_ES_PerfLogAdd(2, 1);
+    CFE_ES_PerfStreamStatus.StopRequest = true;
+    memset(StreamBuf, 0xAA, sizeof(StreamBuf));
+    UT_SetDataBuffer(UT_KEY(OS_write), StreamBuf, sizeof(StreamBuf), false);
+    CFE_ES_PerfStreamTask();
+    StreamLen = sizeof(CFE_ES_PerfMetaData_t);
+    UT_Report(__FILE__, __LINE__,
+              UT_EventIsInHistory(CFE_ES_PERF_STREAM_DONE_EID) &&
+              CFE_ES_PerfStreamStatus.EntriesWritten == 2 &&
+              CFE_ES_PerfStreamStatus.EntriesLost == 0 &&
+              CFE_ES_PerfStreamStatus.Active == false &&
+              UT_GetStubCount(UT_KEY(OS_close)) == 1 &&
+              StreamBuf[StreamLen] == 0x02 && StreamBuf[StreamLen + 1] == 0x00 &&
+              StreamBuf[StreamLen + 2] == 0x05 && StreamBuf[StreamLen + 3] == 0x00 &&
+              StreamBuf[StreamLen + 4] == 0xAA,
+              "CFE_ES_PerfStreamTask",
+              "Entries streamed to file");
+
+    /* Test that entries overwritten before they are drained are replaced
+     * by a lost entry count, keeping half a buffer of the newest entries
+     */
+    ES_ResetUnitTest();
+    OS_TaskCreate(&TestObjId, "UT", NULL, NULL, 0, 0, 0);
+    Id = ES_UT_OSALID_TO_ARRAYIDX(TestObjId);
+    CFE_ES_Global.TaskTable[Id].RecordUsed = true;
+    CFE_ES_StartPerfDataCmd(&CmdBuf.PerfStartCmd);
+    for (Id = 0; Id < CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE + 10; Id++)
+    {
+        CFE_ES_PerfLogAdd(1, 0);
+    }
+    CFE_ES_PerfStreamStatus.FileDescriptor = OS_open(NULL, 0, 0);
+    CFE_ES_PerfStreamDrain();
+    UT_Report(__FILE__, __LINE__,
+              CFE_ES_PerfStreamStatus.EntriesLost ==
+                  CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE / 2 + 10 &&
+              CFE_ES_PerfStreamStatus.EntriesWritten ==
+                  CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE / 2 &&
+              Perf->MetaData.DataCount == 0,
+              "CFE_ES_PerfStreamDrain",
+              "Buffer overrun; oldest entries dropped");
+
+    /* Test the streaming task with a stream file create failure */
+    ES_ResetUnitTest();
+    CFE_ES_PerfStreamStatus.FileDescriptor = -1;
+    Perf->MetaData.State = CFE_ES_PERF_TRIGGERED;
+    UT_SetForceFail(UT_KEY(OS_creat), OS_ERROR);
+    CFE_ES_PerfStreamTask();
+    UT_Report(__FILE__, __LINE__,
+              UT_EventIsInHistory(CFE_ES_PERF_STREAM_FILE_ERR_EID) &&
+              UT_EventIsInHistory(CFE_ES_PERF_STREAM_DONE_EID) &&
+              Perf->MetaData.State == CFE_ES_PERF_IDLE &&
+              CFE_ES_PerfStreamStatus.Active == false,
+              "CFE_ES_PerfStreamTask",
+              "Stream file create failed");
+
+    /* Test performance data collection start in STREAM mode with a child
+     * task create failure
+     */
+    ES_ResetUnitTest();
+    Perf->MetaData.Mode = CFE_ES_PERF_TRIGGER_END;
+    Perf->MetaData.TriggerCount = 5;
+    Perf->MetaData.DataStart = 1;
+    Perf->MetaData.DataEnd = 6;
+    Perf->MetaData.DataCount = 5;
+    CFE_ES_PerfStats[3].LastMarker = CFE_ES_PERF_LAST_ENTRY;
+    UT_SetForceFail(UT_KEY(OS_TaskCreate), OS_ERROR);
+    UT_CallTaskPipe(CFE_ES_TaskPipe, &CmdBuf.Msg, sizeof(CmdBuf.PerfStartCmd),
+            UT_TPID_CFE_ES_CMD_START_PERF_DATA_CC);
+    UT_Report(__FILE__, __LINE__,
+              UT_EventIsInHistory(CFE_ES_PERF_STREAM_ERR_EID) &&
+              CFE_ES_PerfStreamStatus.Active == false &&
+              Perf->MetaData.Mode == CFE_ES_PERF_TRIGGER_END &&
+              Perf->MetaData.TriggerCount == 5 &&
+              Perf->MetaData.DataStart == 1 &&
+              Perf->MetaData.DataEnd == 6 &&
+              Perf->MetaData.DataCount == 5 &&
+              CFE_ES_PerfStats[3].LastMarker == CFE_ES_PERF_LAST_ENTRY,
+              "CFE_ES_StartPerfDataCmd",
+              "Stream performance data; child task create fail");
+    Perf->MetaData.Mode = CFE_ES_PERF_TRIGGER_START;
+
     /* Test performance data collection start with an invalid message length */
     ES_ResetUnitTest();
     UT_CallTaskPipe(CFE_ES_TaskPipe, &CmdBuf.Msg, 0, 
@@ -4295,6 +4591,109 @@ void TestPerf(void)
               !UT_EventIsInHistory(CFE_ES_PERF_TRIGMSKCMD_EID),
               "CFE_ES_SetPerfTriggerMaskCmd",
               "Invalid message length");
+
+    /* Test that statistics are kept while performance data is not collected */
+    ES_ResetUnitTest();
+    memset(CFE_ES_PerfStats, 0, sizeof(CFE_ES_PerfStats));
+    Perf->MetaData.State = CFE_ES_PERF_IDLE;
+    Perf->MetaData.DataCount = 0;
+    CFE_ES_PerfLogAdd(3, 0);
+    CFE_ES_PerfLogAdd(3, 1);
+    UT_Report(__FILE__, __LINE__,
+              CFE_ES_PerfStats[3].Stats.Count == 1 &&
+              CFE_ES_PerfStats[3].LastMarker == CFE_ES_PERF_LAST_EXIT &&
+              Perf->MetaData.DataCount == 0,
+              "CFE_ES_PerfLogAdd",
+              "Statistics while idle");
+
+    /* Test the per id statistics of an entry/exit pair lasting 1000 usec */
+    ES_ResetUnitTest();
+    memset(CFE_ES_PerfStats, 0, sizeof(CFE_ES_PerfStats));
+    Perf->MetaData.Mode = CFE_ES_PERF_TRIGGER_START;
+    Perf->MetaData.State = CFE_ES_PERF_TRIGGERED;
+    Perf->MetaData.TriggerCount = 0;
+    Perf->MetaData.TimerLow32Rollover = 1000;
+    Perf->MetaData.TimerTicksPerSecond = 1000000;
+    CFE_ES_PerfLogAdd(3, 0);
+    CFE_ES_PerfStats[3].LastUpper32 = 0xFFFFFFFF;
+    CFE_ES_PerfLogAdd(3, 1);
+    UT_Report(__FILE__, __LINE__,
+              CFE_ES_PerfStats[3].Stats.Count == 1 &&
+              CFE_ES_PerfStats[3].Stats.TotalUsec == 1000 &&
+              CFE_ES_PerfStats[3].Stats.MinUsec == 1000 &&
+              CFE_ES_PerfStats[3].Stats.MaxUsec == 1000 &&
+              CFE_ES_PerfStats[3].Stats.Histogram[19] == 1,
+              "CFE_ES_PerfLogAdd",
+              "Entry to exit duration statistics");
+
+    /* Test that the time from an exit to the next entry is counted as wait */
+    CFE_ES_PerfStats[3].LastUpper32 = 0xFFFFFFFF;
+    CFE_ES_PerfLogAdd(3, 0);
+    CFE_ES_PerfLogAdd(3, 1);
+    UT_Report(__FILE__, __LINE__,
+              CFE_ES_PerfStats[3].Stats.Count == 2 &&
+              CFE_ES_PerfStats[3].Stats.WaitUsec == 1000 &&
+              CFE_ES_PerfStats[3].Stats.MinUsec == 0 &&
+              CFE_ES_PerfStats[3].Stats.Histogram[0] == 1,
+              "CFE_ES_PerfLogAdd",
+              "Exit to entry wait statistics");
+
+    /* Test sending the statistics packet; reported ids are cleared */
+    CFE_ES_PerfLogAdd(5, 1);
+    CFE_ES_PerfLogAdd(7, 0);
+    CFE_ES_PerfLogAdd(7, 1);
+    CFE_ES_PerfSendStats();
+    UT_Report(__FILE__, __LINE__,
+              CFE_ES_TaskData.PerfStatsPacket.Payload.NumIds == 2 &&
+              CFE_ES_TaskData.PerfStatsPacket.Payload.PerfIds[0].PerfId == 3 &&
+              CFE_ES_TaskData.PerfStatsPacket.Payload.PerfIds[1].PerfId == 7 &&
+              CFE_ES_PerfStats[3].Stats.Count == 0 &&
+              CFE_ES_PerfStats[3].LastMarker == CFE_ES_PERF_LAST_EXIT &&
+              UT_GetStubCount(UT_KEY(CFE_SB_SendMsg)) == 1,
+              "CFE_ES_PerfSendStats",
+              "Send statistics of the active ids");
+
+    /* Test that a record being updated is neither counted nor reported */
+    CFE_ES_PerfLogAdd(7, 0);
+    CFE_ES_PerfLogAdd(7, 1);
+    CFE_ES_PerfStats[7].Seq++;
+    CFE_ES_PerfLogAdd(7, 0);
+    CFE_ES_PerfLogAdd(7, 1);
+    CFE_ES_PerfSendStats();
+    UT_Report(__FILE__, __LINE__,
+              CFE_ES_TaskData.PerfStatsPacket.Payload.NumIds == 0 &&
+              CFE_ES_TaskData.PerfStatsPacket.Payload.DroppedMarkers == 2 &&
+              CFE_ES_PerfStatsDropped == 0 &&
+              CFE_ES_PerfStats[7].Stats.Count == 1,
+              "CFE_ES_PerfSendStats",
+              "Skip a locked record");
+    CFE_ES_PerfStats[7].Seq++;
+
+    /* Test that a long interval saturates instead of overflowing */
+    memset(CFE_ES_PerfStats, 0, sizeof(CFE_ES_PerfStats));
+    Perf->MetaData.TimerLow32Rollover = 0;
+    Perf->MetaData.TimerTicksPerSecond = 0x80000000;
+    CFE_ES_PerfLogAdd(3, 0);
+    CFE_ES_PerfStats[3].LastUpper32 = 0xFFFF0000;
+    CFE_ES_PerfLogAdd(3, 1);
+    UT_Report(__FILE__, __LINE__,
+              CFE_ES_PerfStats[3].Stats.Count == 1 &&
+              CFE_ES_PerfStats[3].Stats.MaxUsec == 0xFFFFFFFF,
+              "CFE_ES_PerfLogAdd",
+              "Long interval saturates");
+
+    /* Test the statistics packet is sent from housekeeping */
+    ES_ResetUnitTest();
+    memset(CFE_ES_PerfStats, 0, sizeof(CFE_ES_PerfStats));
+    CFE_ES_TaskData.PerfStatsCounter = CFE_PLATFORM_ES_PERF_STATS_RATE - 1;
+    UT_CallTaskPipe(CFE_ES_TaskPipe, &CmdBuf.Msg, sizeof(CFE_SB_CmdHdr_t),
+            UT_TPID_CFE_ES_SEND_HK);
+    UT_Report(__FILE__, __LINE__,
+              CFE_ES_TaskData.PerfStatsCounter == 0 &&
+              CFE_ES_TaskData.PerfStatsPacket.Payload.NumIds == 0 &&
+              UT_GetStubCount(UT_KEY(CFE_SB_SendMsg)) == 2,
+              "CFE_ES_HousekeepingCmd",
+              "Send performance statistics");
 }
 
 void TestAPI(void)
@@ -4578,6 +4977,23 @@ void TestAPI(void)
               "CFE_ES_GetAppID",
               "Get application ID by name successful");
 
+    /* Test getting the application ID from a published task entry; this
+     * must not take the ES shared data lock
+     */
+    ES_ResetUnitTest();
+    TestObjId = OS_TaskGetId();
+    Id = ES_UT_OSALID_TO_ARRAYIDX(TestObjId);
+    CFE_ES_Global.TaskTable[Id].RecordUsed = true;
+    CFE_ES_Global.TaskTable[Id].AppId = 2;
+    CFE_ES_Global.TaskTable[Id].TaskId = TestObjId;
+    AppId = 0;
+    UT_Report(__FILE__, __LINE__,
+              CFE_ES_GetAppID(&AppId) == CFE_SUCCESS &&
+              AppId == 2 &&
+              UT_GetStubCount(UT_KEY(OS_MutSemTake)) == 0,
+              "CFE_ES_GetAppID",
+              "Get application ID without locking");
+
     /* Test getting the app name with a bad app ID */
     CFE_ES_Global.AppTable[4].AppState = CFE_ES_AppState_UNDEFINED;
     ES_ResetUnitTest();
@@ -4642,6 +5058,41 @@ void TestAPI(void)
               "CFE_ES_GetTaskInfo",
               "Get task info by ID; invalid task ID");
 
+    /* Test getting the cached name of a main task */
+    ES_ResetUnitTest();
+    OS_TaskCreate(&TestObjId, "UT", NULL, NULL, 0, 0, 0);
+    Id = ES_UT_OSALID_TO_ARRAYIDX(TestObjId);
+    CFE_ES_Global.TaskTable[Id].RecordUsed = true;
+    CFE_ES_Global.TaskTable[Id].AppId = Id;
+    CFE_ES_Global.TaskTable[Id].TaskId = TestObjId;
+    strncpy((char *) CFE_ES_Global.AppTable[Id].StartParams.Name, "UT",
+            OS_MAX_API_NAME);
+    strncpy((char *) CFE_ES_Global.TaskTable[Id].TaskName, "UT",
+            OS_MAX_API_NAME);
+    CFE_ES_SetTaskFullName(Id);
+    UT_Report(__FILE__, __LINE__,
+              CFE_ES_GetTaskFullName(TestObjId, AppName) == CFE_SUCCESS &&
+              strcmp(AppName, "UT") == 0,
+              "CFE_ES_GetTaskFullName",
+              "Get main task name successful");
+
+    /* Test getting the cached name of a child task */
+    strncpy((char *) CFE_ES_Global.TaskTable[Id].TaskName, "Child",
+            OS_MAX_API_NAME);
+    CFE_ES_SetTaskFullName(Id);
+    UT_Report(__FILE__, __LINE__,
+              CFE_ES_GetTaskFullName(TestObjId, AppName) == CFE_SUCCESS &&
+              strcmp(AppName, "UT.Child") == 0,
+              "CFE_ES_GetTaskFullName",
+              "Get child task name successful");
+
+    /* Test getting the cached name of a task whose slot was reused */
+    CFE_ES_Global.TaskTable[Id].TaskId = TestObjId + 1;
+    UT_Report(__FILE__, __LINE__,
+              CFE_ES_GetTaskFullName(TestObjId, AppName) == CFE_ES_ERR_TASKID,
+              "CFE_ES_GetTaskFullName",
+              "Get task name; task ID no longer in use");
+
     /* Test creating a child task with a bad app ID */
     ES_ResetUnitTest();
     CFE_ES_Global.TaskTable[1].RecordUsed = false;
@@ -6289,7 +6740,13 @@ void TestESMempool(void)
     BD_t                  *BdPtr;
     CFE_ES_MemHandle_t    HandlePtr2;
     CFE_ES_MemHandle_t    HandlePtrSave;
+#if CFE_ES_MEMPOOL_CACHE_SLOTS > 0
+    uint32                *CacheBufs[CFE_PLATFORM_ES_MEMPOOL_CACHE_DEPTH + 1];
+    uint32                NumBlocks;
+    uint32                Slot;
+#endif
     uint32                i;
+    uint32                j;
 
 #ifdef UT_VERBOSE
     UT_Text("Begin Test ES memory pool\n");
@@ -6827,6 +7284,144 @@ void TestESMempool(void)
                                         CFE_ES_ERR_MEM_HANDLE,
               "CFE_ES_PutPoolBuf",
               "Invalid memory handle");
+
+    /* Test that the size class lookup picks the smallest block that fits */
+    ES_ResetUnitTest();
+    CFE_ES_PoolCreate(&HandlePtr, Buffer, sizeof(Buffer));
+    PoolPtr = (Pool_t *) HandlePtr;
+    for (i = 0; i <= 8192; ++i)
+    {
+        j = CFE_ES_MAX_MEMPOOL_BLOCK_SIZES - 1;
+        while (PoolPtr->SizeDesc[j].MaxSize < i)
+        {
+            --j;
+        }
+
+        if (CFE_ES_GetPoolBuf((uint32 **) &address, HandlePtr, i) !=
+                PoolPtr->SizeDesc[j].MaxSize ||
+            CFE_ES_PutPoolBuf(HandlePtr, (uint32 *) address) !=
+                PoolPtr->SizeDesc[j].MaxSize)
+        {
+            break;
+        }
+    }
+
+    UT_Report(__FILE__, __LINE__,
+              i > 8192,
+              "CFE_ES_GetPoolBuf",
+              "Size class lookup");
+
+#if CFE_ES_MEMPOOL_CACHE_SLOTS > 0
+    /* Test that released blocks are reused from the task cache, and still
+     * reported as free
+     */
+    CFE_ES_GetMemPoolStats(&Stats, HandlePtr);
+    UT_Report(__FILE__, __LINE__,
+              Stats.CacheHits > Stats.CacheMisses &&
+              Stats.BlockStats[CFE_ES_MAX_MEMPOOL_BLOCK_SIZES - 1].NumFree == 1,
+              "CFE_ES_GetMemPoolStats",
+              "Task cache hits");
+
+    /* Test that a full task cache returns blocks to the shared free list */
+    ES_ResetUnitTest();
+    CFE_ES_PoolCreate(&HandlePtr, Buffer, sizeof(Buffer));
+    PoolPtr = (Pool_t *) HandlePtr;
+    for (i = 0; i <= CFE_PLATFORM_ES_MEMPOOL_CACHE_DEPTH; ++i)
+    {
+        CFE_ES_GetPoolBuf((uint32 **) &CacheBufs[i], HandlePtr, 32);
+    }
+
+    for (i = 0; i <= CFE_PLATFORM_ES_MEMPOOL_CACHE_DEPTH; ++i)
+    {
+        CFE_ES_PutPoolBuf(HandlePtr, CacheBufs[i]);
+    }
+
+    j = CFE_ES_MAX_MEMPOOL_BLOCK_SIZES - 3;
+    CFE_ES_GetMemPoolStats(&Stats, HandlePtr);
+    UT_Report(__FILE__, __LINE__,
+              PoolPtr->SizeDesc[j].MaxSize == 32 &&
+              PoolPtr->SizeDesc[j].NumFree == CFE_PLATFORM_ES_MEMPOOL_CACHE_DEPTH / 2 &&
+              Stats.BlockStats[j].NumFree == CFE_PLATFORM_ES_MEMPOOL_CACHE_DEPTH + 1,
+              "CFE_ES_PutPoolBuf",
+              "Task cache drained to the shared pool");
+
+    /* Test releasing a block twice when the task cache is in use */
+    ES_ResetUnitTest();
+    UT_Report(__FILE__, __LINE__,
+              CFE_ES_PutPoolBuf(HandlePtr, CacheBufs[0]) == CFE_ES_ERR_MEM_HANDLE &&
+              PoolPtr->CheckErrCntr == 1,
+              "CFE_ES_PutPoolBuf",
+              "Deallocating unallocated memory block (task cache)");
+
+    /* Test allocating and releasing while the task cache slots are busy */
+    ES_ResetUnitTest();
+    for (i = 0; i < CFE_ES_MEMPOOL_CACHE_SLOTS; ++i)
+    {
+        PoolPtr->Cache[i].Busy = 1;
+    }
+
+    CFE_ES_GetMemPoolStats(&Stats, HandlePtr);
+    j = Stats.CacheMisses;
+    UT_Report(__FILE__, __LINE__,
+              CFE_ES_GetPoolBuf((uint32 **) &address, HandlePtr, 32) == 32 &&
+              CFE_ES_PutPoolBuf(HandlePtr, (uint32 *) address) == 32 &&
+              CFE_ES_GetMemPoolStats(&Stats, HandlePtr) == CFE_SUCCESS &&
+              Stats.CacheMisses == j + 2,
+              "CFE_ES_GetPoolBuf",
+              "Task cache slot busy");
+
+    for (i = 0; i < CFE_ES_MEMPOOL_CACHE_SLOTS; ++i)
+    {
+        PoolPtr->Cache[i].Busy = 0;
+    }
+
+    /* Test that blocks held in another task's cache are taken back once
+     * the pool is carved out
+     */
+    ES_ResetUnitTest();
+    CFE_ES_PoolCreate(&HandlePtr, Buffer, sizeof(Pool_t) + 256);
+    PoolPtr = (Pool_t *) HandlePtr;
+    for (i = 0; i <= CFE_PLATFORM_ES_MEMPOOL_CACHE_DEPTH; ++i)
+    {
+        if (CFE_ES_GetPoolBuf((uint32 **) &CacheBufs[i], HandlePtr, 32) != 32)
+        {
+            break;
+        }
+    }
+
+    NumBlocks = i;
+    for (i = 0; i < NumBlocks; ++i)
+    {
+        CFE_ES_PutPoolBuf(HandlePtr, CacheBufs[i]);
+    }
+
+    /* Move the cached blocks to a slot that belongs to another task */
+    j = CFE_ES_MAX_MEMPOOL_BLOCK_SIZES - 3;
+    for (i = 0; i < CFE_ES_MEMPOOL_CACHE_SLOTS; ++i)
+    {
+        if (PoolPtr->Cache[i].Count[j] != 0)
+        {
+            break;
+        }
+    }
+
+    Slot = (i + 1) % CFE_ES_MEMPOOL_CACHE_SLOTS;
+    if (i < CFE_ES_MEMPOOL_CACHE_SLOTS && Slot != i)
+    {
+        PoolPtr->Cache[Slot].Top[j] = PoolPtr->Cache[i].Top[j];
+        PoolPtr->Cache[Slot].Count[j] = PoolPtr->Cache[i].Count[j];
+        PoolPtr->Cache[i].Top[j] = NULL;
+        PoolPtr->Cache[i].Count[j] = 0;
+    }
+
+    UT_Report(__FILE__, __LINE__,
+              NumBlocks > 1 && NumBlocks <= CFE_PLATFORM_ES_MEMPOOL_CACHE_DEPTH &&
+              CFE_ES_GetPoolBuf((uint32 **) &address, HandlePtr, 32) == 32 &&
+              PoolPtr->Cache[Slot].Count[j] == 0 &&
+              PoolPtr->SizeDesc[j].NumFree == NumBlocks - 1,
+              "CFE_ES_GetPoolBuf",
+              "Pool carved out, blocks taken back from the task caches");
+#endif
 }
 
 /* Tests to fill gaps in coverage in SysLog */
@@ -49,6 +49,157 @@ const char *FS_SYSLOG_MSGS[] =
 };
 
 static CFE_FS_Decompress_State_t UT_FS_Decompress_State;
+static uint32 UT_FS_SinkBytes;
+static uint32 UT_FS_SinkCalls;
+static CFE_FS_InflateState_t UT_FS_InflateState;
+static uint8 UT_FS_InflateOut[512];
+static CFE_FS_DeflateState_t UT_FS_DeflateState;
+static uint8 UT_FS_DeflateIn[20000];
+static uint8 UT_FS_DeflateOut[21000];
+
+/*
+** Small gzip files for the streaming tests: a stored block, and a fixed
+** Huffman block with every optional header field present
+*/
+static uint8 UT_FS_GzStored[] =
+{
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x01, 0x11,
+    0x00, 0xee, 0xff, 0x53, 0x74, 0x6f, 0x72, 0x65, 0x64, 0x20, 0x62, 0x6c,
+    0x6f, 0x63, 0x6b, 0x20, 0x74, 0x65, 0x73, 0x74, 0x4a, 0xda, 0x8f, 0xfe,
+    0x11, 0x00, 0x00, 0x00
+};
+static uint8 UT_FS_GzFixed[] =
+{
+    0x1f, 0x8b, 0x08, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x02, 0x00,
+    0x61, 0x62, 0x6e, 0x00, 0x63, 0x00, 0x84, 0x8b, 0x73, 0xcb, 0xac, 0x48,
+    0x4d, 0x51, 0x48, 0x43, 0x22, 0x3d, 0x4a, 0xd3, 0xd2, 0x72, 0x13, 0xf3,
+    0x14, 0x92, 0xf3, 0x53, 0x52, 0x8b, 0x75, 0x50, 0xa4, 0xc0, 0xa4, 0x1e,
+    0x00, 0x1c, 0x3b, 0x57, 0xef, 0x33, 0x00, 0x00, 0x00
+};
+
+/*
+** Run a whole gzip image through the streaming API, feeding FeedSize bytes
+** and draining up to DrainSize bytes at a time.  Returns the last status
+** and the total output size and CRC.
+*/
+static int32 UT_FS_InflateImage(const uint8 *Image, uint32 ImageSize, uint32 FeedSize,
+                                uint32 DrainSize, uint32 *TotalOut, uint32 *Crc)
+{
+    uint32 Fed = 0;
+    int32 Status;
+
+    *TotalOut = 0;
+    *Crc = 0;
+    CFE_FS_InflateInit(&UT_FS_InflateState);
+
+    for (;;)
+    {
+        Status = CFE_FS_InflateDrain(&UT_FS_InflateState, UT_FS_InflateOut, DrainSize);
+        if (Status > 0)
+        {
+            *Crc = FS_gz_updcrc(*Crc, UT_FS_InflateOut, Status);
+            *TotalOut += Status;
+        }
+        else if (Status < 0)
+        {
+            return Status;
+        }
+        else if (CFE_FS_InflateFinished(&UT_FS_InflateState))
+        {
+            return CFE_SUCCESS;
+        }
+        else if (Fed < ImageSize)
+        {
+            Status = CFE_FS_InflateFeed(&UT_FS_InflateState, &Image[Fed],
+                                        ImageSize - Fed < FeedSize ? ImageSize - Fed : FeedSize);
+            if (Status < 0)
+            {
+                return Status;
+            }
+            Fed += Status;
+        }
+        else
+        {
+            /* out of input before the end of the stream */
+            return CFE_FS_GZIP_READ_ERROR;
+        }
+    }
+}
+
+/*
+** Compress Size bytes of Data through the streaming API into
+** UT_FS_DeflateOut, after Offset bytes that the caller fills in, feeding
+** FeedSize bytes and draining up to DrainSize bytes at a time.  Returns
+** the last status and the size of the output, Offset included.
+*/
+static int32 UT_FS_DeflateImage(const uint8 *Data, uint32 Size, uint32 Offset,
+                                uint32 FeedSize, uint32 DrainSize, uint32 *OutLen)
+{
+    uint32 Fed = 0;
+    int32 Status;
+
+    *OutLen = Offset;
+    CFE_FS_DeflateInit(&UT_FS_DeflateState);
+
+    for (;;)
+    {
+        if (DrainSize > sizeof(UT_FS_DeflateOut) - *OutLen)
+        {
+            DrainSize = sizeof(UT_FS_DeflateOut) - *OutLen;
+            if (DrainSize == 0)
+            {
+                return CFE_FS_GZIP_WRITE_ERROR;
+            }
+        }
+
+        Status = CFE_FS_DeflateDrain(&UT_FS_DeflateState, &UT_FS_DeflateOut[*OutLen], DrainSize);
+        if (Status > 0)
+        {
+            *OutLen += Status;
+        }
+        else if (Status < 0)
+        {
+            return Status;
+        }
+        else if (CFE_FS_DeflateFinished(&UT_FS_DeflateState))
+        {
+            return CFE_SUCCESS;
+        }
+        else if (Fed < Size)
+        {
+            Status = CFE_FS_DeflateFeed(&UT_FS_DeflateState, &Data[Fed],
+                                        Size - Fed < FeedSize ? Size - Fed : FeedSize);
+            if (Status < 0)
+            {
+                return Status;
+            }
+            Fed += Status;
+        }
+        else
+        {
+            CFE_FS_DeflateFinish(&UT_FS_DeflateState);
+        }
+    }
+}
+
+/*
+** Sink for the decompress to sink tests; counts the data and fails on
+** the call number given in the argument, if any
+*/
+static int32 UT_FS_DecompressSink(void *SinkArg, const uint8 *Data, uint32 Size)
+{
+    uint32 *FailCall = SinkArg;
+
+    UT_FS_SinkCalls++;
+    UT_FS_SinkBytes += Size;
+
+    if (FailCall != NULL && *FailCall == UT_FS_SinkCalls)
+    {
+        return CFE_FS_GZIP_WRITE_ERROR;
+    }
+
+    return CFE_SUCCESS;
+}
 
 
 /*
@@ -71,6 +222,7 @@ void OS_Application_Startup(void)
     UT_ADD_TEST(Test_CFE_FS_ExtractFileNameFromPath);
     UT_ADD_TEST(Test_CFE_FS_Private);
     UT_ADD_TEST(Test_CFE_FS_Decompress);
+    UT_ADD_TEST(Test_CFE_FS_Compress);
     UT_ADD_TEST(Test_CFE_FS_GetUncompressedFile);
 }
 
@@ -439,6 +591,11 @@ void Test_CFE_FS_Private(void)
 void Test_CFE_FS_Decompress(void)
 {
     int NumBytes = 35400;
+    int StreamBytes = 35007;   /* fs_gz_test has zero padding after the gzip trailer */
+    uint32 FailCall;
+    uint32 TotalOut;
+    uint32 Crc;
+    static uint8 Corrupt[35400];
 
 #ifdef UT_VERBOSE
     UT_Text("Begin Test Decompress\n");
@@ -485,49 +642,415 @@ void Test_CFE_FS_Decompress(void)
               "CFE_FS_Decompress",
               "File does not exist");
 
-    /* Test successful decompression of an inflated type 1 (fixed Huffman
-     * codes) block
-     */
+    /* Test file decompression with a read error */
     UT_InitData();
+    UT_SetDeferredRetcode(UT_KEY(OS_read), 1, OS_FS_ERROR);
     UT_Report(__FILE__, __LINE__,
-              FS_gz_inflate_fixed_Reentrant(&UT_FS_Decompress_State) ==
-                CFE_SUCCESS,
-              "FS_gz_inflate_fixed",
-              "Inflated type 1 decompression - successful");
+              CFE_FS_Decompress_Reentrant(&UT_FS_Decompress_State,
+                                          "fs_test.gz", "Output") ==
+                CFE_FS_GZIP_READ_ERROR &&
+              UT_GetStubCount(UT_KEY(OS_remove)) == 1,
+              "CFE_FS_Decompress",
+              "gzip read error");
 
-    /* Test decompressing an inflated type 0 (stored) block */
+    /* Test file decompression with a write error */
     UT_InitData();
+    UT_SetReadBuffer(fs_gz_test, NumBytes);
+    UT_SetDeferredRetcode(UT_KEY(OS_write), 1, -1);
     UT_Report(__FILE__, __LINE__,
-              FS_gz_inflate_stored_Reentrant(&UT_FS_Decompress_State) !=
-                CFE_SUCCESS,
-              "FS_gz_inflate_stored",
-              "Failed");
+              CFE_FS_Decompress_Reentrant(&UT_FS_Decompress_State,
+                                          "fs_test.gz", "Output") ==
+                CFE_FS_GZIP_WRITE_ERROR &&
+              UT_GetStubCount(UT_KEY(OS_remove)) == 1,
+              "CFE_FS_Decompress",
+              "gzip write error");
 
-    /* Test filling the input buffer with a FS error  */
+    /* Test file decompression of a file that ends in the gzip header */
     UT_InitData();
-    UT_SetDeferredRetcode(UT_KEY(OS_read), 1, 4);
-    UT_SetDeferredRetcode(UT_KEY(OS_read), 1, OS_FS_ERROR);
+    UT_SetReadBuffer(fs_gz_test, 5);
+    UT_SetDeferredRetcode(UT_KEY(OS_read), 2, 0);
     UT_Report(__FILE__, __LINE__,
-              FS_gz_fill_inbuf_Reentrant(&UT_FS_Decompress_State) == EOF,
-              "FS_gz_fill_inbuf",
-              "gzip read error");
+              CFE_FS_Decompress_Reentrant(&UT_FS_Decompress_State,
+                                          "fs_test.gz", "Output") ==
+                CFE_FS_GZIP_READ_ERROR_HEADER,
+              "CFE_FS_Decompress",
+              "File truncated in the header");
 
-    /* Test writing the output window and updating the CRC */
+    /* Test file decompression of a file that ends in the compressed data */
     UT_InitData();
-    UT_SetDeferredRetcode(UT_KEY(OS_write), 1, -1);
-    UT_FS_Decompress_State.outcnt = 435;
-    FS_gz_flush_window_Reentrant(&UT_FS_Decompress_State);
+    UT_SetReadBuffer(fs_gz_test, 4096);
+    UT_SetDeferredRetcode(UT_KEY(OS_read), 2, 0);
+    UT_Report(__FILE__, __LINE__,
+              CFE_FS_Decompress_Reentrant(&UT_FS_Decompress_State,
+                                          "fs_test.gz", "Output") ==
+                CFE_FS_GZIP_TRUNCATED &&
+              UT_GetStubCount(UT_KEY(OS_remove)) == 0,
+              "CFE_FS_Decompress",
+              "File truncated in the data");
+
+    /* Test file decompression with a bad CRC and a bad length in the trailer */
+    UT_InitData();
+    memcpy(Corrupt, fs_gz_test, NumBytes);
+    Corrupt[StreamBytes - 8] ^= 0x01;
+    UT_SetReadBuffer(Corrupt, NumBytes);
     UT_Report(__FILE__, __LINE__,
-              UT_FS_Decompress_State.outcnt == 0 &&
-              UT_FS_Decompress_State.Error == CFE_FS_GZIP_WRITE_ERROR,
-              "FS_gz_flush_window",
-              "Write output - successful");
+              CFE_FS_Decompress_Reentrant(&UT_FS_Decompress_State,
+                                          "fs_test.gz", "Output") ==
+                CFE_FS_GZIP_CRC_ERROR,
+              "CFE_FS_Decompress",
+              "CRC error");
+
+    UT_InitData();
+    memcpy(Corrupt, fs_gz_test, NumBytes);
+    Corrupt[StreamBytes - 4] ^= 0x01;
+    UT_SetReadBuffer(Corrupt, NumBytes);
+    UT_Report(__FILE__, __LINE__,
+              CFE_FS_Decompress_Reentrant(&UT_FS_Decompress_State,
+                                          "fs_test.gz", "Output") ==
+                CFE_FS_GZIP_LENGTH_ERROR,
+              "CFE_FS_Decompress",
+              "Length error");
+
+    /* Test file decompression with corrupted compressed data */
+    UT_InitData();
+    memcpy(Corrupt, fs_gz_test, NumBytes);
+    Corrupt[NumBytes / 2] ^= 0x10;
+    UT_SetReadBuffer(Corrupt, NumBytes);
+    UT_Report(__FILE__, __LINE__,
+              CFE_FS_Decompress_Reentrant(&UT_FS_Decompress_State,
+                                          "fs_test.gz", "Output") !=
+                CFE_SUCCESS &&
+              UT_GetStubCount(UT_KEY(OS_remove)) == 1,
+              "CFE_FS_Decompress",
+              "Corrupted data");
+
+    /* Test streaming decompression in small pieces against the trailer */
+    UT_InitData();
+    UT_Report(__FILE__, __LINE__,
+              UT_FS_InflateImage(fs_gz_test, NumBytes, 7, 100, &TotalOut, &Crc) ==
+                CFE_SUCCESS &&
+              TotalOut == LG(&fs_gz_test[StreamBytes - 4]) &&
+              Crc == LG(&fs_gz_test[StreamBytes - 8]),
+              "CFE_FS_InflateDrain",
+              "Streaming decompression - successful");
+
+    /* Test streaming decompression of a stored block */
+    UT_InitData();
+    UT_Report(__FILE__, __LINE__,
+              UT_FS_InflateImage(UT_FS_GzStored, sizeof(UT_FS_GzStored), 3, 5,
+                                 &TotalOut, &Crc) == CFE_SUCCESS &&
+              TotalOut == 17 &&
+              memcmp(UT_FS_InflateState.Window, "Stored block test", 17) == 0,
+              "CFE_FS_InflateDrain",
+              "Stored block - successful");
+
+    /* Test streaming decompression of a fixed Huffman block with all of
+     * the optional header fields, fed one byte at a time
+     */
+    UT_InitData();
+    UT_Report(__FILE__, __LINE__,
+              UT_FS_InflateImage(UT_FS_GzFixed, sizeof(UT_FS_GzFixed), 1,
+                                 sizeof(UT_FS_InflateOut), &TotalOut, &Crc) ==
+                CFE_SUCCESS &&
+              TotalOut == 51 &&
+              memcmp(UT_FS_InflateState.Window,
+                     "Fixed fixed fixed Huffman codes, fixed fixed fixed.", 51) == 0,
+              "CFE_FS_InflateDrain",
+              "Fixed block and header fields - successful");
+
+    /* Test streaming decompression of data that is not gzip */
+    UT_InitData();
+    UT_Report(__FILE__, __LINE__,
+              UT_FS_InflateImage((const uint8 *)"Not a gzip file", 15, 15, 10,
+                                 &TotalOut, &Crc) == CFE_FS_GZIP_NON_ZIP_FILE &&
+              CFE_FS_InflateFeed(&UT_FS_InflateState, "x", 1) ==
+                CFE_FS_GZIP_NON_ZIP_FILE,
+              "CFE_FS_InflateDrain",
+              "Not a gzip file");
+
+    /* Test the streaming functions with bad arguments */
+    UT_InitData();
+    UT_Report(__FILE__, __LINE__,
+              CFE_FS_InflateInit(NULL) == CFE_FS_BAD_ARGUMENT &&
+              CFE_FS_InflateFeed(&UT_FS_InflateState, NULL, 1) == CFE_FS_BAD_ARGUMENT &&
+              CFE_FS_InflateDrain(&UT_FS_InflateState, NULL, 1) == CFE_FS_BAD_ARGUMENT &&
+              !CFE_FS_InflateFinished(NULL),
+              "CFE_FS_InflateInit",
+              "Bad arguments");
+
+    /* Test successful decompression into a sink function */
+    UT_InitData();
+    UT_FS_SinkBytes = 0;
+    UT_FS_SinkCalls = 0;
+    UT_SetReadBuffer(fs_gz_test, NumBytes);
+    UT_Report(__FILE__, __LINE__,
+              CFE_FS_DecompressToSink_Reentrant(&UT_FS_Decompress_State, "fs_test.gz",
+                                                UT_FS_DecompressSink, NULL) ==
+                CFE_SUCCESS &&
+              UT_FS_SinkCalls > 1 &&
+              UT_FS_SinkBytes == UT_FS_Decompress_State.Inflate.TotalOut &&
+              UT_GetStubCount(UT_KEY(OS_creat)) == 0,
+              "CFE_FS_DecompressToSink",
+              "Decompress to sink - successful");
+
+    /* Test decompression into a sink function that fails */
+    UT_InitData();
+    UT_FS_SinkBytes = 0;
+    UT_FS_SinkCalls = 0;
+    FailCall = 1;
+    UT_SetReadBuffer(fs_gz_test, NumBytes);
+    UT_Report(__FILE__, __LINE__,
+              CFE_FS_DecompressToSink_Reentrant(&UT_FS_Decompress_State, "fs_test.gz",
+                                                UT_FS_DecompressSink, &FailCall) ==
+                CFE_FS_GZIP_WRITE_ERROR &&
+              UT_FS_SinkCalls == 1,
+              "CFE_FS_DecompressToSink",
+              "Sink error stops decompression");
+
+    /* Test decompression into a sink function with a file open failure */
+    UT_InitData();
+    UT_SetForceFail(UT_KEY(OS_open), OS_ERROR);
+    UT_Report(__FILE__, __LINE__,
+              CFE_FS_DecompressToSink("Filename.gz", UT_FS_DecompressSink, NULL) ==
+                CFE_FS_GZIP_OPEN_INPUT,
+              "CFE_FS_DecompressToSink",
+              "Open failed");
 
 #ifdef UT_VERBOSE
     UT_Text("End Test Decompress\n\n");
 #endif
 }
 
+/*
+** Test the streaming gzip compressor, checking its output with the
+** decompressor
+*/
+void Test_CFE_FS_Compress(void)
+{
+    uint32 i;
+    uint32 Seed = 1;
+    uint32 OutLen;
+    uint32 TotalOut;
+    uint32 Crc;
+    uint32 Bound;
+    uint32 DataCrc;
+
+#ifdef UT_VERBOSE
+    UT_Text("Begin Test Compress\n");
+#endif
+
+    /* Telemetry like records: a counter and slowly changing values */
+    for (i = 0; i < sizeof(UT_FS_DeflateIn); i++)
+    {
+        UT_FS_DeflateIn[i] = (i % 16 < 4) ? (uint8)(i / 16) : (uint8)(i % 16 + i / 4096);
+    }
+    DataCrc = FS_gz_updcrc(0, UT_FS_DeflateIn, sizeof(UT_FS_DeflateIn));
+
+    /* Test compressing data that compresses well, fed in odd sized pieces */
+    UT_InitData();
+    UT_Report(__FILE__, __LINE__,
+              UT_FS_DeflateImage(UT_FS_DeflateIn, sizeof(UT_FS_DeflateIn), 0, 77, 300,
+                                 &OutLen) == CFE_SUCCESS &&
+              OutLen < sizeof(UT_FS_DeflateIn) / 4 &&
+              UT_FS_InflateImage(UT_FS_DeflateOut, OutLen, 512, 512, &TotalOut, &Crc) ==
+                CFE_SUCCESS &&
+              TotalOut == sizeof(UT_FS_DeflateIn) &&
+              Crc == DataCrc,
+              "CFE_FS_DeflateDrain",
+              "Compressible data - successful");
+
+    /* Test compressing data that does not compress, which is stored */
+    for (i = 0; i < sizeof(UT_FS_DeflateIn); i++)
+    {
+        Seed = Seed * 1103515245 + 12345;
+        UT_FS_DeflateIn[i] = (uint8)(Seed >> 16);
+    }
+    DataCrc = FS_gz_updcrc(0, UT_FS_DeflateIn, sizeof(UT_FS_DeflateIn));
+
+    UT_InitData();
+    CFE_FS_DeflateInit(&UT_FS_DeflateState);
+    Bound = CFE_FS_DeflateBound(&UT_FS_DeflateState, sizeof(UT_FS_DeflateIn));
+    UT_Report(__FILE__, __LINE__,
+              UT_FS_DeflateImage(UT_FS_DeflateIn, sizeof(UT_FS_DeflateIn), 0, 5000, 4096,
+                                 &OutLen) == CFE_SUCCESS &&
+              OutLen <= Bound &&
+              UT_FS_InflateImage(UT_FS_DeflateOut, OutLen, 512, 512, &TotalOut, &Crc) ==
+                CFE_SUCCESS &&
+              TotalOut == sizeof(UT_FS_DeflateIn) &&
+              Crc == DataCrc,
+              "CFE_FS_DeflateDrain",
+              "Incompressible data - successful");
+
+    /* Test compressing no data at all */
+    UT_InitData();
+    UT_Report(__FILE__, __LINE__,
+              UT_FS_DeflateImage(UT_FS_DeflateIn, 0, 0, 1, 1, &OutLen) == CFE_SUCCESS &&
+              UT_FS_InflateImage(UT_FS_DeflateOut, OutLen, 1, 1, &TotalOut, &Crc) ==
+                CFE_SUCCESS &&
+              TotalOut == 0 &&
+              CFE_FS_DeflateBound(&UT_FS_DeflateState, 0) == 0,
+              "CFE_FS_DeflateDrain",
+              "Empty stream - successful");
+
+    /* Test that no input is taken after the stream is finished */
+    UT_InitData();
+    UT_Report(__FILE__, __LINE__,
+              CFE_FS_DeflateFeed(&UT_FS_DeflateState, UT_FS_DeflateIn, 1) ==
+                CFE_FS_BAD_ARGUMENT &&
+              CFE_FS_DeflateFinish(&UT_FS_DeflateState) == CFE_SUCCESS &&
+              CFE_FS_DeflateFinished(&UT_FS_DeflateState),
+              "CFE_FS_DeflateFeed",
+              "Input after finish");
+
+    /* Test that a flushed stream decompresses without being finished */
+    UT_InitData();
+    CFE_FS_DeflateInit(&UT_FS_DeflateState);
+    OutLen = 0;
+    for (i = 0; i < 2; i++)
+    {
+        CFE_FS_DeflateFeed(&UT_FS_DeflateState, &UT_FS_DeflateIn[i * 3000], 3000);
+        CFE_FS_DeflateFlush(&UT_FS_DeflateState);
+        OutLen += CFE_FS_DeflateDrain(&UT_FS_DeflateState, &UT_FS_DeflateOut[OutLen],
+                                      sizeof(UT_FS_DeflateOut) - OutLen);
+    }
+    UT_Report(__FILE__, __LINE__,
+              !CFE_FS_DeflateFinished(&UT_FS_DeflateState) &&
+              UT_FS_InflateImage(UT_FS_DeflateOut, OutLen, 512, 512, &TotalOut, &Crc) ==
+                CFE_FS_GZIP_READ_ERROR &&
+              TotalOut == 6000 &&
+              Crc == FS_gz_updcrc(0, UT_FS_DeflateIn, 6000),
+              "CFE_FS_DeflateFlush",
+              "Flushed data - successful");
+
+    /* Test finishing the flushed stream */
+    UT_InitData();
+    CFE_FS_DeflateFinish(&UT_FS_DeflateState);
+    OutLen += CFE_FS_DeflateDrain(&UT_FS_DeflateState, &UT_FS_DeflateOut[OutLen],
+                                  sizeof(UT_FS_DeflateOut) - OutLen);
+    UT_Report(__FILE__, __LINE__,
+              CFE_FS_DeflateFinished(&UT_FS_DeflateState) &&
+              CFE_FS_DeflateFlush(&UT_FS_DeflateState) == CFE_FS_BAD_ARGUMENT &&
+              UT_FS_InflateImage(UT_FS_DeflateOut, OutLen, 512, 512, &TotalOut, &Crc) ==
+                CFE_SUCCESS &&
+              TotalOut == 6000,
+              "CFE_FS_DeflateFlush",
+              "Finish after flush - successful");
+
+    /* Test writing a stored member */
+    UT_InitData();
+    UT_Report(__FILE__, __LINE__,
+              CFE_FS_DeflateStored(UT_FS_DeflateOut, sizeof(UT_FS_DeflateOut),
+                                   UT_FS_DeflateIn, 100) ==
+                CFE_FS_DEFLATE_STORED_SIZE(100) &&
+              UT_FS_InflateImage(UT_FS_DeflateOut, CFE_FS_DEFLATE_STORED_SIZE(100), 512, 512,
+                                 &TotalOut, &Crc) == CFE_SUCCESS &&
+              TotalOut == 100 &&
+              Crc == FS_gz_updcrc(0, UT_FS_DeflateIn, 100),
+              "CFE_FS_DeflateStored",
+              "Stored member - successful");
+
+    UT_InitData();
+    UT_Report(__FILE__, __LINE__,
+              CFE_FS_DeflateStored(UT_FS_DeflateOut, CFE_FS_DEFLATE_STORED_SIZE(100) - 1,
+                                   UT_FS_DeflateIn, 100) == CFE_FS_BAD_ARGUMENT &&
+              CFE_FS_DeflateStored(UT_FS_DeflateOut, sizeof(UT_FS_DeflateOut),
+                                   UT_FS_DeflateIn, 0x10000) == CFE_FS_BAD_ARGUMENT &&
+              CFE_FS_DeflateStored(NULL, sizeof(UT_FS_DeflateOut),
+                                   UT_FS_DeflateIn, 100) == CFE_FS_BAD_ARGUMENT,
+              "CFE_FS_DeflateStored",
+              "Bad arguments");
+
+    /* Test the streaming functions with bad arguments */
+    UT_InitData();
+    UT_Report(__FILE__, __LINE__,
+              CFE_FS_DeflateInit(NULL) == CFE_FS_BAD_ARGUMENT &&
+              CFE_FS_DeflateFeed(NULL, UT_FS_DeflateIn, 1) == CFE_FS_BAD_ARGUMENT &&
+              CFE_FS_DeflateFlush(NULL) == CFE_FS_BAD_ARGUMENT &&
+              CFE_FS_DeflateFinish(NULL) == CFE_FS_BAD_ARGUMENT &&
+              CFE_FS_DeflateDrain(&UT_FS_DeflateState, NULL, 1) == CFE_FS_BAD_ARGUMENT &&
+              CFE_FS_DeflateBound(NULL, 1) == 0 &&
+              !CFE_FS_DeflateFinished(NULL),
+              "CFE_FS_DeflateInit",
+              "Bad arguments");
+
+    /* Test restoring a cFE file whose data after the headers is compressed */
+    memset(UT_FS_DeflateOut, 0, 100);
+    UT_FS_DeflateOut[0] = 0x63;
+    UT_FS_DeflateOut[1] = 0x46;
+    UT_FS_DeflateOut[2] = 0x45;
+    UT_FS_DeflateOut[3] = 0x31;
+    UT_FS_DeflateOut[70] = 0x1f;
+    UT_FS_DeflateOut[71] = 0x8b;
+    UT_FS_DeflateOut[72] = 0x08;
+    UT_FS_DeflateOut[73] = 0x02;
+
+    UT_InitData();
+    UT_FS_SinkBytes = 0;
+    UT_FS_SinkCalls = 0;
+    UT_FS_DeflateImage(UT_FS_DeflateIn, 3000, 100, 3000, 4096, &OutLen);
+    UT_SetReadBuffer(UT_FS_DeflateOut, OutLen);
+    UT_Report(__FILE__, __LINE__,
+              CFE_FS_DecompressToSink_Reentrant(&UT_FS_Decompress_State, "ds.dat",
+                                                UT_FS_DecompressSink, NULL) ==
+                CFE_SUCCESS &&
+              UT_FS_SinkBytes == 3000 &&
+              UT_FS_Decompress_State.Inflate.Crc ==
+                FS_gz_updcrc(0, UT_FS_DeflateIn, 3000),
+              "CFE_FS_DecompressToSink",
+              "Compressed cFE file - successful");
+
+    /* Test restoring a cFE file with no compressed data after the headers */
+    UT_InitData();
+    UT_SetReadBuffer(UT_FS_DeflateOut, 100);
+    UT_Report(__FILE__, __LINE__,
+              CFE_FS_DecompressToSink_Reentrant(&UT_FS_Decompress_State, "ds.dat",
+                                                UT_FS_DecompressSink, NULL) ==
+                CFE_FS_GZIP_NON_ZIP_FILE,
+              "CFE_FS_DecompressToSink",
+              "Uncompressed cFE file");
+
+    /*
+    ** Test restoring a cFE file with a stored member of headers followed
+    ** by the compressed data, as data storage writes them
+    */
+    UT_InitData();
+    UT_FS_SinkBytes = 0;
+    UT_FS_DeflateImage(&UT_FS_DeflateIn[50], 3000, 64 + CFE_FS_DEFLATE_STORED_SIZE(50),
+                       3000, 4096, &OutLen);
+    memset(UT_FS_DeflateOut, 0, 64);
+    UT_FS_DeflateOut[0] = 0x63;
+    UT_FS_DeflateOut[1] = 0x46;
+    UT_FS_DeflateOut[2] = 0x45;
+    UT_FS_DeflateOut[3] = 0x31;
+    CFE_FS_DeflateStored(&UT_FS_DeflateOut[64], CFE_FS_DEFLATE_STORED_SIZE(50),
+                         UT_FS_DeflateIn, 50);
+    UT_SetReadBuffer(UT_FS_DeflateOut, OutLen);
+    UT_Report(__FILE__, __LINE__,
+              CFE_FS_DecompressToSink_Reentrant(&UT_FS_Decompress_State, "ds.dat",
+                                                UT_FS_DecompressSink, NULL) ==
+                CFE_SUCCESS &&
+              UT_FS_SinkBytes == 3050,
+              "CFE_FS_DecompressToSink",
+              "Two members - successful");
+
+    /* Test restoring the same file cut off before its trailer */
+    UT_InitData();
+    UT_FS_SinkBytes = 0;
+    UT_SetReadBuffer(UT_FS_DeflateOut, OutLen - FS_GZ_TRAILER_BYTES);
+    UT_SetDeferredRetcode(UT_KEY(OS_read), 2, 0);
+    UT_Report(__FILE__, __LINE__,
+              CFE_FS_DecompressToSink_Reentrant(&UT_FS_Decompress_State, "ds.dat",
+                                                UT_FS_DecompressSink, NULL) ==
+                CFE_FS_GZIP_TRUNCATED &&
+              UT_FS_SinkBytes == 3050,
+              "CFE_FS_DecompressToSink",
+              "Cut off member");
+
+#ifdef UT_VERBOSE
+    UT_Text("End Test Compress\n\n");
+#endif
+}
+
 /*
  * Test the CFE_FS_GetUncompressedFile() API which is a wrapper
  * around CFE_FS_Decompress() that outputs to a temp file
@@ -251,12 +251,34 @@ void Test_CFE_FS_Private(void);
 **        This function does not return a value.
 **
 ** \sa #UT_Text, #UT_InitData, #UT_SetOSFail, #UT_Report, #CFE_FS_Decompress,
-** \sa #UT_SetReadBuffer, #FS_gz_inflate_fixed, #FS_gz_inflate_stored,
-** \sa #FS_gz_fill_inbuf, #FS_gz_flush_window
+** \sa #UT_SetReadBuffer, #CFE_FS_InflateInit, #CFE_FS_InflateFeed,
+** \sa #CFE_FS_InflateDrain, #CFE_FS_InflateFinished
 **
 ******************************************************************************/
 void Test_CFE_FS_Decompress(void);
 
+/*****************************************************************************/
+/**
+** \brief Tests for the streaming gzip compressor
+**
+** \par Description
+**        This function tests the CFE_FS_Deflate functions, checking the
+**        compressed data with the decompressor, and the restore of a cFE
+**        file whose data is compressed.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+**
+** \sa #UT_Text, #UT_InitData, #UT_Report, #CFE_FS_DeflateInit,
+** \sa #CFE_FS_DeflateFeed, #CFE_FS_DeflateFinish, #CFE_FS_DeflateDrain,
+** \sa #CFE_FS_DeflateFinished, #CFE_FS_DeflateBound
+**
+******************************************************************************/
+void Test_CFE_FS_Compress(void);
+
 /*****************************************************************************/
 /**
 ** \brief Tests for CFE_FS_GetUncompressedFile function
@@ -563,7 +563,6 @@ void Test_SB_AppInit_EVSSendEvtFail(void)
     int32 ActRtn;
     int32 TestStat = CFE_PASS;
     int32 ForcedRtnVal = -1;
-    CFE_ES_TaskInfo_t TestTaskInfo;
 
 #ifdef UT_VERBOSE
     UT_Text("Start of EVS_SendEvent Failure Test");
@@ -571,13 +570,6 @@ void Test_SB_AppInit_EVSSendEvtFail(void)
 
     SB_ResetUnitTest();
 
-    /* To get coverage on CFE_SB_GetAppTskName(), this ensures that the
-     * path with different app/task names is followed on at least one event.
-     */
-    memset(&TestTaskInfo, 0, sizeof(TestTaskInfo));
-    strncpy((char*)TestTaskInfo.TaskName, "test", sizeof(TestTaskInfo.TaskName)-1);
-    UT_SetDataBuffer(UT_KEY(CFE_ES_GetTaskInfo), &TestTaskInfo, sizeof(TestTaskInfo), false);
-
     /* There are three events prior to init, pipe created (1) and subscription
      * rcvd (2). Fourth is SB initialized, but it is the first to use SendEvent.
      * (The others use SendEventWithAppID which is a different counter).
@@ -3083,7 +3075,7 @@ void Test_CreatePipe_NullPtr(void)
     SB_ResetUnitTest();
 
     /* This provides completion of code coverage in CFE_SB_GetAppTskName() */
-    UT_SetDeferredRetcode(UT_KEY(CFE_ES_GetTaskInfo), 1, CFE_ES_ERR_APPID);
+    UT_SetDeferredRetcode(UT_KEY(CFE_ES_GetTaskFullName), 1, CFE_ES_ERR_TASKID);
 
     ExpRtn = CFE_SB_BAD_ARGUMENT;
     UT_SetDeferredRetcode(UT_KEY(OS_QueueCreate), 1, OS_SUCCESS); /* Avoids creating socket */
@@ -7291,6 +7283,7 @@ void Test_RcvMsg_API(void)
     Test_RcvMsg_GetLastSenderInvalidPipe();
     Test_RcvMsg_GetLastSenderInvalidCaller();
     Test_RcvMsg_GetLastSenderSuccess();
+    Test_RcvMsg_GetLastSenderName();
     Test_RcvMsg_Timeout();
     Test_RcvMsg_PipeReadError();
     Test_RcvMsg_PendForever();
@@ -7684,6 +7677,59 @@ void Test_RcvMsg_GetLastSenderSuccess(void)
               "GetLastSenderId Success Test");
 } /* end Test_RcvMsg_GetLastSenderSuccess */
 
+/*
+** Test that the last sender name is resolved from the sending task
+*/
+void Test_RcvMsg_GetLastSenderName(void)
+{
+    CFE_SB_PipeId_t   PipeId;
+    CFE_SB_MsgId_t    MsgId = SB_UT_TLM_MID;
+    CFE_SB_MsgPtr_t   PtrToMsg;
+    SB_UT_Test_Tlm_t  TlmPkt;
+    CFE_SB_MsgPtr_t   TlmPktPtr = (CFE_SB_MsgPtr_t) &TlmPkt;
+    CFE_SB_SenderId_t *GLSPtr;
+    uint32            PipeDepth = 10;
+    int32             TestStat = CFE_PASS;
+
+#ifdef UT_VERBOSE
+    UT_Text("Begin Test for GetLastSender Name");
+#endif
+
+    SB_ResetUnitTest();
+    CFE_SB_CreatePipe(&PipeId, PipeDepth, "RcvMsgTestPipe");
+    CFE_SB_InitMsg(&TlmPkt, MsgId, sizeof(TlmPkt), true);
+    CFE_SB_Subscribe(MsgId, PipeId);
+
+    /* With reporting on the sending task's cached name is returned */
+    CFE_SB.SenderReporting = 1;
+    CFE_SB_SendMsg(TlmPktPtr);
+    CFE_SB_RcvMsg(&PtrToMsg, PipeId, CFE_SB_PEND_FOREVER);
+
+    if (CFE_SB_GetLastSenderId(&GLSPtr, PipeId) != CFE_SUCCESS ||
+        strcmp(GLSPtr->AppName, "UT") != 0)
+    {
+        UT_Text("Unexpected sender name with sender reporting enabled");
+        TestStat = CFE_FAIL;
+    }
+
+    /* With reporting off no sender is recorded */
+    CFE_SB.SenderReporting = 0;
+    CFE_SB_SendMsg(TlmPktPtr);
+    CFE_SB_RcvMsg(&PtrToMsg, PipeId, CFE_SB_PEND_FOREVER);
+
+    if (CFE_SB_GetLastSenderId(&GLSPtr, PipeId) != CFE_SUCCESS ||
+        GLSPtr->AppName[0] != '\0')
+    {
+        UT_Text("Unexpected sender name with sender reporting disabled");
+        TestStat = CFE_FAIL;
+    }
+
+    CFE_SB_DeletePipe(PipeId);
+    UT_Report(__FILE__, __LINE__,
+              TestStat, "Test_RcvMsg_API",
+              "GetLastSenderId sender name test");
+} /* end Test_RcvMsg_GetLastSenderName */
+
 /*
 ** Test receiving a message response to a timeout
 */
@@ -8026,6 +8072,7 @@ void Test_SB_Utils(void)
     Test_CFE_SB_SetGetTotalMsgLength();
     Test_CFE_SB_SetGetMsgTime();
     Test_CFE_SB_TimeStampMsg();
+    Test_CFE_SB_TimeStampMsgs();
     Test_CFE_SB_SetGetCmdCode();
     Test_CFE_SB_ChecksumUtils();
     Test_CFE_SB_ValidateMsgId();
@@ -8971,6 +9018,64 @@ void Test_CFE_SB_TimeStampMsg(void)
               "Telemetry packet with secondary header test");
 } /* end Test_CFE_SB_TimeStampMsg */
 
+/*
+** Test setting the time field of several messages with one time read
+*/
+void Test_CFE_SB_TimeStampMsgs(void)
+{
+    SB_UT_Test_Tlm_t   SBTlm[2];
+    CFE_SB_MsgPtr_t    MsgPtrs[3];
+    CFE_TIME_SysTime_t Time0;
+    CFE_TIME_SysTime_t Time1;
+    int32              TestStat = CFE_PASS;
+
+#ifdef UT_VERBOSE
+    UT_Text("Begin Test_CFE_SB_TimeStampMsgs");
+#endif
+
+    SB_ResetUnitTest();
+    memset(SBTlm, 0xff, sizeof(SBTlm));
+    CFE_SB_SetMsgId((CFE_SB_MsgPtr_t) &SBTlm[0], SB_UT_TLM_MID);
+    CFE_SB_SetMsgId((CFE_SB_MsgPtr_t) &SBTlm[1], SB_UT_TLM_MID);
+    MsgPtrs[0] = (CFE_SB_MsgPtr_t) &SBTlm[0];
+    MsgPtrs[1] = NULL;
+    MsgPtrs[2] = (CFE_SB_MsgPtr_t) &SBTlm[1];
+
+    /* The CFE_TIME_GetTime stub counts up on each call, so equal times
+     * in both packets show that the time was read only once
+     */
+    CFE_SB_TimeStampMsgs(MsgPtrs, 3);
+    Time0 = CFE_SB_GetMsgTime(MsgPtrs[0]);
+    Time1 = CFE_SB_GetMsgTime(MsgPtrs[2]);
+
+    if (Time0.Seconds != Time1.Seconds ||
+        Time0.Subseconds != Time1.Subseconds ||
+        UT_GetStubCount(UT_KEY(CFE_TIME_GetTime)) != 1)
+    {
+        snprintf(cMsg, UT_MAX_MESSAGE_LENGTH,
+                 "Time0.Sec=%lu, Time1.Sec=%lu, GetTime calls=%lu",
+                 (unsigned long) Time0.Seconds,
+                 (unsigned long) Time1.Seconds,
+                 (unsigned long) UT_GetStubCount(UT_KEY(CFE_TIME_GetTime)));
+        UT_Text(cMsg);
+        TestStat = CFE_FAIL;
+    }
+
+    /* An empty list must not read the time at all */
+    CFE_SB_TimeStampMsgs(MsgPtrs, 0);
+    CFE_SB_TimeStampMsgs(NULL, 3);
+
+    if (UT_GetStubCount(UT_KEY(CFE_TIME_GetTime)) != 1)
+    {
+        UT_Text("CFE_TIME_GetTime called for an empty list");
+        TestStat = CFE_FAIL;
+    }
+
+    UT_Report(__FILE__, __LINE__,
+              TestStat, "CFE_SB_TimeStampMsgs",
+              "Stamp a list of packets with one time read");
+} /* end Test_CFE_SB_TimeStampMsgs */
+
 /*
 ** Test setting and getting the opcode field of message
 */
@@ -2653,7 +2653,8 @@ void Test_SendMsg_MaxMsgSizePlusOne_ZeroCopy(void);
 ** \sa #Test_RcvMsg_Poll, #Test_RcvMsg_GetLastSenderNull,
 ** \sa #Test_RcvMsg_GetLastSenderInvalidPipe,
 ** \sa #Test_RcvMsg_GetLastSenderInvalidCaller,
-** \sa #Test_RcvMsg_GetLastSenderSuccess, #Test_RcvMsg_Timeout,
+** \sa #Test_RcvMsg_GetLastSenderSuccess, #Test_RcvMsg_GetLastSenderName,
+** \sa #Test_RcvMsg_Timeout,
 ** \sa #Test_RcvMsg_PipeReadError, #Test_RcvMsg_PendForever
 **
 ******************************************************************************/
@@ -2806,6 +2807,28 @@ void Test_RcvMsg_GetLastSenderInvalidCaller(void);
 ******************************************************************************/
 void Test_RcvMsg_GetLastSenderSuccess(void);
 
+/*****************************************************************************/
+/**
+** \brief Test the sender name returned for the last message
+**
+** \par Description
+**        This function tests that the sender recorded when a message is
+**        sent is resolved to a name by the get last sender request, and
+**        that no name is returned when sender reporting is disabled.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+**
+** \sa #UT_Text, #SB_ResetUnitTest, #CFE_SB_CreatePipe, #CFE_SB_SendMsg,
+** \sa #CFE_SB_RcvMsg, #CFE_SB_GetLastSenderId, #CFE_SB_DeletePipe,
+** \sa #UT_Report
+**
+******************************************************************************/
+void Test_RcvMsg_GetLastSenderName(void);
+
 /*****************************************************************************/
 /**
 ** \brief Test receiving a message response to a timeout
@@ -3127,6 +3150,26 @@ void Test_CFE_SB_SetGetMsgTime(void);
 ******************************************************************************/
 void Test_CFE_SB_TimeStampMsg(void);
 
+/*****************************************************************************/
+/**
+** \brief Test setting the time field of several messages with one time read
+**
+** \par Description
+**        This function tests that a list of messages is stamped with a
+**        single current time, skipping NULL entries.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+**
+** \sa #UT_Text, #SB_ResetUnitTest, #CFE_SB_SetMsgId, #CFE_SB_TimeStampMsgs,
+** \sa #CFE_SB_GetMsgTime, #UT_Report
+**
+******************************************************************************/
+void Test_CFE_SB_TimeStampMsgs(void);
+
 /*****************************************************************************/
 /**
 ** \brief Test setting and getting the opcode field of message
@@ -136,6 +136,9 @@ void OS_Application_Startup(void)
 
     /* Miscellaneous cfe_tbl_internal.c tests */
     UT_ADD_TEST(Test_CFE_TBL_Internal);
+
+    /* Uses its own table registry */
+    UT_ADD_TEST(Test_CFE_TBL_ReadAddress);
 }
 
 /*
@@ -176,6 +179,7 @@ void UT_ResetTableRegistry(void)
         CFE_TBL_TaskData.Handles[i].LockFlag = false;
         CFE_TBL_TaskData.Handles[i].Updated = false;
         CFE_TBL_TaskData.Handles[i].BufferIndex = 0;
+        CFE_TBL_TaskData.Handles[i].ReadEpoch = 0;
     }
 
     /* Initialize the table validation results records */
@@ -205,6 +209,38 @@ void UT_ResetTableRegistry(void)
     CFE_TBL_TaskData.LastTblUpdated = CFE_TBL_NOT_FOUND;
 }
 
+/*
+** Set up the decompressed image of a gzip table file, in file byte order
+*/
+void UT_SetGzTableImage(const char *TableName, uint32 Offset,
+                        uint32 NumBytes, uint32 ImageSize)
+{
+    static struct
+    {
+        CFE_FS_Header_t    StdFileHeader;
+        CFE_TBL_File_Hdr_t TblFileHeader;
+        uint8              Data[16];
+    } GzImage;
+
+    memset(&GzImage, 0, sizeof(GzImage));
+    GzImage.StdFileHeader.ContentType = CFE_FS_FILE_CONTENT_ID;
+    GzImage.StdFileHeader.SubType = CFE_FS_SubType_TBL_IMG;
+    strncpy(GzImage.TblFileHeader.TableName, TableName,
+            sizeof(GzImage.TblFileHeader.TableName) - 1);
+    GzImage.TblFileHeader.Offset = Offset;
+    GzImage.TblFileHeader.NumBytes = NumBytes;
+
+    if (UT_Endianess == UT_LITTLE_ENDIAN)
+    {
+        CFE_TBL_ByteSwapStdHeader(&GzImage.StdFileHeader);
+        CFE_TBL_ByteSwapTblHeader(&GzImage.TblFileHeader);
+    }
+
+    UT_SetForceFail(UT_KEY(CFE_FS_IsGzFile), true);
+    UT_SetDataBuffer(UT_KEY(CFE_FS_DecompressToSink), &GzImage,
+                     ImageSize, false);
+}
+
 /*
 ** Tests to cover table task initialization functions
 */
@@ -3279,6 +3315,105 @@ void Test_CFE_TBL_ReleaseAddresses(void)
                 "been loaded)");
 }
 
+/*
+** Test function that reads tables with epoch based access
+*/
+void Test_CFE_TBL_ReadAddress(void)
+{
+    int32       RtnCode;
+    bool        EventsCorrect;
+    UT_Table1_t TestTable1;
+    UT_Table1_t *TblPtr;
+    UT_Table1_t *OldTblPtr;
+    CFE_TBL_RegistryRec_t *RegRecPtr;
+
+#ifdef UT_VERBOSE
+    UT_Text("Begin Test Read Address\n");
+#endif
+
+    memset(&TestTable1, 0, sizeof(TestTable1));
+
+    /* Test reading with an invalid handle */
+    UT_InitData();
+    UT_SetAppID(1);
+    UT_ResetTableRegistry();
+    RtnCode = CFE_TBL_GetReadAddress((void **) &TblPtr, CFE_PLATFORM_TBL_MAX_NUM_HANDLES);
+    UT_Report(__FILE__, __LINE__,
+              RtnCode == CFE_TBL_ERR_INVALID_HANDLE && TblPtr == NULL &&
+              CFE_TBL_ReleaseReadAddress(CFE_PLATFORM_TBL_MAX_NUM_HANDLES) == CFE_TBL_ERR_INVALID_HANDLE,
+              "CFE_TBL_GetReadAddress",
+              "Invalid table handle");
+
+    /* Test reading a loaded double buffered table */
+    UT_InitData();
+    CFE_TBL_Register(&App1TblHandle2, "UT_Table2", sizeof(UT_Table1_t),
+                     CFE_TBL_OPT_DBL_BUFFER, NULL);
+    CFE_TBL_Load(App1TblHandle2, CFE_TBL_SRC_ADDRESS, &TestTable1);
+    RegRecPtr = &CFE_TBL_TaskData.Registry[CFE_TBL_TaskData.Handles[App1TblHandle2].RegIndex];
+    RtnCode = CFE_TBL_GetReadAddress((void **) &OldTblPtr, App1TblHandle2);
+    UT_Report(__FILE__, __LINE__,
+              RtnCode == CFE_TBL_INFO_UPDATED &&
+              OldTblPtr == (UT_Table1_t *) RegRecPtr->Buffers[RegRecPtr->ActiveBufferIndex].BufferPtr &&
+              CFE_TBL_TaskData.Handles[App1TblHandle2].ReadEpoch == RegRecPtr->Epoch,
+              "CFE_TBL_GetReadAddress",
+              "Read double buffered table");
+
+    /* Test that an update publishes the new buffer without waiting for
+     * the reader
+     */
+    UT_InitData();
+    TestTable1.TblElement1 = 1;
+    RtnCode = CFE_TBL_Load(App1TblHandle2, CFE_TBL_SRC_ADDRESS, &TestTable1);
+    CFE_TBL_GetReadAddress((void **) &TblPtr, App1TblHandle2);
+    UT_Report(__FILE__, __LINE__,
+              RtnCode == CFE_SUCCESS && TblPtr != OldTblPtr && TblPtr->TblElement1 == 1,
+              "CFE_TBL_Load",
+              "Double buffered update with a reader present");
+
+    /* Test that the retired buffer is not reused before the reader of the
+     * previous epoch reports a quiescent point
+     */
+    UT_InitData();
+    CFE_TBL_TaskData.Handles[App1TblHandle2].ReadEpoch = RegRecPtr->Epoch - 1;
+    RtnCode = CFE_TBL_Load(App1TblHandle2, CFE_TBL_SRC_ADDRESS, &TestTable1);
+    UT_Report(__FILE__, __LINE__,
+              RtnCode == CFE_TBL_ERR_NO_BUFFER_AVAIL,
+              "CFE_TBL_Load",
+              "Retired buffer still in use by a reader");
+
+    UT_InitData();
+    RtnCode = CFE_TBL_ReleaseReadAddress(App1TblHandle2);
+    EventsCorrect = (CFE_TBL_TaskData.Handles[App1TblHandle2].ReadEpoch == 0);
+    UT_Report(__FILE__, __LINE__,
+              RtnCode == CFE_SUCCESS && EventsCorrect &&
+              CFE_TBL_Load(App1TblHandle2, CFE_TBL_SRC_ADDRESS, &TestTable1) == CFE_SUCCESS,
+              "CFE_TBL_ReleaseReadAddress",
+              "Retired buffer reused after quiescent point");
+
+    /* Test that a single buffered table is not updated in place while it
+     * is being read, and that managing the table is a quiescent point
+     */
+    UT_InitData();
+    CFE_TBL_Register(&App1TblHandle1, "UT_Table1", sizeof(UT_Table1_t),
+                     CFE_TBL_OPT_DEFAULT, NULL);
+    CFE_TBL_Load(App1TblHandle1, CFE_TBL_SRC_ADDRESS, &TestTable1);
+    CFE_TBL_GetReadAddress((void **) &TblPtr, App1TblHandle1);
+    RegRecPtr = &CFE_TBL_TaskData.Registry[CFE_TBL_TaskData.Handles[App1TblHandle1].RegIndex];
+    RtnCode = CFE_TBL_Load(App1TblHandle1, CFE_TBL_SRC_ADDRESS, &TestTable1);
+    UT_Report(__FILE__, __LINE__,
+              RtnCode == CFE_TBL_INFO_TABLE_LOCKED && RegRecPtr->LoadPending,
+              "CFE_TBL_Load",
+              "Single buffered table locked by a reader");
+
+    UT_InitData();
+    RtnCode = CFE_TBL_Manage(App1TblHandle1);
+    UT_Report(__FILE__, __LINE__,
+              RtnCode == CFE_TBL_INFO_UPDATED && !RegRecPtr->LoadPending &&
+              CFE_TBL_TaskData.Handles[App1TblHandle1].ReadEpoch == 0,
+              "CFE_TBL_Manage",
+              "Update single buffered table after quiescent point");
+}
+
 /*
 ** Test function for validating the table image for a specified table
 */
@@ -4077,6 +4212,9 @@ void Test_CFE_TBL_Internal(void)
     CFE_TBL_File_Hdr_t         TblFileHeader;
     int32                      FileDescriptor = 0;
     void                       *TblPtr;
+    CFE_TBL_RegistryRec_t      BigRegRec;
+    CFE_TBL_LoadBuff_t         BigLoadBuff;
+    static uint8               BigTable[10000];
 
 #ifdef UT_VERBOSE
     UT_Text("Begin Test Internal\n");
@@ -4315,6 +4453,119 @@ void Test_CFE_TBL_Internal(void)
               "CFE_TBL_LoadFromFile",
               "File too short warning");
 
+    /* Test CFE_TBL_LoadFromFile reading a table larger than one read block */
+    UT_InitData();
+    Filename[OS_MAX_PATH_LEN - 1] = '\0';
+    StdFileHeader.ContentType = CFE_FS_FILE_CONTENT_ID;
+    StdFileHeader.SubType = CFE_FS_SubType_TBL_IMG;
+    strncpy((char *)TblFileHeader.TableName, "ut_cfe_tbl.UT_Table2",
+            sizeof(TblFileHeader.TableName));
+    TblFileHeader.NumBytes = sizeof(BigTable);
+    TblFileHeader.Offset = 0;
+
+    if (UT_Endianess == UT_LITTLE_ENDIAN)
+    {
+        CFE_TBL_ByteSwapUint32(&TblFileHeader.NumBytes);
+        CFE_TBL_ByteSwapUint32(&TblFileHeader.Offset);
+    }
+
+    BigRegRec = *RegRecPtr;
+    BigRegRec.Size = sizeof(BigTable);
+    BigLoadBuff = *WorkingBufferPtr;
+    BigLoadBuff.BufferPtr = BigTable;
+    UT_SetReadBuffer(&TblFileHeader, sizeof(TblFileHeader));
+    UT_SetReadHeader(&StdFileHeader, sizeof(StdFileHeader));
+    UT_SetDeferredRetcode(UT_KEY(OS_read), 5, 0);
+    RtnCode = CFE_TBL_LoadFromFile(&BigLoadBuff, &BigRegRec, Filename);
+    EventsCorrect = (UT_GetNumEventsSent() == 0);
+    UT_Report(__FILE__, __LINE__,
+              RtnCode == CFE_SUCCESS && EventsCorrect &&
+              UT_GetStubCount(UT_KEY(OS_read)) == 5,
+              "CFE_TBL_LoadFromFile",
+              "Table loaded in multiple read blocks");
+
+    /* Test CFE_TBL_LoadFromFile loading a gzip compressed table file */
+    UT_InitData();
+    UT_SetGzTableImage("ut_cfe_tbl.UT_Table2", 0, sizeof(UT_Table1_t),
+                       UT_GZ_IMAGE_HDR_SIZE + sizeof(UT_Table1_t));
+    RtnCode = CFE_TBL_LoadFromFile(WorkingBufferPtr, RegRecPtr, "ut.tbl.gz");
+    EventsCorrect = (UT_GetNumEventsSent() == 0);
+    UT_Report(__FILE__, __LINE__,
+              RtnCode == CFE_SUCCESS && EventsCorrect &&
+              UT_GetStubCount(UT_KEY(OS_open)) == 0 &&
+              strcmp(WorkingBufferPtr->DataSource, "ut.tbl.gz") == 0,
+              "CFE_TBL_LoadFromFile",
+              "Compressed file loaded");
+
+    /* Test CFE_TBL_LoadFromFile loading a short gzip compressed table file */
+    UT_InitData();
+    UT_SetGzTableImage("ut_cfe_tbl.UT_Table2", 0, sizeof(UT_Table1_t) - 1,
+                       UT_GZ_IMAGE_HDR_SIZE + sizeof(UT_Table1_t) - 1);
+    RtnCode = CFE_TBL_LoadFromFile(WorkingBufferPtr, RegRecPtr, "ut.tbl.gz");
+    UT_Report(__FILE__, __LINE__,
+              RtnCode == CFE_TBL_WARN_SHORT_FILE,
+              "CFE_TBL_LoadFromFile",
+              "Compressed file too short warning");
+
+    /* Test CFE_TBL_LoadFromFile response to a gzip compressed table file
+     * with more data than the header claims
+     */
+    UT_InitData();
+    UT_SetGzTableImage("ut_cfe_tbl.UT_Table2", 0, sizeof(UT_Table1_t) - 1,
+                       UT_GZ_IMAGE_HDR_SIZE + sizeof(UT_Table1_t));
+    RtnCode = CFE_TBL_LoadFromFile(WorkingBufferPtr, RegRecPtr, "ut.tbl.gz");
+    UT_Report(__FILE__, __LINE__,
+              RtnCode == CFE_TBL_ERR_FILE_TOO_LARGE,
+              "CFE_TBL_LoadFromFile",
+              "Compressed file content too large");
+
+    /* Test CFE_TBL_LoadFromFile response to a gzip compressed table file
+     * with less data than the header claims
+     */
+    UT_InitData();
+    UT_SetGzTableImage("ut_cfe_tbl.UT_Table2", 0, sizeof(UT_Table1_t),
+                       UT_GZ_IMAGE_HDR_SIZE + sizeof(UT_Table1_t) - 1);
+    RtnCode = CFE_TBL_LoadFromFile(WorkingBufferPtr, RegRecPtr, "ut.tbl.gz");
+    UT_Report(__FILE__, __LINE__,
+              RtnCode == CFE_TBL_ERR_LOAD_INCOMPLETE,
+              "CFE_TBL_LoadFromFile",
+              "Compressed file content incomplete");
+
+    /* Test CFE_TBL_LoadFromFile response to a gzip compressed table file
+     * for the wrong table
+     */
+    UT_InitData();
+    UT_SetGzTableImage("ut_cfe_tbl.NotUT_Table2", 0, sizeof(UT_Table1_t),
+                       UT_GZ_IMAGE_HDR_SIZE + sizeof(UT_Table1_t));
+    RtnCode = CFE_TBL_LoadFromFile(WorkingBufferPtr, RegRecPtr, "ut.tbl.gz");
+    UT_Report(__FILE__, __LINE__,
+              RtnCode == CFE_TBL_ERR_FILE_FOR_WRONG_TABLE,
+              "CFE_TBL_LoadFromFile",
+              "Compressed file for wrong table");
+
+    /* Test CFE_TBL_LoadFromFile response to a gzip compressed table file
+     * that ends inside the table header
+     */
+    UT_InitData();
+    UT_SetGzTableImage("ut_cfe_tbl.UT_Table2", 0, sizeof(UT_Table1_t),
+                       sizeof(CFE_FS_Header_t) + 4);
+    RtnCode = CFE_TBL_LoadFromFile(WorkingBufferPtr, RegRecPtr, "ut.tbl.gz");
+    UT_Report(__FILE__, __LINE__,
+              RtnCode == CFE_TBL_ERR_NO_TBL_HEADER &&
+              UT_EventIsInHistory(CFE_TBL_FILE_TBL_HDR_ERR_EID),
+              "CFE_TBL_LoadFromFile",
+              "Compressed file missing table header");
+
+    /* Test CFE_TBL_LoadFromFile response to a gzip decompression error */
+    UT_InitData();
+    UT_SetForceFail(UT_KEY(CFE_FS_IsGzFile), true);
+    UT_SetForceFail(UT_KEY(CFE_FS_DecompressToSink), CFE_FS_GZIP_CRC_ERROR);
+    RtnCode = CFE_TBL_LoadFromFile(WorkingBufferPtr, RegRecPtr, "ut.tbl.gz");
+    UT_Report(__FILE__, __LINE__,
+              RtnCode == CFE_FS_GZIP_CRC_ERROR,
+              "CFE_TBL_LoadFromFile",
+              "Compressed file decompression error");
+
     /* Test CFE_TBL_ReadHeaders response to a failure reading the standard cFE
      * file header
      */
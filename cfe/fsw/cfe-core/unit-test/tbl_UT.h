@@ -69,6 +69,9 @@ typedef struct
     UT_Table1_t        TblData;
 } UT_TempFile_t;
 
+/* Size of the headers in front of the data of a table file */
+#define UT_GZ_IMAGE_HDR_SIZE (sizeof(CFE_FS_Header_t) + sizeof(CFE_TBL_File_Hdr_t))
+
 
 /* TBL unit test functions */
 
@@ -111,6 +114,26 @@ void UT_InitializeTableRegistryNames(void);
 ******************************************************************************/
 void UT_ResetTableRegistry(void);
 
+/*****************************************************************************/
+/**
+** \brief Set up the decompressed image of a gzip table file
+**
+** \par Description
+**        Builds the standard cFE header, table header and zeroed data of a
+**        table file in file byte order, makes the CFE_FS_IsGzFile stub report
+**        a compressed file and passes the first \c ImageSize bytes of the
+**        image to the CFE_FS_DecompressToSink stub.
+**
+** \par Assumptions, External Events, and Notes:
+**        -# \c ImageSize is at most #UT_GZ_IMAGE_HDR_SIZE plus 16 bytes.
+**
+** \returns
+**        This function does not return a value.
+**
+******************************************************************************/
+void UT_SetGzTableImage(const char *TableName, uint32 Offset,
+                        uint32 NumBytes, uint32 ImageSize);
+
 /*****************************************************************************/
 /**
 ** \brief Tests to cover table task initialization functions
@@ -811,6 +834,27 @@ void Test_CFE_TBL_TblMod(void);
 ******************************************************************************/
 void Test_CFE_TBL_Internal(void);
 
+/*****************************************************************************/
+/**
+** \brief Test function that reads tables with epoch based access
+**
+** \par Description
+**        This function tests the functions that read a table without
+**        locking it and report quiescent points.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+**
+** \sa #UT_Text, #UT_InitData, #UT_SetAppID, #UT_ResetTableRegistry,
+** \sa #CFE_TBL_Register, #CFE_TBL_Load, #CFE_TBL_GetReadAddress,
+** \sa #CFE_TBL_ReleaseReadAddress, #CFE_TBL_Manage, #UT_Report
+**
+******************************************************************************/
+void Test_CFE_TBL_ReadAddress(void);
+
 /*****************************************************************************/
 /**
 ** \brief Test function executed when the contents of a table need to be
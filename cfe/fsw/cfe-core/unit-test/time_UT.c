@@ -220,6 +220,7 @@ void OS_Application_Startup(void)
     UT_ADD_TEST(Test_State);
     UT_ADD_TEST(Test_GetReference);
     UT_ADD_TEST(Test_Tone);
+    UT_ADD_TEST(Test_ClockDiscipline);
     UT_ADD_TEST(Test_1Hz);
     UT_ADD_TEST(Test_UnregisterSynchCallback);
     UT_ADD_TEST(Test_CleanUpApp);
@@ -1030,6 +1031,8 @@ void Test_ConvertTime(void)
     char timeBuf[sizeof("yyyy-ddd-hh:mm:ss.xxxxx_")];
     CFE_TIME_SysTime_t METTime;
     volatile CFE_TIME_ReferenceState_t *RefState;
+    uint32 MicroSecs;
+    uint32 ExpSubSecs;
 
 #if (CFE_MISSION_TIME_CFG_DEFAULT_TAI == true)
     /* TAI time derived = MET + STCF */
@@ -1136,6 +1139,29 @@ void Test_ConvertTime(void)
               "CFE_TIME_Micro2SubSecs",
               "Microseconds equals maximum value (subsecond adjustment)");
 
+    /* Test microseconds to subseconds conversion; the fixed-point
+     * conversion matches the divide based formula for every input
+     */
+    UT_InitData();
+    result = true;
+
+    for (MicroSecs = 0; MicroSecs <= 999999 && result; MicroSecs++)
+    {
+        ExpSubSecs = ((((MicroSecs << 11) / 5) << 3) / 3125) << 12;
+
+        if (ExpSubSecs > 0x80001000)
+        {
+            ExpSubSecs += 0x1000;
+        }
+
+        result = (CFE_TIME_Micro2SubSecs(MicroSecs) == ExpSubSecs);
+    }
+
+    UT_Report(__FILE__, __LINE__,
+              result,
+              "CFE_TIME_Micro2SubSecs",
+              "Fixed-point conversion matches divide based conversion");
+
     /* Test microseconds to subseconds conversion; microseconds exceeds
      * maximum limit
      */
@@ -3045,6 +3071,236 @@ void Test_Tone(void)
 #endif
 }
 
+/*
+** Simulated tone source for the clock discipline tests.  The local clock
+** runs DriftPPM fast of true time and each tone is latched up to
+** JitterUsecs early or late.
+*/
+typedef struct
+{
+    int32  DriftPPM;
+    uint32 JitterUsecs;
+    uint32 Seed;
+    uint32 Tone;          /* True MET seconds of the next tone */
+    uint32 Offset;        /* Seconds the time source adds to the tone MET */
+    bool   Monotonic;     /* Every sample was later than the one before */
+    uint32 MaxErrorUsecs; /* Largest MET error once settled */
+    CFE_TIME_SysTime_t LastMET;
+} UT_TIME_ToneSource_t;
+
+/*
+** Latch the simulated local clock at a true time (microseconds)
+*/
+static CFE_TIME_SysTime_t UT_TIME_SimLatch(const UT_TIME_ToneSource_t *Sim,
+                                           uint64 TrueUsecs, int32 JitterUsecs)
+{
+    CFE_TIME_SysTime_t Latch;
+    uint64 LocalUsecs;
+
+    LocalUsecs = 1000000000 + TrueUsecs +
+                 ((int64)TrueUsecs * Sim->DriftPPM) / 1000000 + JitterUsecs;
+
+    UT_SetBSP_Time(LocalUsecs / 1000000, LocalUsecs % 1000000);
+    Latch.Seconds = LocalUsecs / 1000000;
+    Latch.Subseconds = CFE_TIME_Micro2SubSecs(LocalUsecs % 1000000);
+
+    return Latch;
+}
+
+/*
+** Deliver the next tone and its time at the tone data
+*/
+static void UT_TIME_SimTone(UT_TIME_ToneSource_t *Sim)
+{
+    int32 Jitter = 0;
+
+    if (Sim->JitterUsecs != 0)
+    {
+        Sim->Seed = (Sim->Seed * 1103515245) + 12345;
+        Jitter = (int32)((Sim->Seed >> 8) % (2 * Sim->JitterUsecs + 1)) -
+                 (int32)Sim->JitterUsecs;
+    }
+
+    CFE_TIME_TaskData.ToneSignalLatch =
+            UT_TIME_SimLatch(Sim, (uint64)Sim->Tone * 1000000, Jitter);
+    CFE_TIME_TaskData.VirtualMET = Sim->Tone + Sim->Offset;
+    CFE_TIME_TaskData.PendingMET.Seconds = Sim->Tone + Sim->Offset;
+    CFE_TIME_TaskData.PendingMET.Subseconds = 0;
+    CFE_TIME_ToneUpdate();
+    Sim->Tone++;
+}
+
+/*
+** Run the tone source, reading MET three times between tones and
+** checking it against true time once Settle tones have passed
+*/
+static void UT_TIME_SimRun(UT_TIME_ToneSource_t *Sim, uint32 Count, uint32 Settle)
+{
+    CFE_TIME_Reference_t Reference;
+    uint64 TrueUsecs;
+    int64  Error;
+    uint32 i;
+    uint32 j;
+
+    for (i = 0; i < Count; i++)
+    {
+        UT_TIME_SimTone(Sim);
+
+        for (j = 1; j <= 3; j++)
+        {
+            TrueUsecs = ((uint64)(Sim->Tone - 1) * 1000000) + (j * 250000);
+            UT_TIME_SimLatch(Sim, TrueUsecs, 0);
+            CFE_TIME_GetReference(&Reference);
+
+            if (CFE_TIME_Compare(Reference.CurrentMET, Sim->LastMET) != CFE_TIME_A_GT_B)
+            {
+                Sim->Monotonic = false;
+            }
+
+            Sim->LastMET = Reference.CurrentMET;
+
+            Error = (int64)((((uint64)Reference.CurrentMET.Seconds << 32) |
+                             Reference.CurrentMET.Subseconds) -
+                            (((uint64)(TrueUsecs / 1000000) << 32) |
+                             CFE_TIME_Micro2SubSecs(TrueUsecs % 1000000)));
+            Error = (Error * 1000000) / 0x100000000LL;
+
+            if (Error < 0)
+            {
+                Error = -Error;
+            }
+
+            if (i >= Settle && Error > Sim->MaxErrorUsecs)
+            {
+                Sim->MaxErrorUsecs = (uint32)Error;
+            }
+        }
+    }
+}
+
+/*
+** Start the tone source with a clean time reference
+*/
+static void UT_TIME_SimStart(UT_TIME_ToneSource_t *Sim, int32 DriftPPM, uint32 JitterUsecs)
+{
+    volatile CFE_TIME_ReferenceState_t *RefState;
+
+    memset(Sim, 0, sizeof(*Sim));
+    Sim->DriftPPM = DriftPPM;
+    Sim->JitterUsecs = JitterUsecs;
+    Sim->Seed = 1;
+    Sim->Tone = 100;
+    Sim->Monotonic = true;
+
+    UT_InitData();
+    CFE_TIME_TaskData.ClockSource = CFE_TIME_SourceSelect_INTERNAL;
+    CFE_TIME_TaskData.MaxLocalClock.Seconds = CFE_PLATFORM_TIME_MAX_LOCAL_SECS;
+    CFE_TIME_TaskData.MaxLocalClock.Subseconds = CFE_PLATFORM_TIME_MAX_LOCAL_SUBS;
+    CFE_TIME_TaskData.DisciplineStepLimit = CFE_TIME_Micro2SubSecs(CFE_PLATFORM_TIME_CFG_STEP_LIMIT);
+    CFE_TIME_TaskData.DisciplineFreq = 0;
+    CFE_TIME_TaskData.DisciplineStepCounter = 0;
+    CFE_TIME_TaskData.DisciplineSamples = 0;
+    CFE_TIME_TaskData.DisciplineValid = false;
+
+    RefState = CFE_TIME_StartReferenceUpdate();
+    RefState->ClockFlyState = CFE_TIME_FlywheelState_NO_FLY;
+    RefState->AtToneRate = 0;
+    RefState->AtToneDelay.Seconds = 0;
+    RefState->AtToneDelay.Subseconds = 0;
+    CFE_TIME_FinishReferenceUpdate(RefState);
+}
+
+/*
+** Test the clock discipline loop against a simulated tone source
+*/
+void Test_ClockDiscipline(void)
+{
+    UT_TIME_ToneSource_t Sim;
+    CFE_TIME_Reference_t Reference;
+    int32 ExpRate;
+    char  testDesc[UT_MAX_MESSAGE_LENGTH];
+
+#ifdef UT_VERBOSE
+    UT_Text("Begin Test Clock Discipline\n");
+#endif
+
+    /* Test a drifting local clock with an ideal tone */
+    UT_TIME_SimStart(&Sim, 100, 0);
+    UT_TIME_SimRun(&Sim, 100, 60);
+    ExpRate = -(int32)((100ULL << 32) / 1000000);
+    snprintf(testDesc, UT_MAX_MESSAGE_LENGTH,
+             "Drift 100 ppm, no jitter: rate %ld (exp %ld), max error %lu us",
+             (long)CFE_TIME_TaskData.DisciplineFreq, (long)ExpRate,
+             (unsigned long)Sim.MaxErrorUsecs);
+    UT_Report(__FILE__, __LINE__,
+              CFE_TIME_TaskData.DisciplineFreq > ExpRate - 4295 &&
+              CFE_TIME_TaskData.DisciplineFreq < ExpRate + 4295 &&
+              Sim.MaxErrorUsecs <= 5 &&
+              Sim.Monotonic &&
+              CFE_TIME_TaskData.DisciplineStepCounter == 1,
+              "CFE_TIME_DisciplineClock",
+              testDesc);
+
+    /* Test a drifting local clock with a jittery tone */
+    UT_TIME_SimStart(&Sim, -250, 200);
+    UT_TIME_SimRun(&Sim, 300, 150);
+    ExpRate = (int32)((250ULL << 32) / 1000000);
+    snprintf(testDesc, UT_MAX_MESSAGE_LENGTH,
+             "Drift -250 ppm, jitter 200 us: rate %ld (exp %ld), max error %lu us",
+             (long)CFE_TIME_TaskData.DisciplineFreq, (long)ExpRate,
+             (unsigned long)Sim.MaxErrorUsecs);
+    UT_Report(__FILE__, __LINE__,
+              CFE_TIME_TaskData.DisciplineFreq > ExpRate - (40 * 4295) &&
+              CFE_TIME_TaskData.DisciplineFreq < ExpRate + (40 * 4295) &&
+              Sim.MaxErrorUsecs <= 200 &&
+              Sim.Monotonic &&
+              CFE_TIME_TaskData.DisciplineStepCounter == 1,
+              "CFE_TIME_DisciplineClock",
+              testDesc);
+
+    /* Test a tone far from the disciplined time, which steps the MET */
+    Sim.Offset = 5;
+    UT_TIME_SimTone(&Sim);
+    CFE_TIME_GetReference(&Reference);
+    UT_Report(__FILE__, __LINE__,
+              CFE_TIME_TaskData.DisciplineStepCounter == 2 &&
+              CFE_TIME_TaskData.DisciplinePhase == 0x7FFFFFFF &&
+              Reference.AtToneMET.Seconds == Sim.Tone - 1 + Sim.Offset &&
+              Reference.AtToneMET.Subseconds == 0,
+              "CFE_TIME_DisciplineClock",
+              "Phase error over the step limit");
+
+    /* Test with the discipline loop turned off */
+    UT_TIME_SimStart(&Sim, 100, 0);
+    CFE_TIME_TaskData.DisciplineStepLimit = 0;
+    UT_TIME_SimRun(&Sim, 5, 5);
+    CFE_TIME_GetReference(&Reference);
+    UT_Report(__FILE__, __LINE__,
+              CFE_TIME_TaskData.DisciplineStepCounter == 5 &&
+              Reference.AtToneRate == 0 &&
+              Reference.AtToneMET.Seconds == Sim.Tone - 1 &&
+              Reference.AtToneMET.Subseconds == 0,
+              "CFE_TIME_DisciplineClock",
+              "Step limit of zero steps at every tone");
+
+    /* Test that the loop state is reported in the diagnostic packet */
+    UT_TIME_SimStart(&Sim, 50, 0);
+    UT_TIME_SimRun(&Sim, 10, 10);
+    CFE_TIME_GetDiagData();
+    UT_Report(__FILE__, __LINE__,
+              CFE_TIME_TaskData.DiagPacket.Payload.RateError ==
+                  CFE_TIME_TaskData.DisciplineFreq &&
+              CFE_TIME_TaskData.DiagPacket.Payload.PhaseError ==
+                  CFE_TIME_TaskData.DisciplinePhase &&
+              CFE_TIME_TaskData.DiagPacket.Payload.SlewRate != 0 &&
+              CFE_TIME_TaskData.DiagPacket.Payload.StepCounter == 1,
+              "CFE_TIME_GetDiagData",
+              "Clock discipline state");
+
+    /* Leave the reference running at the local clock rate */
+    UT_TIME_SimStart(&Sim, 0, 0);
+}
+
 /*
 ** Test the 1Hz STCF adjustment, local interrupt service request and task
 ** (non-tone), and tone task functions
@@ -389,6 +389,28 @@ void Test_GetReference(void);
 ******************************************************************************/
 void Test_Tone(void);
 
+/*****************************************************************************/
+/**
+** \brief Test the clock discipline loop
+**
+** \par Description
+**        This function drives the tone update from a simulated tone source
+**        with configurable drift and jitter, and checks the frequency
+**        estimate, MET error and monotonicity, stepping on large phase
+**        errors and the diagnostic telemetry.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+**
+** \sa #UT_InitData, #UT_SetBSP_Time, #CFE_TIME_ToneUpdate,
+** \sa #CFE_TIME_GetReference, #CFE_TIME_GetDiagData, #UT_Report
+**
+******************************************************************************/
+void Test_ClockDiscipline(void);
+
 /*****************************************************************************/
 /**
 ** \brief Test the 1Hz STCF adjustment, local interrupt service request and
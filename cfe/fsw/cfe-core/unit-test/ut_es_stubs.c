@@ -659,6 +659,43 @@ int32 CFE_ES_GetTaskInfo(CFE_ES_TaskInfo_t *TaskInfo, uint32 TaskId)
     return status;
 }
 
+/*****************************************************************************/
+/**
+** \brief CFE_ES_GetTaskFullName stub function
+**
+** \par Description
+**        This function is used to mimic the response of the cFE ES function
+**        CFE_ES_GetTaskFullName.  The user can force an error return with
+**        UT_SetDeferredRetcode, and can supply the name with
+**        UT_SetDataBuffer; otherwise the name "UT" is returned, which is
+**        the name the CFE_ES_GetTaskInfo stub reports for both the
+**        application and the task.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        Returns either a user-defined status flag or CFE_SUCCESS.
+**
+******************************************************************************/
+int32 CFE_ES_GetTaskFullName(uint32 OSTaskId, char *FullName)
+{
+    int32   status = CFE_SUCCESS;
+
+    status = UT_DEFAULT_IMPL(CFE_ES_GetTaskFullName);
+
+    if (status >= 0)
+    {
+        if (UT_Stub_CopyToLocal(UT_KEY(CFE_ES_GetTaskFullName), (uint8*)FullName, OS_MAX_API_NAME) < OS_MAX_API_NAME)
+        {
+            strncpy(FullName, "UT", OS_MAX_API_NAME);
+        }
+        FullName[OS_MAX_API_NAME - 1] = '\0';
+    }
+
+    return status;
+}
+
 /*****************************************************************************/
 /**
 ** \brief CFE_ES_ExitApp stub function
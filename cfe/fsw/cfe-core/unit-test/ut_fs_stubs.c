@@ -322,6 +322,380 @@ int32 CFE_FS_Decompress(const char * SourceFile, const char * DestinationFile)
     return status;
 }
 
+/*****************************************************************************/
+/**
+** \brief CFE_FS_DecompressToSink stub function
+**
+** \par Description
+**        This function is used to mimic the response of the cFE FS function
+**        CFE_FS_DecompressToSink.  The user can adjust the response by
+**        setting a return code for this stub.  If a data buffer has been
+**        set for this stub and the return code is CFE_SUCCESS then the
+**        buffer contents are passed to the sink, and the sink's status is
+**        returned.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        Returns either a user-defined status flag, the sink status or
+**        CFE_SUCCESS.
+**
+******************************************************************************/
+int32 CFE_FS_DecompressToSink(const char * SourceFile, CFE_FS_DecompressSink_t SinkFunc, void *SinkArg)
+{
+    int32 status;
+    void *DataPtr;
+    uint32 DataSize;
+    uint32 Position;
+
+    UT_Stub_RegisterContext(UT_KEY(CFE_FS_DecompressToSink), SourceFile);
+    status = UT_DEFAULT_IMPL(CFE_FS_DecompressToSink);
+
+    if (status == CFE_SUCCESS)
+    {
+        UT_GetDataBuffer(UT_KEY(CFE_FS_DecompressToSink), &DataPtr, &DataSize, &Position);
+        if (DataPtr != NULL && DataSize > 0)
+        {
+            status = SinkFunc(SinkArg, DataPtr, DataSize);
+        }
+    }
+
+    return status;
+}
+
+/*****************************************************************************/
+/**
+** \brief CFE_FS_InflateInit stub function
+**
+** \par Description
+**        This function is used to mimic the response of the cFE FS function
+**        CFE_FS_InflateInit.  The user can adjust the response by setting
+**        a return code for this stub.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        Returns either a user-defined status flag or CFE_SUCCESS.
+**
+******************************************************************************/
+int32 CFE_FS_InflateInit(CFE_FS_InflateState_t *State)
+{
+    int32 status;
+
+    UT_Stub_RegisterContext(UT_KEY(CFE_FS_InflateInit), State);
+    status = UT_DEFAULT_IMPL(CFE_FS_InflateInit);
+
+    return status;
+}
+
+/*****************************************************************************/
+/**
+** \brief CFE_FS_InflateFeed stub function
+**
+** \par Description
+**        This function is used to mimic the response of the cFE FS function
+**        CFE_FS_InflateFeed.  The user can adjust the response by setting
+**        a return code for this stub.  All of the data is accepted
+**        otherwise.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        Returns either a user-defined status flag or Size.
+**
+******************************************************************************/
+int32 CFE_FS_InflateFeed(CFE_FS_InflateState_t *State, const void *Data, uint32 Size)
+{
+    int32 status;
+
+    UT_Stub_RegisterContext(UT_KEY(CFE_FS_InflateFeed), Data);
+    status = UT_DEFAULT_IMPL_RC(CFE_FS_InflateFeed, Size);
+
+    return status;
+}
+
+/*****************************************************************************/
+/**
+** \brief CFE_FS_InflateDrain stub function
+**
+** \par Description
+**        This function is used to mimic the response of the cFE FS function
+**        CFE_FS_InflateDrain.  The user can adjust the response by setting
+**        a return code for this stub.  If a data buffer has been set for
+**        this stub then its contents are copied out and the number of
+**        bytes copied is returned.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        Returns either a user-defined status flag, the number of bytes
+**        copied or zero.
+**
+******************************************************************************/
+int32 CFE_FS_InflateDrain(CFE_FS_InflateState_t *State, void *Buffer, uint32 Size)
+{
+    int32 status;
+
+    UT_Stub_RegisterContext(UT_KEY(CFE_FS_InflateDrain), Buffer);
+    status = UT_DEFAULT_IMPL(CFE_FS_InflateDrain);
+
+    if (status == 0)
+    {
+        status = UT_Stub_CopyToLocal(UT_KEY(CFE_FS_InflateDrain), Buffer, Size);
+    }
+
+    return status;
+}
+
+/*****************************************************************************/
+/**
+** \brief CFE_FS_InflateFinished stub function
+**
+** \par Description
+**        This function is used to mimic the response of the cFE FS function
+**        CFE_FS_InflateFinished.  The user can adjust the response by
+**        setting a return code for this stub.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        Returns false if a user-defined status of zero was set, true
+**        otherwise, so that callers waiting for the end of the stream stop.
+**
+******************************************************************************/
+bool CFE_FS_InflateFinished(const CFE_FS_InflateState_t *State)
+{
+    int32 status;
+
+    UT_Stub_RegisterContext(UT_KEY(CFE_FS_InflateFinished), State);
+    status = UT_DEFAULT_IMPL_RC(CFE_FS_InflateFinished, 1);
+
+    return (status != 0);
+}
+
+/*****************************************************************************/
+/**
+** \brief CFE_FS_DeflateInit stub function
+**
+** \par Description
+**        This function is used to mimic the response of the cFE FS function
+**        CFE_FS_DeflateInit.  The user can adjust the response by setting
+**        a return code for this stub.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        Returns either a user-defined status flag or CFE_SUCCESS.
+**
+******************************************************************************/
+int32 CFE_FS_DeflateInit(CFE_FS_DeflateState_t *State)
+{
+    int32 status;
+
+    UT_Stub_RegisterContext(UT_KEY(CFE_FS_DeflateInit), State);
+    status = UT_DEFAULT_IMPL(CFE_FS_DeflateInit);
+
+    return status;
+}
+
+/*****************************************************************************/
+/**
+** \brief CFE_FS_DeflateFeed stub function
+**
+** \par Description
+**        This function is used to mimic the response of the cFE FS function
+**        CFE_FS_DeflateFeed.  The user can adjust the response by setting
+**        a return code for this stub.  All of the data is accepted
+**        otherwise.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        Returns either a user-defined status flag or Size.
+**
+******************************************************************************/
+int32 CFE_FS_DeflateFeed(CFE_FS_DeflateState_t *State, const void *Data, uint32 Size)
+{
+    int32 status;
+
+    UT_Stub_RegisterContext(UT_KEY(CFE_FS_DeflateFeed), Data);
+    status = UT_DEFAULT_IMPL_RC(CFE_FS_DeflateFeed, Size);
+
+    return status;
+}
+
+/*****************************************************************************/
+/**
+** \brief CFE_FS_DeflateFinish stub function
+**
+** \par Description
+**        This function is used to mimic the response of the cFE FS function
+**        CFE_FS_DeflateFinish.  The user can adjust the response by setting
+**        a return code for this stub.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        Returns either a user-defined status flag or CFE_SUCCESS.
+**
+******************************************************************************/
+int32 CFE_FS_DeflateFinish(CFE_FS_DeflateState_t *State)
+{
+    int32 status;
+
+    UT_Stub_RegisterContext(UT_KEY(CFE_FS_DeflateFinish), State);
+    status = UT_DEFAULT_IMPL(CFE_FS_DeflateFinish);
+
+    return status;
+}
+
+/*****************************************************************************/
+/**
+** \brief CFE_FS_DeflateFlush stub function
+**
+** \par Description
+**        This function is used to mimic the response of the cFE FS function
+**        CFE_FS_DeflateFlush.  The user can adjust the response by setting
+**        a return code for this stub.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        Returns either a user-defined status flag or CFE_SUCCESS.
+**
+******************************************************************************/
+int32 CFE_FS_DeflateFlush(CFE_FS_DeflateState_t *State)
+{
+    int32 status;
+
+    UT_Stub_RegisterContext(UT_KEY(CFE_FS_DeflateFlush), State);
+    status = UT_DEFAULT_IMPL(CFE_FS_DeflateFlush);
+
+    return status;
+}
+
+/*****************************************************************************/
+/**
+** \brief CFE_FS_DeflateDrain stub function
+**
+** \par Description
+**        This function is used to mimic the response of the cFE FS function
+**        CFE_FS_DeflateDrain.  The user can adjust the response by setting
+**        a return code for this stub.  If a data buffer has been set for
+**        this stub then its contents are copied out and the number of
+**        bytes copied is returned.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        Returns either a user-defined status flag, the number of bytes
+**        copied or zero.
+**
+******************************************************************************/
+int32 CFE_FS_DeflateDrain(CFE_FS_DeflateState_t *State, void *Buffer, uint32 Size)
+{
+    int32 status;
+
+    UT_Stub_RegisterContext(UT_KEY(CFE_FS_DeflateDrain), Buffer);
+    status = UT_DEFAULT_IMPL(CFE_FS_DeflateDrain);
+
+    if (status == 0)
+    {
+        status = UT_Stub_CopyToLocal(UT_KEY(CFE_FS_DeflateDrain), Buffer, Size);
+    }
+
+    return status;
+}
+
+/*****************************************************************************/
+/**
+** \brief CFE_FS_DeflateFinished stub function
+**
+** \par Description
+**        This function is used to mimic the response of the cFE FS function
+**        CFE_FS_DeflateFinished.  The user can adjust the response by
+**        setting a return code for this stub.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        Returns false if a user-defined status of zero was set, true
+**        otherwise, so that callers waiting for the end of the stream stop.
+**
+******************************************************************************/
+bool CFE_FS_DeflateFinished(const CFE_FS_DeflateState_t *State)
+{
+    int32 status;
+
+    UT_Stub_RegisterContext(UT_KEY(CFE_FS_DeflateFinished), State);
+    status = UT_DEFAULT_IMPL_RC(CFE_FS_DeflateFinished, 1);
+
+    return (status != 0);
+}
+
+/*****************************************************************************/
+/**
+** \brief CFE_FS_DeflateBound stub function
+**
+** \par Description
+**        This function is used to mimic the response of the cFE FS function
+**        CFE_FS_DeflateBound.  The user can adjust the response by setting
+**        a return code for this stub.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        Returns either a user-defined value or Size.
+**
+******************************************************************************/
+uint32 CFE_FS_DeflateBound(const CFE_FS_DeflateState_t *State, uint32 Size)
+{
+    int32 status;
+
+    UT_Stub_RegisterContext(UT_KEY(CFE_FS_DeflateBound), State);
+    status = UT_DEFAULT_IMPL_RC(CFE_FS_DeflateBound, Size);
+
+    return (uint32)status;
+}
+
+/*****************************************************************************/
+/**
+** \brief CFE_FS_DeflateStored stub function
+**
+** \par Description
+**        This function is used to mimic the response of the cFE FS function
+**        CFE_FS_DeflateStored.  The user can adjust the response by setting
+**        a return code for this stub.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        Returns either a user-defined status flag or the member size.
+**
+******************************************************************************/
+int32 CFE_FS_DeflateStored(void *Buffer, uint32 Size, const void *Data, uint32 Length)
+{
+    int32 status;
+
+    UT_Stub_RegisterContext(UT_KEY(CFE_FS_DeflateStored), Buffer);
+    status = UT_DEFAULT_IMPL_RC(CFE_FS_DeflateStored, CFE_FS_DEFLATE_STORED_SIZE(Length));
+
+    return status;
+}
+
 /*****************************************************************************/
 /**
 ** \brief CFE_FS_IsGzFile stub function
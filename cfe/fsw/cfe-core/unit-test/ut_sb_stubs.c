@@ -563,6 +563,26 @@ void CFE_SB_TimeStampMsg(CFE_SB_MsgPtr_t MsgPtr)
     UT_DEFAULT_IMPL(CFE_SB_TimeStampMsg);
 }
 
+/*****************************************************************************/
+/**
+** \brief CFE_SB_TimeStampMsgs stub function
+**
+** \par Description
+**        This function is used as a placeholder for the cFE SB function
+**        CFE_SB_TimeStampMsgs.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+**
+******************************************************************************/
+void CFE_SB_TimeStampMsgs(CFE_SB_MsgPtr_t *MsgPtrs, uint32 MsgCount)
+{
+    UT_DEFAULT_IMPL(CFE_SB_TimeStampMsgs);
+}
+
 /*****************************************************************************/
 /**
 ** \brief CFE_SB_GetTotalMsgLength stub function
@@ -139,6 +139,22 @@ UT_DEFAULT_STUB(CFE_TBL_Manage, (CFE_TBL_Handle_t TblHandle))
 
 UT_DEFAULT_STUB(CFE_TBL_ReleaseAddress, (CFE_TBL_Handle_t TblHandle))
 
+int32 CFE_TBL_GetReadAddress (void **TblPtr, CFE_TBL_Handle_t TblHandle)
+{
+    int32 status;
+    int32 ForceValue;
+
+    status = UT_DEFAULT_IMPL(CFE_TBL_GetReadAddress);
+    if (status >= 0 && !UT_Stub_CheckForceFail(UT_KEY(CFE_TBL_GetReadAddress), &ForceValue))
+    {
+        UT_Stub_CopyToLocal(UT_KEY(CFE_TBL_GetReadAddress), (uint8 *)TblPtr, sizeof(void*));
+    }
+
+    return status;
+}
+
+UT_DEFAULT_STUB(CFE_TBL_ReleaseReadAddress, (CFE_TBL_Handle_t TblHandle))
+
 UT_DEFAULT_STUB(CFE_TBL_NotifyByMessage, (CFE_TBL_Handle_t TblHandle, CFE_SB_MsgId_t MsgId, uint16 CommandCode, uint32 Parameter))
 
 UT_DEFAULT_STUB(CFE_TBL_Modified, (CFE_TBL_Handle_t TblHandle ))
@@ -402,6 +402,25 @@ int32 OS_TaskGetIdByName       (uint32 *task_id, const char *task_name);
  */
 int32 OS_TaskGetInfo           (uint32 task_id, OS_task_prop_t *task_prop);          
 
+/*-------------------------------------------------------------------------------------*/
+/**
+ * @brief Obtain the processor time consumed by a task
+ *
+ * This function passes back the total processor time that the specified
+ * task has spent running since it was created.  Sampling it periodically
+ * gives the share of the processor used by each task without needing a
+ * spinning idle task to infer it.
+ *
+ * @param[in]   task_id The object ID to operate on
+ * @param[out]  cpu_time The processor time used by the task
+ *
+ * @returns OS_SUCCESS on success, or appropriate error code
+ * OS_ERR_INVALID_ID if the ID passed to it is invalid
+ * OS_INVALID_POINTER if the cpu_time pointer is NULL
+ * OS_ERR_NOT_IMPLEMENTED if the OS does not account time per task
+ */
+int32 OS_TaskGetCpuTime        (uint32 task_id, OS_time_t *cpu_time);
+
 /*
 ** Message Queue API
 */
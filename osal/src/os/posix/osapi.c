@@ -1094,6 +1094,35 @@ int32 OS_TaskGetInfo_Impl (uint32 task_id, OS_task_prop_t *task_prop)
    return OS_SUCCESS;
 } /* end OS_TaskGetInfo_Impl */
 
+/*----------------------------------------------------------------
+ *
+ * Function: OS_TaskGetCpuTime_Impl
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype in os-impl.h for argument/return detail
+ *
+ *           Reads the per thread CPU clock of the task, which is the
+ *           same figure the kernel reports in /proc/self/task/<tid>/stat
+ *           but without opening and parsing a file per task.
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_TaskGetCpuTime_Impl (uint32 task_id, OS_time_t *cpu_time)
+{
+   clockid_t       clock_id;
+   struct timespec ts;
+
+   if (pthread_getcpuclockid(OS_impl_task_table[task_id].id, &clock_id) != 0 ||
+       clock_gettime(clock_id, &ts) != 0)
+   {
+      return OS_ERROR;
+   }
+
+   cpu_time->seconds   = ts.tv_sec;
+   cpu_time->microsecs = ts.tv_nsec / 1000;
+
+   return OS_SUCCESS;
+} /* end OS_TaskGetCpuTime_Impl */
+
 /****************************************************************************************
                                 MESSAGE QUEUE API
  ***************************************************************************************/
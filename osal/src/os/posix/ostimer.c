@@ -14,9 +14,10 @@
  *
  * Purpose: This file contains the OSAL Timer API for POSIX systems.
  *
- *          This implementation depends on the POSIX Timer API which may not be available
- *          in older versions of the Linux kernel. It was developed and tested on
- *          RHEL 5 ./ CentOS 5 with Linux kernel 2.6.18
+ *          The time base handler threads wait for absolute times of the
+ *          preferred (monotonic) clock on a condition variable.  A time base
+ *          only wakes up when one of its callbacks is due, and is woken early
+ *          when it is changed under the time base lock.
  */
 
 /****************************************************************************************
@@ -33,7 +34,7 @@
                                 INTERNAL FUNCTION PROTOTYPES
  ***************************************************************************************/
 
-static void  OS_UsecToTimespec(uint32 usecs, struct timespec *time_spec);
+static void  OS_TimeBase_SoftWaitCleanup(void *arg);
 
 /****************************************************************************************
                                      DEFINES
@@ -59,9 +60,7 @@ typedef struct
 {
     pthread_t           handler_thread;
     pthread_mutex_t     handler_mutex;
-    timer_t             host_timerid;
-    int                 assigned_signal;
-    sigset_t            sigset;
+    pthread_cond_t      handler_cond;
     uint32              reset_flag;
     struct timespec     softsleep;
 
@@ -78,29 +77,6 @@ OS_impl_timebase_internal_record_t OS_impl_timebase_table[OS_MAX_TIMEBASES];
  ***************************************************************************************/
 
 
-/*----------------------------------------------------------------
- *
- * Function: OS_UsecToTimespec
- *
- *  Purpose: Local helper routine, not part of OSAL API.
- *           Convert Microseconds to a POSIX timespec structure.
- *
- *-----------------------------------------------------------------*/
-static void OS_UsecToTimespec(uint32 usecs, struct timespec *time_spec)
-{
-
-   if ( usecs < 1000000 )
-   {
-      time_spec->tv_nsec = (usecs * 1000);
-      time_spec->tv_sec = 0;
-   }
-   else
-   {
-      time_spec->tv_sec = usecs / 1000000;
-      time_spec->tv_nsec = (usecs % 1000000) * 1000;
-   }
-} /* end OS_UsecToTimespec */
-                        
 /*----------------------------------------------------------------
  *
  * Function: OS_TimeBaseLock_Impl
@@ -124,79 +100,173 @@ void OS_TimeBaseLock_Impl(uint32 local_id)
  *-----------------------------------------------------------------*/
 void OS_TimeBaseUnlock_Impl(uint32 local_id)
 {
+    /*
+     * A timer or the time base itself was changed under the lock, which
+     * may move the next tick earlier, so have the handler thread work out
+     * its wait again.  The handler thread's own unlocks never set this.
+     */
+    if (OS_timebase_table[local_id].schedule_changed)
+    {
+        OS_timebase_table[local_id].schedule_changed = false;
+        pthread_cond_broadcast(&OS_impl_timebase_table[local_id].handler_cond);
+    }
     pthread_mutex_unlock(&OS_impl_timebase_table[local_id].handler_mutex);
 } /* end OS_TimeBaseUnlock_Impl */
 
                         
+/*----------------------------------------------------------------
+ *
+ * Function: OS_TimeBase_SoftWaitCleanup
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Releases the time base lock if the handler thread is cancelled
+ *           while waiting.
+ *
+ *-----------------------------------------------------------------*/
+static void OS_TimeBase_SoftWaitCleanup(void *arg)
+{
+    OS_impl_timebase_internal_record_t *local = arg;
+
+    pthread_mutex_unlock(&local->handler_mutex);
+} /* end OS_TimeBase_SoftWaitCleanup */
+
+                        
+/*----------------------------------------------------------------
+ *
+ * Function: OS_TimeBase_TimespecAdd
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Adds a number of microseconds to a timespec.
+ *
+ *-----------------------------------------------------------------*/
+static void OS_TimeBase_TimespecAdd(struct timespec *ts, int64 usec)
+{
+    ts->tv_sec += (time_t)(usec / 1000000);
+    ts->tv_nsec += (long)(1000 * (usec % 1000000));
+    if (ts->tv_nsec >= 1000000000)
+    {
+        ts->tv_nsec -= 1000000000;
+        ++ts->tv_sec;
+    }
+} /* end OS_TimeBase_TimespecAdd */
+
+                        
 /*----------------------------------------------------------------
  *
  * Function: OS_TimeBase_SoftWaitImpl
  *
  *  Purpose: Local helper routine, not part of OSAL API.
+ *           Waits for the next tick of the time base that has a callback
+ *           due, and returns the time elapsed since the previous one.
+ *
+ *           Ticks stay on the grid set by OS_TimeBaseSet(), only the ones
+ *           with nothing to do are skipped.  The wait is worked out again
+ *           whenever the schedule is changed by another thread, e.g.
+ *           by OS_TimerSet().
+ *
+ *           If the thread falls behind (a stall or an overload), the grid
+ *           moves up to the last tick at or before now and the missed time
+ *           is returned with the next tick, so the overruns are merged into
+ *           one tick instead of being replayed.  The thread always waits
+ *           for a tick that is still ahead, as the signal based timer did.
  *
  *-----------------------------------------------------------------*/
 static uint32 OS_TimeBase_SoftWaitImpl(uint32 timer_id)
 {
-    int ret;
     OS_impl_timebase_internal_record_t *local;
+    OS_timebase_internal_record_t *timebase;
+    struct timespec now;
+    struct timespec wakeup;
     uint32 interval_time;
-    int sig;
+    uint32 wait_time;
+    uint32 elapsed_time;
+    uint32 merged_time;
+    int64 behind_usec;
+    int ret;
 
     local = &OS_impl_timebase_table[timer_id];
+    timebase = &OS_timebase_table[timer_id];
+    elapsed_time = 0;
+    merged_time = 0;
 
-    if (local->reset_flag == 0)
-    {
-        interval_time = OS_timebase_table[timer_id].nominal_interval_time;
-    }
-    else
-    {
-        interval_time = OS_timebase_table[timer_id].nominal_start_time;
-        local->reset_flag = 0;
-    }
+    pthread_mutex_lock(&local->handler_mutex);
+    pthread_cleanup_push(OS_TimeBase_SoftWaitCleanup, local);
 
-    if (local->assigned_signal == 0)
+    while (elapsed_time == 0)
     {
-        /*
-         * If no signal is in use and this function got called,
-         * just implement it using a software delay.  This is the
-         * least accurate option, but it always works.
-         */
-        if (interval_time == 0)
+        interval_time = timebase->nominal_interval_time;
+
+        if (local->reset_flag != 0 && timebase->nominal_start_time != 0)
+        {
+            /* first tick after OS_TimeBaseSet() */
+            wait_time = timebase->nominal_start_time;
+            merged_time = 0;
+        }
+        else if (interval_time == 0)
+        {
+            /* the time base is not running, wait for OS_TimeBaseSet() */
+            wait_time = 0;
+        }
+        else
         {
             /*
-             * Protect against a zero interval time causing a "spin loop"
-             * In this case sleep for 10ms.
+             * Move the grid up to the last tick at or before now.  These
+             * ticks are reported with the next one, so callbacks set
+             * meanwhile are counted from the right tick and overruns are
+             * merged rather than replayed.
              */
-            interval_time = 10000;
+            clock_gettime(OS_PREFERRED_CLOCK, &now);
+            behind_usec = ((int64)(now.tv_sec - local->softsleep.tv_sec) * 1000000) +
+                    ((now.tv_nsec - local->softsleep.tv_nsec) / 1000);
+            if (behind_usec >= interval_time)
+            {
+                behind_usec -= behind_usec % interval_time;
+                OS_TimeBase_TimespecAdd(&local->softsleep, behind_usec);
+                if (behind_usec > (OS_TIMEBASE_MAX_IDLE_TIME - merged_time))
+                {
+                    merged_time = OS_TIMEBASE_MAX_IDLE_TIME - (OS_TIMEBASE_MAX_IDLE_TIME % interval_time);
+                }
+                else
+                {
+                    merged_time += (uint32)behind_usec;
+                }
+            }
+
+            /* skip to the tick at which the next callback is due */
+            wait_time = OS_TimeBase_NextExpiry(timer_id, merged_time);
+            wait_time = (wait_time + interval_time - 1) / interval_time;
+            if (wait_time == 0)
+            {
+                wait_time = 1;
+            }
+            wait_time *= interval_time;
         }
-        local->softsleep.tv_nsec += 1000 * (interval_time % 1000000);
-        local->softsleep.tv_sec += interval_time / 1000000;
-        if (local->softsleep.tv_nsec > 1000000000)
+
+        if (wait_time == 0)
         {
-            local->softsleep.tv_nsec -= 1000000000;
-            ++local->softsleep.tv_sec;
+            pthread_cond_wait(&local->handler_cond, &local->handler_mutex);
+            continue;
         }
-    }
 
+        wakeup = local->softsleep;
+        OS_TimeBase_TimespecAdd(&wakeup, wait_time);
 
-    do
-    {
         /*
-         * Note that either of these calls can be interrupted by OTHER signals,
-         * so it needs to be repeated until it actually returns the proper code.
+         * Returning early means that the time base changed (or the wait
+         * was interrupted), in which case the wait is worked out again.
          */
-        if (local->assigned_signal == 0)
+        ret = pthread_cond_timedwait(&local->handler_cond, &local->handler_mutex, &wakeup);
+        if (ret == ETIMEDOUT)
         {
-            ret = clock_nanosleep(OS_PREFERRED_CLOCK, TIMER_ABSTIME, &local->softsleep, NULL);
-        }
-        else
-        {
-            ret = sigwait(&local->sigset, &sig);
+            local->softsleep = wakeup;
+            local->reset_flag = 0;
+            elapsed_time = merged_time + wait_time;
         }
     }
-    while (ret != 0);
 
-    return interval_time;
+    pthread_cleanup_pop(1);
+
+    return elapsed_time;
 } /* end OS_TimeBase_SoftWaitImpl */
 
 
@@ -218,6 +288,7 @@ int32 OS_Posix_TimeBaseAPI_Impl_Init(void)
    int    status;
    int    i;
    pthread_mutexattr_t mutex_attr;
+   pthread_condattr_t cond_attr;
    struct timespec clock_resolution;
    int32  return_code;
 
@@ -295,6 +366,37 @@ int32 OS_Posix_TimeBaseAPI_Impl_Init(void)
            }
        }
 
+       if (return_code != OS_SUCCESS)
+       {
+           break;
+       }
+
+       /*
+       ** The handler threads wait for absolute times of the preferred clock
+       */
+       status = pthread_condattr_init(&cond_attr);
+       if ( status == 0 )
+       {
+           status = pthread_condattr_setclock(&cond_attr, OS_PREFERRED_CLOCK);
+       }
+       if ( status != 0 )
+       {
+          OS_DEBUG("Error: pthread_condattr_setclock failed: %s\n",strerror(status));
+          return_code = OS_ERROR;
+          break;
+       }
+
+       for (i = 0; i < OS_MAX_TIMEBASES; ++i)
+       {
+           status = pthread_cond_init(&OS_impl_timebase_table[i].handler_cond, &cond_attr);
+           if ( status != 0 )
+           {
+              OS_DEBUG("Error: Condition could not be created: %s\n",strerror(status));
+              return_code = OS_ERROR;
+              break;
+           }
+       }
+
        /*
         * Pre-calculate the clock tick to microsecond conversion factor.
         * This is used by OS_Tick2Micros(), OS_Milli2Ticks(), etc.
@@ -345,9 +447,6 @@ static void *OS_TimeBasePthreadEntry(void *arg)
 int32 OS_TimeBaseCreate_Impl(uint32 timer_id)
 {
     int32  return_code;
-    int    status;
-    int    i;
-    struct sigevent   evp;
     OS_impl_timebase_internal_record_t *local;
     OS_common_record_t *global;
     OS_U32ValueWrapper_t arg;
@@ -374,101 +473,19 @@ int32 OS_TimeBaseCreate_Impl(uint32 timer_id)
         return return_code;
     }
 
-    local->assigned_signal = 0;
+    local->reset_flag = 0;
     clock_gettime(OS_PREFERRED_CLOCK, &local->softsleep);
 
     /*
-     * Set up the necessary OS constructs
-     *
      * If an external sync function is used then there is nothing to do here -
      * we simply call that function and it should synchronize to the time source.
      *
-     * If no external sync function is provided then this will set up a POSIX
-     * timer to locally simulate the timer tick using the CPU clock.
+     * If no external sync function is provided then the handler thread
+     * simulates the timer tick by waiting on the CPU clock.
      */
     if (OS_timebase_table[timer_id].external_sync == NULL)
     {
-        sigemptyset(&local->sigset);
-
-        /*
-         * find an RT signal that is not used by another time base object.
-         * This is all done while the global lock is held so no chance of the
-         * underlying tables changing
-         */
-        for(i = 0; i < OS_MAX_TIMEBASES; ++i)
-        {
-            if (i != timer_id &&
-                    OS_global_timebase_table[i].active_id != 0 &&
-                    OS_impl_timebase_table[i].assigned_signal != 0)
-            {
-                sigaddset(&local->sigset, OS_impl_timebase_table[i].assigned_signal);
-            }
-        }
-
-        for(i = SIGRTMIN; i <= SIGRTMAX; ++i)
-        {
-            if (!sigismember(&local->sigset, i))
-            {
-                local->assigned_signal = i;
-                break;
-            }
-        }
-
-        do
-        {
-            if (local->assigned_signal == 0)
-            {
-                OS_DEBUG("No free RT signals to use for simulated time base\n");
-                return_code = OS_TIMER_ERR_UNAVAILABLE;
-                break;
-            }
-
-            sigemptyset(&local->sigset);
-            sigaddset(&local->sigset, local->assigned_signal);
-
-            /*
-            **  Initialize the sigevent structures for the handler.
-            */
-            memset((void *)&evp, 0, sizeof(evp));
-            evp.sigev_notify = SIGEV_SIGNAL;
-            evp.sigev_signo = local->assigned_signal;
-
-            /*
-             * Pass the Timer Index value of the object ID to the signal handler --
-             *  Note that the upper bits can be safely assumed as a timer ID to recreate the original,
-             *  and doing it this way should still work on a system where sizeof(sival_int) < sizeof(uint32)
-             *  (as long as sizeof(sival_int) >= number of bits in OS_OBJECT_INDEX_MASK)
-             */
-            evp.sigev_value.sival_int = (int)(global->active_id & OS_OBJECT_INDEX_MASK);
-
-            /*
-            ** Create the timer
-            ** Note using the "MONOTONIC" clock here as this will still produce consistent intervals
-            ** even if the system clock is stepped (e.g. clock_settime).
-            */
-            status = timer_create(OS_PREFERRED_CLOCK, &evp, &local->host_timerid);
-            if (status < 0)
-            {
-                return_code = OS_TIMER_ERR_UNAVAILABLE;
-                break;
-            }
-
-            OS_timebase_table[timer_id].external_sync = OS_TimeBase_SoftWaitImpl;
-        }
-        while (0);
-
-    }
-
-    if (return_code != OS_SUCCESS)
-    {
-        /*
-         * NOTE about the thread cancellation -- this technically is just a backup,
-         * we should not need to cancel it because the handler thread will exit automatically
-         * if the active ID does not match the expected value.  This check would fail
-         * if this function returns non-success (the ID in the global will be set zero)
-         */
-        pthread_cancel(local->handler_thread);
-        local->assigned_signal = 0;
+        OS_timebase_table[timer_id].external_sync = OS_TimeBase_SoftWaitImpl;
     }
 
     return return_code;
@@ -485,48 +502,22 @@ int32 OS_TimeBaseCreate_Impl(uint32 timer_id)
 int32 OS_TimeBaseSet_Impl(uint32 timer_id, int32 start_time, int32 interval_time)
 {
     OS_impl_timebase_internal_record_t *local;
-    struct itimerspec timeout;
-    int32 return_code;
-    int status;
 
     local = &OS_impl_timebase_table[timer_id];
-    return_code = OS_SUCCESS;
 
-    /* There is only something to do here if we are generating a simulated tick */
-    if (local->assigned_signal != 0)
+    /*
+     * There is only something to do here if we are generating a simulated tick.
+     * The ticks restart from now; the handler thread is woken up when the
+     * caller releases the time base lock.
+     */
+    if (OS_timebase_table[timer_id].external_sync == OS_TimeBase_SoftWaitImpl)
     {
-        /*
-        ** Convert from Microseconds to timespec structures
-        */
-        memset(&timeout, 0, sizeof(timeout));
-        OS_UsecToTimespec(start_time, &timeout.it_value);
-        OS_UsecToTimespec(interval_time, &timeout.it_interval);
-
-        /*
-        ** Program the real timer
-        */
-        status = timer_settime(local->host_timerid,
-                0,              /* Flags field can be zero */
-                &timeout,       /* struct itimerspec */
-                NULL);         /* Oldvalue */
-
-        if (status < 0)
-        {
-            OS_DEBUG("Error in timer_settime: %s\n",strerror(errno));
-            return_code = OS_TIMER_ERR_INTERNAL;
-        }
-        else if (interval_time > 0)
-        {
-            OS_timebase_table[timer_id].accuracy_usec = (uint32)((timeout.it_interval.tv_nsec + 999) / 1000);
-        }
-        else
-        {
-            OS_timebase_table[timer_id].accuracy_usec = (uint32)((timeout.it_value.tv_nsec + 999) / 1000);
-        }
+        clock_gettime(OS_PREFERRED_CLOCK, &local->softsleep);
+        OS_timebase_table[timer_id].accuracy_usec = (POSIX_GlobalVars.ClockAccuracyNsec + 999) / 1000;
     }
 
-    local->reset_flag = (return_code == OS_SUCCESS);
-    return return_code;
+    local->reset_flag = 1;
+    return OS_SUCCESS;
 } /* end OS_TimeBaseSet_Impl */
 
 
@@ -542,27 +533,11 @@ int32 OS_TimeBaseSet_Impl(uint32 timer_id, int32 start_time, int32 interval_time
 int32 OS_TimeBaseDelete_Impl(uint32 timer_id)
 {
     OS_impl_timebase_internal_record_t *local;
-    int status;
 
     local = &OS_impl_timebase_table[timer_id];
 
     pthread_cancel(local->handler_thread);
 
-    /*
-    ** Delete the timer
-    */
-    if (local->assigned_signal != 0)
-    {
-        status = timer_delete(OS_impl_timebase_table[timer_id].host_timerid);
-        if (status < 0)
-        {
-            OS_DEBUG("Error deleting timer: %s\n",strerror(errno));
-            return ( OS_TIMER_ERR_INTERNAL);
-        }
-
-        local->assigned_signal = 0;
-    }
-
     return OS_SUCCESS;
 } /* end OS_TimeBaseDelete_Impl */
 
@@ -163,11 +163,24 @@ typedef struct
     uint32              accuracy_usec;
     uint32              first_cb;
     uint32              freerun_time;
+    uint32              next_expiry_time;   /* freerun_time when the earliest armed callback is due */
+    bool                expiry_pending;     /* next_expiry_time is valid (some callback is armed) */
+    bool                set_pending;        /* a callback was set and is waiting to be armed */
+    bool                schedule_changed;   /* callbacks or ticks changed, the sync routine must work out its wait again */
     uint32              nominal_start_time;
     uint32              nominal_interval_time;
 } OS_timebase_internal_record_t;
 
 #define TIMECB_FLAG_DEDICATED_TIMEBASE      0x1
+#define TIMECB_FLAG_SET_PENDING             0x2     /* wait_time was set and is not yet armed */
+#define TIMECB_FLAG_ARMED                   0x4     /* callback is due at expiry_time */
+
+/*
+ * Longest time a sync routine may skip when no callback of its time base
+ * is due, in time base units (microseconds for the OS provided time bases).
+ * This keeps the free run time moving on an idle time base.
+ */
+#define OS_TIMEBASE_MAX_IDLE_TIME           1000000
 typedef struct
 {
     char                timer_name[OS_MAX_API_NAME];
@@ -178,6 +191,7 @@ typedef struct
     uint32              backlog_resets;
     int32               wait_time;
     int32               interval_time;
+    uint32              expiry_time;
     OS_ArgCallback_t    callback_ptr;
     void                *callback_arg;
 } OS_timecb_internal_record_t;
@@ -857,6 +871,15 @@ uint32 OS_TaskGetId_Impl             (void);
  ------------------------------------------------------------------*/
 int32  OS_TaskGetInfo_Impl           (uint32 task_id, OS_task_prop_t *task_prop);
 
+/*----------------------------------------------------------------
+   Function: OS_TaskGetCpuTime_Impl
+  
+    Purpose: Obtain the processor time consumed by a task
+  
+    Returns: OS_SUCCESS on success, or relevant error code
+ ------------------------------------------------------------------*/
+int32  OS_TaskGetCpuTime_Impl        (uint32 task_id, OS_time_t *cpu_time);
+
 /*----------------------------------------------------------------
   
    Function: OS_TaskRegister_Impl
@@ -1190,6 +1213,19 @@ int32 OS_TimeBaseGetInfo_Impl       (uint32 timer_id, OS_timebase_prop_t *timer_
  ------------------------------------------------------------------*/
 void  OS_TimeBase_CallbackThread    (uint32 timebase_id);
 
+/*----------------------------------------------------------------
+   Function: OS_TimeBase_NextExpiry
+
+    Purpose: Get the time from the last tick until the earliest callback
+             of the time base is due, so the sync routine can skip the
+             ticks in between.  elapsed_time is how long ago the last
+             tick was, callbacks set meanwhile are counted from then on.
+             Must be called with the time base lock held.
+
+    Returns: Time in time base units, at most OS_TIMEBASE_MAX_IDLE_TIME
+ ------------------------------------------------------------------*/
+uint32 OS_TimeBase_NextExpiry       (uint32 timebase_id, uint32 elapsed_time);
+
 /*
  * Clock API low-level handlers
  * These simply get/set the kernel RTC (if it has one)
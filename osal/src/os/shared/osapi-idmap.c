@@ -62,6 +62,11 @@ typedef enum
    OS_MAX_TOTAL_RECORDS = OS_CONSOLE_BASE + OS_MAX_CONSOLES
 } OS_ObjectIndex_t;
 
+/*
+ * Number of name hash chains of each object type (must be a power of two)
+ */
+#define OS_NAME_HASH_BUCKETS    64
+
 
 /*
  * Global ID storage tables
@@ -73,6 +78,20 @@ static OS_common_record_t OS_common_table[OS_MAX_TOTAL_RECORDS];
 /* Keep track of the last successfully-issued object ID of each type */
 static uint32 OS_last_id_issued[OS_OBJECT_TYPE_USER];
 
+/*
+ * Name index: each object type has hash chains of the records allocated
+ * with a name.  Links hold an OS_common_table index plus one, so that zero
+ * ends a chain, and OS_name_hash_bucket holds the chain a record is on
+ * plus one (zero when not on any chain).
+ *
+ * Deleted records are not unlinked (objects are deleted by clearing the
+ * active_id in many places), they stay on their chain until the record is
+ * reused and are skipped by the lookups meanwhile.
+ */
+static uint32 OS_name_hash_head[OS_OBJECT_TYPE_USER][OS_NAME_HASH_BUCKETS];
+static uint32 OS_name_hash_next[OS_MAX_TOTAL_RECORDS];
+static uint32 OS_name_hash_bucket[OS_MAX_TOTAL_RECORDS];
+
 
 OS_common_record_t * const OS_global_task_table       = &OS_common_table[OS_TASK_BASE];
 OS_common_record_t * const OS_global_queue_table      = &OS_common_table[OS_QUEUE_BASE];
@@ -105,6 +124,9 @@ int32 OS_ObjectIdInit(void)
 {
     memset(OS_common_table, 0, sizeof(OS_common_table));
     memset(OS_last_id_issued, 0, sizeof(OS_last_id_issued));
+    memset(OS_name_hash_head, 0, sizeof(OS_name_hash_head));
+    memset(OS_name_hash_next, 0, sizeof(OS_name_hash_next));
+    memset(OS_name_hash_bucket, 0, sizeof(OS_name_hash_bucket));
     return OS_SUCCESS;
 } /* end OS_ObjectIdInit */
 
@@ -230,6 +252,140 @@ static bool OS_ObjectNameMatch(void *ref, uint32 local_id, const OS_common_recor
             strcmp((const char*)ref, obj->name_entry) == 0);
 } /* end OS_ObjectNameMatch */
 
+/*----------------------------------------------------------------
+ *
+ * Function: OS_ObjectNameHash
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Returns the name hash chain of an object name (FNV-1a)
+ *
+ *-----------------------------------------------------------------*/
+static uint32 OS_ObjectNameHash(const char *name)
+{
+    uint32 hash = 2166136261U;
+
+    while (*name != 0)
+    {
+        hash ^= (uint8)*name;
+        hash *= 16777619U;
+        ++name;
+    }
+
+    return (hash ^ (hash >> 16)) & (OS_NAME_HASH_BUCKETS - 1);
+} /* end OS_ObjectNameHash */
+
+/*----------------------------------------------------------------
+ *
+ * Function: OS_ObjectNameIndexed
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Tells whether the objects of a type are found through the name index.
+ *
+ *           Streams and directories are allocated without a name (a stream
+ *           name is set or changed later, and may be duplicated), so they
+ *           are always found by searching the whole table.
+ *
+ *-----------------------------------------------------------------*/
+static bool OS_ObjectNameIndexed(uint32 idtype)
+{
+    return (idtype < OS_OBJECT_TYPE_USER &&
+            idtype != OS_OBJECT_TYPE_OS_STREAM &&
+            idtype != OS_OBJECT_TYPE_OS_DIR);
+} /* end OS_ObjectNameIndexed */
+
+/*----------------------------------------------------------------
+ *
+ * Function: OS_ObjectNameIndexInsert
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Adds a record to the name index of its type.
+ *
+ *           This is an internal function and no table locking is performed here.
+ *           Locking must be done by the calling function.
+ *
+ *-----------------------------------------------------------------*/
+static void OS_ObjectNameIndexInsert(uint32 idtype, uint32 table_idx, const char *name)
+{
+    uint32 bucket = OS_ObjectNameHash(name);
+
+    OS_name_hash_next[table_idx] = OS_name_hash_head[idtype][bucket];
+    OS_name_hash_head[idtype][bucket] = table_idx + 1;
+    OS_name_hash_bucket[table_idx] = bucket + 1;
+} /* end OS_ObjectNameIndexInsert */
+
+/*----------------------------------------------------------------
+ *
+ * Function: OS_ObjectNameIndexRemove
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Removes a record from the name index of its type, if it is on it.
+ *
+ *           This is an internal function and no table locking is performed here.
+ *           Locking must be done by the calling function.
+ *
+ *-----------------------------------------------------------------*/
+static void OS_ObjectNameIndexRemove(uint32 idtype, uint32 table_idx)
+{
+    uint32 *link;
+
+    if (OS_name_hash_bucket[table_idx] == 0)
+    {
+        return;
+    }
+
+    link = &OS_name_hash_head[idtype][OS_name_hash_bucket[table_idx] - 1];
+    while (*link != 0)
+    {
+        if (*link == table_idx + 1)
+        {
+            *link = OS_name_hash_next[table_idx];
+            break;
+        }
+        link = &OS_name_hash_next[*link - 1];
+    }
+
+    OS_name_hash_next[table_idx] = 0;
+    OS_name_hash_bucket[table_idx] = 0;
+} /* end OS_ObjectNameIndexRemove */
+
+/*----------------------------------------------------------------
+ *
+ * Function: OS_ObjectNameIndexSearch
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Locate an active object of the given type by name through the name index.
+ *
+ *           This is an internal function and no table locking is performed here.
+ *           Locking must be done by the calling function.
+ *
+ *  returns: OS_ERR_NAME_NOT_FOUND if not found, OS_SUCCESS if match is found
+ *
+ *-----------------------------------------------------------------*/
+static int32 OS_ObjectNameIndexSearch(uint32 idtype, const char *name, OS_common_record_t **record)
+{
+    uint32 link;
+    OS_common_record_t *obj = NULL;
+
+    link = OS_name_hash_head[idtype][OS_ObjectNameHash(name)];
+    while (link != 0)
+    {
+        if (OS_common_table[link - 1].active_id != 0 &&
+                OS_ObjectNameMatch((void*)name, 0, &OS_common_table[link - 1]))
+        {
+            obj = &OS_common_table[link - 1];
+            break;
+        }
+        link = OS_name_hash_next[link - 1];
+    }
+
+    if (record != NULL)
+    {
+        *record = obj;
+    }
+
+    return (obj != NULL) ? OS_SUCCESS : OS_ERR_NAME_NOT_FOUND;
+} /* end OS_ObjectNameIndexSearch */
+
                         
 /*----------------------------------------------------------------
  *
@@ -432,6 +588,12 @@ static int32 OS_ObjectIdSearch(uint32 idtype, OS_ObjectMatchFunc_t MatchFunc, vo
     uint32 local_id;
     OS_common_record_t *obj;
 
+    /* names are unique within a type, use the index when there is one */
+    if (MatchFunc == OS_ObjectNameMatch && OS_ObjectNameIndexed(idtype))
+    {
+        return OS_ObjectNameIndexSearch(idtype, (const char *)arg, record);
+    }
+
     return_code = OS_ERR_NAME_NOT_FOUND;
     obj = &OS_common_table[OS_GetBaseForObjectType(idtype)];
     obj_count = OS_GetMaxForObjectType(idtype);
@@ -526,6 +688,9 @@ static int32 OS_ObjectIdFindNext(uint32 idtype, uint32 *array_index, OS_common_r
 
    if(return_code == OS_SUCCESS)
    {
+       /* the record may still be on the name index under its former name */
+       OS_ObjectNameIndexRemove(idtype, local_id + base_id);
+
        return_code = OS_ObjectIdMap(idtype, idvalue, &obj->active_id);
 
        /* Ensure any data in the record has been cleared */
@@ -932,6 +1097,11 @@ int32 OS_ObjectIdAllocateNew(uint32 idtype, const char *name, uint32 *array_inde
       return_code = OS_ObjectIdFindNext(idtype, array_index, record);
    }
 
+   if (return_code == OS_SUCCESS && name != NULL && OS_ObjectNameIndexed(idtype))
+   {
+      OS_ObjectNameIndexInsert(idtype, *record - OS_common_table, name);
+   }
+
    /* If allocation failed for any reason, unlock the global.
     * otherwise the global should stay locked so remaining initialization can be done */
    if (return_code != OS_SUCCESS)
@@ -480,6 +480,41 @@ int32 OS_TaskGetInfo (uint32 task_id, OS_task_prop_t *task_prop)
 } /* end OS_TaskGetInfo */
 
                         
+/*----------------------------------------------------------------
+ *
+ * Function: OS_TaskGetCpuTime
+ *
+ *  Purpose: Implemented per public OSAL API
+ *           See description in API and header file for detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_TaskGetCpuTime (uint32 task_id, OS_time_t *cpu_time)
+{
+   OS_common_record_t *record;
+   int32             return_code;
+   uint32            local_id;
+
+   /* Check parameters */
+   if (cpu_time == NULL)
+   {
+      return OS_INVALID_POINTER;
+   }
+
+   memset(cpu_time,0,sizeof(OS_time_t));
+
+   return_code = OS_ObjectIdGetById(OS_LOCK_MODE_GLOBAL,LOCAL_OBJID_TYPE, task_id, &local_id, &record);
+   if (return_code == OS_SUCCESS)
+   {
+      return_code = OS_TaskGetCpuTime_Impl(local_id, cpu_time);
+
+      OS_Unlock_Global_Impl(LOCAL_OBJID_TYPE);
+   }
+
+   return return_code;
+
+} /* end OS_TaskGetCpuTime */
+
+                        
 /*----------------------------------------------------------------
  *
  * Function: OS_TaskInstallDeleteHandler
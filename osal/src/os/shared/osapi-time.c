@@ -173,6 +173,8 @@ static int32 OS_DoTimerAdd(uint32 *timer_id, const char *timer_name, uint32 time
            OS_timecb_table[local->next_ref].prev_ref = local_id;
        }
 
+       OS_timebase_table[timebase_local_id].schedule_changed = true;
+
        OS_TimeBaseUnlock_Impl(timebase_local_id);
 
        /* Check result, finalize record, and unlock global table. */
@@ -346,8 +348,16 @@ int32 OS_TimerSet(uint32 timer_id, uint32 start_time, uint32 interval_time)
            dedicated_timebase_id = OS_global_timebase_table[local->timebase_ref].active_id;
        }
 
+       /*
+        * The time base thread arms the callback on its next tick, or earlier
+        * if it is waiting for several ticks (see OS_TimeBase_NextExpiry).
+        */
        local->wait_time = (int32)start_time;
        local->interval_time = (int32)interval_time;
+       local->flags &= ~TIMECB_FLAG_ARMED;
+       local->flags |= TIMECB_FLAG_SET_PENDING;
+       OS_timebase_table[local->timebase_ref].set_pending = true;
+       OS_timebase_table[local->timebase_ref].schedule_changed = true;
 
        OS_TimeBaseUnlock_Impl(local->timebase_ref);
 
@@ -430,7 +440,7 @@ int32 OS_TimerDelete(uint32 timer_id)
         {
             if (local->next_ref != local_id)
             {
-                OS_ObjectIdMap(OS_OBJECT_TYPE_OS_TIMEBASE, local->next_ref, &OS_timebase_table[local->timebase_ref].first_cb);
+                OS_timebase_table[local->timebase_ref].first_cb = OS_global_timecb_table[local->next_ref].active_id;
             }
             else
             {
@@ -449,6 +459,8 @@ int32 OS_TimerDelete(uint32 timer_id)
         /* Clear the ID to zero */
         record->active_id = 0;
 
+        OS_timebase_table[local->timebase_ref].schedule_changed = true;
+
         OS_TimeBaseUnlock_Impl(local->timebase_ref);
 
         OS_Unlock_Global_Impl(OS_OBJECT_TYPE_OS_TIMECB);
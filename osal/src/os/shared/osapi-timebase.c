@@ -207,6 +207,7 @@ int32 OS_TimeBaseSet(uint32 timer_id, uint32 start_time, uint32 interval_time)
            /* Save the value since we were successful */
             OS_timebase_table[local_id].nominal_start_time = start_time;
             OS_timebase_table[local_id].nominal_interval_time = interval_time;
+            OS_timebase_table[local_id].schedule_changed = true;
         }
 
         OS_TimeBaseUnlock_Impl(local_id);
@@ -370,6 +371,195 @@ int32 OS_TimeBaseGetFreeRun     (uint32 timebase_id, uint32 *freerun_val)
     return return_code;
 } /* end OS_TimeBaseGetFreeRun */
 
+/*----------------------------------------------------------------
+ *
+ * Function: OS_TimeBase_ArmCallbacks
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Turns the wait time of the callbacks set since the last tick
+ *           into an absolute expiry time, counted from anchor_time.
+ *
+ *           Must be called with the time base lock held.
+ *
+ *-----------------------------------------------------------------*/
+static void OS_TimeBase_ArmCallbacks(OS_timebase_internal_record_t *timebase, uint32 anchor_time)
+{
+    OS_timecb_internal_record_t *timecb;
+    uint32 timer_id;
+    uint32 curr_cb_local_id;
+
+    timebase->set_pending = false;
+
+    if (OS_ObjectIdToArrayIndex(OS_OBJECT_TYPE_OS_TIMECB, timebase->first_cb, &timer_id) != 0)
+    {
+        return;
+    }
+
+    curr_cb_local_id = timer_id;
+    do
+    {
+        timecb = &OS_timecb_table[curr_cb_local_id];
+        if ((timecb->flags & TIMECB_FLAG_SET_PENDING) != 0)
+        {
+            timecb->flags &= ~TIMECB_FLAG_SET_PENDING;
+            timecb->flags |= TIMECB_FLAG_ARMED;
+            timecb->expiry_time = anchor_time + timecb->wait_time;
+
+            if (!timebase->expiry_pending ||
+                    (int32)(timecb->expiry_time - timebase->next_expiry_time) < 0)
+            {
+                timebase->next_expiry_time = timecb->expiry_time;
+                timebase->expiry_pending = true;
+            }
+        }
+        curr_cb_local_id = timecb->next_ref;
+    }
+    while (curr_cb_local_id != timer_id);
+} /* end OS_TimeBase_ArmCallbacks */
+
+/*----------------------------------------------------------------
+ *
+ * Function: OS_TimeBase_ProcessCallbacks
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Gives the callbacks that became due with the last tick and
+ *           works out when the next one is due.
+ *
+ *           Must be called with the time base lock held.
+ *
+ *-----------------------------------------------------------------*/
+static void OS_TimeBase_ProcessCallbacks(OS_timebase_internal_record_t *timebase, uint32 tick_time)
+{
+    OS_timecb_internal_record_t *timecb;
+    uint32 timer_id;
+    uint32 curr_cb_local_id;
+    uint32 curr_cb_public_id;
+    int32 saved_wait_time;
+    int32 wait_time;
+    int32 next_wait_time;
+
+    timebase->expiry_pending = false;
+    next_wait_time = 0;
+
+    if (OS_ObjectIdToArrayIndex(OS_OBJECT_TYPE_OS_TIMECB, timebase->first_cb, &timer_id) != 0)
+    {
+        return;
+    }
+
+    curr_cb_local_id = timer_id;
+    do
+    {
+        curr_cb_public_id = OS_global_timecb_table[curr_cb_local_id].active_id;
+        timecb = &OS_timecb_table[curr_cb_local_id];
+
+        if ((timecb->flags & TIMECB_FLAG_ARMED) != 0)
+        {
+            wait_time = (int32)(timecb->expiry_time - timebase->freerun_time);
+            if (wait_time <= 0)
+            {
+                saved_wait_time = wait_time + (int32)tick_time;
+
+                /*
+                 * A tick that covers more than one interval (a merged overrun, or a
+                 * cb "interval_time" less than the timebase interval_time) gives the
+                 * missed callbacks back to back, so the next expiry is always ahead
+                 * of the free run time and gets scheduled.
+                 */
+                while (wait_time <= 0)
+                {
+                    wait_time += timecb->interval_time;
+
+                    /*
+                     * Only allow the "wait_time" underflow to go as far negative as one interval time
+                     * This prevents a cb "interval_time" of less than the timebase interval_time from
+                     * accumulating infinitely
+                     */
+                    if (wait_time < -timecb->interval_time)
+                    {
+                        ++timecb->backlog_resets;
+                        wait_time = -timecb->interval_time;
+                    }
+
+                    /*
+                     * Only give the callback if the wait_time actually transitioned from positive to negative.
+                     * This allows one-shot operation where the API sets the "wait_time" positive but keeps
+                     * the "interval_time" at zero.  A one-shot callback is disarmed once it expired, until
+                     * the API sets it again.
+                     */
+                    if (saved_wait_time > 0 && timecb->callback_ptr != NULL)
+                    {
+                        (*timecb->callback_ptr)(curr_cb_public_id, timecb->callback_arg);
+                    }
+
+                    if (timecb->interval_time <= 0)
+                    {
+                        break;
+                    }
+                }
+
+                if (timecb->interval_time == 0)
+                {
+                    timecb->flags &= ~TIMECB_FLAG_ARMED;
+                }
+                else
+                {
+                    timecb->expiry_time = timebase->freerun_time + wait_time;
+                }
+            }
+
+            if ((timecb->flags & TIMECB_FLAG_ARMED) != 0 &&
+                    (!timebase->expiry_pending || wait_time < next_wait_time))
+            {
+                timebase->next_expiry_time = timecb->expiry_time;
+                timebase->expiry_pending = true;
+                next_wait_time = wait_time;
+            }
+        }
+
+        curr_cb_local_id = timecb->next_ref;
+    }
+    while (curr_cb_local_id != timer_id);
+} /* end OS_TimeBase_ProcessCallbacks */
+
+/*----------------------------------------------------------------
+ *
+ * Function: OS_TimeBase_NextExpiry
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           See prototype in os-impl.h for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+uint32 OS_TimeBase_NextExpiry(uint32 timebase_id, uint32 elapsed_time)
+{
+    OS_timebase_internal_record_t *timebase;
+    int32 wait_time;
+
+    timebase = &OS_timebase_table[timebase_id];
+
+    if (timebase->set_pending)
+    {
+        OS_TimeBase_ArmCallbacks(timebase, timebase->freerun_time + elapsed_time);
+    }
+
+    if (!timebase->expiry_pending)
+    {
+        return OS_TIMEBASE_MAX_IDLE_TIME;
+    }
+
+    wait_time = (int32)(timebase->next_expiry_time - timebase->freerun_time);
+    if (wait_time <= 0)
+    {
+        return 0;
+    }
+
+    if (wait_time > OS_TIMEBASE_MAX_IDLE_TIME)
+    {
+        return OS_TIMEBASE_MAX_IDLE_TIME;
+    }
+
+    return (uint32)wait_time;
+} /* end OS_TimeBase_NextExpiry */
+
 /*----------------------------------------------------------------
  *
  * Function: OS_TimeBase_CallbackThread
@@ -388,20 +578,20 @@ int32 OS_TimeBaseGetFreeRun     (uint32 timebase_id, uint32 *freerun_val)
  *          Doing callbacks directly as an ISR or signal handler can be dangerous, as the
  *          available C library calls are very limited in that context.
  *
+ *          Callbacks are kept armed with an absolute expiry time, so a tick only
+ *          looks at them when the earliest one is due.  A sync routine may also
+ *          return several ticks at once (see OS_TimeBase_NextExpiry).
+ *
  *-----------------------------------------------------------------*/
 void OS_TimeBase_CallbackThread(uint32 timebase_id)
 {
     OS_TimerSync_t syncfunc;
     OS_timebase_internal_record_t *timebase;
-    OS_timecb_internal_record_t *timecb;
     OS_common_record_t *record;
     uint32 local_id;
-    uint32 timer_id;
-    uint32 curr_cb_local_id;
-    uint32 curr_cb_public_id;
     uint32 tick_time;
+    uint32 prev_time;
     uint32 spin_cycles;
-    int32 saved_wait_time;
 
     /*
      * Register this task as a time base handler.
@@ -484,45 +674,22 @@ void OS_TimeBase_CallbackThread(uint32 timebase_id)
             break;
         }
 
+        prev_time = timebase->freerun_time;
         timebase->freerun_time += tick_time;
-        if (OS_ObjectIdToArrayIndex(OS_OBJECT_TYPE_OS_TIMECB, timebase->first_cb, &timer_id) == 0)
-        {
-            curr_cb_local_id = timer_id;
-            do
-            {
-                curr_cb_public_id = OS_global_timecb_table[curr_cb_local_id].active_id;
-                timecb = &OS_timecb_table[curr_cb_local_id];
-                saved_wait_time = timecb->wait_time;
-                timecb->wait_time -= tick_time;
-                if (timecb->wait_time <= 0)
-                {
-                    timecb->wait_time += timecb->interval_time;
 
-                    /*
-                     * Only allow the "wait_time" underflow to go as far negative as one interval time
-                     * This prevents a cb "interval_time" of less than the timebase interval_time from
-                     * accumulating infinitely
-                     */
-                    if (timecb->wait_time < -timecb->interval_time)
-                    {
-                        ++timecb->backlog_resets;
-                        timecb->wait_time = -timecb->interval_time;
-                    }
+        /*
+         * Callbacks set since the last tick count down from that tick,
+         * the same as if their wait time had been decremented by this one.
+         */
+        if (timebase->set_pending)
+        {
+            OS_TimeBase_ArmCallbacks(timebase, prev_time);
+        }
 
-                    /*
-                     * Only give the callback if the wait_time actually transitioned from positive to negative.
-                     * This allows one-shot operation where the API sets the "wait_time" positive but keeps
-                     * the "interval_time" at zero.  With the interval_time at zero the wait time will never
-                     * go positive again unless the API sets it again.
-                     */
-                    if (saved_wait_time > 0 && timecb->callback_ptr != NULL)
-                    {
-                        (*timecb->callback_ptr)(curr_cb_public_id, timecb->callback_arg);
-                    }
-                }
-                curr_cb_local_id = timecb->next_ref;
-            }
-            while (curr_cb_local_id != timer_id);
+        if (timebase->expiry_pending &&
+                (int32)(timebase->next_expiry_time - timebase->freerun_time) <= 0)
+        {
+            OS_TimeBase_ProcessCallbacks(timebase, tick_time);
         }
 
         OS_TimeBaseUnlock_Impl(local_id);
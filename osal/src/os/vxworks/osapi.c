@@ -727,6 +727,19 @@ int32 OS_TaskGetInfo_Impl (uint32 task_id, OS_task_prop_t *task_prop)
 
 } /* end OS_TaskGetInfo_Impl */
 
+/*----------------------------------------------------------------
+ *
+ * Function: OS_TaskGetCpuTime_Impl
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype in os-impl.h for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_TaskGetCpuTime_Impl (uint32 task_id, OS_time_t *cpu_time)
+{
+    return OS_ERR_NOT_IMPLEMENTED;
+} /* end OS_TaskGetCpuTime_Impl */
+
 
 /****************************************************************************************
                                 MESSAGE QUEUE API
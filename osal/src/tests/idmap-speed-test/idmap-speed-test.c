@@ -0,0 +1,145 @@
+/*
+ *      Copyright (c) 2018, United States government as represented by the
+ *      administrator of the National Aeronautics Space Administration.
+ *      All rights reserved. This software was created at NASA Glenn
+ *      Research Center pursuant to government contracts.
+ *
+ *      This is governed by the NASA Open Source Agreement and may be used,
+ *      distributed and modified only according to the terms of that agreement.
+ */
+
+/*
+** Object Name Lookup Speed Test
+**
+** This is a simple way to gauge the cost of looking up
+** OSAL objects by name on a given machine.
+**
+** The test fills every binary semaphore slot, then looks
+** each one up by name, followed by a name that does not
+** exist, for a fixed number of rounds.  It then deletes one
+** semaphore, checks that its name is no longer found, and
+** that a new semaphore reusing the slot is found under its
+** new name.
+**
+** At the end of the test, the number of lookups per
+** millisecond is indicated.  Higher numbers indicate
+** better performance.
+*/
+#include <stdio.h>
+#include "common_types.h"
+#include "osapi.h"
+#include "utassert.h"
+#include "uttest.h"
+#include "utbsp.h"
+#include "uttools.h"
+
+/* Define setup and test functions for UT assert */
+void IdMapSetup(void);
+void IdMapRun(void);
+
+#define LOOKUP_ROUNDS   20000
+
+uint32 sem_ids[OS_MAX_BIN_SEMAPHORES];
+char   sem_names[OS_MAX_BIN_SEMAPHORES][OS_MAX_API_NAME];
+
+void OS_Application_Startup(void)
+{
+    if (OS_API_Init() != OS_SUCCESS)
+    {
+        UtAssert_Abort("OS_API_Init() failed");
+    }
+
+    /*
+     * Register the test setup and check routines in UT assert
+     */
+    UtTest_Add(IdMapRun, IdMapSetup, NULL, "IdMapSpeedTest");
+}
+
+void IdMapSetup(void)
+{
+   uint32 i;
+   int32  status;
+
+   /*
+   ** Create as many semaphores as configured
+   */
+   for (i = 0; i < OS_MAX_BIN_SEMAPHORES; i++)
+   {
+      snprintf(sem_names[i], sizeof(sem_names[i]), "IdMapSpeed%u", (unsigned int)i);
+      status = OS_BinSemCreate(&sem_ids[i], sem_names[i], 0, 0);
+      UtAssert_True(status == OS_SUCCESS, "Sem %u create Id=%u Rc=%d", (unsigned int)i,
+            (unsigned int)sem_ids[i], (int)status);
+   }
+}
+
+void IdMapRun(void)
+{
+   OS_time_t start_time;
+   OS_time_t end_time;
+   uint32    elapsed_ms;
+   uint32    lookups;
+   uint32    mismatches;
+   uint32    round;
+   uint32    i;
+   uint32    id;
+   int32     status;
+
+   mismatches = 0;
+   lookups = 0;
+
+   OS_GetLocalTime(&start_time);
+
+   for (round = 0; round < LOOKUP_ROUNDS; round++)
+   {
+      for (i = 0; i < OS_MAX_BIN_SEMAPHORES; i++)
+      {
+         if (OS_BinSemGetIdByName(&id, sem_names[i]) != OS_SUCCESS || id != sem_ids[i])
+         {
+            ++mismatches;
+         }
+      }
+
+      if (OS_BinSemGetIdByName(&id, "IdMapMissing") != OS_ERR_NAME_NOT_FOUND)
+      {
+         ++mismatches;
+      }
+
+      lookups += OS_MAX_BIN_SEMAPHORES + 1;
+   }
+
+   OS_GetLocalTime(&end_time);
+
+   elapsed_ms = ((end_time.seconds - start_time.seconds) * 1000) +
+         (end_time.microsecs / 1000) - (start_time.microsecs / 1000);
+
+   UtAssert_True(mismatches == 0, "Lookup mismatches = %u", (unsigned int)mismatches);
+   UtPrintf("%u lookups with %u objects in %u ms (%u per ms)\n", (unsigned int)lookups,
+         (unsigned int)OS_MAX_BIN_SEMAPHORES, (unsigned int)elapsed_ms,
+         (unsigned int)(lookups / (elapsed_ms ? elapsed_ms : 1)));
+
+   /*
+   ** A deleted name is not found, a reused slot is found under its new name
+   */
+   status = OS_BinSemDelete(sem_ids[0]);
+   UtAssert_True(status == OS_SUCCESS, "Sem 0 delete Rc=%d", (int)status);
+
+   status = OS_BinSemGetIdByName(&id, sem_names[0]);
+   UtAssert_True(status == OS_ERR_NAME_NOT_FOUND, "Deleted sem lookup Rc=%d", (int)status);
+
+   snprintf(sem_names[0], sizeof(sem_names[0]), "IdMapReused");
+   status = OS_BinSemCreate(&sem_ids[0], sem_names[0], 0, 0);
+   UtAssert_True(status == OS_SUCCESS, "Sem 0 create Id=%u Rc=%d", (unsigned int)sem_ids[0], (int)status);
+
+   status = OS_BinSemGetIdByName(&id, sem_names[0]);
+   UtAssert_True(status == OS_SUCCESS && id == sem_ids[0], "Reused sem lookup Id=%u Rc=%d",
+         (unsigned int)id, (int)status);
+
+   /*
+   ** Delete resources
+   */
+   for (i = 0; i < OS_MAX_BIN_SEMAPHORES; i++)
+   {
+      status = OS_BinSemDelete(sem_ids[i]);
+      UtAssert_True(status == OS_SUCCESS, "Sem %u delete Rc=%d", (unsigned int)i, (int)status);
+   }
+}
@@ -452,6 +452,22 @@ void Test_OS_ObjectIdAllocateNew(void)
     actual = OS_ObjectIdAllocateNew(OS_OBJECT_TYPE_OS_TASK, "UT_alloc", &objid, &rptr);
     UtAssert_True(actual == expected, "OS_ObjectIdAllocate() (%ld) == OS_ERR_NAME_TAKEN", (long)actual);
 
+    /* the name index finds the new object by name */
+    expected = OS_SUCCESS;
+    actual = OS_ObjectIdFindByName(OS_OBJECT_TYPE_OS_TASK, "UT_alloc", &objid);
+    UtAssert_True(actual == expected, "OS_ObjectIdFindByName() (%ld) == OS_SUCCESS", (long)actual);
+    UtAssert_True(objid == rptr->active_id, "objid (%lx) == active_id", (unsigned long)objid);
+
+    /* once deleted, the name is no longer found and can be used again */
+    rptr->active_id = 0;
+    expected = OS_ERR_NAME_NOT_FOUND;
+    actual = OS_ObjectIdFindByName(OS_OBJECT_TYPE_OS_TASK, "UT_alloc", &objid);
+    UtAssert_True(actual == expected, "OS_ObjectIdFindByName() (%ld) == OS_ERR_NAME_NOT_FOUND", (long)actual);
+
+    expected = OS_SUCCESS;
+    actual = OS_ObjectIdAllocateNew(OS_OBJECT_TYPE_OS_TASK, "UT_alloc", &objid, &rptr);
+    UtAssert_True(actual == expected, "OS_ObjectIdAllocate() (%ld) == OS_SUCCESS", (long)actual);
+
 }
 
 void Test_OS_ConvertToArrayIndex(void)
@@ -249,6 +249,29 @@ void Test_OS_TaskGetInfo(void)
     OS_task_table[1].priority = 0;
 }
 
+void Test_OS_TaskGetCpuTime(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_TaskGetCpuTime (uint32 task_id, OS_time_t *cpu_time)
+     */
+    int32 expected = OS_SUCCESS;
+    int32 actual = ~OS_SUCCESS;
+    OS_time_t cpu_time;
+
+    actual = OS_TaskGetCpuTime(1, &cpu_time);
+    UtAssert_True(actual == expected, "OS_TaskGetCpuTime() (%ld) == OS_SUCCESS", (long)actual);
+
+    expected = OS_INVALID_POINTER;
+    actual = OS_TaskGetCpuTime(1, NULL);
+    UtAssert_True(actual == expected, "OS_TaskGetCpuTime() (%ld) == OS_INVALID_POINTER", (long)actual);
+
+    expected = OS_ERR_NOT_IMPLEMENTED;
+    UT_SetForceFail(UT_KEY(OS_TaskGetCpuTime_Impl), OS_ERR_NOT_IMPLEMENTED);
+    actual = OS_TaskGetCpuTime(1, &cpu_time);
+    UtAssert_True(actual == expected, "OS_TaskGetCpuTime() (%ld) == OS_ERR_NOT_IMPLEMENTED", (long)actual);
+}
+
 void Test_OS_TaskInstallDeleteHandler(void)
 {
     /*
@@ -306,6 +329,7 @@ void OS_Application_Startup(void)
     ADD_TEST(OS_TaskGetId);
     ADD_TEST(OS_TaskGetIdByName);
     ADD_TEST(OS_TaskGetInfo);
+    ADD_TEST(OS_TaskGetCpuTime);
     ADD_TEST(OS_TaskInstallDeleteHandler);
 }
 
@@ -250,7 +250,9 @@ void Test_OS_TimeBase_CallbackThread(void)
 
     OS_timebase_table[2].external_sync = UT_TimerSync;
     OS_timecb_table[0].wait_time = 2000;
+    OS_timecb_table[0].flags = TIMECB_FLAG_SET_PENDING;
     OS_timecb_table[0].callback_ptr = UT_TimeCB;
+    OS_timebase_table[2].set_pending = true;
     TimerSyncCount = 0;
     TimerSyncRetVal = 0;
     TimeCB = 0;
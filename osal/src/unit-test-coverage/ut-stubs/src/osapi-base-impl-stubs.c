@@ -63,6 +63,7 @@ uint32 OS_TaskGetId_Impl            (void)
     return UT_DEFAULT_IMPL(OS_TaskGetId_Impl);
 }
 UT_DEFAULT_STUB(OS_TaskGetInfo_Impl,(uint32 task_id, OS_task_prop_t *task_prop))
+UT_DEFAULT_STUB(OS_TaskGetCpuTime_Impl,(uint32 task_id, OS_time_t *cpu_time))
 UT_DEFAULT_STUB(OS_TaskRegister_Impl,(uint32 global_task_id))
 
 /*
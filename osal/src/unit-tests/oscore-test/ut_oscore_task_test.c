@@ -1161,6 +1161,147 @@ UT_os_task_get_info_test_exit_tag:
     UT_OS_LOG_API_MACRO(apiInfo)
 }
 
+/*--------------------------------------------------------------------------------*/
+
+void spin_test_task(void)
+{
+    OS_time_t start_time;
+    OS_time_t now;
+
+    OS_TaskRegister();
+
+    /* Use the processor for about 50 milliseconds, then idle */
+    OS_GetLocalTime(&start_time);
+    do
+    {
+        OS_GetLocalTime(&now);
+    }
+    while (((now.seconds - start_time.seconds) * 1000000 + now.microsecs - start_time.microsecs) < 50000);
+
+    while (1)
+    {
+        OS_TaskDelay(1000);
+    }
+}
+
+/*--------------------------------------------------------------------------------*
+** Syntax: int32 OS_TaskGetCpuTime(uint32 task_id, OS_time_t *cpu_time)
+** Purpose: Returns the processor time used by the given task
+** Parameters: task_id - the task id to look up
+**             *cpu_time - pointer to the time structure to fill
+** Returns: OS_INVALID_POINTER if the pointer passed in is null
+**          OS_ERR_INVALID_ID if the id passed in is not a valid task
+**          OS_SUCCESS if succeeded
+** -----------------------------------------------------
+** Test #1: Invalid-ID-arg condition
+**   1) Call this routine with a non-existing task id as argument
+**   2) Expect the returned value to be
+**        (a) OS_ERR_INVALID_ID
+** -----------------------------------------------------
+** Test #2: Invalid-pointer-arg condition
+**   1) Call OS_TaskCreate() to create a task
+**   2) Expect the returned value to be
+**        (a) OS_SUCCESS __and__
+**        (b) the returned task id is valid
+**   3) Call this routine with the task id returned in #2 and a null pointer as arguments
+**   4) Expect the returned value to be
+**        (a) OS_INVALID_POINTER
+** -----------------------------------------------------
+** Test #3: Nominal condition
+**   1) Call OS_TaskCreate() to create a task that runs for a while, then idles
+**   2) Expect the returned value to be
+**        (a) OS_SUCCESS __and__
+**        (b) the returned task id is valid
+**   3) Call this routine with the task id returned in #2
+**   4) Expect the returned value to be
+**        (a) OS_SUCCESS __and__
+**        (b) a non-zero processor time
+**--------------------------------------------------------------------------------*/
+void UT_os_task_get_cpu_time_test()
+{
+    int32 res=0, idx=0;
+    UT_OsApiInfo_t apiInfo;
+    OS_time_t cpu_time;
+    const char* testDesc=NULL;
+
+    UT_OS_CLEAR_API_INFO_MACRO(apiInfo, idx)
+
+    /*-----------------------------------------------------*/
+    testDesc = "API not implemented";
+
+    res = OS_TaskGetCpuTime(99999, &cpu_time);
+    if (res == OS_ERR_NOT_IMPLEMENTED)
+    {
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_NA)
+        goto UT_os_task_get_cpu_time_test_exit_tag;
+    }
+
+    /*-----------------------------------------------------*/
+    testDesc = "#1 Invalid-ID-arg";
+
+    res = OS_TaskGetCpuTime(99999, &cpu_time);
+    if (res == OS_ERR_INVALID_ID)
+       UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+    else
+       UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+    /*-----------------------------------------------------*/
+    testDesc = "#2 Invalid-pointer-arg";
+
+    /* Setup */
+    res = OS_TaskCreate(&g_task_ids[2], g_task_names[2], generic_test_task, g_task_stacks[2],
+                        UT_TASK_STACK_SIZE, UT_TASK_PRIORITY, 0);
+    if (res != OS_SUCCESS)
+    {
+        testDesc = "#2 Invalid-pointer-arg - Task-Create failed";
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_TSF)
+    }
+    else
+    {
+        res = OS_TaskGetCpuTime(g_task_ids[2], NULL);
+        if (res == OS_INVALID_POINTER)
+            UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+        else
+            UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+        /* Delay to let child task run */
+        OS_TaskDelay(500);
+
+        /* Reset test environment */
+        res = OS_TaskDelete(g_task_ids[2]);
+    }
+
+    /*-----------------------------------------------------*/
+    testDesc = "#3 Nominal";
+
+    /* Setup */
+    res = OS_TaskCreate(&g_task_ids[3], g_task_names[3], spin_test_task, g_task_stacks[3],
+                        UT_TASK_STACK_SIZE, UT_TASK_PRIORITY, 0);
+    if (res != OS_SUCCESS)
+    {
+        testDesc = "#3 Nominal - Task-Create failed";
+        UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_TSF)
+    }
+    else
+    {
+        /* Delay to let child task run */
+        OS_TaskDelay(500);
+
+        res = OS_TaskGetCpuTime(g_task_ids[3], &cpu_time);
+        if ((res == OS_SUCCESS) && ((cpu_time.seconds != 0) || (cpu_time.microsecs != 0)))
+            UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_PASSED)
+        else
+            UT_OS_SET_TEST_RESULT_MACRO(apiInfo, idx, testDesc, UT_OS_FAILED)
+
+        /* Reset test environment */
+        res = OS_TaskDelete(g_task_ids[3]);
+    }
+
+UT_os_task_get_cpu_time_test_exit_tag:
+    UT_OS_SET_API_NAME_AND_TEST_COUNT_MACRO(apiInfo, "OS_TaskGetCpuTime", idx)
+    UT_OS_LOG_API_MACRO(apiInfo)
+}
+
 /*================================================================================*
 ** End of File: ut_oscore_task_test.c
 **================================================================================*/
@@ -44,6 +44,7 @@ void UT_os_task_register_test(void);
 void UT_os_task_get_id(void);
 void UT_os_task_get_id_by_name_test(void);
 void UT_os_task_get_info_test(void);
+void UT_os_task_get_cpu_time_test(void);
 void UT_os_task_delay_test(void);
 void UT_os_task_get_id_test(void);
 
@@ -53,6 +53,7 @@ void UT_os_init_task_register_test(void);
 void UT_os_init_task_get_id_test(void);
 void UT_os_init_task_get_id_by_name_test(void);
 void UT_os_init_task_get_info_test(void);
+void UT_os_init_task_get_cpu_time_test(void);
 
 /*--------------------------------------------------------------------------------*
 ** Local function definitions
@@ -167,6 +168,16 @@ void UT_os_init_task_get_info_test()
     g_task_names[3] = "GetInfo_Nominal";
 }
 
+/*--------------------------------------------------------------------------------*/
+
+void UT_os_init_task_get_cpu_time_test()
+{
+    g_task_names[0] = "GetCpuTime_NotImpl";
+    g_task_names[1] = "GetCpuTime_InvId";
+    g_task_names[2] = "GetCpuTime_InvPtr";
+    g_task_names[3] = "GetCpuTime_Nominal";
+}
+
 /*--------------------------------------------------------------------------------*
 ** Main
 **--------------------------------------------------------------------------------*/
@@ -253,6 +264,9 @@ void OS_Application_Startup(void)
     UT_os_init_task_get_info_test();
     UT_os_task_get_info_test();
 
+    UT_os_init_task_get_cpu_time_test();
+    UT_os_task_get_cpu_time_test();
+
     UT_os_geterrorname_test();
 
     UT_os_tick2micros_test();
@@ -275,6 +275,27 @@ int32 OS_TaskGetInfo(uint32 task_id, OS_task_prop_t *task_prop)
 }
 
 
+/*****************************************************************************
+ *
+ * Stub function for OS_TaskGetCpuTime()
+ *
+ *****************************************************************************/
+int32 OS_TaskGetCpuTime(uint32 task_id, OS_time_t *cpu_time)
+{
+    int32 status;
+
+    status = UT_DEFAULT_IMPL(OS_TaskGetCpuTime);
+
+    if (status == OS_SUCCESS &&
+            UT_Stub_CopyToLocal(UT_KEY(OS_TaskGetCpuTime), cpu_time, sizeof(*cpu_time)) < sizeof(*cpu_time))
+    {
+        memset(cpu_time, 0, sizeof(*cpu_time));
+    }
+
+    return status;
+}
+
+
 /*****************************************************************************
  *
  * Stub function for OS_TaskInstallDeleteHandler()
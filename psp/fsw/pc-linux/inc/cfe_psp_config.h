@@ -64,5 +64,20 @@ typedef struct
 */
 #define CFE_PSP_NUM_EEPROM_BANKS 1
 
+/*
+** File backed Critical Data Store
+**
+** When CFE_PSP_CDS_BACKING_FILE is defined the CDS is a shared mapping of
+** that file rather than a SysV shared memory segment, so its contents also
+** survive a power cycle (start the cFE with a processor reset to keep them).
+** Writes only mark the pages they touch; a background thread writes the
+** dirty pages back to the file every CFE_PSP_CDS_FLUSH_MSEC milliseconds,
+** which bounds how much recent CDS data a power loss can cost.
+**
+** Comment out CFE_PSP_CDS_BACKING_FILE to use a shared memory segment.
+*/
+#define CFE_PSP_CDS_BACKING_FILE  "cfe_cds.dat"
+#define CFE_PSP_CDS_FLUSH_MSEC    100
+
 #endif
 
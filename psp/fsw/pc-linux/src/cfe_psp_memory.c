@@ -45,7 +45,11 @@
 #include <sys/types.h>
 #include <sys/ipc.h>
 #include <sys/shm.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
 #include <fcntl.h>
+#include <pthread.h>
+#include <time.h>
 
 /*
 ** cFE includes 
@@ -100,6 +104,23 @@ uint8 *CFE_PSP_UserReservedAreaPtr = 0;
 int    ResetAreaShmId;
 int    CDSShmId;
 int    UserShmId;
+
+#ifdef CFE_PSP_CDS_BACKING_FILE
+/*
+** File backed CDS state.  CFE_PSP_CDSDirty holds one bit per page of the
+** CDS written since the flush thread last visited it.
+*/
+static int        CFE_PSP_CDSFd = -1;
+static uint32     CFE_PSP_CDSPageSize;
+static uint32     CFE_PSP_CDSDirtyWords;
+static uint32    *CFE_PSP_CDSDirty = NULL;
+static pthread_t  CFE_PSP_CDSFlushThread;
+
+static int32 CFE_PSP_InitCDSFile(uint32 RestartType);
+static void  CFE_PSP_MarkCDSDirty(uint32 CDSOffset, uint32 NumBytes);
+static void  CFE_PSP_FlushCDS(void);
+static void *CFE_PSP_CDSFlushTask(void *Arg);
+#endif
                                                                               
                                                                               
                                                                               
@@ -130,6 +151,16 @@ int32 CFE_PSP_InitCDS(uint32 RestartType )
    int32 return_code;
    key_t key;
 
+#ifdef CFE_PSP_CDS_BACKING_FILE
+   if ( CFE_PSP_InitCDSFile(RestartType) == CFE_PSP_SUCCESS )
+   {
+      return(CFE_PSP_SUCCESS);
+   }
+
+   OS_printf("CFE_PSP: Cannot map CDS file %s, using a Shared memory segment.\n",
+             CFE_PSP_CDS_BACKING_FILE);
+#endif
+
    /* 
    ** Make the Shared memory key
    */
@@ -188,6 +219,18 @@ void CFE_PSP_DeleteCDS(void)
    int    ReturnCode;
    struct shmid_ds ShmCtrl;
    
+#ifdef CFE_PSP_CDS_BACKING_FILE
+   /*
+   ** The file is kept; only make sure it holds the latest contents
+   */
+   if ( CFE_PSP_CDSDirty != NULL )
+   {
+      msync(CFE_PSP_CDSPtr, CFE_PSP_CDS_SIZE, MS_SYNC);
+      printf("CFE_PSP: Critical Data Store file %s synchronized\n", CFE_PSP_CDS_BACKING_FILE);
+      return;
+   }
+#endif
+
    ReturnCode = shmctl(CDSShmId, IPC_RMID, &ShmCtrl);
    
    if ( ReturnCode == 0 )
@@ -261,6 +304,13 @@ int32 CFE_PSP_WriteToCDS(const void *PtrToDataToWrite, uint32 CDSOffset, uint32
        {
           CopyPtr = &(CFE_PSP_CDSPtr[CDSOffset]);
           memcpy(CopyPtr, (char *)PtrToDataToWrite,NumBytes);
+
+#ifdef CFE_PSP_CDS_BACKING_FILE
+          if ( CFE_PSP_CDSDirty != NULL )
+          {
+             CFE_PSP_MarkCDSDirty(CDSOffset, NumBytes);
+          }
+#endif
           
           return_code = CFE_PSP_SUCCESS;
        }
@@ -318,6 +368,216 @@ int32 CFE_PSP_ReadFromCDS(void *PtrToDataToRead, uint32 CDSOffset, uint32 NumByt
    
 }
 
+#ifdef CFE_PSP_CDS_BACKING_FILE
+/******************************************************************************
+**  Function: CFE_PSP_InitCDSFile
+**
+**  Purpose:
+**    This is an internal function to map the CDS from its backing file and
+**    start the thread that writes modified pages back to the file.
+**
+**  Arguments:
+**    RestartType : the CDS is cleared on a power on reset
+**
+**  Return:
+**    CFE_PSP_SUCCESS, or CFE_PSP_ERROR if the file cannot be used
+*/
+static int32 CFE_PSP_InitCDSFile(uint32 RestartType)
+{
+   struct stat FileStats;
+   void       *Mapping;
+   uint32      Pages;
+
+   CFE_PSP_CDSFd = open(CFE_PSP_CDS_BACKING_FILE, O_RDWR | O_CREAT, 0644);
+   if ( CFE_PSP_CDSFd < 0 )
+   {
+      return(CFE_PSP_ERROR);
+   }
+
+   /*
+   ** A file of another size was not written with this CDS layout
+   */
+   if ( fstat(CFE_PSP_CDSFd, &FileStats) != 0 )
+   {
+      close(CFE_PSP_CDSFd);
+      return(CFE_PSP_ERROR);
+   }
+
+   if ( FileStats.st_size != (off_t)CFE_PSP_CDS_SIZE )
+   {
+      if ( ftruncate(CFE_PSP_CDSFd, CFE_PSP_CDS_SIZE) != 0 )
+      {
+         close(CFE_PSP_CDSFd);
+         return(CFE_PSP_ERROR);
+      }
+      RestartType = CFE_PSP_RST_TYPE_POWERON;
+   }
+
+   Mapping = mmap(NULL, CFE_PSP_CDS_SIZE, PROT_READ | PROT_WRITE, MAP_SHARED, CFE_PSP_CDSFd, 0);
+   if ( Mapping == MAP_FAILED )
+   {
+      close(CFE_PSP_CDSFd);
+      return(CFE_PSP_ERROR);
+   }
+
+   CFE_PSP_CDSPageSize = sysconf(_SC_PAGESIZE);
+   Pages = (CFE_PSP_CDS_SIZE + CFE_PSP_CDSPageSize - 1) / CFE_PSP_CDSPageSize;
+   CFE_PSP_CDSDirtyWords = (Pages + 31) / 32;
+   CFE_PSP_CDSDirty = calloc(CFE_PSP_CDSDirtyWords, sizeof(uint32));
+   if ( CFE_PSP_CDSDirty == NULL )
+   {
+      munmap(Mapping, CFE_PSP_CDS_SIZE);
+      close(CFE_PSP_CDSFd);
+      return(CFE_PSP_ERROR);
+   }
+
+   CFE_PSP_CDSPtr = Mapping;
+
+   if ( RestartType == CFE_PSP_RST_TYPE_POWERON )
+   {
+      OS_printf("CFE_PSP: Clearing out CFE CDS file %s.\n", CFE_PSP_CDS_BACKING_FILE);
+      memset(CFE_PSP_CDSPtr, 0, CFE_PSP_CDS_SIZE);
+      CFE_PSP_MarkCDSDirty(0, CFE_PSP_CDS_SIZE);
+   }
+   else
+   {
+      OS_printf("CFE_PSP: Restored CFE CDS from file %s.\n", CFE_PSP_CDS_BACKING_FILE);
+   }
+
+   if ( pthread_create(&CFE_PSP_CDSFlushThread, NULL, CFE_PSP_CDSFlushTask, NULL) != 0 )
+   {
+      /*
+      ** Without the thread nothing would reach the file before the kernel
+      ** writes it back on its own, so use a shared memory segment instead
+      */
+      CFE_PSP_CDSPtr = 0;
+      free(CFE_PSP_CDSDirty);
+      CFE_PSP_CDSDirty = NULL;
+      munmap(Mapping, CFE_PSP_CDS_SIZE);
+      close(CFE_PSP_CDSFd);
+      return(CFE_PSP_ERROR);
+   }
+
+   return(CFE_PSP_SUCCESS);
+}
+
+/******************************************************************************
+**  Function: CFE_PSP_MarkCDSDirty
+**
+**  Purpose:
+**    This is an internal function to note the pages touched by a CDS write.
+**    The bits are set after the data is copied, so a flush that clears them
+**    always writes back the completed copy.
+**
+**  Arguments:
+**    CDSOffset, NumBytes : the range written
+**
+**  Return:
+**    (none)
+*/
+static void CFE_PSP_MarkCDSDirty(uint32 CDSOffset, uint32 NumBytes)
+{
+   uint32 Page;
+   uint32 LastPage;
+
+   if ( NumBytes == 0 )
+   {
+      return;
+   }
+
+   Page = CDSOffset / CFE_PSP_CDSPageSize;
+   LastPage = (CDSOffset + NumBytes - 1) / CFE_PSP_CDSPageSize;
+
+   while ( Page <= LastPage )
+   {
+      __atomic_fetch_or(&CFE_PSP_CDSDirty[Page / 32], 1U << (Page % 32), __ATOMIC_RELEASE);
+      ++Page;
+   }
+}
+
+/******************************************************************************
+**  Function: CFE_PSP_FlushCDS
+**
+**  Purpose:
+**    This is an internal function to write the dirty CDS pages back to the
+**    file, one msync per run of consecutive dirty pages.
+**
+**  Arguments:
+**    (none)
+**
+**  Return:
+**    (none)
+*/
+static void CFE_PSP_FlushCDS(void)
+{
+   uint32 Word;
+   uint32 Bit;
+   uint32 Bits;
+   uint32 RunStart = 0;
+   uint32 RunLength = 0;
+
+   for ( Word = 0; Word <= CFE_PSP_CDSDirtyWords; ++Word )
+   {
+      Bits = 0;
+      if ( Word < CFE_PSP_CDSDirtyWords &&
+           __atomic_load_n(&CFE_PSP_CDSDirty[Word], __ATOMIC_RELAXED) != 0 )
+      {
+         Bits = __atomic_exchange_n(&CFE_PSP_CDSDirty[Word], 0, __ATOMIC_ACQUIRE);
+      }
+
+      /*
+      ** A pass past the last word closes a run that reaches the end
+      */
+      for ( Bit = 0; Bit < 32; ++Bit )
+      {
+         if ( (Bits & (1U << Bit)) != 0 )
+         {
+            if ( RunLength == 0 )
+            {
+               RunStart = Word * 32 + Bit;
+            }
+            ++RunLength;
+         }
+         else if ( RunLength != 0 )
+         {
+            msync(&CFE_PSP_CDSPtr[RunStart * CFE_PSP_CDSPageSize],
+                  RunLength * CFE_PSP_CDSPageSize, MS_SYNC);
+            RunLength = 0;
+         }
+      }
+   }
+}
+
+/******************************************************************************
+**  Function: CFE_PSP_CDSFlushTask
+**
+**  Purpose:
+**    Background thread writing the CDS back to its file every
+**    CFE_PSP_CDS_FLUSH_MSEC milliseconds.
+**
+**  Arguments:
+**    (none)
+**
+**  Return:
+**    (none)
+*/
+static void *CFE_PSP_CDSFlushTask(void *Arg)
+{
+   struct timespec Delay;
+
+   Delay.tv_sec = CFE_PSP_CDS_FLUSH_MSEC / 1000;
+   Delay.tv_nsec = (CFE_PSP_CDS_FLUSH_MSEC % 1000) * 1000000;
+
+   while ( 1 )
+   {
+      nanosleep(&Delay, NULL);
+      CFE_PSP_FlushCDS();
+   }
+
+   return(NULL);
+}
+#endif
+
 /*
 *********************************************************************************
 ** ES Reset Area related functions
@@ -47,6 +47,7 @@
 */
 #include <stdio.h>
 #include <stdlib.h>
+#include <time.h>
 
 /*
 ** Types and prototypes for this module
@@ -56,16 +57,27 @@
 
 /******************* Macro Definitions ***********************/
 
-#define CFE_PSP_TIMER_TICKS_PER_SECOND       1000000     /* Resolution of the least significant 32 bits of the 64 bit
+#define CFE_PSP_TIMER_TICKS_PER_SECOND       1000000000  /* Resolution of the least significant 32 bits of the 64 bit
                                                            time stamp returned by OS_BSPGet_Timebase in timer ticks per second.
                                                            The timer resolution for accuracy should not be any slower than 1000000
                                                            ticks per second or 1 us per tick */
-#define CFE_PSP_TIMER_LOW32_ROLLOVER         1000000     /* The number that the least significant 32 bits of the 64 bit
+#define CFE_PSP_TIMER_LOW32_ROLLOVER         1000000000  /* The number that the least significant 32 bits of the 64 bit
                                                            time stamp returned by OS_BSPGet_Timebase rolls over.  If the lower 32
                                                            bits rolls at 1 second, then the OS_BSP_TIMER_LOW32_ROLLOVER will be 1000000.
                                                            if the lower 32 bits rolls at its maximum value (2^32) then
                                                            OS_BSP_TIMER_LOW32_ROLLOVER will be 0. */
 
+/*
+** The timebase is used to stamp performance log entries, so it should not
+** follow adjustments to the wall clock.  CLOCK_MONOTONIC_RAW is also free of
+** NTP rate slewing; older systems without it use CLOCK_MONOTONIC.
+*/
+#ifdef CLOCK_MONOTONIC_RAW
+#define CFE_PSP_TIMEBASE_CLOCK               CLOCK_MONOTONIC_RAW
+#else
+#define CFE_PSP_TIMEBASE_CLOCK               CLOCK_MONOTONIC
+#endif
+
 /******************************************************************************
 **  Function:  CFE_PSP_GetTime()
 **
@@ -76,11 +88,16 @@
 
 void CFE_PSP_GetTime( OS_time_t *LocalTime)
 {
+    struct timespec  time;
 
     /* since we don't have a hardware register to access like the mcp750,
-     * we use a call to the OS to get the time */
+     * we read the wall clock that OS_GetLocalTime uses.  Calling
+     * clock_gettime() directly is served from the vDSO without going
+     * through the OSAL clock layer. */
 
-    OS_GetLocalTime(LocalTime);
+    clock_gettime(CLOCK_REALTIME, &time);
+    LocalTime->seconds   = time.tv_sec;
+    LocalTime->microsecs = time.tv_nsec / 1000;
 
 }/* end CFE_PSP_GetLocalTime */
 
@@ -157,15 +174,16 @@ uint32 CFE_PSP_GetTimerLow32Rollover(void)
 **  Arguments:
 **
 **  Return:
-**  Timebase register value
+**  Timebase register value: seconds in the upper word and nanoseconds in the
+**  lower word of the monotonic clock
 */
 void CFE_PSP_Get_Timebase(uint32 *Tbu, uint32* Tbl)
 {
-   OS_time_t        time;
+   struct timespec  time;
 
-   OS_GetLocalTime(&time);
-   *Tbu = time.seconds;
-   *Tbl = time.microsecs;
+   clock_gettime(CFE_PSP_TIMEBASE_CLOCK, &time);
+   *Tbu = time.tv_sec;
+   *Tbl = time.tv_nsec;
 }
 
 /******************************************************************************
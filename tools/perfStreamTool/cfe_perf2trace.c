@@ -0,0 +1,359 @@
+/*
+**      GSC-18128-1, "Core Flight Executive Version 6.7"
+**
+**      Copyright (c) 2006-2019 United States Government as represented by
+**      the Administrator of the National Aeronautics and Space Administration.
+**      All Rights Reserved.
+**
+**      Licensed under the Apache License, Version 2.0 (the "License");
+**      you may not use this file except in compliance with the License.
+**      You may obtain a copy of the License at
+**
+**        http://www.apache.org/licenses/LICENSE-2.0
+**
+**      Unless required by applicable law or agreed to in writing, software
+**      distributed under the License is distributed on an "AS IS" BASIS,
+**      WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**      See the License for the specific language governing permissions and
+**      limitations under the License.
+**
+**  cfe_perf2trace
+**
+**  This program converts the files written by the ES Performance Analyzer
+**  in stream mode into a Chrome trace (JSON) file that can be opened with
+**  chrome://tracing or https://ui.perfetto.dev.
+**
+**  Inputs: Optional perfids.h headers used to name the markers, followed by
+**          the stream files.  The files can be given in any order.
+**
+**  Outputs: The trace is written to standard output, or to the file named
+**           with the -o option.  Each application is a process lane and each
+**           of its markers a thread lane, with a slice from every entry to
+**           the matching exit.
+*/
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+
+typedef unsigned char uint8;
+typedef unsigned int uint32;
+typedef unsigned long long uint64;
+typedef long long int64;
+
+/*
+** Stream file layout, see CFE_ES_PerfStreamOpen() in cfe_es_perf.c
+*/
+#define CFE_FS_FILE_CONTENT_ID      0x63464531   /* 'cFE1' */
+#define CFE_FS_SUBTYPE_PERFSTREAM   24
+#define CFE_FS_HEADER_SIZE          64
+#define PERF_META_FIXED_SIZE        44           /* metadata up to the masks */
+#define PERF_META_MASK_SIZE_OFFSET  40
+#define PERF_LOST_CODE              0xFFFFFFFF   /* marker << 1 | exit flag otherwise */
+
+#define MAX_MARKERS                 1024
+#define MAX_NAME                    64
+
+typedef struct
+{
+    char  Name[MAX_NAME];
+    char  App[MAX_NAME];
+    int   AppLane;
+    int   Used;
+} Marker_t;
+
+static Marker_t  Markers[MAX_MARKERS];
+static char      Apps[MAX_MARKERS][MAX_NAME];
+static int       AppCount;
+static int       FirstEvent = 1;
+
+
+/*
+** Read a 32 bit word stored most significant byte first
+*/
+static uint32 GetBigEndian32(const uint8 *Ptr)
+{
+    return ((uint32)Ptr[0] << 24) | ((uint32)Ptr[1] << 16) | ((uint32)Ptr[2] << 8) | Ptr[3];
+}
+
+/*
+** Read a 32 bit word in the byte order of the processor that wrote the file
+*/
+static uint32 GetNative32(const uint8 *Ptr, int BigEndian)
+{
+    if (BigEndian)
+    {
+        return GetBigEndian32(Ptr);
+    }
+
+    return ((uint32)Ptr[3] << 24) | ((uint32)Ptr[2] << 16) | ((uint32)Ptr[1] << 8) | Ptr[0];
+}
+
+/*
+** Read a variable length integer; returns 0 at the end of the data
+*/
+static int GetVarint(const uint8 **Ptr, const uint8 *End, uint64 *Value)
+{
+    int    Shift = 0;
+    uint8  Byte;
+
+    *Value = 0;
+    do
+    {
+        if (*Ptr >= End || Shift > 63)
+        {
+            return 0;
+        }
+        Byte = *(*Ptr)++;
+        *Value |= (uint64)(Byte & 0x7F) << Shift;
+        Shift += 7;
+    } while (Byte & 0x80);
+
+    return 1;
+}
+
+/*
+** Return the lane number of an application, adding it if it is new
+*/
+static int GetAppLane(const char *App)
+{
+    int i;
+
+    for (i = 0; i < AppCount; i++)
+    {
+        if (strcmp(Apps[i], App) == 0)
+        {
+            return i + 1;
+        }
+    }
+
+    if (AppCount >= MAX_MARKERS)
+    {
+        return 0;
+    }
+
+    strncpy(Apps[AppCount], App, MAX_NAME - 1);
+    AppCount++;
+    return AppCount;
+}
+
+/*
+** Record the "#define <NAME>_PERF_ID <number>" lines of a perfids.h header.
+** The application is the first word of the name, or the first two words
+** for the cFE core services (CFE_ES, CFE_SB, ...).
+*/
+static void ReadPerfIds(const char *FileName)
+{
+    FILE         *File;
+    char          Line[256];
+    char          Name[MAX_NAME];
+    char         *Sep;
+    long          Id;
+
+    File = fopen(FileName, "r");
+    if (File == NULL)
+    {
+        fprintf(stderr, "cfe_perf2trace: can't open %s\n", FileName);
+        exit(1);
+    }
+
+    while (fgets(Line, sizeof(Line), File) != NULL)
+    {
+        if (sscanf(Line, " #define %63s %li", Name, &Id) != 2 ||
+            strstr(Name, "PERF_ID") == NULL || Id < 0 || Id >= MAX_MARKERS)
+        {
+            continue;
+        }
+
+        strcpy(Markers[Id].Name, Name);
+        strcpy(Markers[Id].App, Name);
+
+        Sep = strchr(Markers[Id].App, '_');
+        if (Sep != NULL && strncmp(Markers[Id].App, "CFE_", 4) == 0)
+        {
+            Sep = strchr(Sep + 1, '_');
+        }
+        if (Sep != NULL)
+        {
+            *Sep = '\0';
+        }
+
+        Markers[Id].Used = 1;
+    }
+
+    fclose(File);
+}
+
+/*
+** Fill in the lanes of a marker the first time it is seen
+*/
+static Marker_t *GetMarker(FILE *Out, uint32 Id)
+{
+    static Marker_t Unknown;
+    Marker_t       *Marker = &Unknown;
+
+    if (Id < MAX_MARKERS)
+    {
+        Marker = &Markers[Id];
+    }
+
+    if (Marker->AppLane == 0)
+    {
+        if (!Marker->Used)
+        {
+            snprintf(Marker->Name, MAX_NAME, "PERF_ID_%u", Id);
+            strcpy(Marker->App, "unknown");
+        }
+
+        Marker->AppLane = GetAppLane(Marker->App);
+
+        fprintf(Out, "%s\n{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":%d,\"args\":{\"name\":\"%s\"}}",
+                FirstEvent ? "" : ",", Marker->AppLane, Marker->App);
+        fprintf(Out, ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":%d,\"tid\":%u,\"args\":{\"name\":\"%s\"}}",
+                Marker->AppLane, Id, Marker->Name);
+        FirstEvent = 0;
+    }
+
+    return Marker;
+}
+
+/*
+** Convert the records of one stream file.  Returns the number of entries.
+*/
+static uint32 ConvertFile(FILE *Out, const char *FileName)
+{
+    FILE         *File;
+    uint8        *Data;
+    const uint8  *Ptr;
+    const uint8  *End;
+    long          Size;
+    int           BigEndian;
+    uint32        MetaSize;
+    uint32        TicksPerSecond;
+    uint32        Entries = 0;
+    uint64        Code;
+    uint64        Value;
+    int64         Ticks = 0;
+    double        Usec = 0;
+    Marker_t     *Marker;
+
+    File = fopen(FileName, "rb");
+    if (File == NULL)
+    {
+        fprintf(stderr, "cfe_perf2trace: can't open %s\n", FileName);
+        exit(1);
+    }
+
+    fseek(File, 0, SEEK_END);
+    Size = ftell(File);
+    fseek(File, 0, SEEK_SET);
+
+    Data = malloc(Size > 0 ? Size : 1);
+    if (Data == NULL || fread(Data, 1, Size, File) != (size_t)Size)
+    {
+        fprintf(stderr, "cfe_perf2trace: can't read %s\n", FileName);
+        exit(1);
+    }
+    fclose(File);
+
+    if (Size < CFE_FS_HEADER_SIZE + PERF_META_FIXED_SIZE ||
+        GetBigEndian32(&Data[0]) != CFE_FS_FILE_CONTENT_ID ||
+        GetBigEndian32(&Data[4]) != CFE_FS_SUBTYPE_PERFSTREAM)
+    {
+        fprintf(stderr, "cfe_perf2trace: %s is not a performance stream file\n", FileName);
+        exit(1);
+    }
+
+    Ptr = &Data[CFE_FS_HEADER_SIZE];
+    BigEndian = (Ptr[1] != 0);
+    TicksPerSecond = GetNative32(&Ptr[4], BigEndian);
+    MetaSize = PERF_META_FIXED_SIZE + 8 * GetNative32(&Ptr[PERF_META_MASK_SIZE_OFFSET], BigEndian);
+    if (TicksPerSecond == 0 || CFE_FS_HEADER_SIZE + MetaSize > (uint32)Size)
+    {
+        fprintf(stderr, "cfe_perf2trace: %s has bad performance metadata\n", FileName);
+        exit(1);
+    }
+
+    Ptr += MetaSize;
+    End = &Data[Size];
+
+    while (GetVarint(&Ptr, End, &Code) && GetVarint(&Ptr, End, &Value))
+    {
+        if (Code == PERF_LOST_CODE)
+        {
+            fprintf(Out, "%s\n{\"name\":\"%llu entries lost\",\"ph\":\"i\",\"s\":\"g\",\"ts\":%.3f}",
+                    FirstEvent ? "" : ",", Value, Usec);
+            FirstEvent = 0;
+            continue;
+        }
+
+        /* times are zigzag encoded differences from the previous record */
+        Ticks += (int64)((Value >> 1) ^ (0 - (Value & 1)));
+        Usec = (double)Ticks * 1000000.0 / TicksPerSecond;
+
+        Marker = GetMarker(Out, (uint32)(Code >> 1));
+        fprintf(Out, ",\n{\"name\":\"%s\",\"ph\":\"%c\",\"pid\":%d,\"tid\":%u,\"ts\":%.3f}",
+                Marker->Name, (Code & 1) ? 'E' : 'B', Marker->AppLane, (uint32)(Code >> 1), Usec);
+        Entries++;
+    }
+
+    free(Data);
+    return Entries;
+}
+
+
+int main(int argc, char **argv)
+{
+    FILE   *Out = stdout;
+    uint32  Entries = 0;
+    int     Files = 0;
+    int     i;
+
+    if (argc < 2 || strcmp(argv[1], "-help") == 0)
+    {
+        printf("\ncFE performance stream to Chrome trace converter.");
+        printf("\nUsage: cfe_perf2trace [-i perfids.h]... [-o trace.json] streamfile...\n");
+        exit(0);
+    }
+
+    for (i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "-i") == 0 && i + 1 < argc)
+        {
+            ReadPerfIds(argv[++i]);
+        }
+        else if (strcmp(argv[i], "-o") == 0 && i + 1 < argc)
+        {
+            Out = fopen(argv[++i], "w");
+            if (Out == NULL)
+            {
+                fprintf(stderr, "cfe_perf2trace: can't create %s\n", argv[i]);
+                exit(1);
+            }
+        }
+    }
+
+    fprintf(Out, "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[");
+
+    for (i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "-i") == 0 || strcmp(argv[i], "-o") == 0)
+        {
+            i++;
+            continue;
+        }
+
+        Entries += ConvertFile(Out, argv[i]);
+        Files++;
+    }
+
+    fprintf(Out, "\n]}\n");
+
+    if (Out != stdout)
+    {
+        fclose(Out);
+    }
+
+    fprintf(stderr, "cfe_perf2trace: %u entries from %d files\n", Entries, Files);
+
+    return 0;
+}
@@ -74,11 +74,12 @@
 */
 #define CFE_ES_HK_TLM_MID           CFE_MISSION_TLM_MID_BASE1 + CFE_MISSION_ES_HK_TLM_MSG       /* 0x0800 */
 #define CFE_EVS_HK_TLM_MID          CFE_MISSION_TLM_MID_BASE1 + CFE_MISSION_EVS_HK_TLM_MSG      /* 0x0801 */
-                                                       /* Message ID 0x0802 is available  */
+#define CFE_ES_PERFSTATS_TLM_MID    CFE_MISSION_TLM_MID_BASE1 + CFE_MISSION_ES_PERFSTATS_TLM_MSG /* 0x0802 */
 #define CFE_SB_HK_TLM_MID           CFE_MISSION_TLM_MID_BASE1 + CFE_MISSION_SB_HK_TLM_MSG       /* 0x0803 */
 #define CFE_TBL_HK_TLM_MID          CFE_MISSION_TLM_MID_BASE1 + CFE_MISSION_TBL_HK_TLM_MSG      /* 0x0804 */
 #define CFE_TIME_HK_TLM_MID         CFE_MISSION_TLM_MID_BASE1 + CFE_MISSION_TIME_HK_TLM_MSG     /* 0x0805 */
 #define CFE_TIME_DIAG_TLM_MID       CFE_MISSION_TLM_MID_BASE1 + CFE_MISSION_TIME_DIAG_TLM_MSG   /* 0x0806 */
+#define CFE_ES_BOOTPROFILE_TLM_MID  CFE_MISSION_TLM_MID_BASE1 + CFE_MISSION_ES_BOOTPROFILE_TLM_MSG /* 0x0807 */
 #define CFE_EVS_LONG_EVENT_MSG_MID  CFE_MISSION_TLM_MID_BASE1 + CFE_MISSION_EVS_LONG_EVENT_MSG_MSG   /* 0x0808 */
 #define CFE_EVS_SHORT_EVENT_MSG_MID CFE_MISSION_TLM_MID_BASE1 + CFE_MISSION_EVS_SHORT_EVENT_MSG_MSG  /* 0x0809 */
 #define CFE_SB_STATS_TLM_MID        CFE_MISSION_TLM_MID_BASE1 + CFE_MISSION_SB_STATS_TLM_MSG    /* 0x080A */
@@ -509,6 +509,52 @@
 #define CFE_PLATFORM_TIME_CFG_LATCH_FLY   8
 
 
+/**
+**  \cfetimecfg Define Clock Discipline Step Limit
+**
+**  \par Description:
+**       Define the largest phase error, between the disciplined MET and the
+**       MET received at a tone, that is removed by slewing the MET rate.  A
+**       larger error steps the MET to the tone value as before.  Units are
+**       microseconds.  A value of zero turns the discipline loop off, so
+**       every tone steps the MET.
+**
+**  \par Limits
+**       Not Applicable
+*/
+#define CFE_PLATFORM_TIME_CFG_STEP_LIMIT  10000
+
+
+/**
+**  \cfetimecfg Define Clock Discipline Loop Gains
+**
+**  \par Description:
+**       The frequency estimate moves 1/2^FREQ_SHIFT of the way to each new
+**       measurement taken from successive tones, and 1/2^SLEW_SHIFT of the
+**       phase error is removed each second.  Larger values give a smoother
+**       but slower loop.
+**
+**  \par Limits
+**       Both values must be less than 16.
+*/
+#define CFE_PLATFORM_TIME_CFG_FREQ_SHIFT  4
+#define CFE_PLATFORM_TIME_CFG_SLEW_SHIFT  3
+
+
+/**
+**  \cfetimecfg Define Clock Discipline Maximum Frequency Error
+**
+**  \par Description:
+**       Define the largest local clock frequency error that the discipline
+**       loop will correct.  The applied rate, phase slew included, is held
+**       to twice this value.  Units are parts per million.
+**
+**  \par Limits
+**       Must be greater than zero and no more than 100000.
+*/
+#define CFE_PLATFORM_TIME_CFG_MAX_RATE    500
+
+
 /**
 **  \cfeescfg Define Max Number of Applications
 **
@@ -821,6 +867,28 @@
 */
 #define CFE_PLATFORM_ES_MEMPOOL_ALIGN_SIZE_MIN   4
 
+/**
+**  \cfeescfg Define Memory Pool Task Cache Size
+**
+**  \par Description:
+**       Memory pools created with a mutex keep a small cache of free blocks
+**       for each size class in front of the shared free lists.  Tasks are
+**       spread over #CFE_PLATFORM_ES_MEMPOOL_CACHE_SLOTS cache slots by task
+**       index, and a task that finds its slot in use by another task simply
+**       falls back to the locked shared pool.  Each slot holds up to
+**       #CFE_PLATFORM_ES_MEMPOOL_CACHE_DEPTH blocks of a size class and
+**       refills from, or returns to, the shared pool half of that at a time.
+**
+**       Every cache slot adds about 10 bytes per block size to the pool
+**       management structure.  Setting the number of slots to 0 removes
+**       the cache entirely.
+**
+**  \par Limits
+**       The cache depth must be at least 2 and no more than 65535.
+*/
+#define CFE_PLATFORM_ES_MEMPOOL_CACHE_SLOTS      4
+#define CFE_PLATFORM_ES_MEMPOOL_CACHE_DEPTH      8
+
 
 /**
 **  \cfeescfg ES Nonvolatile Startup Filename
@@ -1171,6 +1239,81 @@
 */
 #define CFE_PLATFORM_ES_PERF_ENTRIES_BTWN_DLYS             50
 
+/**
+**  \cfeescfg Define Default Performance Stream Base Filename
+**
+**  \par Description:
+**       The base name of the files written while the Performance Analyzer is
+**       started in stream mode.  The files are named <base>_00.dat, <base>_01.dat
+**       and so on, and are reused in turn once all of them have been written.
+**       The files are not compressed.  Each entry is stored as its marker code
+**       and the timer ticks since the previous entry, both as variable length
+**       integers, which typically takes 3 to 5 bytes instead of 12.
+**
+**  \par Limits
+**       The length of each string, including the NULL terminator and the
+**       suffix added to it, cannot exceed the #OS_MAX_PATH_LEN value.
+*/
+#define CFE_PLATFORM_ES_DEFAULT_PERF_STREAM_FILENAME       "/ram/cfe_es_perfstream"
+
+/**
+**  \cfeescfg Define Performance Stream File Size
+**
+**  \par Description:
+**       The size in bytes at which a performance stream file is closed and the
+**       next file of the rotation is started.  Entries are compressed to about
+**       4 bytes each, so the default holds roughly 64000 entries per file.
+**
+**  \par Limits
+**       This parameter must be at least 1024 bytes.
+*/
+#define CFE_PLATFORM_ES_PERF_STREAM_FILE_SIZE              262144
+
+/**
+**  \cfeescfg Define Number of Performance Stream Files
+**
+**  \par Description:
+**       The number of files the performance stream rotates through.  When the
+**       last file is full the first one is overwritten.
+**
+**  \par Limits
+**       This parameter must be between 1 and 100.
+*/
+#define CFE_PLATFORM_ES_PERF_STREAM_NUM_FILES              8
+
+/**
+**  \cfeescfg Define Performance Stream Drain Period
+**
+**  \par Description:
+**       The delay time (in milliseconds) between the passes in which the
+**       performance streaming child task copies new entries to the stream
+**       file.  Entries logged faster than #CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE
+**       per period are lost.
+**
+**  \par Limits
+**       This parameter is limited by the maximum value allowed by the data type.
+**       In this case, the data type is an unsigned 32-bit integer, so the valid
+**       range is 0 to 0xFFFFFFFF.
+*/
+#define CFE_PLATFORM_ES_PERF_STREAM_MS_DELAY               100
+
+/**
+**  \cfeescfg Define Performance Statistics Telemetry Rate
+**
+**  \par Description:
+**       The number of housekeeping requests received by Executive Services
+**       between two #CFE_ES_PerfStatsTlm_t packets.  Each packet reports and
+**       then clears the statistics of the next #CFE_MISSION_ES_PERF_STATS_PER_PKT
+**       perf ids that were used.  Zero disables the statistics, which also
+**       removes their cost from CFE_ES_PerfLogEntry() and CFE_ES_PerfLogExit().
+**
+**  \par Limits
+**       This parameter is limited by the maximum value allowed by the data type.
+**       In this case, the data type is an unsigned 32-bit integer, so the valid
+**       range is 0 to 0xFFFFFFFF.
+*/
+#define CFE_PLATFORM_ES_PERF_STATS_RATE                    1
+
 /**
 **  \cfeescfg Define Default Stack Size for an Application
 **
@@ -1835,13 +1978,12 @@
 **      During startup, some tasks may need to synchronize their own initialization
 **      with the initialization of other applications in the system.
 **
-**      CFE ES implements an API to accomplish this, that performs a task delay (sleep)
-**      while polling the overall system state until other tasks are ready.
+**      CFE ES implements an API to accomplish this, that waits on a semaphore which
+**      is signalled each time an app or the overall system changes state.
 **
-**      This value controls the amount of time that the CFE_ES_ApplicationSyncDelay
-**      will sleep between each check of the system state.  This should be large enough
-**      to allow other tasks to run, but not so large as to noticeably delay the startup
-**      completion.
+**      This value controls the longest time that the CFE_ES_ApplicationSyncDelay
+**      will wait between checks of the system state if no signal arrives.  It only
+**      bounds the delay after a missed wakeup, so it can be fairly large.
 **
 **      Units are in milliseconds
 **
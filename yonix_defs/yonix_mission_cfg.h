@@ -453,11 +453,12 @@
 */
 #define CFE_MISSION_ES_HK_TLM_MSG       0
 #define CFE_MISSION_EVS_HK_TLM_MSG      1
-   /* Offset 2 is available */
+#define CFE_MISSION_ES_PERFSTATS_TLM_MSG 2
 #define CFE_MISSION_SB_HK_TLM_MSG       3
 #define CFE_MISSION_TBL_HK_TLM_MSG      4
 #define CFE_MISSION_TIME_HK_TLM_MSG     5
 #define CFE_MISSION_TIME_DIAG_TLM_MSG   6
+#define CFE_MISSION_ES_BOOTPROFILE_TLM_MSG 7
 
 #define CFE_MISSION_EVS_LONG_EVENT_MSG_MSG    8
 #define CFE_MISSION_EVS_SHORT_EVENT_MSG_MSG   9
@@ -542,6 +543,25 @@
 */
 #define CFE_MISSION_ES_PERF_MAX_IDS                  128
 
+/**
+**  \cfeescfg Maximum number of perf ids in a performance statistics packet
+**
+**  \par Description:
+**       Defines the number of perf ids whose statistics are carried in one
+**       #CFE_ES_PerfStatsTlm_t packet.  Active ids are reported in turn, so
+**       with more active ids than this each one is reported every few packets.
+**
+**      This affects the layout of command/telemetry messages but does not affect run
+**      time behavior or internal allocation.
+**
+**  \par Limits
+**       All CPUs within the same SB domain (mission) must share the same definition
+**       Note this affects the size of messages, so it must not cause any message
+**       to exceed the max length.
+**
+*/
+#define CFE_MISSION_ES_PERF_STATS_PER_PKT            8
+
 /**
 **  \cfetblcfg Maximum Length of Full Table Name in messages
 **